@@ -0,0 +1,891 @@
+/*******************************************************************************************
+*
+*   raylib [rlua] marshaling micro-benchmark
+*
+*   Measures the cost per call of every raylib-lua marshaling path in isolation: struct
+*   arguments reading (LuaGetArgument_*), struct results pushing (LuaPush_*), GET_TABLE arrays,
+*   opaque types checking and opaque types fields lookup (LuaIndex*).
+*
+*   Every path is compared with alternative representations of the same data:
+*     - table:    current representation, a Lua table with named fields (Matrix: array of 16 numbers,
+*                 representation before Matrix userdata, kept as baseline)
+*     - scalars:  struct fields passed/returned unpacked as plain Lua numbers
+*     - userdata: struct copied into a full userdata with metatable (like Image or Font),
+*                 current representation of Matrix (LuaPush_Matrix(), LuaGetArgument_Matrix())
+*
+*   Reported per case: nanoseconds per call and Lua allocations (and bytes) per call,
+*   allocations are counted by raylib-lua allocator (blocks created or grown). Garbage collector
+*   runs normally, its cost is included in the cases creating garbage.
+*
+*   Batch math kernels (SIMD when available) are checked against scalar raymath functions on
+*   random inputs before measuring, --check runs only that check (exit code 1 on mismatch).
+*
+*   USAGE:
+*       rlua_marshal_bench [--iterations N] [--output report.json] [--filter text] [--check]
+*
+*   NOTE: This example requires Lua library (http://luabinaries.sourceforge.net/download.html)
+*
+*   Compile example (raylib null backend, no window, GPU or audio required) using:
+*   gcc -o rlua_marshal_bench rlua_marshal_bench.c ../src/raylib-null.c -DRLUA_HEADLESS -O2  /
+*       -I../src -I<raylib>/src -I../src/external/lua/include -L../src/external/lua/lib     /
+*       -llua53 -lm -lpthread -std=c99
+*
+*   This example has been created using raylib 2.0 (www.raylib.com)
+*   raylib is licensed under an unmodified zlib/libpng license (View raylib.h for details)
+*
+*   Copyright (c) 2019 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#define RLUA_IMPLEMENTATION
+#include "raylib-lua.h"               // raylib Lua binding
+
+#include "raylib-null.h"              // raylib null backend: NullGetWallTime()
+
+#include <stdio.h>                    // Required for: printf(), FILE, fopen(), fprintf()
+
+#define DEFAULT_ITERATIONS      1000000     // Calls measured per case
+#define MAX_BENCH_CASES         64          // Maximum benchmark cases
+
+#define CHECK_ELEMENTS          1027        // Elements per batch kernel check (not multiple of 4, checks scalar tail)
+#define CHECK_TOLERANCE         1e-4f       // Relative tolerance of batch kernels vs scalar raymath
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Benchmark case function, measures its marshaling path with BENCH_LOOP()
+// NOTE: It runs in protected mode (lua_pcall), stack starts empty
+typedef int (*BenchFunc)(lua_State *L);
+
+// Benchmark case
+typedef struct BenchCase {
+    const char *name;               // Marshaling path measured
+    const char *representation;     // Data representation: table, scalars, userdata
+    BenchFunc func;                 // Case function
+} BenchCase;
+
+// Benchmark case results
+typedef struct BenchResult {
+    char error[256];                // Lua error message (empty if no error)
+    double nsPerCall;               // Nanoseconds per call
+    double allocsPerCall;           // Lua allocations per call
+    double bytesPerCall;            // Lua bytes allocated per call
+} BenchResult;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static int iterations = DEFAULT_ITERATIONS;     // Calls measured per case
+static BenchResult current = { 0 };             // Results of case being measured
+
+static volatile float sink = 0.0f;              // Consumes read values, avoids loops being optimized out
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+
+// Measure loop body (one marshaling call) for all iterations, only the loop is timed
+#define BENCH_LOOP(...) \
+    { \
+        unsigned long long allocsStart = 0, bytesStart = 0, allocsEnd = 0, bytesEnd = 0; \
+        rLuaGetAllocCounters(&allocsStart, &bytesStart); \
+        double timeStart = NullGetWallTime(); \
+        for (int i = 0; i < iterations; i++) { __VA_ARGS__ } \
+        double timeEnd = NullGetWallTime(); \
+        rLuaGetAllocCounters(&allocsEnd, &bytesEnd); \
+        current.nsPerCall = (timeEnd - timeStart)*1e9/iterations; \
+        current.allocsPerCall = (double)(allocsEnd - allocsStart)/iterations; \
+        current.bytesPerCall = (double)(bytesEnd - bytesStart)/iterations; \
+    }
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition: inputs
+//----------------------------------------------------------------------------------
+
+// Push a struct copied into a userdata with benchmark metatable (userdata representation)
+#define PushBenchUserdata(L, value, meta) LuaPushOpaqueWithMetatable(L, &value, sizeof(value), meta)
+
+// Push a Vector3 table (used by Camera inputs)
+static void PushVector3Table(lua_State *L, float x, float y, float z)
+{
+    LuaPush_Vector3(L, ((Vector3){ x, y, z }));
+}
+
+// Push a Camera table, as expected by LuaGetArgument_Camera()
+static void PushCameraTable(lua_State *L)
+{
+    lua_createtable(L, 0, 5);
+    PushVector3Table(L, 10.0f, 10.0f, 10.0f);
+    lua_setfield(L, -2, "position");
+    PushVector3Table(L, 0.0f, 0.0f, 0.0f);
+    lua_setfield(L, -2, "target");
+    PushVector3Table(L, 0.0f, 1.0f, 0.0f);
+    lua_setfield(L, -2, "up");
+    lua_pushnumber(L, 45.0);
+    lua_setfield(L, -2, "fovy");
+    lua_pushinteger(L, 0);
+    lua_setfield(L, -2, "type");
+}
+
+// Push a Matrix as an array of 16 numbers (Matrix representation before Matrix userdata)
+static void PushMatrixTable(lua_State *L, Matrix *matrix)
+{
+    const float *values = &matrix->m0;
+    lua_createtable(L, 16, 0);
+
+    for (int i = 0; i < 16; i++)
+    {
+        lua_pushnumber(L, values[i]);
+        lua_rawseti(L, -2, i + 1);
+    }
+}
+
+// Push an array of count Vector2 tables (GET_TABLE input)
+static void PushVector2Array(lua_State *L, int count)
+{
+    lua_createtable(L, count, 0);
+
+    for (int i = 0; i < count; i++)
+    {
+        LuaPush_Vector2(L, ((Vector2){ (float)i, (float)(2*i) }));
+        lua_rawseti(L, -2, i + 1);
+    }
+}
+
+// Push a flat array of 2*count numbers: x1, y1, x2, y2... (scalars alternative to GET_TABLE)
+static void PushFlatArray(lua_State *L, int count)
+{
+    lua_createtable(L, 2*count, 0);
+
+    for (int i = 0; i < count; i++)
+    {
+        lua_pushnumber(L, (float)i);
+        lua_rawseti(L, -2, 2*i + 1);
+        lua_pushnumber(L, (float)(2*i));
+        lua_rawseti(L, -2, 2*i + 2);
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition: LuaGetArgument_* cases
+//----------------------------------------------------------------------------------
+static int BenchGetVector2(lua_State *L)
+{
+    LuaPush_Vector2(L, ((Vector2){ 1.0f, 2.0f }));
+    BENCH_LOOP( sink += LuaGetArgument_Vector2(L, 1).x; )
+    return 0;
+}
+
+static int BenchGetVector2Scalars(lua_State *L)
+{
+    lua_pushnumber(L, 1.0);
+    lua_pushnumber(L, 2.0);
+    BENCH_LOOP( Vector2 v = { LuaGetArgument_float(L, 1), LuaGetArgument_float(L, 2) }; sink += v.x; )
+    return 0;
+}
+
+static int BenchGetVector2Userdata(lua_State *L)
+{
+    Vector2 value = { 1.0f, 2.0f };
+    PushBenchUserdata(L, value, "BenchVector2");
+    BENCH_LOOP( sink += (*(Vector2 *)LuaGetArgumentOpaqueTypeWithMetatable(L, 1, "BenchVector2")).x; )
+    return 0;
+}
+
+static int BenchGetVector3(lua_State *L)
+{
+    PushVector3Table(L, 1.0f, 2.0f, 3.0f);
+    BENCH_LOOP( sink += LuaGetArgument_Vector3(L, 1).x; )
+    return 0;
+}
+
+static int BenchGetVector3Scalars(lua_State *L)
+{
+    lua_pushnumber(L, 1.0);
+    lua_pushnumber(L, 2.0);
+    lua_pushnumber(L, 3.0);
+    BENCH_LOOP( Vector3 v = { LuaGetArgument_float(L, 1), LuaGetArgument_float(L, 2), LuaGetArgument_float(L, 3) }; sink += v.x; )
+    return 0;
+}
+
+static int BenchGetVector3Userdata(lua_State *L)
+{
+    Vector3 value = { 1.0f, 2.0f, 3.0f };
+    PushBenchUserdata(L, value, "BenchVector3");
+    BENCH_LOOP( sink += (*(Vector3 *)LuaGetArgumentOpaqueTypeWithMetatable(L, 1, "BenchVector3")).x; )
+    return 0;
+}
+
+static int BenchGetVector4(lua_State *L)
+{
+    LuaPush_Vector4(L, ((Vector4){ 1.0f, 2.0f, 3.0f, 4.0f }));
+    BENCH_LOOP( sink += LuaGetArgument_Vector4(L, 1).x; )
+    return 0;
+}
+
+static int BenchGetColor(lua_State *L)
+{
+    LuaPush_Color(L, RAYWHITE);
+    BENCH_LOOP( sink += LuaGetArgument_Color(L, 1).r; )
+    return 0;
+}
+
+static int BenchGetColorScalars(lua_State *L)
+{
+    lua_pushinteger(L, 0xf5f5f5ff);     // Color packed as 0xRRGGBBAA integer
+    BENCH_LOOP( unsigned int c = LuaGetArgument_unsigned(L, 1); Color color = { c >> 24, (c >> 16) & 0xff, (c >> 8) & 0xff, c & 0xff }; sink += color.r; )
+    return 0;
+}
+
+static int BenchGetColorUserdata(lua_State *L)
+{
+    Color value = RAYWHITE;
+    PushBenchUserdata(L, value, "BenchColor");
+    BENCH_LOOP( sink += (*(Color *)LuaGetArgumentOpaqueTypeWithMetatable(L, 1, "BenchColor")).r; )
+    return 0;
+}
+
+static int BenchGetRectangle(lua_State *L)
+{
+    LuaPush_Rectangle(L, ((Rectangle){ 10, 20, 30, 40 }));
+    BENCH_LOOP( sink += LuaGetArgument_Rectangle(L, 1).x; )
+    return 0;
+}
+
+static int BenchGetRectangleScalars(lua_State *L)
+{
+    lua_pushnumber(L, 10.0);
+    lua_pushnumber(L, 20.0);
+    lua_pushnumber(L, 30.0);
+    lua_pushnumber(L, 40.0);
+    BENCH_LOOP( Rectangle r = { LuaGetArgument_float(L, 1), LuaGetArgument_float(L, 2), LuaGetArgument_float(L, 3), LuaGetArgument_float(L, 4) }; sink += r.x; )
+    return 0;
+}
+
+static int BenchGetRectangleUserdata(lua_State *L)
+{
+    Rectangle value = { 10, 20, 30, 40 };
+    PushBenchUserdata(L, value, "BenchRectangle");
+    BENCH_LOOP( sink += (*(Rectangle *)LuaGetArgumentOpaqueTypeWithMetatable(L, 1, "BenchRectangle")).x; )
+    return 0;
+}
+
+static int BenchGetCamera(lua_State *L)
+{
+    PushCameraTable(L);
+    BENCH_LOOP( sink += LuaGetArgument_Camera(L, 1).fovy; )
+    return 0;
+}
+
+static int BenchGetCameraUserdata(lua_State *L)
+{
+    Camera value = { { 10.0f, 10.0f, 10.0f }, { 0.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, 45.0f, 0 };
+    PushBenchUserdata(L, value, "BenchCamera");
+    BENCH_LOOP( sink += (*(Camera *)LuaGetArgumentOpaqueTypeWithMetatable(L, 1, "BenchCamera")).fovy; )
+    return 0;
+}
+
+// NOTE: LuaGetArgument_Matrix() still accepts tables of 16 numbers (decoded field by field)
+static int BenchGetMatrixTable(lua_State *L)
+{
+    Matrix value = MatrixIdentity();
+    PushMatrixTable(L, &value);
+    BENCH_LOOP( sink += LuaGetArgument_Matrix(L, 1).m0; )
+    return 0;
+}
+
+// Matrix userdata (LuaPush_Matrix() result), current representation
+static int BenchGetMatrix(lua_State *L)
+{
+    Matrix value = MatrixIdentity();
+    LuaPush_Matrix(L, &value);
+    BENCH_LOOP( sink += LuaGetArgument_Matrix(L, 1).m0; )
+    return 0;
+}
+
+static int BenchGetMatrixUserdata(lua_State *L)
+{
+    Matrix value = MatrixIdentity();
+    PushBenchUserdata(L, value, "BenchMatrix");
+    BENCH_LOOP( sink += (*(Matrix *)LuaGetArgumentOpaqueTypeWithMetatable(L, 1, "BenchMatrix")).m0; )
+    return 0;
+}
+
+// GET_TABLE() of Vector2, as used by DrawPolyEx() and friends
+// NOTE: GET_TABLE() pops one extra value from the stack, a padding value is pushed on every call
+static void BenchGetTableVector2(lua_State *L, int count)
+{
+    PushVector2Array(L, count);
+    BENCH_LOOP(
+        lua_pushnil(L);
+        GET_TABLE(Vector2, points, 1);
+        sink += points[points_size - 1].x;
+        free(points);
+    )
+}
+
+static int BenchGetTable4(lua_State *L) { BenchGetTableVector2(L, 4); return 0; }
+static int BenchGetTable64(lua_State *L) { BenchGetTableVector2(L, 64); return 0; }
+static int BenchGetTable1024(lua_State *L) { BenchGetTableVector2(L, 1024); return 0; }
+
+// Flat numbers array read with lua_rawgeti(), scalars alternative to GET_TABLE()
+static void BenchGetFlatArray(lua_State *L, int count)
+{
+    PushFlatArray(L, count);
+    BENCH_LOOP(
+        int size = (int)lua_rawlen(L, 1)/2;
+        Vector2 *points = (Vector2 *)malloc(size*sizeof(Vector2));
+        for (int p = 0; p < size; p++)
+        {
+            lua_rawgeti(L, 1, 2*p + 1);
+            lua_rawgeti(L, 1, 2*p + 2);
+            points[p] = (Vector2){ (float)lua_tonumber(L, -2), (float)lua_tonumber(L, -1) };
+            lua_pop(L, 2);
+        }
+        sink += points[size - 1].x;
+        free(points);
+    )
+}
+
+static int BenchGetFlatArray4(lua_State *L) { BenchGetFlatArray(L, 4); return 0; }
+static int BenchGetFlatArray64(lua_State *L) { BenchGetFlatArray(L, 64); return 0; }
+static int BenchGetFlatArray1024(lua_State *L) { BenchGetFlatArray(L, 1024); return 0; }
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition: LuaPush_* cases
+//----------------------------------------------------------------------------------
+static int BenchPushVector2(lua_State *L)
+{
+    Vector2 value = { 1.0f, 2.0f };
+    BENCH_LOOP( LuaPush_Vector2(L, value); lua_pop(L, 1); )
+    return 0;
+}
+
+static int BenchPushVector2Scalars(lua_State *L)
+{
+    Vector2 value = { 1.0f, 2.0f };
+    BENCH_LOOP( LuaPush_float(L, value.x); LuaPush_float(L, value.y); lua_pop(L, 2); )
+    return 0;
+}
+
+static int BenchPushVector2Userdata(lua_State *L)
+{
+    Vector2 value = { 1.0f, 2.0f };
+    BENCH_LOOP( PushBenchUserdata(L, value, "BenchVector2"); lua_pop(L, 1); )
+    return 0;
+}
+
+static int BenchPushVector3(lua_State *L)
+{
+    Vector3 value = { 1.0f, 2.0f, 3.0f };
+    BENCH_LOOP( LuaPush_Vector3(L, value); lua_pop(L, 1); )
+    return 0;
+}
+
+static int BenchPushVector3Userdata(lua_State *L)
+{
+    Vector3 value = { 1.0f, 2.0f, 3.0f };
+    BENCH_LOOP( PushBenchUserdata(L, value, "BenchVector3"); lua_pop(L, 1); )
+    return 0;
+}
+
+static int BenchPushVector4(lua_State *L)
+{
+    Vector4 value = { 1.0f, 2.0f, 3.0f, 4.0f };
+    BENCH_LOOP( LuaPush_Vector4(L, value); lua_pop(L, 1); )
+    return 0;
+}
+
+static int BenchPushQuaternion(lua_State *L)
+{
+    Quaternion value = { 0.0f, 0.0f, 0.0f, 1.0f };
+    BENCH_LOOP( LuaPush_Quaternion(L, value); lua_pop(L, 1); )
+    return 0;
+}
+
+static int BenchPushColor(lua_State *L)
+{
+    BENCH_LOOP( LuaPush_Color(L, RAYWHITE); lua_pop(L, 1); )
+    return 0;
+}
+
+static int BenchPushColorScalars(lua_State *L)
+{
+    Color value = RAYWHITE;
+    BENCH_LOOP( LuaPush_int(L, ((unsigned int)value.r << 24) | (value.g << 16) | (value.b << 8) | value.a); lua_pop(L, 1); )
+    return 0;
+}
+
+static int BenchPushRectangle(lua_State *L)
+{
+    Rectangle value = { 10, 20, 30, 40 };
+    BENCH_LOOP( LuaPush_Rectangle(L, value); lua_pop(L, 1); )
+    return 0;
+}
+
+static int BenchPushRay(lua_State *L)
+{
+    Ray value = { { 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f } };
+    BENCH_LOOP( LuaPush_Ray(L, value); lua_pop(L, 1); )
+    return 0;
+}
+
+static int BenchPushRayHitInfo(lua_State *L)
+{
+    RayHitInfo value = { true, 1.0f, { 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f } };
+    BENCH_LOOP( LuaPush_RayHitInfo(L, value); lua_pop(L, 1); )
+    return 0;
+}
+
+static int BenchPushBoundingBox(lua_State *L)
+{
+    BoundingBox value = { { -1.0f, -1.0f, -1.0f }, { 1.0f, 1.0f, 1.0f } };
+    BENCH_LOOP( LuaPush_BoundingBox(L, value); lua_pop(L, 1); )
+    return 0;
+}
+
+static int BenchPushCamera(lua_State *L)
+{
+    Camera value = { { 10.0f, 10.0f, 10.0f }, { 0.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, 45.0f, 0 };
+    BENCH_LOOP( LuaPush_Camera(L, value); lua_pop(L, 1); )
+    return 0;
+}
+
+static int BenchPushCamera2D(lua_State *L)
+{
+    Camera2D value = { { 0.0f, 0.0f }, { 0.0f, 0.0f }, 0.0f, 1.0f };
+    BENCH_LOOP( LuaPush_Camera2D(L, value); lua_pop(L, 1); )
+    return 0;
+}
+
+static int BenchPushMatrixTable(lua_State *L)
+{
+    Matrix value = MatrixIdentity();
+    BENCH_LOOP( PushMatrixTable(L, &value); lua_pop(L, 1); )
+    return 0;
+}
+
+// Matrix userdata, current representation
+static int BenchPushMatrix(lua_State *L)
+{
+    Matrix value = MatrixIdentity();
+    BENCH_LOOP( LuaPush_Matrix(L, &value); lua_pop(L, 1); )
+    return 0;
+}
+
+static int BenchPushMatrixUserdata(lua_State *L)
+{
+    Matrix value = MatrixIdentity();
+    BENCH_LOOP( PushBenchUserdata(L, value, "BenchMatrix"); lua_pop(L, 1); )
+    return 0;
+}
+
+static int BenchPushImage(lua_State *L)
+{
+    Image value = { 0 };
+    BENCH_LOOP( LuaPush_Image(L, value); lua_pop(L, 1); )
+    return 0;
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition: opaque types cases
+//----------------------------------------------------------------------------------
+static int BenchGetImage(lua_State *L)
+{
+    Image value = { NULL, 64, 64, 1, UNCOMPRESSED_R8G8B8A8 };
+    LuaPush_Image(L, value);
+    BENCH_LOOP( sink += (LuaGetArgument_Image(L, 1)).width; )
+    return 0;
+}
+
+// LuaIndexImage() called directly, first and last fields
+static int BenchIndexImageWidth(lua_State *L)
+{
+    Image value = { NULL, 64, 64, 1, UNCOMPRESSED_R8G8B8A8 };
+    LuaPush_Image(L, value);
+    lua_pushstring(L, "width");
+    BENCH_LOOP( LuaIndexImage(L); lua_pop(L, 1); )
+    return 0;
+}
+
+static int BenchIndexImageFormat(lua_State *L)
+{
+    Image value = { NULL, 64, 64, 1, UNCOMPRESSED_R8G8B8A8 };
+    LuaPush_Image(L, value);
+    lua_pushstring(L, "format");
+    BENCH_LOOP( LuaIndexImage(L); lua_pop(L, 1); )
+    return 0;
+}
+
+// Image field lookup as done by scripts (image.width), __index metamethod dispatch included
+static int BenchIndexImageMeta(lua_State *L)
+{
+    Image value = { NULL, 64, 64, 1, UNCOMPRESSED_R8G8B8A8 };
+    LuaPush_Image(L, value);
+    BENCH_LOOP( lua_getfield(L, 1, "width"); sink += (float)lua_tointeger(L, -1); lua_pop(L, 1); )
+    return 0;
+}
+
+static int BenchIndexFontBaseSize(lua_State *L)
+{
+    Font value = { 0 };
+    value.baseSize = 10;
+    LuaPush_Font(L, value);
+    lua_pushstring(L, "baseSize");
+    BENCH_LOOP( LuaIndexFont(L); lua_pop(L, 1); )
+    return 0;
+}
+
+// Font texture field pushes a new Texture2D userdata on every lookup
+static int BenchIndexFontTexture(lua_State *L)
+{
+    Font value = { 0 };
+    LuaPush_Font(L, value);
+    lua_pushstring(L, "texture");
+    BENCH_LOOP( LuaIndexFont(L); lua_pop(L, 1); )
+    return 0;
+}
+
+static int BenchIndexFontMeta(lua_State *L)
+{
+    Font value = { 0 };
+    value.charsCount = 95;
+    LuaPush_Font(L, value);
+    BENCH_LOOP( lua_getfield(L, 1, "charsCount"); sink += (float)lua_tointeger(L, -1); lua_pop(L, 1); )
+    return 0;
+}
+
+//----------------------------------------------------------------------------------
+// Benchmark cases list
+//----------------------------------------------------------------------------------
+static BenchCase benchCases[] = {
+    { "LuaGetArgument_Vector2", "table", BenchGetVector2 },
+    { "LuaGetArgument_Vector2", "scalars", BenchGetVector2Scalars },
+    { "LuaGetArgument_Vector2", "userdata", BenchGetVector2Userdata },
+    { "LuaGetArgument_Vector3", "table", BenchGetVector3 },
+    { "LuaGetArgument_Vector3", "scalars", BenchGetVector3Scalars },
+    { "LuaGetArgument_Vector3", "userdata", BenchGetVector3Userdata },
+    { "LuaGetArgument_Vector4", "table", BenchGetVector4 },
+    { "LuaGetArgument_Color", "table", BenchGetColor },
+    { "LuaGetArgument_Color", "scalars", BenchGetColorScalars },
+    { "LuaGetArgument_Color", "userdata", BenchGetColorUserdata },
+    { "LuaGetArgument_Rectangle", "table", BenchGetRectangle },
+    { "LuaGetArgument_Rectangle", "scalars", BenchGetRectangleScalars },
+    { "LuaGetArgument_Rectangle", "userdata", BenchGetRectangleUserdata },
+    { "LuaGetArgument_Camera", "table", BenchGetCamera },
+    { "LuaGetArgument_Camera", "userdata", BenchGetCameraUserdata },
+    { "LuaGetArgument_Matrix", "table", BenchGetMatrixTable },
+    { "LuaGetArgument_Matrix", "userdata", BenchGetMatrix },
+    { "LuaGetArgumentOpaqueTypeWithMetatable(Matrix)", "userdata", BenchGetMatrixUserdata },
+    { "GET_TABLE(Vector2) x4", "table", BenchGetTable4 },
+    { "GET_TABLE(Vector2) x4", "scalars", BenchGetFlatArray4 },
+    { "GET_TABLE(Vector2) x64", "table", BenchGetTable64 },
+    { "GET_TABLE(Vector2) x64", "scalars", BenchGetFlatArray64 },
+    { "GET_TABLE(Vector2) x1024", "table", BenchGetTable1024 },
+    { "GET_TABLE(Vector2) x1024", "scalars", BenchGetFlatArray1024 },
+    { "LuaPush_Vector2", "table", BenchPushVector2 },
+    { "LuaPush_Vector2", "scalars", BenchPushVector2Scalars },
+    { "LuaPush_Vector2", "userdata", BenchPushVector2Userdata },
+    { "LuaPush_Vector3", "table", BenchPushVector3 },
+    { "LuaPush_Vector3", "userdata", BenchPushVector3Userdata },
+    { "LuaPush_Vector4", "table", BenchPushVector4 },
+    { "LuaPush_Quaternion", "table", BenchPushQuaternion },
+    { "LuaPush_Color", "table", BenchPushColor },
+    { "LuaPush_Color", "scalars", BenchPushColorScalars },
+    { "LuaPush_Rectangle", "table", BenchPushRectangle },
+    { "LuaPush_Ray", "table", BenchPushRay },
+    { "LuaPush_RayHitInfo", "table", BenchPushRayHitInfo },
+    { "LuaPush_BoundingBox", "table", BenchPushBoundingBox },
+    { "LuaPush_Camera", "table", BenchPushCamera },
+    { "LuaPush_Camera2D", "table", BenchPushCamera2D },
+    { "LuaPush_Matrix", "table", BenchPushMatrixTable },
+    { "LuaPush_Matrix", "userdata", BenchPushMatrix },
+    { "LuaPushOpaqueWithMetatable(Matrix)", "userdata", BenchPushMatrixUserdata },
+    { "LuaPush_Image", "userdata", BenchPushImage },
+    { "LuaGetArgumentOpaqueTypeWithMetatable(Image)", "userdata", BenchGetImage },
+    { "LuaIndexImage(width)", "userdata", BenchIndexImageWidth },
+    { "LuaIndexImage(format)", "userdata", BenchIndexImageFormat },
+    { "image.width (__index)", "userdata", BenchIndexImageMeta },
+    { "LuaIndexFont(baseSize)", "userdata", BenchIndexFontBaseSize },
+    { "LuaIndexFont(texture)", "userdata", BenchIndexFontTexture },
+    { "font.charsCount (__index)", "userdata", BenchIndexFontMeta },
+};
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition: runner
+//----------------------------------------------------------------------------------
+
+// Create metatables for userdata representation cases
+static void CreateBenchMetatables(lua_State *L)
+{
+    const char *names[] = { "BenchVector2", "BenchVector3", "BenchColor", "BenchRectangle", "BenchCamera", "BenchMatrix" };
+
+    for (int i = 0; i < sizeof(names)/sizeof(names[0]); i++)
+    {
+        luaL_newmetatable(L, names[i]);
+        lua_pop(L, 1);
+    }
+}
+
+// Run benchmark case in protected mode, errors are reported instead of aborting
+static BenchResult RunBenchCase(BenchCase *bench)
+{
+    current = (BenchResult){ 0 };
+
+    lua_settop(L, 0);
+    lua_gc(L, LUA_GCCOLLECT, 0);    // Start every case with same garbage state
+
+    lua_pushcfunction(L, bench->func);
+
+    if (lua_pcall(L, 0, 0, 0) != LUA_OK)
+    {
+        snprintf(current.error, sizeof(current.error), "%s", lua_tostring(L, -1));
+        lua_pop(L, 1);
+    }
+
+    return current;
+}
+
+// Write JSON string escaping quotes, backslashes and control characters
+static void WriteJsonString(FILE *file, const char *text)
+{
+    fputc('"', file);
+
+    for (const char *c = text; *c != '\0'; c++)
+    {
+        if ((*c == '"') || (*c == '\\')) fprintf(file, "\\%c", *c);
+        else if ((unsigned char)*c < 0x20) fprintf(file, "\\u%04x", *c);
+        else fputc(*c, file);
+    }
+
+    fputc('"', file);
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition: batch kernels check
+//----------------------------------------------------------------------------------
+
+// Check count floats against reference values, returns mismatches count
+static int CheckFloats(const char *kernel, const float *values, const float *reference, int count)
+{
+    int mismatches = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        if (fabsf(values[i] - reference[i]) > CHECK_TOLERANCE*fmaxf(1.0f, fabsf(reference[i])))
+        {
+            if (mismatches == 0) printf("%s mismatch at float %i: %f, expected %f\n", kernel, i, values[i], reference[i]);
+            mismatches++;
+        }
+    }
+
+    printf("%-46s %s\n", kernel, (mismatches == 0)? "OK" : "FAILED");
+
+    return mismatches;
+}
+
+// Check batch math kernels against scalar raymath functions, returns mismatches count
+static int CheckBatchKernels(void)
+{
+    static float a[16*CHECK_ELEMENTS], b[16*CHECK_ELEMENTS];
+    static float result[16*CHECK_ELEMENTS], reference[16*CHECK_ELEMENTS];
+    int mismatches = 0;
+
+    RandomStream rng = { 0 };
+    RandomSeed(&rng, 1234, 0);      // Same inputs every run
+    for (int i = 0; i < 16*CHECK_ELEMENTS; i++) a[i] = -10.0f + 20.0f*RandomFloat(&rng);
+    for (int i = 0; i < 16*CHECK_ELEMENTS; i++) b[i] = -10.0f + 20.0f*RandomFloat(&rng);
+
+    // TransformPointsKernel() vs VectorTransform()
+    Matrix mat;
+    memcpy(&mat, b, sizeof(Matrix));
+    TransformPointsKernel(mat, a, result, CHECK_ELEMENTS);
+
+    for (int i = 0; i < CHECK_ELEMENTS; i++)
+    {
+        Vector3 v = { a[3*i], a[3*i + 1], a[3*i + 2] };
+        VectorTransform(&v, mat);
+        memcpy(reference + 3*i, &v, sizeof(Vector3));
+    }
+
+    mismatches += CheckFloats("TransformPointsKernel", result, reference, 3*CHECK_ELEMENTS);
+
+    // NormalizeVectorsKernel() vs Vector2Normalize(), VectorNormalize(), QuaternionNormalize()
+    NormalizeVectorsKernel(a, result, CHECK_ELEMENTS, 2);
+    for (int i = 0; i < CHECK_ELEMENTS; i++)
+    {
+        Vector2 v = { a[2*i], a[2*i + 1] };
+        Vector2Normalize(&v);
+        memcpy(reference + 2*i, &v, sizeof(Vector2));
+    }
+    mismatches += CheckFloats("NormalizeVectorsKernel (2 components)", result, reference, 2*CHECK_ELEMENTS);
+
+    NormalizeVectorsKernel(a, result, CHECK_ELEMENTS, 3);
+    for (int i = 0; i < CHECK_ELEMENTS; i++)
+    {
+        Vector3 v = { a[3*i], a[3*i + 1], a[3*i + 2] };
+        VectorNormalize(&v);
+        memcpy(reference + 3*i, &v, sizeof(Vector3));
+    }
+    mismatches += CheckFloats("NormalizeVectorsKernel (3 components)", result, reference, 3*CHECK_ELEMENTS);
+
+    NormalizeVectorsKernel(a, result, CHECK_ELEMENTS, 4);
+    for (int i = 0; i < CHECK_ELEMENTS; i++)
+    {
+        Quaternion q = { a[4*i], a[4*i + 1], a[4*i + 2], a[4*i + 3] };
+        QuaternionNormalize(&q);
+        memcpy(reference + 4*i, &q, sizeof(Quaternion));
+    }
+    mismatches += CheckFloats("NormalizeVectorsKernel (4 components)", result, reference, 4*CHECK_ELEMENTS);
+
+    // LerpFloatsKernel() vs VectorLerp()
+    LerpFloatsKernel(a, b, 0.3f, result, 3*CHECK_ELEMENTS);
+    for (int i = 0; i < CHECK_ELEMENTS; i++)
+    {
+        Vector3 v1 = { a[3*i], a[3*i + 1], a[3*i + 2] };
+        Vector3 v2 = { b[3*i], b[3*i + 1], b[3*i + 2] };
+        Vector3 v = VectorLerp(v1, v2, 0.3f);
+        memcpy(reference + 3*i, &v, sizeof(Vector3));
+    }
+    mismatches += CheckFloats("LerpFloatsKernel", result, reference, 3*CHECK_ELEMENTS);
+
+    // MatrixMultiplyKernel() vs MatrixMultiply(), buffers and shared matrix (stride 0) operands
+    MatrixMultiplyKernel(a, 16, b, 16, result, CHECK_ELEMENTS);
+    for (int i = 0; i < CHECK_ELEMENTS; i++)
+    {
+        Matrix left, right;
+        memcpy(&left, a + 16*i, sizeof(Matrix));
+        memcpy(&right, b + 16*i, sizeof(Matrix));
+        Matrix m = MatrixMultiply(left, right);
+        memcpy(reference + 16*i, &m, sizeof(Matrix));
+    }
+    mismatches += CheckFloats("MatrixMultiplyKernel", result, reference, 16*CHECK_ELEMENTS);
+
+    MatrixMultiplyKernel(a, 16, &mat.m0, 0, result, CHECK_ELEMENTS);
+    for (int i = 0; i < CHECK_ELEMENTS; i++)
+    {
+        Matrix left;
+        memcpy(&left, a + 16*i, sizeof(Matrix));
+        Matrix m = MatrixMultiply(left, mat);
+        memcpy(reference + 16*i, &m, sizeof(Matrix));
+    }
+    mismatches += CheckFloats("MatrixMultiplyKernel (shared right)", result, reference, 16*CHECK_ELEMENTS);
+
+    return mismatches;
+}
+
+//----------------------------------------------------------------------------------
+// Main entry point
+//----------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const char *outputFile = NULL;
+    const char *filter = NULL;
+    bool checkOnly = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--iterations") && (i + 1 < argc)) iterations = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--output") && (i + 1 < argc)) outputFile = argv[++i];
+        else if (!strcmp(argv[i], "--filter") && (i + 1 < argc)) filter = argv[++i];
+        else if (!strcmp(argv[i], "--check")) checkOnly = true;
+        else
+        {
+            printf("USAGE: %s [--iterations N] [--output report.json] [--filter text] [--check]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (iterations <= 0) iterations = DEFAULT_ITERATIONS;
+
+    int casesCount = sizeof(benchCases)/sizeof(benchCases[0]);
+    BenchResult results[MAX_BENCH_CASES] = { 0 };
+    bool selected[MAX_BENCH_CASES] = { 0 };
+
+    rLuaInitDevice();
+    CreateBenchMetatables(L);
+    //--------------------------------------------------------------------------------------
+
+    // Batch kernels check
+    //--------------------------------------------------------------------------------------
+    int mismatches = CheckBatchKernels();
+
+    if (checkOnly || (mismatches > 0))
+    {
+        rLuaCloseDevice();
+        return (mismatches > 0)? 1 : 0;
+    }
+    //--------------------------------------------------------------------------------------
+
+    // Benchmark
+    //--------------------------------------------------------------------------------------
+    printf("%-46s %-9s %12s %12s %12s\n", "marshaling path", "repr", "ns/call", "allocs/call", "bytes/call");
+
+    for (int i = 0; (i < casesCount) && (i < MAX_BENCH_CASES); i++)
+    {
+        if ((filter != NULL) && (strstr(benchCases[i].name, filter) == NULL)) continue;
+
+        selected[i] = true;
+
+        RunBenchCase(&benchCases[i]);               // Warm-up: strings interning, stack and caches
+        results[i] = RunBenchCase(&benchCases[i]);
+
+        if (results[i].error[0] != '\0') printf("%-46s %-9s error: %s\n", benchCases[i].name, benchCases[i].representation, results[i].error);
+        else printf("%-46s %-9s %12.1f %12.2f %12.1f\n", benchCases[i].name, benchCases[i].representation,
+                    results[i].nsPerCall, results[i].allocsPerCall, results[i].bytesPerCall);
+    }
+    //--------------------------------------------------------------------------------------
+
+    // Report
+    //--------------------------------------------------------------------------------------
+    if (outputFile != NULL)
+    {
+        FILE *file = fopen(outputFile, "wt");
+
+        if (file != NULL)
+        {
+            bool first = true;
+
+            fprintf(file, "{\n  \"iterations\": %i,\n  \"cases\": [\n", iterations);
+
+            for (int i = 0; (i < casesCount) && (i < MAX_BENCH_CASES); i++)
+            {
+                if (!selected[i]) continue;
+
+                fprintf(file, "%s    { \"name\": ", first? "" : ",\n");
+                WriteJsonString(file, benchCases[i].name);
+                fprintf(file, ", \"representation\": \"%s\", ", benchCases[i].representation);
+
+                if (results[i].error[0] != '\0')
+                {
+                    fprintf(file, "\"error\": ");
+                    WriteJsonString(file, results[i].error);
+                    fprintf(file, " }");
+                }
+                else fprintf(file, "\"ns_per_call\": %.2f, \"allocs_per_call\": %.3f, \"bytes_per_call\": %.1f }",
+                             results[i].nsPerCall, results[i].allocsPerCall, results[i].bytesPerCall);
+
+                first = false;
+            }
+
+            fprintf(file, "\n  ]\n}\n");
+            fclose(file);
+
+            printf("Report written: %s\n", outputFile);
+        }
+        else printf("Report file could not be written: %s\n", outputFile);
+    }
+    //--------------------------------------------------------------------------------------
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    rLuaCloseDevice();
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
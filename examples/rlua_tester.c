@@ -1,6 +1,16 @@
 /*******************************************************************************************
 *
-*   raylib [rlua] examples test suite
+*   raylib [rlua] examples test suite and benchmark runner
+*
+*   Every example found in examples modules directories (Lua files in ./<module>) is executed in a fresh
+*   Lua device, examples are sorted by module and name to keep runs comparable.
+*
+*   In headless mode (RLUA_HEADLESS, linked with raylib null backend) every example runs for
+*   a fixed number of frames with deterministic scripted input and a JSON report is written:
+*   frame time (mean, p50, p99, max), GC time, Lua memory, backend calls and binding calls.
+*
+*   USAGE (headless):
+*       rlua_tester_headless [--frames N] [--output report.json] [--filter text]
 *
 *   NOTE: This example requires Lua library (http://luabinaries.sourceforge.net/download.html)
 *
@@ -10,6 +20,11 @@
 *       -lraylib -lglfw3 -lopengl32 -lgdi32 -lopenal32 -lwinmm -llua53 -lpthread -static     /
 *       -std=c99 -Wl,-allow-multiple-definition -Wl,--subsystem,windows
 *
+*   Compile example headless (no window, GPU or audio) using raylib null backend:
+*   gcc -o rlua_tester_headless rlua_tester.c ../src/raylib-null.c -DRLUA_HEADLESS     /
+*       -I../src -I<raylib>/src -I../src/external/lua/include -L../src/external/lua/lib  /
+*       -llua53 -lm -lpthread -std=c99
+*
 *   This example has been created using raylib 1.7 (www.raylib.com)
 *   raylib is licensed under an unmodified zlib/libpng license (View raylib.h for details)
 *
@@ -22,100 +37,358 @@
 #define RLUA_IMPLEMENTATION
 #include "raylib-lua.h"               // raylib Lua binding
 
-int main()
+#include <stdio.h>                    // Required for: FILE, fopen(), fprintf()
+#include <math.h>                     // Required for: sinf(), cosf(), ceil()
+#include <dirent.h>                   // Required for: DIR, opendir(), readdir()
+
+#if defined(RLUA_HEADLESS)
+    #include "raylib-null.h"          // raylib null backend: scripted input, frame limit and stats
+#endif
+
+#define MAX_EXAMPLES            256     // Maximum examples to run
+#define MAX_EXAMPLE_PATH        256     // Maximum example path length (module/file.lua)
+#define DEFAULT_FRAMES          300     // Frames to run every example (headless mode)
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Example benchmark results
+typedef struct ExampleResult {
+    char path[MAX_EXAMPLE_PATH];    // Example path: module/file.lua
+    char error[256];                // Lua error message (empty if no error)
+    int frames;                     // Frames drawn
+    double *frameTimes;             // Wall time per frame (seconds), frame time includes GC step
+    double gcTime;                  // Total time spent on GC steps (seconds)
+    double loadTime;                // Time until first frame (script load and resources init)
+    int memoryPeak;                 // Lua memory peak (bytes), measured at frame end
+    int memoryFinal;                // Lua memory at last frame (bytes)
+} ExampleResult;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static ExampleResult *current = NULL;           // Example being benchmarked
+static double frameStartTime = 0.0;             // Wall time at current frame start
+static int gcCountAfterStep = 0;                // Lua memory after last GC step (KB)
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+
+// Compare examples paths (qsort)
+static int ComparePaths(const void *a, const void *b)
+{
+    return strcmp((const char *)a, (const char *)b);
+}
+
+// Compare frame times (qsort)
+static int CompareTimes(const void *a, const void *b)
+{
+    double ta = *(const double *)a;
+    double tb = *(const double *)b;
+
+    return (ta > tb) - (ta < tb);
+}
+
+// Scan examples directories (Lua files in ./<module>), returns examples count
+static int ScanExamples(char (*paths)[MAX_EXAMPLE_PATH], const char *filter)
+{
+    int count = 0;
+    DIR *root = opendir(".");
+
+    if (root == NULL) return 0;
+
+    struct dirent *module = NULL;
+
+    while ((module = readdir(root)) != NULL)
+    {
+        if (module->d_name[0] == '.') continue;
+
+        DIR *dir = opendir(module->d_name);
+        if (dir == NULL) continue;      // Not a directory
+
+        struct dirent *entry = NULL;
+
+        while (((entry = readdir(dir)) != NULL) && (count < MAX_EXAMPLES))
+        {
+            if (!IsFileExtension(entry->d_name, ".lua")) continue;
+            if ((strlen(module->d_name) + strlen(entry->d_name) + 2) > MAX_EXAMPLE_PATH) continue;
+
+            snprintf(paths[count], MAX_EXAMPLE_PATH, "%s/%s", module->d_name, entry->d_name);
+
+            if ((filter == NULL) || (strstr(paths[count], filter) != NULL)) count++;
+        }
+
+        closedir(dir);
+    }
+
+    closedir(root);
+
+    qsort(paths, count, MAX_EXAMPLE_PATH, ComparePaths);
+
+    return count;
+}
+
+#if defined(RLUA_HEADLESS)
+// Set deterministic scripted input for next frame
+// NOTE: Exit key (ESCAPE) is never pressed, examples run until frames limit
+static void SetScriptedInput(int frame)
+{
+    int width = (GetScreenWidth() > 0)? GetScreenWidth() : 800;
+    int height = (GetScreenHeight() > 0)? GetScreenHeight() : 450;
+
+    // Mouse: Lissajous path over the screen, left button pressed every other 30 frames
+    SetMousePosition((Vector2){ width/2.0f + width/3.0f*sinf(frame*0.05f), height/2.0f + height/3.0f*sinf(frame*0.07f) });
+    NullSetMouseButtonDown(MOUSE_LEFT_BUTTON, ((frame/30)%2) == 1);
+    NullSetMouseButtonDown(MOUSE_RIGHT_BUTTON, (frame%90) < 5);
+    NullSetMouseWheelMove(((frame%20) == 0)? 1 : (((frame%20) == 10)? -1 : 0));
+
+    // Keyboard: arrows held in turns, space and enter pressed periodically, letters typed
+    NullSetKeyDown(KEY_RIGHT, (frame%120) < 30);
+    NullSetKeyDown(KEY_DOWN, ((frame%120) >= 30) && ((frame%120) < 60));
+    NullSetKeyDown(KEY_LEFT, ((frame%120) >= 60) && ((frame%120) < 90));
+    NullSetKeyDown(KEY_UP, (frame%120) >= 90);
+    NullSetKeyDown(KEY_SPACE, (frame%45) == 0);
+    NullSetKeyDown(KEY_ENTER, (frame%100) == 0);
+    for (int key = KEY_A; key <= KEY_Z; key++) NullSetKeyDown(key, ((frame%15) == 0) && (key == (KEY_A + (frame/15)%26)));
+
+    // Gamepad: left stick circling, button A pressed periodically
+    NullSetGamepadAvailable(GAMEPAD_PLAYER1, true);
+    NullSetGamepadAxisMovement(GAMEPAD_PLAYER1, 0, cosf(frame*0.03f));
+    NullSetGamepadAxisMovement(GAMEPAD_PLAYER1, 1, sinf(frame*0.03f));
+    NullSetGamepadButtonDown(GAMEPAD_PLAYER1, 0, (frame%60) < 5);
+
+    // Gestures: tap when mouse button pressed
+    NullSetGestureDetected(((frame%60) == 30)? GESTURE_TAP : GESTURE_NONE);
+}
+
+// Frame callback: measure frame time, run GC step (timed) and set input for next frame
+static void BenchmarkFrameCallback(int frame, void *userData)
+{
+    int maxFrames = *(int *)userData;
+
+    // Incremental step sized by memory allocated since last step (KB), collector keeps pace with script
+    // NOTE: Step size 0 only runs one basic step, not enough for scripts allocating every frame
+    int allocated = lua_gc(mainLuaState, LUA_GCCOUNT, 0) - gcCountAfterStep;
+
+    double gcStartTime = NullGetWallTime();
+    lua_gc(mainLuaState, LUA_GCSTEP, (allocated > 0)? allocated : 0);
+    double frameEndTime = NullGetWallTime();
+
+    gcCountAfterStep = lua_gc(mainLuaState, LUA_GCCOUNT, 0);
+
+    if (frame == 1) current->loadTime = gcStartTime - frameStartTime;
+
+    if ((frame > 1) && (frame - 2 < maxFrames))
+    {
+        // NOTE: First frame time includes script loading, it is not recorded
+        current->frameTimes[current->frames++] = frameEndTime - frameStartTime;
+        current->gcTime += frameEndTime - gcStartTime;
+    }
+
+    int memory = lua_gc(mainLuaState, LUA_GCCOUNT, 0)*1024 + lua_gc(mainLuaState, LUA_GCCOUNTB, 0);
+    if (memory > current->memoryPeak) current->memoryPeak = memory;
+    current->memoryFinal = memory;
+
+    SetScriptedInput(frame);
+
+    frameStartTime = NullGetWallTime();
+}
+
+// Write JSON string (escaped)
+static void WriteJsonString(FILE *file, const char *text)
+{
+    fputc('"', file);
+
+    for (const char *c = text; *c != '\0'; c++)
+    {
+        if ((*c == '"') || (*c == '\\')) fprintf(file, "\\%c", *c);
+        else if (*c == '\n') fprintf(file, "\\n");
+        else if ((unsigned char)*c < 0x20) fprintf(file, "\\u%04x", *c);
+        else fputc(*c, file);
+    }
+
+    fputc('"', file);
+}
+
+// Run example headless for frames, results filled
+static void BenchmarkExample(ExampleResult *result, int frames, FILE *report, bool first)
+{
+    char directory[MAX_EXAMPLE_PATH] = { 0 };
+    strcpy(directory, result->path);
+    *strchr(directory, '/') = '\0';
+
+    const char *workingDirectory = GetWorkingDirectory();
+    char previousDirectory[512] = { 0 };
+    strncpy(previousDirectory, workingDirectory, 511);
+
+    result->frameTimes = (double *)calloc(frames, sizeof(double));
+    current = result;
+
+    srand(1);               // Deterministic GetRandomValue() sequence
+    NullResetState();
+    NullResetStats();
+    NullSetFrameLimit(frames + 1);      // First frame (script loading) is not recorded
+    NullSetFrameCallback(BenchmarkFrameCallback, &frames);
+    SetScriptedInput(0);
+
+    rLuaInitDevice();
+    rLuaEnableCallCounters();
+
+    ChangeDirectory(directory);
+
+    lua_gc(mainLuaState, LUA_GCSTOP, 0);    // GC steps are run (and timed) at frame end
+    gcCountAfterStep = lua_gc(mainLuaState, LUA_GCCOUNT, 0);
+    frameStartTime = NullGetWallTime();
+
+    if (luaL_dofile(mainLuaState, GetFileName(result->path)) != LUA_OK)
+    {
+        const char *message = lua_tostring(mainLuaState, -1);
+        strncpy(result->error, (message != NULL)? message : "unknown error", 255);
+        TraceLog(WARNING, "[%s] Lua error: %s", result->path, result->error);
+    }
+
+    ChangeDirectory(previousDirectory);
+    NullSetFrameCallback(NULL, NULL);
+
+    // Compute frame time statistics
+    double mean = 0.0, p50 = 0.0, p99 = 0.0, max = 0.0;
+
+    if (result->frames > 0)
+    {
+        for (int i = 0; i < result->frames; i++) mean += result->frameTimes[i];
+        mean /= result->frames;
+
+        qsort(result->frameTimes, result->frames, sizeof(double), CompareTimes);
+        p50 = result->frameTimes[(result->frames - 1)/2];
+        p99 = result->frameTimes[(int)ceil(0.99*result->frames) - 1];   // Nearest-rank percentile
+        max = result->frameTimes[result->frames - 1];
+    }
+
+    NullStats stats = NullGetStats();
+
+    // Write example report
+    fprintf(report, "%s\n    {\n      \"example\": ", first? "" : ",");
+    WriteJsonString(report, result->path);
+    fprintf(report, ",\n      \"status\": \"%s\",\n", (result->error[0] == '\0')? "ok" : "error");
+    if (result->error[0] != '\0')
+    {
+        fprintf(report, "      \"error\": ");
+        WriteJsonString(report, result->error);
+        fprintf(report, ",\n");
+    }
+    fprintf(report, "      \"frames\": %i,\n", result->frames);
+    fprintf(report, "      \"load_ms\": %.4f,\n", result->loadTime*1000.0);
+    fprintf(report, "      \"frame_ms\": { \"mean\": %.4f, \"p50\": %.4f, \"p99\": %.4f, \"max\": %.4f },\n", mean*1000.0, p50*1000.0, p99*1000.0, max*1000.0);
+    fprintf(report, "      \"gc_ms\": { \"total\": %.4f, \"per_frame\": %.4f },\n", result->gcTime*1000.0, (result->frames > 0)? result->gcTime*1000.0/result->frames : 0.0);
+    fprintf(report, "      \"lua_memory_bytes\": { \"peak\": %i, \"final\": %i },\n", result->memoryPeak, result->memoryFinal);
+    fprintf(report, "      \"backend_calls\": { \"draw\": %i, \"mode\": %i, \"window\": %i, \"resource\": %i, \"audio\": %i },\n",
+            stats.drawCalls, stats.modeCalls, stats.windowCalls, stats.resourceCalls, stats.audioCalls);
+
+    // Binding calls: total and per function (only called functions)
+    const char *name = NULL;
+    unsigned int totalCalls = 0;
+    bool firstCall = true;
+
+    for (int i = 0; ; i++)
+    {
+        unsigned int count = rLuaGetCallCount(i, &name);
+
+        if (name == NULL) break;
+        totalCalls += count;
+    }
+
+    fprintf(report, "      \"binding_calls\": { \"total\": %u, \"per_frame\": %.2f, \"functions\": {", totalCalls, (stats.frames > 0)? (float)totalCalls/stats.frames : 0.0f);
+
+    for (int i = 0; ; i++)
+    {
+        unsigned int count = rLuaGetCallCount(i, &name);
+
+        if (name == NULL) break;
+        if (count == 0) continue;
+
+        fprintf(report, "%s\n        \"%s\": %u", firstCall? "" : ",", name, count);
+        firstCall = false;
+    }
+
+    fprintf(report, "%s} }\n    }", firstCall? " " : "\n      ");
+
+    rLuaCloseDevice();
+
+    free(result->frameTimes);
+    result->frameTimes = NULL;
+    current = NULL;
+
+    TraceLog(INFO, "[%s] %s: %.4f ms/frame (p99: %.4f ms)", result->path, (result->error[0] == '\0')? "ok" : "error", mean*1000.0, p99*1000.0);
+}
+#endif
+
+int main(int argc, char *argv[])
 {
     // Initialization
     //--------------------------------------------------------------------------------------
-    InitLuaDevice();
-    //--------------------------------------------------------------------------------------
+    int frames = DEFAULT_FRAMES;
+    const char *outputFile = "rlua_benchmark.json";
+    const char *filter = NULL;
 
-    // [core] module examples
-    ChangeDirectory("./core");
-    ExecuteLuaFile("core_basic_window.lua");
-    // ExecuteLuaFile("core_input_keys.lua");
-    // ExecuteLuaFile("core_input_mouse.lua");
-    // ExecuteLuaFile("core_mouse_wheel.lua");
-    // ExecuteLuaFile("core_input_gamepad.lua");
-    // ExecuteLuaFile("core_random_values.lua");
-    // ExecuteLuaFile("core_color_select.lua");
-    // ExecuteLuaFile("core_drop_files.lua");
-    // ExecuteLuaFile("core_storage_values.lua");
-    // ExecuteLuaFile("core_gestures_detection.lua");
-    // ExecuteLuaFile("core_3d_mode.lua");
-    // ExecuteLuaFile("core_3d_picking.lua");
-    // ExecuteLuaFile("core_3d_camera_free.lua");
-    // ExecuteLuaFile("core_3d_camera_first_person.lua");
-    // ExecuteLuaFile("core_2d_camera.lua");
-    // ExecuteLuaFile("core_world_screen.lua");
-    // ExecuteLuaFile("core_vr_simulator.lua");             // ERROR: Lua Error: attempt to index a nil value
-    
-    // [shapes] module examples
-    // ChangeDirectory("./shapes");
-    // ExecuteLuaFile("shapes_logo_raylib.lua");
-    // ExecuteLuaFile("shapes_basic_shapes.lua");
-    // ExecuteLuaFile("shapes_colors_palette.lua");
-    // ExecuteLuaFile("shapes_logo_raylib_anim.lua");
-    // ExecuteLuaFile("shapes_lines_bezier.lua");
-    
-    // [textures] module examples
-    // ChangeDirectory("./textures");
-    // ExecuteLuaFile("textures_logo_raylib.lua");
-    // ExecuteLuaFile("textures_image_loading.lua");
-    // ExecuteLuaFile("textures_image_drawing.lua");
-    // ExecuteLuaFile("textures_image_processing.lua");     // ERROR: GetImageData() --> UpdateTexture()
-    // ExecuteLuaFile("textures_rectangle.lua");
-    // ExecuteLuaFile("textures_srcrec_dstrec.lua");
-    // ExecuteLuaFile("textures_to_image.lua");
-    // ExecuteLuaFile("textures_raw_data.lua");             // ERROR: LoadImageEx()
-    // ExecuteLuaFile("textures_particles_blending.lua");
-
-    // [text] module examples
-    // ChangeDirectory("./text");
-    // ExecuteLuaFile("text_sprite_fonts.lua");
-    // ExecuteLuaFile("text_bmfont_ttf.lua");
-    // ExecuteLuaFile("text_raylib_fonts.lua");
-    // ExecuteLuaFile("text_format_text.lua");
-    // ExecuteLuaFile("text_writing_anim.lua");
-    // ExecuteLuaFile("text_ttf_loading.lua");
-    // ExecuteLuaFile("text_bmfont_unordered.lua");
-    // ExecuteLuaFile("text_input_box.lua");                // ERROR: Lua Error: attempt to index a string value
-    
-    // [models] module examples
-    // ChangeDirectory("./models");
-    // ExecuteLuaFile("models_geometric_shapes.lua");
-    // ExecuteLuaFile("models_box_collisions.lua");
-    // ExecuteLuaFile("models_billboard.lua");
-    // ExecuteLuaFile("models_obj_loading.lua");
-    // ExecuteLuaFile("models_heightmap.lua");
-    // ExecuteLuaFile("models_cubicmap.lua");
-    // ExecuteLuaFile("models_mesh_picking.lua");           // ERROR: Lua Error: attempt to index a nil value
-    
-    // [shaders] module examples
-    // ChangeDirectory("./shaders");
-    // ExecuteLuaFile("shaders_model_shader.lua");
-    // ExecuteLuaFile("shaders_shapes_textures.lua");
-    // ExecuteLuaFile("shaders_custom_uniform.lua");
-    // ExecuteLuaFile("shaders_postprocessing.lua");
-    
-    // [audio] module examples
-    // ChangeDirectory("./audio");
-    // ExecuteLuaFile("audio_sound_loading.lua");
-    // ExecuteLuaFile("audio_music_stream.lua");
-    // ExecuteLuaFile("audio_module_playing.lua");
-    // ExecuteLuaFile("audio_raw_stream.lua");              // ERROR: UpdateAudioStream()
-    
-    // TODO: [physac] module examples
-    // ChangeDirectory("./physac");
-    // ExecuteLuaFile("physics_demo.lua");
-    // ExecuteLuaFile("physics_movement.lua");
-    // ExecuteLuaFile("physics_friction.lua");
-    // ExecuteLuaFile("physics_restitution.lua");
-    // ExecuteLuaFile("physics_shatter.lua");
-    
-    // De-Initialization
-    //--------------------------------------------------------------------------------------
-    CloseLuaDevice();        // Close Lua device and free resources
+    for (int i = 1; i < argc - 1; i++)
+    {
+        if (strcmp(argv[i], "--frames") == 0) frames = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--output") == 0) outputFile = argv[++i];
+        else if (strcmp(argv[i], "--filter") == 0) filter = argv[++i];
+    }
+
+    if (frames < 1) frames = 1;
+
+    static char paths[MAX_EXAMPLES][MAX_EXAMPLE_PATH] = { 0 };
+    int count = ScanExamples(paths, filter);
+
+    TraceLog(INFO, "rlua_tester: %i examples found", count);
     //--------------------------------------------------------------------------------------
 
+#if defined(RLUA_HEADLESS)
+    FILE *report = fopen(outputFile, "wt");
+
+    if (report == NULL)
+    {
+        TraceLog(WARNING, "[%s] Report file could not be opened", outputFile);
+        return 1;
+    }
+
+    fprintf(report, "{\n  \"frames\": %i,\n  \"examples\": [", frames);
+
+    for (int i = 0; i < count; i++)
+    {
+        ExampleResult result = { 0 };
+        strcpy(result.path, paths[i]);
+
+        BenchmarkExample(&result, frames, report, (i == 0));
+    }
+
+    fprintf(report, "\n  ]\n}\n");
+    fclose(report);
+
+    TraceLog(INFO, "rlua_tester: report written to %s", outputFile);
+#else
+    // Run every example, close window (ESC) to move to next one
+    (void)outputFile;
+
+    for (int i = 0; i < count; i++)
+    {
+        char directory[MAX_EXAMPLE_PATH] = { 0 };
+        strcpy(directory, paths[i]);
+        *strchr(directory, '/') = '\0';
+
+        rLuaInitDevice();
+
+        ChangeDirectory(directory);
+        rLuaExecuteFile(GetFileName(paths[i]));
+        ChangeDirectory("..");
+
+        rLuaCloseDevice();       // Close Lua device and free resources
+    }
+#endif
+
     return 0;
 }
@@ -36,6 +36,9 @@ local gravity = 3.0
 
 local smoke = LoadTexture("resources/smoke.png")
 
+-- Sprite batch for particles, all of them drawn with a single flush() call
+local particlesBatch = SpriteBatch(smoke, MAX_PARTICLES)
+
 local blending = BlendMode.ALPHA
 
 SetTargetFPS(60)
@@ -87,12 +90,14 @@ while not WindowShouldClose() do            -- Detect window close button or ESC
             -- Draw active particles
             for i = 1, MAX_PARTICLES do
                 if (mouseTail[i].active) then 
-                    DrawTexturePro(smoke, Rectangle(0, 0, smoke.width, smoke.height), 
+                    particlesBatch:add(Rectangle(0, 0, smoke.width, smoke.height),
                         Rectangle(mouseTail[i].position.x, mouseTail[i].position.y, 
                                   smoke.width*mouseTail[i].size//1, smoke.height*mouseTail[i].size//1),
                         Vector2(smoke.width*mouseTail[i].size/2, smoke.height*mouseTail[i].size/2), 
                         mouseTail[i].rotation, Fade(mouseTail[i].color, mouseTail[i].alpha)) end
             end
+
+            particlesBatch:flush()
         
         EndBlendMode()
         
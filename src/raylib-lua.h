@@ -91,6 +91,17 @@ RLUADEF void rLuaExecuteCode(const char *code);      // Execute raylib Lua code
 RLUADEF void rLuaExecuteFile(const char *filename);  // Execute raylib Lua script
 RLUADEF void rLuaCloseDevice(void);                  // De-initialize Lua system
 
+RLUADEF void rLuaEnableAllocProfiler(int sampleBytes);  // Enable Lua allocation-site profiler (sampling period in bytes)
+RLUADEF void rLuaDisableAllocProfiler(void);            // Disable Lua allocation-site profiler (keeps collected data)
+RLUADEF void rLuaTraceAllocReport(int maxSites);        // Log top Lua allocation sites (bytes per frame)
+RLUADEF void rLuaGetAllocCounters(unsigned long long *count, unsigned long long *bytes);  // Get Lua allocator counters (new and grown blocks)
+
+RLUADEF void rLuaEnableCallCounters(void);              // Count calls per raylib Lua function (registers counting wrappers)
+RLUADEF void rLuaResetCallCounters(void);               // Reset raylib Lua functions calls counters
+RLUADEF unsigned int rLuaGetCallCount(int index, const char **name);    // Get calls count for function index (name is NULL past last function)
+
+RLUADEF void rLuaEnablePipelinedMode(void);             // Execute Lua code on a worker thread, frames drawn on calling thread (one frame latency)
+
 /***********************************************************************************
 *
 *   RLUA IMPLEMENTATION
@@ -101,17 +112,60 @@ RLUADEF void rLuaCloseDevice(void);                  // De-initialize Lua system
 
 #include "raylib.h"
 #include "raymath.h"
+#include "rlgl.h"                       // Required for: rlBegin(), rlVertex2f()... (SpriteBatch)
 
 #define PHYSAC_IMPLEMENTATION
 #include "physac.h"
 
+// NOTE: Dynamic fonts rasterize glyphs from font data loaded once, raylib stb_truetype is compiled static (as raylib does)
+#define STBTT_STATIC
+#define STB_TRUETYPE_IMPLEMENTATION
+#include "external/stb_truetype.h"      // Required for: stbtt_InitFont(), stbtt_GetCodepointBitmap() (dynamic fonts)
+
 #include <string.h>
 #include <stdlib.h>
+#include <stdio.h>                      // Required for: snprintf() (text formatting)
+#include <time.h>                       // Required for: time() (Random() default seed)
+#include <math.h>
+
+// NOTE: Threads (particles update, SDF fonts loading, pipelined mode) require pthreads, not available with MSVC
+// or web builds without pthreads support, define RLUA_NO_THREADS to run all work on calling thread
+#if !defined(RLUA_NO_THREADS) && !defined(_MSC_VER) && (!defined(PLATFORM_WEB) || defined(__EMSCRIPTEN_PTHREADS__))
+    #include <pthread.h>                // Required for: pthread_create(), pthread_mutex_lock()...
+    #define RLUA_THREADS
+#else
+    // Without threads, thread creation always fails (callers do the work on current thread), other calls are no-ops
+    typedef int pthread_t;
+    typedef int pthread_mutex_t;
+    typedef int pthread_cond_t;
+    #define pthread_create(thread, attr, start, arg)    ((void)(thread), (void)(arg), -1)
+    #define pthread_join(thread, result)                ((void)(thread))
+    #define pthread_mutex_init(mutex, attr)             ((void)(mutex))
+    #define pthread_mutex_destroy(mutex)                ((void)(mutex))
+    #define pthread_mutex_lock(mutex)                   ((void)(mutex))
+    #define pthread_mutex_unlock(mutex)                 ((void)(mutex))
+    #define pthread_cond_init(cond, attr)               ((void)(cond))
+    #define pthread_cond_destroy(cond)                  ((void)(cond))
+    #define pthread_cond_signal(cond)                   ((void)(cond))
+    #define pthread_cond_broadcast(cond)                ((void)(cond))
+    #define pthread_cond_wait(cond, mutex)              ((void)(cond), (void)(mutex))
+#endif
 
 #include <lua.h>
 #include <lauxlib.h>
 #include <lualib.h>
 
+// NOTE: Batch math kernels and frustum culling use SSE (x86) or NEON (AArch64) when available, define RLUA_NO_SIMD for scalar code only
+#if !defined(RLUA_NO_SIMD)
+    #if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+        #include <xmmintrin.h>          // Required for: SSE intrinsics (batch math kernels, frustum culling)
+        #define RLUA_SIMD_SSE
+    #elif defined(__ARM_NEON) && defined(__aarch64__)
+        #include <arm_neon.h>           // Required for: NEON intrinsics (batch math kernels, frustum culling)
+        #define RLUA_SIMD_NEON
+    #endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -123,7 +177,6 @@ RLUADEF void rLuaCloseDevice(void);                  // De-initialize Lua system
 #define LuaPush_Image(L, img)           LuaPushOpaqueTypeWithMetatable(L, img, Image)
 #define LuaPush_Texture2D(L, tex)       LuaPushOpaqueTypeWithMetatable(L, tex, Texture2D)
 #define LuaPush_RenderTexture2D(L, tex) LuaPushOpaqueTypeWithMetatable(L, tex, RenderTexture2D)
-#define LuaPush_Font(L, sf)             LuaPushOpaqueTypeWithMetatable(L, sf, Font)
 #define LuaPush_Mesh(L, vd)             LuaPushOpaqueType(L, vd)
 #define LuaPush_Shader(L, s)            LuaPushOpaqueType(L, s)
 #define LuaPush_Sound(L, snd)           LuaPushOpaqueType(L, snd)
@@ -155,12 +208,745 @@ RLUADEF void rLuaCloseDevice(void);                  // De-initialize Lua system
 #define LuaPushOpaqueType(L, str)                    LuaPushOpaque(L, &str, sizeof(str))
 #define LuaPushOpaqueTypeWithMetatable(L, str, meta) LuaPushOpaqueWithMetatable(L, &str, sizeof(str), #meta)
 
+#define RLUA_MAX_ALLOC_SITES            1024    // Maximum allocation sites tracked by profiler (power of two)
+#define RLUA_ALLOC_SITE_TYPES             12    // Object types tracked per site (Lua type tags + block resize)
+#define RLUA_ALLOC_SAMPLE_BYTES         4096    // Default allocation profiler sampling period (in bytes)
+
+#define RLUA_SPRITEBATCH_CAPACITY       1024    // Default SpriteBatch sprites capacity (grows on demand)
+#define RLUA_SPRITEBATCH_CHUNK          2048    // Sprites submitted per rlgl batch (keep below rlgl MAX_QUADS_BATCH)
+
+#define RLUA_TILEMAP_CHUNK                16    // Tilemap chunk size in tiles (chunk quads are cached and culled together)
+
+#define RLUA_GLYPH_PAGE_SIZE             256    // Codepoints per glyphs lookup page (BMP direct table split in pages)
+#define RLUA_GLYPH_PAGES                 256    // Glyphs lookup pages (BMP codepoints/page size)
+
+#define RLUA_DYNAMIC_FONT_ATLAS         1024    // Default dynamic font atlas size (pixels)
+
+#if !defined(RLUA_SDF_THREADS)
+    #define RLUA_SDF_THREADS               4    // Threads generating SDF glyphs, font loader thread included (1 disables workers)
+#endif
+#define RLUA_SDF_PADDING                   4    // SDF glyphs padding (pixels), as raylib SDF_CHAR_PADDING
+#define RLUA_SDF_ON_EDGE              128.0f    // SDF value on glyph edge, as raylib SDF_ON_EDGE_VALUE
+#define RLUA_SDF_DIST_SCALE            64.0f    // SDF value change per pixel of distance, as raylib SDF_PIXEL_DIST_SCALE
+#define RLUA_SDF_INFINITY              1e20f    // Distance transform infinity
+
+#define RLUA_TEXT_CACHE_SIZE             256    // Text runs cached (measured extents and glyph quads), least recently used evicted
+#define RLUA_TEXT_CACHE_BUCKETS          512    // Text runs cache hash buckets
+#define RLUA_TEXT_FORMAT_SIZE           1024    // Formatted text buffer size (DrawTextF(), TraceLog()), longer text is truncated
+
+#define RLUA_MAX_PARTICLE_EMITTERS        16    // Maximum emitters per particle system
+#if !defined(RLUA_PARTICLES_THREADS)
+    #define RLUA_PARTICLES_THREADS         4    // Maximum threads updating a particle system (1 disables threading)
+#endif
+#define RLUA_PARTICLES_THREAD_MIN      16384    // Minimum particles per update thread
+
+#define RLUA_TWEENS_CAPACITY             256    // Default maximum tweens per tween system
+
+#define RLUA_PIPELINE_FIRST_KEY           32    // First keyboard key in input snapshot (KEY_SPACE)
+#define RLUA_PIPELINE_MAX_KEYS           349    // Keyboard keys in input snapshot (last key + 1)
+#define RLUA_PIPELINE_MAX_MOUSE_BUTTONS    3    // Mouse buttons in input snapshot
+#define RLUA_PIPELINE_MAX_GAMEPADS         4    // Gamepads in input snapshot
+#define RLUA_PIPELINE_MAX_GAMEPAD_BUTTONS 32    // Buttons per gamepad in input snapshot
+#define RLUA_PIPELINE_MAX_GAMEPAD_AXIS     8    // Axis per gamepad in input snapshot
+
+#define COMMAND_ALIGN(size)     (((size) + 3) & ~3)     // Command list data alignment (4 bytes)
+
+#define RLUA_RENDERQUEUE_MAX_SHADERS     256    // Shaders per render queue flush (key shader field)
+#define RLUA_RENDERQUEUE_MAX_SEGMENTS   4096    // Barriers per render queue flush (key segment field)
+
+#define RENDERQUEUE_KEY_SEGMENT           52    // Render queue key fields shifts: segment (12 bits), layer (8 bits),
+#define RENDERQUEUE_KEY_LAYER             44    // shader (8 bits), blend mode (4 bits), texture (16 bits) and depth (16 bits)
+#define RENDERQUEUE_KEY_SHADER            36
+#define RENDERQUEUE_KEY_BLEND             32
+#define RENDERQUEUE_KEY_TEXTURE           16
+
+#define INPUT_DOWN                         1    // Input snapshot state flag: key/button down
+#define INPUT_PRESSED                      2    // Input snapshot state flag: key/button pressed this frame
+#define INPUT_RELEASED                     4    // Input snapshot state flag: key/button released this frame
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Allocation site, innermost Lua line (and function) allocating memory
+typedef struct AllocSite {
+    char source[LUA_IDSIZE];        // Chunk name of the innermost Lua frame
+    char function[32];              // Innermost function name (raylib binding or Lua function)
+    int line;                       // Current line of the innermost Lua frame (-1 if none)
+    unsigned int hash;              // Site hash (0 means empty slot)
+    unsigned int samples;           // Sampled allocations count
+    size_t bytes;                   // Estimated bytes allocated
+    size_t typeBytes[RLUA_ALLOC_SITE_TYPES];    // Estimated bytes allocated per object type
+} AllocSite;
+
+// Allocation-site profiler data
+typedef struct AllocProfiler {
+    bool enabled;                   // Profiler is sampling allocations
+    int sampleBytes;                // Sampling period, average bytes between samples
+    long long bytesUntilSample;     // Bytes left until next sample
+    int frames;                     // Frames drawn since profiler was enabled
+    int sitesCount;                 // Allocation sites registered
+    unsigned int droppedSamples;    // Samples not registered (sites table full)
+    AllocSite *sites;               // Allocation sites hash table
+    lua_State *state;               // Lua state whose call stack is sampled (allocator is not given the allocating state)
+    unsigned long long allocsCount; // Allocator calls creating or growing a block (always counted)
+    unsigned long long allocsBytes; // Bytes requested by those calls (growth only for reallocations)
+} AllocProfiler;
+
+// Typed buffer elements type
+typedef enum {
+    BUFFER_FLOAT = 0,               // 32bit floats (positions, sizes, radius...)
+    BUFFER_INT                      // 32bit integers (packed colors 0xRRGGBBAA, as ColorToInt())
+} BufferType;
+
+// Typed buffer, fixed size array of numbers stored in a Lua userdata (metatable "Buffer")
+// NOTE: Used as struct-of-arrays input by batch functions, data is stored just after the header
+typedef struct TypedBuffer {
+    int type;                       // Elements type (BufferType)
+    int count;                      // Elements count
+    float *floats;                  // Elements data (BUFFER_FLOAT)
+    int *ints;                      // Elements data (BUFFER_INT), same memory as floats
+} TypedBuffer;
+
+// Sprite batch, textured quads of one texture accumulated C-side and submitted at once
+// NOTE: Vertex arrays are kept between flushes, reused every frame
+typedef struct SpriteBatch {
+    Texture2D texture;              // Texture used by all sprites
+    int count;                      // Sprites added since last flush
+    int capacity;                   // Sprites capacity of vertex arrays
+    Vector2 *vertices;              // Quads vertices (4 per sprite, already transformed)
+    Vector2 *texcoords;             // Quads texture coordinates (4 per sprite)
+    Color *colors;                  // Sprites tint (1 per sprite)
+} SpriteBatch;
+
+// Particle emitter, spawn parameters and size/color curves (linear over particle life)
+typedef struct ParticleEmitter {
+    bool active;                    // Emitter spawns particles every update
+    Vector2 position;               // Spawn position
+    float rate;                     // Particles spawned per second
+    float spawnAccumulator;         // Fraction of particle pending to be spawned
+    float lifeMin, lifeMax;         // Particle life range (seconds)
+    float speedMin, speedMax;       // Initial speed range (pixels/second)
+    float direction, spread;        // Initial direction and spread angle (degrees)
+    Vector2 gravity;                // Particles acceleration (pixels/second^2)
+    float spinMin, spinMax;         // Rotation speed range (degrees/second)
+    float sizeStart, sizeEnd;       // Size at birth and death (pixels)
+    Color colorStart, colorEnd;     // Color at birth and death
+} ParticleEmitter;
+
+// Particle system, particles stored as struct-of-arrays and drawn with one texture
+typedef struct ParticleSystem {
+    Texture2D texture;              // Particles texture
+    int count;                      // Alive particles
+    int capacity;                   // Maximum particles
+    int emittersCount;              // Emitters defined
+    ParticleEmitter emitters[RLUA_MAX_PARTICLE_EMITTERS];
+    unsigned int randomState;       // Spawn random generator state
+    float *x, *y;                   // Particles position
+    float *vx, *vy;                 // Particles velocity
+    float *ax, *ay;                 // Particles acceleration (emitter gravity)
+    float *rotation, *spin;         // Particles rotation and rotation speed (degrees)
+    float *age, *life;              // Particles age and life (seconds)
+    unsigned char *emitter;         // Particles emitter index (size and color curves)
+    SpriteBatch batch;              // Quads submission arrays (reused every frame)
+} ParticleSystem;
+
+// Tilemap chunk, tiles quads cached in world space (rebuilt only after a tile change)
+typedef struct TilemapChunk {
+    SpriteBatch batch;              // Chunk tiles quads (vertex arrays allocated on first build)
+    bool dirty;                     // Chunk tiles changed since last build
+} TilemapChunk;
+
+// Tilemap, grid of tileset tiles drawn by chunks (only chunks visible are drawn)
+// NOTE: Tile 0 is empty, tile n is tileset tile n - 1 (row-major)
+typedef struct Tilemap {
+    Texture2D tileset;              // Tileset texture
+    int tileWidth, tileHeight;      // Tile size (pixels)
+    int columns;                    // Tileset columns
+    int tilesCount;                 // Tileset tiles
+    int width, height;              // Map size (tiles)
+    int chunksX, chunksY;           // Map size (chunks)
+    Vector2 position;               // Map top-left corner (world space)
+    int *tiles;                     // Map tiles (width*height)
+    TilemapChunk *chunks;           // Map chunks (chunksX*chunksY)
+} Tilemap;
+
+// Draw command types, one per recorded drawing function
+// NOTE: Texture drawing functions are recorded as COMMAND_TEXTURE (DrawTexturePro() parameters),
+// simple versions of 3D drawing functions are recorded as their extended version
+typedef enum {
+    COMMAND_PIXEL = 0,
+    COMMAND_PIXEL_V,
+    COMMAND_LINE,
+    COMMAND_LINE_V,
+    COMMAND_LINE_EX,
+    COMMAND_LINE_BEZIER,
+    COMMAND_CIRCLE,
+    COMMAND_CIRCLE_GRADIENT,
+    COMMAND_CIRCLE_V,
+    COMMAND_CIRCLE_LINES,
+    COMMAND_RECTANGLE,
+    COMMAND_RECTANGLE_V,
+    COMMAND_RECTANGLE_REC,
+    COMMAND_RECTANGLE_PRO,
+    COMMAND_RECTANGLE_GRADIENT_V,
+    COMMAND_RECTANGLE_GRADIENT_H,
+    COMMAND_RECTANGLE_GRADIENT_EX,
+    COMMAND_RECTANGLE_LINES,
+    COMMAND_RECTANGLE_LINES_EX,
+    COMMAND_TRIANGLE,
+    COMMAND_TRIANGLE_LINES,
+    COMMAND_POLY,
+    COMMAND_TEXTURE,
+    COMMAND_TEXT,
+    COMMAND_TEXT_EX,
+    COMMAND_FPS,
+    COMMAND_POLY_EX,                // DrawPolyEx() points
+    COMMAND_POLY_EX_LINES,
+    COMMAND_LINE_3D,
+    COMMAND_CIRCLE_3D,
+    COMMAND_CUBE,
+    COMMAND_CUBE_WIRES,
+    COMMAND_CUBE_TEXTURE,
+    COMMAND_SPHERE,
+    COMMAND_SPHERE_WIRES,
+    COMMAND_CYLINDER,
+    COMMAND_CYLINDER_WIRES,
+    COMMAND_PLANE,
+    COMMAND_RAY,
+    COMMAND_GRID,
+    COMMAND_GIZMO,
+    COMMAND_BOUNDING_BOX,
+    COMMAND_BILLBOARD,
+    COMMAND_MODEL,
+    COMMAND_MODEL_WIRES,
+    COMMAND_MESH_INSTANCES,         // Mesh instances transforms (DrawModelInstances(), DrawModelsCulled())
+    COMMAND_SPRITES,                // SpriteBatch quads (SpriteBatch, ParticleSystem)
+    COMMAND_CLEAR_BACKGROUND,
+    COMMAND_BEGIN_MODE_2D,
+    COMMAND_END_MODE_2D,
+    COMMAND_BEGIN_MODE_3D,
+    COMMAND_END_MODE_3D,
+    COMMAND_BEGIN_TEXTURE_MODE,
+    COMMAND_END_TEXTURE_MODE,
+    COMMAND_BEGIN_SHADER_MODE,
+    COMMAND_END_SHADER_MODE,
+    COMMAND_BEGIN_BLEND_MODE,
+    COMMAND_END_BLEND_MODE,
+    COMMAND_BEGIN_VR_DRAWING,
+    COMMAND_END_VR_DRAWING,
+    COMMAND_OFFSET                  // Offset displacement (nested command lists)
+} CommandType;
+
+// Shape command parameters, fields used depend on command type
+typedef struct ShapeCommand {
+    Vector2 points[3];              // Positions: point, line start/end, center, rectangle position, triangle vertex
+    Vector2 size;                   // Rectangle size
+    float values[3];                // Radius, thickness, rotation, polygon sides
+    Color colors[4];                // Color (gradients use several)
+} ShapeCommand;
+
+// Texture command parameters (DrawTexturePro())
+typedef struct TextureCommand {
+    Texture2D texture;
+    Rectangle sourceRec;
+    Rectangle destRec;
+    Vector2 origin;
+    float rotation;
+    Color tint;
+} TextureCommand;
+
+// Text command parameters, text string (NULL terminated) is stored just after
+typedef struct TextCommand {
+    Font font;                      // Font (not used by COMMAND_TEXT, default font)
+    Vector2 position;
+    float fontSize;
+    float spacing;
+    Color color;
+} TextCommand;
+
+// Sprites command parameters, sprites vertices, texcoords and colors arrays are stored just after
+typedef struct SpritesCommand {
+    Texture2D texture;
+    int count;
+} SpritesCommand;
+
+// Polygon command parameters (DrawPolyEx()), points array is stored just after
+typedef struct PolyCommand {
+    int count;
+    Color color;
+} PolyCommand;
+
+// 3D shape command parameters, fields used depend on command type (not displaced by offset)
+typedef struct Shape3DCommand {
+    Vector3 points[2];              // Positions: position, center, line start/end, ray position/direction, box min/max, circle axis
+    Vector3 size;                   // Cube size, plane size (x, z)
+    float values[4];                // Radius, rotation angle, rings, slices, cylinder radius/height, grid spacing, billboard size
+    Color color;
+    Texture2D texture;              // Cube and billboard texture
+    Rectangle sourceRec;            // Billboard source rectangle
+    Camera camera;                  // Billboard camera
+} Shape3DCommand;
+
+// Model command parameters (DrawModelEx())
+typedef struct ModelCommand {
+    Model model;
+    Vector3 position;
+    Vector3 rotationAxis;
+    float rotationAngle;
+    Vector3 scale;
+    Color tint;
+} ModelCommand;
+
+// Mesh instances command parameters, instances transforms (Matrix) array is stored just after
+typedef struct MeshInstancesCommand {
+    Mesh mesh;
+    Material material;
+    int count;
+} MeshInstancesCommand;
+
+// Command list, recorded drawing commands replayed from C
+// NOTE: Commands are stored as a byte stream: type (int) + parameters (+ text or arrays), 4-byte aligned
+typedef struct CommandList {
+    unsigned char *data;            // Commands data
+    int size;                       // Commands data size (bytes)
+    int capacity;                   // Commands data capacity (bytes)
+    int count;                      // Commands recorded
+} CommandList;
+
+// Input state snapshot, taken on main thread after every frame drawn (pipelined mode)
+typedef struct InputSnapshot {
+    unsigned char keys[RLUA_PIPELINE_MAX_KEYS];         // Keys state flags (INPUT_DOWN, INPUT_PRESSED, INPUT_RELEASED)
+    unsigned char mouseButtons[RLUA_PIPELINE_MAX_MOUSE_BUTTONS];
+    unsigned char gamepadButtons[RLUA_PIPELINE_MAX_GAMEPADS][RLUA_PIPELINE_MAX_GAMEPAD_BUTTONS];
+    float gamepadAxis[RLUA_PIPELINE_MAX_GAMEPADS][RLUA_PIPELINE_MAX_GAMEPAD_AXIS];
+    int gamepadAxisCount[RLUA_PIPELINE_MAX_GAMEPADS];
+    bool gamepadAvailable[RLUA_PIPELINE_MAX_GAMEPADS];
+    int keyPressed;
+    int gamepadButtonPressed;
+    Vector2 mousePosition;
+    int mouseWheelMove;
+    int gesture;
+    int screenWidth;
+    int screenHeight;
+    int fps;
+    float frameTime;
+    double time;
+    bool shouldClose;
+} InputSnapshot;
+
+// View frustum, planes (a, b, c, d) pointing inside: left, right, bottom, top, near, far
+typedef struct Frustum {
+    float planes[6][4];
+} Frustum;
+
+// Render queue command entry
+typedef struct RenderQueueEntry {
+    int offset;                     // Command data offset in render queue list
+    int size;                       // Command data size (set on flush)
+    int shader;                     // Shader index in render queue shaders table (0 is default shader)
+    int blend;                      // Blend mode
+    unsigned int texture;           // Texture id (0 for shapes)
+    bool barrier;                   // Command keeps submission order (drawing modes, nested command lists)
+} RenderQueueEntry;
+
+// Render queue sorting item
+typedef struct RenderQueueItem {
+    unsigned long long key;         // Sort key: segment, layer, shader, blend, texture, depth
+    int index;                      // Entry index
+} RenderQueueItem;
+
+// Render queue, commands recorded and drawn sorted to minimize state changes
+typedef struct RenderQueue {
+    bool active;                    // Render queue begun
+    CommandList list;               // Commands recorded
+    CommandList *parent;            // Command list recorded before BeginRenderQueue() (sorted commands are recorded on it)
+    RenderQueueEntry *entries;      // Commands entries
+    RenderQueueItem *items;         // Sorting items (2*capacity, second half used as radix sort buffer)
+    int count;                      // Commands entries count
+    int capacity;                   // Commands entries capacity
+    Shader shaders[RLUA_RENDERQUEUE_MAX_SHADERS];   // Shaders table (sort key uses indices)
+    int shadersCount;               // Shaders in table
+    int segment;                    // Current key segment (incremented by barriers)
+    int layer;                      // Current layer
+    int depth;                      // Current depth
+    int shader;                     // Current shader index
+    int blend;                      // Current blend mode
+    struct {
+        int commands;               // Commands drawn
+        int changesSubmitted;       // State changes in submission order
+        int changesSorted;          // State changes after sorting
+    } stats;
+} RenderQueue;
+
+// Dynamic font, glyphs rasterized on first use into an atlas of rows (shelves)
+// NOTE: Least recently used row is evicted when atlas is full, rows used in current frame are kept
+typedef struct DynamicFont {
+    char *fileName;                 // Font file
+    int fontSize;                   // Glyphs rasterization size
+    unsigned char *fileData;        // Font file data (loaded once, referenced by fontInfo)
+    stbtt_fontinfo fontInfo;        // Font parsed tables, glyphs rasterized from it (same metrics as LoadFontData())
+    float scaleFactor;              // Font units to pixels scale for fontSize
+    int ascent;                     // Font ascent (font units), glyphs offsetY is relative to it
+    Image atlas;                    // Atlas pixels (gray-alpha), uploaded when changed
+    Texture2D texture;              // Atlas texture
+    bool dirty;                     // Atlas changed since last upload
+    CharInfo *chars;                // Glyphs slots (Font chars), slot 0 is space/fallback glyph, free slots value is -1
+    int *slotRows;                  // Glyphs slots atlas row (-1 if none)
+    int slotsCount;                 // Glyphs slots (Font charsCount)
+    int *freeSlots;                 // Free glyphs slots stack
+    int freeCount;
+    int rowHeight;                  // Atlas rows height (pixels)
+    int rowsCount;                  // Atlas rows
+    int rowsUsed;                   // Atlas rows used at least once
+    int *rowWidths;                 // Atlas rows filled width (pixels)
+    unsigned int *rowFrames;        // Atlas rows last frame used
+    int currentRow;                 // Atlas row being filled
+    int *missing;                   // Codepoints missing for text being prepared
+    int missingCapacity;
+    unsigned int fullFrame;         // Last frame atlas was full + 1 (0 if never)
+    unsigned int generation;        // Increased on every row eviction (text runs laid out again)
+    unsigned int evictions;         // Atlas rows evicted
+} DynamicFont;
+
+// Font glyphs lookup, codepoint to glyph index in constant time
+// NOTE: Glyph indices are stored + 1, 0 means codepoint not found
+typedef struct GlyphLookup {
+    const CharInfo *chars;          // Font glyphs array (font identity)
+    int charsCount;                 // Font glyphs count
+    int *pages[RLUA_GLYPH_PAGES];   // BMP codepoints pages (allocated only for pages with glyphs)
+    int *hashCodepoints;            // Higher planes codepoints (open addressing hash)
+    int *hashIndices;               // Higher planes glyph indices
+    int hashSize;                   // Hash slots (power of two, 0 if no glyphs out of BMP)
+    int hashCount;                  // Hash entries
+    DynamicFont *dynamic;           // Dynamic font (lookup updated as glyphs are loaded), NULL otherwise
+} GlyphLookup;
+
+// Font loader, SDF font glyphs rasterized and generated in background
+typedef struct FontLoader {
+    char *fileName;                 // Font file
+    int fontSize;                   // Glyphs size
+    int *codepoints;                // Glyphs codepoints
+    int charsCount;                 // Glyphs count
+    CharInfo *chars;                // Glyphs (NULL after loaded into a font)
+    pthread_t thread;               // Loader thread (rasterizes glyphs, then generates SDF with workers)
+    pthread_mutex_t mutex;          // Protects glyphs queue and progress
+    int nextGlyph;                  // Next glyph to generate SDF
+    int glyphsDone;                 // SDF glyphs generated
+    bool done;                      // Loader thread finished
+    bool joined;                    // Loader thread joined
+    bool initialized;               // Loader data allocated (freed on collection)
+    bool consumed;                  // Glyphs loaded into a font
+} FontLoader;
+
+// Text run, one string laid out with one font, size and spacing
+typedef struct TextRun {
+    const char *text;               // Lua string (referenced while cached, address is the key)
+    int textRef;                    // Lua string registry reference
+    const CharInfo *fontChars;      // Font identity: glyphs array and texture
+    unsigned int fontTextureId;
+    float fontSize;                 // Font size
+    float spacing;                  // Characters spacing
+    bool measured;                  // Size computed (MeasureTextEx())
+    Vector2 size;
+    bool laidOut;                   // Glyph quads computed (DrawTextEx())
+    Color tint;                     // Glyph quads color
+    unsigned int fontGeneration;    // Dynamic font generation of glyph quads
+    SpriteBatch quads;              // Glyph quads, relative to text position
+    unsigned int bucket;            // Hash bucket
+    int hashNext;                   // Next run in hash bucket (1-based, 0 is none)
+    int prev, next;                 // LRU list links (1-based, 0 is none)
+} TextRun;
+
+// Text runs cache, hash table of runs with LRU eviction
+typedef struct TextCache {
+    TextRun runs[RLUA_TEXT_CACHE_SIZE];
+    int buckets[RLUA_TEXT_CACHE_BUCKETS];   // First run in bucket (1-based, 0 is none)
+    int used;                       // Runs slots used
+    int free;                       // Released runs slots list, linked by hashNext (1-based, 0 is none)
+    int count;                      // Runs cached
+    int head, tail;                 // Most and least recently used runs (1-based, 0 is none)
+    unsigned int hits, misses, evictions;
+} TextCache;
+
+// Text buffer line, text copy laid out as a run (measured on append, glyph quads cached on first draw)
+typedef struct TextBufferLine {
+    TextRun run;                    // Line run (text points to line text)
+    char *text;                     // Line text (NUL-terminated, reused by the line replacing it)
+    int textSize;                   // Line text allocated size
+    Color color;                    // Line color
+} TextBufferLine;
+
+// Text buffer, ring of text lines (oldest replaced when full) drawn by visible window
+typedef struct TextBuffer {
+    Font font;                      // Lines font
+    float fontSize;                 // Lines font size
+    float spacing;                  // Lines characters spacing
+    float lineHeight;               // Distance between lines
+    Color color;                    // Lines default color
+    int capacity;                   // Lines capacity
+    int first;                      // Oldest line in ring
+    int count;                      // Lines in buffer
+    TextBufferLine *lines;          // Lines ring
+    SpriteBatch visible;            // Visible lines glyph quads, relative to buffer position (rebuilt on every draw)
+} TextBuffer;
+
+// Text layout line, glyphs range [start, end) of layout text
+typedef struct TextLayoutLine {
+    int start;                      // First glyph
+    int end;                        // Glyph after last glyph
+    float width;                    // Line width
+} TextLayoutLine;
+
+// Text layout, text word wrapped to a maximum width (glyph advances computed once per text)
+typedef struct TextLayout {
+    Font font;                      // Text font
+    float fontSize;                 // Text font size
+    float spacing;                  // Characters spacing
+    float maxWidth;                 // Maximum lines width (0 for no wrapping)
+    float lineHeight;               // Distance between lines
+    char *text;                     // Text (NUL-terminated)
+    int textSize;                   // Text allocated size
+    int glyphsCount;                // Text glyphs (line breaks included)
+    int glyphsCapacity;
+    int *offsets;                   // Glyphs bytes offsets in text
+    float *advances;                // Glyphs advances, scaled and spaced (0 for line breaks)
+    int linesCount;                 // Lines after wrapping
+    int linesCapacity;
+    TextLayoutLine *lines;
+    Vector2 size;                   // Text size after wrapping
+    bool wrapped;                   // Lines computed for current text and maximum width
+    bool laidOut;                   // Glyph quads computed for current lines
+    Color tint;                     // Glyph quads color
+    unsigned int fontGeneration;    // Dynamic font generation of glyph quads
+    SpriteBatch quads;              // Glyph quads, relative to text position
+} TextLayout;
+
+// Random numbers stream, PCG32 generator (odd increment selects one of 2^63 independent streams)
+typedef struct RandomStream {
+    unsigned long long state;       // Generator state
+    unsigned long long increment;   // Stream increment (odd)
+} RandomStream;
+
+// Tween easing curves, in/out/inOut variants of each curve (tweenEasingNames order)
+typedef enum {
+    EASE_LINEAR = 0,
+    EASE_QUAD,                      // Curves: EASE_LINEAR + 3*curve + mode (0 = in, 1 = out, 2 = inOut)
+    EASE_CUBIC,
+    EASE_QUART,
+    EASE_SINE,
+    EASE_EXPO,
+    EASE_CIRC,
+    EASE_BACK,
+    EASE_ELASTIC,
+    EASE_BOUNCE
+} TweenCurve;
+
+// Tween slot state
+typedef enum {
+    TWEEN_FREE = 0,                 // Slot not used (linked in free slots list)
+    TWEEN_WAITING,                  // Sequenced, waiting for previous tween to end
+    TWEEN_RUNNING                   // Delayed or animating
+} TweenState;
+
+// Tween flags
+typedef enum {
+    TWEEN_FLAG_INT = 1,             // Target is an IntBuffer element (value rounded)
+    TWEEN_FLAG_FROM = 2,            // Start value given (not read from target on start)
+    TWEEN_FLAG_STARTED = 4,         // Delay elapsed, start value set
+    TWEEN_FLAG_YOYO = 8             // Reverse direction on every loop
+} TweenFlags;
+
+// Tween system, tweens stored as struct-of-arrays and advanced in one pass per update
+// NOTE: Targets (buffers, vectors, matrices) are kept alive in system user value table, indexed by slot
+typedef struct TweenSystem {
+    int count;                      // Active tweens (running or waiting)
+    int capacity;                   // Maximum tweens
+    int used;                       // Slots used at least once [0, used)
+    int freeSlot;                   // First free slot below used (-1 if none)
+    float **targets;                // Target float (or int) address
+    float *from, *to;               // Start and end values (swapped on yoyo loops)
+    float *elapsed;                 // Time since tween started (delay included)
+    float *delay;                   // Delay before animating (first loop only)
+    float *duration;                // Time per loop
+    int *loops;                     // Remaining loops (-1 for endless)
+    int *followers;                 // First tween sequenced after this one (-1 if none)
+    int *siblings;                  // Next tween sequenced after same tween, next free slot for free slots
+    int *leaders;                   // Tween this one is sequenced after (-1 if none)
+    unsigned int *generations;      // Slot generation, increased when slot is freed (stale ids detection)
+    unsigned char *easing;          // Easing curve (TweenCurve and mode)
+    unsigned char *state;           // TweenState
+    unsigned char *flags;           // TweenFlags
+} TweenSystem;
+
+// Pipelined mode state: Lua script runs on a worker thread recording frames,
+// main thread draws recorded frames and executes calls requiring it (GPU, window, audio)
+typedef struct Pipeline {
+    bool enabled;                   // Pipelined mode enabled (rLuaEnablePipelinedMode())
+    pthread_mutex_t mutex;          // Protects frame and call handoff fields
+    pthread_cond_t cond;            // Signaled on every handoff field change
+    CommandList frames[2];          // Double-buffered frames: worker records one while main thread draws the other
+    int recordFrame;                // Frame being recorded by worker
+    int readyFrame;                 // Frame recorded, waiting to be drawn
+    bool frameReady;                // Frame waiting to be taken by main thread
+    int framesDrawn;                // Frames drawn by main thread
+    bool callPending;               // Function call waiting to be executed by main thread
+    lua_State *callState;           // Function call Lua state (function and arguments on stack)
+    int callArgs;                   // Function call arguments count
+    int callStatus;                 // Function call result (lua_pcall())
+    bool scriptIsFile;              // Script is a file name (code otherwise)
+    bool scriptDone;                // Script execution finished
+    int scriptStatus;               // Script execution result
+    InputSnapshot input;            // Input state seen by worker (current frame)
+    InputSnapshot nextInput;        // Input state taken after last frame drawn (next frame)
+} Pipeline;
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
 static lua_State* mainLuaState = 0;
 static lua_State* L = 0;
 
+static AllocProfiler allocProfiler = { 0 };     // Lua allocation-site profiler
+
+static CommandList *recordingList = NULL;       // Command list being recorded (drawing functions are recorded, not drawn)
+static CommandList *recordingParent = NULL;     // Command list recorded before BeginRecording() (pipelined mode frame)
+static int recordingListRef = LUA_NOREF;        // Registry reference keeping recorded command list alive
+
+static Pipeline pipeline;                       // Pipelined mode state
+static RenderQueue renderQueue;                 // Render queue state
+static TextCache textCache;                     // Text runs cache (measure and draw text)
+static TextRun textFormatRun;                   // Formatted text run (not cached, quads arrays reused)
+static GlyphLookup *glyphLookups = NULL;        // Fonts glyphs lookups
+static int glyphLookupsCount = 0;
+static unsigned int dynamicFontsFrame = 0;      // Frames counter for dynamic fonts atlas rows eviction
+
+// Allocation profiler object type names, indexed by Lua type tag
+static const char *allocTypeNames[RLUA_ALLOC_SITE_TYPES] = {
+    "block", "", "", "", "string", "table", "closure", "userdata", "thread", "proto", "", "resize"
+};
+
+//----------------------------------------------------------------------------------
+// SIMD operations
+//----------------------------------------------------------------------------------
+
+// SIMD operations on 4 floats (batch math kernels, frustum culling)
+// NOTE: 4 vectors are processed at once as components registers (x, y, z, w of 4 vectors)
+#if defined(RLUA_SIMD_SSE)
+    #define RLUA_SIMD
+    typedef __m128 Simd4;
+    #define Simd4Set1(x)        _mm_set1_ps(x)
+    #define Simd4Load(p)        _mm_loadu_ps(p)
+    #define Simd4Store(p, v)    _mm_storeu_ps(p, v)
+    #define Simd4Add(a, b)      _mm_add_ps(a, b)
+    #define Simd4Sub(a, b)      _mm_sub_ps(a, b)
+    #define Simd4Mul(a, b)      _mm_mul_ps(a, b)
+    #define Simd4Div(a, b)      _mm_div_ps(a, b)
+    #define Simd4Sqrt(a)        _mm_sqrt_ps(a)
+    #define Simd4Abs(a)         _mm_andnot_ps(_mm_set1_ps(-0.0f), a)
+
+// Get lanes greater or equal than zero as bits mask (lane i is bit i)
+static inline int Simd4MaskNonNegative(Simd4 a)
+{
+    return _mm_movemask_ps(_mm_cmpge_ps(a, _mm_setzero_ps()));
+}
+
+// Replace zero lanes by value
+static inline Simd4 Simd4ReplaceZero(Simd4 a, Simd4 value)
+{
+    Simd4 mask = _mm_cmpeq_ps(a, _mm_setzero_ps());
+    return _mm_or_ps(_mm_and_ps(mask, value), _mm_andnot_ps(mask, a));
+}
+
+// Load 4 vectors of n components (2..4) as components registers
+static inline void Simd4LoadVectors(const float *p, int n, Simd4 *v)
+{
+    if (n == 2)
+    {
+        Simd4 a = _mm_loadu_ps(p), b = _mm_loadu_ps(p + 4);     // x0 y0 x1 y1, x2 y2 x3 y3
+        v[0] = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+        v[1] = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+    }
+    else if (n == 3)
+    {
+        Simd4 a = _mm_loadu_ps(p), b = _mm_loadu_ps(p + 4), c = _mm_loadu_ps(p + 8);   // x0 y0 z0 x1, y1 z1 x2 y2, z2 x3 y3 z3
+        v[0] = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+        v[1] = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        v[2] = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+    }
+    else
+    {
+        v[0] = _mm_loadu_ps(p);
+        v[1] = _mm_loadu_ps(p + 4);
+        v[2] = _mm_loadu_ps(p + 8);
+        v[3] = _mm_loadu_ps(p + 12);
+        _MM_TRANSPOSE4_PS(v[0], v[1], v[2], v[3]);
+    }
+}
+
+// Store 4 vectors of n components (2..4) from components registers
+static inline void Simd4StoreVectors(float *p, int n, const Simd4 *v)
+{
+    if (n == 2)
+    {
+        _mm_storeu_ps(p, _mm_unpacklo_ps(v[0], v[1]));
+        _mm_storeu_ps(p + 4, _mm_unpackhi_ps(v[0], v[1]));
+    }
+    else if (n == 3)
+    {
+        _mm_storeu_ps(p, _mm_shuffle_ps(_mm_shuffle_ps(v[0], v[1], _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(v[2], v[0], _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(p + 4, _mm_shuffle_ps(_mm_shuffle_ps(v[1], v[2], _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(v[0], v[1], _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(p + 8, _mm_shuffle_ps(_mm_shuffle_ps(v[2], v[0], _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(v[1], v[2], _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+    }
+    else
+    {
+        Simd4 a = v[0], b = v[1], c = v[2], d = v[3];
+        _MM_TRANSPOSE4_PS(a, b, c, d);
+        _mm_storeu_ps(p, a);
+        _mm_storeu_ps(p + 4, b);
+        _mm_storeu_ps(p + 8, c);
+        _mm_storeu_ps(p + 12, d);
+    }
+}
+#elif defined(RLUA_SIMD_NEON)
+    #define RLUA_SIMD
+    typedef float32x4_t Simd4;
+    #define Simd4Set1(x)        vdupq_n_f32(x)
+    #define Simd4Load(p)        vld1q_f32(p)
+    #define Simd4Store(p, v)    vst1q_f32(p, v)
+    #define Simd4Add(a, b)      vaddq_f32(a, b)
+    #define Simd4Sub(a, b)      vsubq_f32(a, b)
+    #define Simd4Mul(a, b)      vmulq_f32(a, b)
+    #define Simd4Div(a, b)      vdivq_f32(a, b)
+    #define Simd4Sqrt(a)        vsqrtq_f32(a)
+    #define Simd4Abs(a)         vabsq_f32(a)
+
+static inline int Simd4MaskNonNegative(Simd4 a)
+{
+    static const uint32_t bits[4] = { 1, 2, 4, 8 };
+    return (int)vaddvq_u32(vandq_u32(vcgeq_f32(a, vdupq_n_f32(0.0f)), vld1q_u32(bits)));
+}
+
+static inline Simd4 Simd4ReplaceZero(Simd4 a, Simd4 value)
+{
+    return vbslq_f32(vceqq_f32(a, vdupq_n_f32(0.0f)), value, a);
+}
+
+static inline void Simd4LoadVectors(const float *p, int n, Simd4 *v)
+{
+    if (n == 2) { float32x4x2_t r = vld2q_f32(p); v[0] = r.val[0]; v[1] = r.val[1]; }
+    else if (n == 3) { float32x4x3_t r = vld3q_f32(p); v[0] = r.val[0]; v[1] = r.val[1]; v[2] = r.val[2]; }
+    else { float32x4x4_t r = vld4q_f32(p); v[0] = r.val[0]; v[1] = r.val[1]; v[2] = r.val[2]; v[3] = r.val[3]; }
+}
+
+static inline void Simd4StoreVectors(float *p, int n, const Simd4 *v)
+{
+    if (n == 2) vst2q_f32(p, ((float32x4x2_t){ { v[0], v[1] } }));
+    else if (n == 3) vst3q_f32(p, ((float32x4x3_t){ { v[0], v[1], v[2] } }));
+    else vst4q_f32(p, ((float32x4x4_t){ { v[0], v[1], v[2], v[3] } }));
+}
+#endif
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
@@ -174,6 +960,7 @@ static void LuaPush_Rectangle(lua_State* L, Rectangle rect);
 static void LuaPush_Camera(lua_State* L, Camera cam);
 static void LuaPush_Camera2D(lua_State* L, Camera2D cam);
 static void LuaPush_Model(lua_State* L, Model mdl);
+static void LuaPush_Font(lua_State* L, Font font);
 static void LuaPush_Ray(lua_State* L, Ray ray);
 static void LuaPush_RayHitInfo(lua_State* L, RayHitInfo hit);
 
@@ -189,6 +976,78 @@ static Camera2D LuaGetArgument_Camera2D(lua_State* L, int index);
 static Model LuaGetArgument_Model(lua_State* L, int index);
 static Ray LuaGetArgument_Ray(lua_State* L, int index);
 
+static const char *LuaFormatText(lua_State *L, const char *format, int first, char *buffer, int size);
+
+static int LuaSpriteBatchAdd(lua_State *L);
+static int LuaSpriteBatchAddBuffers(lua_State *L);
+static int LuaSpriteBatchFlush(lua_State *L);
+static int LuaSpriteBatchClear(lua_State *L);
+static int LuaSpriteBatchCount(lua_State *L);
+static int LuaSpriteBatchGC(lua_State *L);
+
+static int LuaParticleSystemAddEmitter(lua_State *L);
+static int LuaParticleSystemSetEmitter(lua_State *L);
+static int LuaParticleSystemMoveEmitter(lua_State *L);
+static int LuaParticleSystemEmit(lua_State *L);
+static int LuaParticleSystemUpdate(lua_State *L);
+static int LuaParticleSystemDraw(lua_State *L);
+static int LuaParticleSystemClear(lua_State *L);
+static int LuaParticleSystemCount(lua_State *L);
+static int LuaParticleSystemGC(lua_State *L);
+
+static int LuaTilemapSetTile(lua_State *L);
+static int LuaTilemapGetTile(lua_State *L);
+static int LuaTilemapSetPosition(lua_State *L);
+static int LuaTilemapGetSize(lua_State *L);
+static int LuaTilemapDraw(lua_State *L);
+static int LuaTilemapGC(lua_State *L);
+
+static int LuaFontLoaderProgress(lua_State *L);
+static int LuaFontLoaderIsReady(lua_State *L);
+static int LuaFontLoaderGC(lua_State *L);
+
+static int LuaTextBufferAppend(lua_State *L);
+static int LuaTextBufferGetLine(lua_State *L);
+static int LuaTextBufferGetLineHeight(lua_State *L);
+static int LuaTextBufferClear(lua_State *L);
+static int LuaTextBufferDraw(lua_State *L);
+static int LuaTextBufferCount(lua_State *L);
+static int LuaTextBufferGC(lua_State *L);
+
+static int LuaTextLayoutSetText(lua_State *L);
+static int LuaTextLayoutSetMaxWidth(lua_State *L);
+static int LuaTextLayoutGetSize(lua_State *L);
+static int LuaTextLayoutGetLine(lua_State *L);
+static int LuaTextLayoutCount(lua_State *L);
+static int LuaTextLayoutGC(lua_State *L);
+
+static int LuaRandomSeed(lua_State *L);
+static int LuaRandomInt(lua_State *L);
+static int LuaRandomFloat(lua_State *L);
+static int LuaRandomGaussian(lua_State *L);
+static int LuaRandomGetState(lua_State *L);
+static int LuaRandomSetState(lua_State *L);
+
+static int LuaTweenSystemAdd(lua_State *L);
+static int LuaTweenSystemCancel(lua_State *L);
+static int LuaTweenSystemIsActive(lua_State *L);
+static int LuaTweenSystemUpdate(lua_State *L);
+static int LuaTweenSystemClear(lua_State *L);
+static int LuaTweenSystemCount(lua_State *L);
+static int LuaTweenSystemGC(lua_State *L);
+
+static void LuaBuildVectorMetatable(lua_State *L, int n);
+static void LuaBuildMatrixMetatable(lua_State *L);
+
+static void RecordModeCommand(int type, const void *params, int size);
+static void RenderQueuePush(CommandList *list, unsigned int textureId, bool barrier);
+static int RenderQueueShaderIndex(const Shader *shader);
+static void RenderQueueFlush(void);
+static void RenderQueueEnd(void);
+static void SpriteBatchSubmit(const SpriteBatch *batch, Vector2 offset);
+static int LuaCommandListCount(lua_State *L);
+static int LuaCommandListGC(lua_State *L);
+
 //----------------------------------------------------------------------------------
 // rlua Helper Functions
 //----------------------------------------------------------------------------------
@@ -237,6 +1096,163 @@ static void* LuaGetArgumentOpaqueTypeWithMetatable(lua_State* L, int index, cons
     return luaL_checkudata(L, index, metatable_name);
 }
 
+//----------------------------------------------------------------------------------
+// Lua memory allocator and allocation-site profiler
+//----------------------------------------------------------------------------------
+
+// Register one sample on profiler, at the allocation site currently running in state
+// NOTE: Coroutines allocations are attributed to the main thread call stack
+static void LuaRegisterAllocSample(AllocProfiler *profiler, lua_State *state, int type, size_t bytes)
+{
+    AllocSite site = { 0 };
+    lua_Debug ar = { 0 };
+
+    strcpy(site.source, "[C]");
+    site.line = -1;
+
+    // Walk the stack until the innermost Lua frame, keeping innermost function name
+    for (int level = 0; lua_getstack(state, level, &ar); level++)
+    {
+        lua_getinfo(state, "Sln", &ar);
+
+        if ((level == 0) && (ar.name != NULL)) strncpy(site.function, ar.name, sizeof(site.function) - 1);
+
+        if (ar.currentline >= 0)
+        {
+            strncpy(site.source, ar.short_src, sizeof(site.source) - 1);
+            site.line = ar.currentline;
+            break;
+        }
+    }
+
+    // FNV-1a hash of site source, line and function
+    unsigned int hash = 2166136261u;
+    for (const char *c = site.source; *c; c++) hash = (hash ^ (unsigned char)*c)*16777619u;
+    for (const char *c = site.function; *c; c++) hash = (hash ^ (unsigned char)*c)*16777619u;
+    hash = (hash ^ (unsigned int)site.line)*16777619u;
+    hash |= 1;
+
+    // Find site slot (open addressing, linear probing)
+    unsigned int index = hash & (RLUA_MAX_ALLOC_SITES - 1);
+
+    for (int probe = 0; probe < RLUA_MAX_ALLOC_SITES; probe++)
+    {
+        AllocSite *slot = &profiler->sites[index];
+
+        if (slot->hash == 0)
+        {
+            site.hash = hash;
+            *slot = site;
+            profiler->sitesCount++;
+        }
+
+        if ((slot->hash == hash) && (slot->line == site.line) &&
+            !strcmp(slot->source, site.source) && !strcmp(slot->function, site.function))
+        {
+            slot->samples++;
+            slot->bytes += bytes;
+            slot->typeBytes[type] += bytes;
+            return;
+        }
+
+        index = (index + 1) & (RLUA_MAX_ALLOC_SITES - 1);
+    }
+
+    profiler->droppedSamples++;
+}
+
+// Lua allocator, it also feeds the allocation-site profiler
+// NOTE: When ptr is NULL, osize contains the Lua type tag of the object being created (variant bits included,
+// i.e. long strings or C closures), ud is the profiler state
+static void *LuaAllocator(void *ud, void *ptr, size_t osize, size_t nsize)
+{
+    AllocProfiler *profiler = (AllocProfiler *)ud;
+
+    if (nsize == 0)
+    {
+        free(ptr);
+        return NULL;
+    }
+
+    size_t growth = (ptr == NULL)? nsize : ((nsize > osize)? (nsize - osize) : 0);
+
+    if (growth > 0)
+    {
+        profiler->allocsCount++;
+        profiler->allocsBytes += growth;
+    }
+
+    // NOTE: Sampling is done before reallocating, Lua stack could be the block being reallocated
+    if (profiler->enabled && (profiler->state != NULL))
+    {
+        profiler->bytesUntilSample -= (long long)growth;
+
+        if ((growth > 0) && (profiler->bytesUntilSample <= 0))
+        {
+            // Big allocations could span several sampling periods
+            long long periods = 1 + (-profiler->bytesUntilSample)/profiler->sampleBytes;
+            int type = ((ptr == NULL) && ((osize & 0x0f) < RLUA_ALLOC_SITE_TYPES - 1))? (int)(osize & 0x0f) : (RLUA_ALLOC_SITE_TYPES - 1);
+
+            profiler->bytesUntilSample += periods*profiler->sampleBytes;
+            LuaRegisterAllocSample(profiler, profiler->state, type, (size_t)(periods*profiler->sampleBytes));
+        }
+    }
+
+    return realloc(ptr, nsize);
+}
+
+// Lua panic function, called on errors outside a protected environment
+static int LuaPanic(lua_State *L)
+{
+    TraceLog(ERROR, "Lua PANIC: unprotected error in call to Lua API (%s)", lua_tostring(L, -1));
+    return 0;
+}
+
+// Compare allocation sites by allocated bytes (descending)
+static int LuaCompareAllocSites(const void *a, const void *b)
+{
+    const AllocSite *siteA = *(const AllocSite **)a;
+    const AllocSite *siteB = *(const AllocSite **)b;
+
+    if (siteA->bytes < siteB->bytes) return 1;
+    else if (siteA->bytes > siteB->bytes) return -1;
+    else return 0;
+}
+
+// Get allocation sites sorted by allocated bytes, returns sites count
+// NOTE: Returned array must be freed by caller
+static int LuaGetTopAllocSites(AllocSite ***sites)
+{
+    int count = 0;
+
+    *sites = (AllocSite **)malloc(RLUA_MAX_ALLOC_SITES*sizeof(AllocSite *));
+
+    if (allocProfiler.sites != NULL)
+    {
+        for (int i = 0; i < RLUA_MAX_ALLOC_SITES; i++)
+        {
+            if (allocProfiler.sites[i].hash != 0) (*sites)[count++] = &allocProfiler.sites[i];
+        }
+    }
+
+    qsort(*sites, count, sizeof(AllocSite *), LuaCompareAllocSites);
+
+    return count;
+}
+
+// Get object type allocating most bytes on a site
+static int LuaGetAllocSiteMainType(const AllocSite *site)
+{
+    int type = 0;
+
+    for (int i = 1; i < RLUA_ALLOC_SITE_TYPES; i++)
+    {
+        if (site->typeBytes[i] > site->typeBytes[type]) type = i;
+    }
+
+    return type;
+}
+
 //----------------------------------------------------------------------------------
 // LuaIndex* functions
 //----------------------------------------------------------------------------------
@@ -294,6 +1310,97 @@ static int LuaIndexFont(lua_State* L)
     return 1;
 }
 
+//----------------------------------------------------------------------------------
+// Typed buffers functions
+//----------------------------------------------------------------------------------
+
+// Push a new typed buffer (zero initialized), returns buffer to be filled
+static TypedBuffer *LuaPushBuffer(lua_State *L, int type, int count)
+{
+    TypedBuffer *buffer = (TypedBuffer *)lua_newuserdata(L, sizeof(TypedBuffer) + count*sizeof(float));
+
+    buffer->type = type;
+    buffer->count = count;
+    buffer->floats = (float *)(buffer + 1);
+    buffer->ints = (int *)(buffer + 1);
+    memset(buffer->floats, 0, count*sizeof(float));
+
+    luaL_setmetatable(L, "Buffer");
+
+    return buffer;
+}
+
+// Get typed buffer argument, checking elements type
+static TypedBuffer *LuaGetArgument_Buffer(lua_State *L, int index, int type)
+{
+    TypedBuffer *buffer = (TypedBuffer *)luaL_checkudata(L, index, "Buffer");
+    luaL_argcheck(L, buffer->type == type, index, (type == BUFFER_FLOAT)? "Expected FloatBuffer" : "Expected IntBuffer");
+    return buffer;
+}
+
+// Create a typed buffer from a size or a table of numbers
+static int LuaCreateBuffer(lua_State *L, int type)
+{
+    if (lua_type(L, 1) == LUA_TTABLE)
+    {
+        int count = (int)luaL_len(L, 1);
+        TypedBuffer *buffer = LuaPushBuffer(L, type, count);
+
+        for (int i = 0; i < count; i++)
+        {
+            lua_geti(L, 1, i + 1);
+            if (type == BUFFER_FLOAT) buffer->floats[i] = (float)luaL_checknumber(L, -1);
+            else buffer->ints[i] = (int)(unsigned int)luaL_checkinteger(L, -1);
+            lua_pop(L, 1);
+        }
+    }
+    else
+    {
+        int count = (int)luaL_checkinteger(L, 1);
+        luaL_argcheck(L, count >= 0, 1, "Expected size >= 0");
+        LuaPushBuffer(L, type, count);
+    }
+
+    return 1;
+}
+
+// Typed buffer element read: buffer[i], 1-based (nil if out of range)
+static int LuaIndexBuffer(lua_State *L)
+{
+    TypedBuffer *buffer = (TypedBuffer *)luaL_checkudata(L, 1, "Buffer");
+    lua_Integer i = luaL_checkinteger(L, 2);
+
+    if ((i < 1) || (i > buffer->count)) return 0;
+
+    if (buffer->type == BUFFER_FLOAT) lua_pushnumber(L, buffer->floats[i - 1]);
+    else LuaPush_int(L, buffer->ints[i - 1]);
+
+    return 1;
+}
+
+// Typed buffer element write: buffer[i] = value, 1-based
+static int LuaNewIndexBuffer(lua_State *L)
+{
+    TypedBuffer *buffer = (TypedBuffer *)luaL_checkudata(L, 1, "Buffer");
+    lua_Integer i = luaL_checkinteger(L, 2);
+
+    luaL_argcheck(L, (i >= 1) && (i <= buffer->count), 2, "Buffer index out of range");
+
+    // NOTE: Integers are stored as 32bit patterns, packed colors like 0xff0000ff are valid
+    if (buffer->type == BUFFER_FLOAT) buffer->floats[i - 1] = (float)luaL_checknumber(L, 3);
+    else buffer->ints[i - 1] = (int)(unsigned int)luaL_checkinteger(L, 3);
+
+    return 0;
+}
+
+// Typed buffer elements count: #buffer
+static int LuaLenBuffer(lua_State *L)
+{
+    TypedBuffer *buffer = (TypedBuffer *)luaL_checkudata(L, 1, "Buffer");
+    LuaPush_int(L, buffer->count);
+    return 1;
+}
+
 static void LuaBuildOpaqueMetatables(void)
 {
     luaL_newmetatable(L, "Image");
@@ -315,15 +1422,186 @@ static void LuaBuildOpaqueMetatables(void)
     lua_pushcfunction(L, &LuaIndexFont);
     lua_setfield(L, -2, "__index");
     lua_pop(L, 1);
+
+    luaL_newmetatable(L, "Buffer");
+    lua_pushcfunction(L, &LuaIndexBuffer);
+    lua_setfield(L, -2, "__index");
+    lua_pushcfunction(L, &LuaNewIndexBuffer);
+    lua_setfield(L, -2, "__newindex");
+    lua_pushcfunction(L, &LuaLenBuffer);
+    lua_setfield(L, -2, "__len");
+    lua_pop(L, 1);
+
+    // SpriteBatch methods are looked up on its own metatable: batch:add(...), batch:flush()
+    luaL_newmetatable(L, "SpriteBatch");
+    lua_pushvalue(L, -1);
+    lua_setfield(L, -2, "__index");
+    lua_pushcfunction(L, &LuaSpriteBatchAdd);
+    lua_setfield(L, -2, "add");
+    lua_pushcfunction(L, &LuaSpriteBatchAddBuffers);
+    lua_setfield(L, -2, "addBuffers");
+    lua_pushcfunction(L, &LuaSpriteBatchFlush);
+    lua_setfield(L, -2, "flush");
+    lua_pushcfunction(L, &LuaSpriteBatchClear);
+    lua_setfield(L, -2, "clear");
+    lua_pushcfunction(L, &LuaSpriteBatchCount);
+    lua_setfield(L, -2, "__len");
+    lua_pushcfunction(L, &LuaSpriteBatchGC);
+    lua_setfield(L, -2, "__gc");
+    lua_pop(L, 1);
+
+    luaL_newmetatable(L, "ParticleSystem");
+    lua_pushvalue(L, -1);
+    lua_setfield(L, -2, "__index");
+    lua_pushcfunction(L, &LuaParticleSystemAddEmitter);
+    lua_setfield(L, -2, "addEmitter");
+    lua_pushcfunction(L, &LuaParticleSystemSetEmitter);
+    lua_setfield(L, -2, "setEmitter");
+    lua_pushcfunction(L, &LuaParticleSystemMoveEmitter);
+    lua_setfield(L, -2, "moveEmitter");
+    lua_pushcfunction(L, &LuaParticleSystemEmit);
+    lua_setfield(L, -2, "emit");
+    lua_pushcfunction(L, &LuaParticleSystemUpdate);
+    lua_setfield(L, -2, "update");
+    lua_pushcfunction(L, &LuaParticleSystemDraw);
+    lua_setfield(L, -2, "draw");
+    lua_pushcfunction(L, &LuaParticleSystemClear);
+    lua_setfield(L, -2, "clear");
+    lua_pushcfunction(L, &LuaParticleSystemCount);
+    lua_setfield(L, -2, "__len");
+    lua_pushcfunction(L, &LuaParticleSystemGC);
+    lua_setfield(L, -2, "__gc");
+    lua_pop(L, 1);
+
+    luaL_newmetatable(L, "Tilemap");
+    lua_pushvalue(L, -1);
+    lua_setfield(L, -2, "__index");
+    lua_pushcfunction(L, &LuaTilemapSetTile);
+    lua_setfield(L, -2, "setTile");
+    lua_pushcfunction(L, &LuaTilemapGetTile);
+    lua_setfield(L, -2, "getTile");
+    lua_pushcfunction(L, &LuaTilemapSetPosition);
+    lua_setfield(L, -2, "setPosition");
+    lua_pushcfunction(L, &LuaTilemapGetSize);
+    lua_setfield(L, -2, "getSize");
+    lua_pushcfunction(L, &LuaTilemapDraw);
+    lua_setfield(L, -2, "draw");
+    lua_pushcfunction(L, &LuaTilemapGC);
+    lua_setfield(L, -2, "__gc");
+    lua_pop(L, 1);
+
+    luaL_newmetatable(L, "FontLoader");
+    lua_pushvalue(L, -1);
+    lua_setfield(L, -2, "__index");
+    lua_pushcfunction(L, &LuaFontLoaderProgress);
+    lua_setfield(L, -2, "progress");
+    lua_pushcfunction(L, &LuaFontLoaderIsReady);
+    lua_setfield(L, -2, "isReady");
+    lua_pushcfunction(L, &LuaFontLoaderGC);
+    lua_setfield(L, -2, "__gc");
+    lua_pop(L, 1);
+
+    luaL_newmetatable(L, "TextBuffer");
+    lua_pushvalue(L, -1);
+    lua_setfield(L, -2, "__index");
+    lua_pushcfunction(L, &LuaTextBufferAppend);
+    lua_setfield(L, -2, "append");
+    lua_pushcfunction(L, &LuaTextBufferGetLine);
+    lua_setfield(L, -2, "getLine");
+    lua_pushcfunction(L, &LuaTextBufferGetLineHeight);
+    lua_setfield(L, -2, "getLineHeight");
+    lua_pushcfunction(L, &LuaTextBufferClear);
+    lua_setfield(L, -2, "clear");
+    lua_pushcfunction(L, &LuaTextBufferDraw);
+    lua_setfield(L, -2, "draw");
+    lua_pushcfunction(L, &LuaTextBufferCount);
+    lua_setfield(L, -2, "__len");
+    lua_pushcfunction(L, &LuaTextBufferGC);
+    lua_setfield(L, -2, "__gc");
+    lua_pop(L, 1);
+
+    luaL_newmetatable(L, "TextLayout");
+    lua_pushvalue(L, -1);
+    lua_setfield(L, -2, "__index");
+    lua_pushcfunction(L, &LuaTextLayoutSetText);
+    lua_setfield(L, -2, "setText");
+    lua_pushcfunction(L, &LuaTextLayoutSetMaxWidth);
+    lua_setfield(L, -2, "setMaxWidth");
+    lua_pushcfunction(L, &LuaTextLayoutGetSize);
+    lua_setfield(L, -2, "getSize");
+    lua_pushcfunction(L, &LuaTextLayoutGetLine);
+    lua_setfield(L, -2, "getLine");
+    lua_pushcfunction(L, &LuaTextLayoutCount);
+    lua_setfield(L, -2, "__len");
+    lua_pushcfunction(L, &LuaTextLayoutGC);
+    lua_setfield(L, -2, "__gc");
+    lua_pop(L, 1);
+
+    luaL_newmetatable(L, "Random");
+    lua_pushvalue(L, -1);
+    lua_setfield(L, -2, "__index");
+    lua_pushcfunction(L, &LuaRandomSeed);
+    lua_setfield(L, -2, "seed");
+    lua_pushcfunction(L, &LuaRandomInt);
+    lua_setfield(L, -2, "int");
+    lua_pushcfunction(L, &LuaRandomFloat);
+    lua_setfield(L, -2, "float");
+    lua_pushcfunction(L, &LuaRandomGaussian);
+    lua_setfield(L, -2, "gaussian");
+    lua_pushcfunction(L, &LuaRandomGetState);
+    lua_setfield(L, -2, "getState");
+    lua_pushcfunction(L, &LuaRandomSetState);
+    lua_setfield(L, -2, "setState");
+    lua_pop(L, 1);
+
+    luaL_newmetatable(L, "TweenSystem");
+    lua_pushvalue(L, -1);
+    lua_setfield(L, -2, "__index");
+    lua_pushcfunction(L, &LuaTweenSystemAdd);
+    lua_setfield(L, -2, "add");
+    lua_pushcfunction(L, &LuaTweenSystemCancel);
+    lua_setfield(L, -2, "cancel");
+    lua_pushcfunction(L, &LuaTweenSystemIsActive);
+    lua_setfield(L, -2, "isActive");
+    lua_pushcfunction(L, &LuaTweenSystemUpdate);
+    lua_setfield(L, -2, "update");
+    lua_pushcfunction(L, &LuaTweenSystemClear);
+    lua_setfield(L, -2, "clear");
+    lua_pushcfunction(L, &LuaTweenSystemCount);
+    lua_setfield(L, -2, "__len");
+    lua_pushcfunction(L, &LuaTweenSystemGC);
+    lua_setfield(L, -2, "__gc");
+    lua_pop(L, 1);
+
+    LuaBuildVectorMetatable(L, 2);
+    LuaBuildVectorMetatable(L, 3);
+    LuaBuildVectorMetatable(L, 4);
+    LuaBuildMatrixMetatable(L);
+
+    luaL_newmetatable(L, "CommandList");
+    lua_pushcfunction(L, &LuaCommandListCount);
+    lua_setfield(L, -2, "__len");
+    lua_pushcfunction(L, &LuaCommandListGC);
+    lua_setfield(L, -2, "__gc");
+    lua_pop(L, 1);
 }
 
 //----------------------------------------------------------------------------------
 // LuaGetArgument functions
 //----------------------------------------------------------------------------------
 
+// Vector fields type: table or vector userdata
+static bool LuaIsVectorType(int type)
+{
+    return (type == LUA_TTABLE) || (type == LUA_TUSERDATA);
+}
+
 // Vector2 type
 static Vector2 LuaGetArgument_Vector2(lua_State *L, int index)
 {
+    Vector2 *vector = (Vector2 *)luaL_testudata(L, index, "Vector2");
+    if (vector != NULL) return *vector;
+
     Vector2 result = { 0 };
     index = lua_absindex(L, index); // Makes sure we use absolute indices because we push multiple values
     luaL_argcheck(L, lua_getfield(L, index, "x") == LUA_TNUMBER, index, "Expected Vector2.x");
@@ -337,6 +1615,9 @@ static Vector2 LuaGetArgument_Vector2(lua_State *L, int index)
 // Vector3 type
 static Vector3 LuaGetArgument_Vector3(lua_State *L, int index)
 {
+    Vector3 *vector = (Vector3 *)luaL_testudata(L, index, "Vector3");
+    if (vector != NULL) return *vector;
+
     Vector3 result = { 0 };
     index = lua_absindex(L, index); // Makes sure we use absolute indices because we push multiple values
     luaL_argcheck(L, lua_getfield(L, index, "x") == LUA_TNUMBER, index, "Expected Vector3.x");
@@ -368,6 +1649,9 @@ static Vector4 LuaGetArgument_Vector4(lua_State *L, int index)
 
 static Quaternion LuaGetArgument_Quaternion(lua_State* L, int index)
 {
+    Quaternion *quaternion = (Quaternion *)luaL_testudata(L, index, "Quaternion");
+    if (quaternion != NULL) return *quaternion;
+
     Quaternion result = { 0 };
     index = lua_absindex(L, index); // Makes sure we use absolute indices because we push multiple values
     luaL_argcheck(L, lua_getfield(L, index, "x") == LUA_TNUMBER, index, "Expected Quaternion.x");
@@ -385,6 +1669,9 @@ static Quaternion LuaGetArgument_Quaternion(lua_State* L, int index)
 // Matrix type
 static Matrix LuaGetArgument_Matrix(lua_State* L, int index)
 {
+    Matrix *matrix = (Matrix *)luaL_testudata(L, index, "Matrix");
+    if (matrix != NULL) return *matrix;
+
     Matrix result = { 0 };
     float* ptr = &result.m0;
     index = lua_absindex(L, index); // Makes sure we use absolute indices because we push multiple values
@@ -466,11 +1753,11 @@ static Camera LuaGetArgument_Camera(lua_State *L, int index)
 {
     Camera result = { 0 };
     index = lua_absindex(L, index); // Makes sure we use absolute indices because we push multiple values
-    luaL_argcheck(L, lua_getfield(L, index, "position") == LUA_TNUMBER, index, "Expected Camera.position");
+    luaL_argcheck(L, LuaIsVectorType(lua_getfield(L, index, "position")), index, "Expected Camera.position");
     result.position = LuaGetArgument_Vector3(L, -1);
-    luaL_argcheck(L, lua_getfield(L, index, "target") == LUA_TNUMBER, index, "Expected Camera.target");
+    luaL_argcheck(L, LuaIsVectorType(lua_getfield(L, index, "target")), index, "Expected Camera.target");
     result.target = LuaGetArgument_Vector3(L, -1);
-    luaL_argcheck(L, lua_getfield(L, index, "up") == LUA_TNUMBER, index, "Expected Camera.up");
+    luaL_argcheck(L, LuaIsVectorType(lua_getfield(L, index, "up")), index, "Expected Camera.up");
     result.up = LuaGetArgument_Vector3(L, -1);
     luaL_argcheck(L, lua_getfield(L, index, "fovy") == LUA_TNUMBER, index, "Expected Camera.fovy");
     result.fovy = LuaGetArgument_float(L, -1);
@@ -485,9 +1772,9 @@ static Camera2D LuaGetArgument_Camera2D(lua_State *L, int index)
 {
     Camera2D result = { 0 };
     index = lua_absindex(L, index); // Makes sure we use absolute indices because we push multiple values
-    luaL_argcheck(L, lua_getfield(L, index, "offset") == LUA_TNUMBER, index, "Expected Camera2D.offset");
+    luaL_argcheck(L, LuaIsVectorType(lua_getfield(L, index, "offset")), index, "Expected Camera2D.offset");
     result.offset = LuaGetArgument_Vector2(L, -1);
-    luaL_argcheck(L, lua_getfield(L, index, "target") == LUA_TNUMBER, index, "Expected Camera2D.target");
+    luaL_argcheck(L, LuaIsVectorType(lua_getfield(L, index, "target")), index, "Expected Camera2D.target");
     result.target = LuaGetArgument_Vector2(L, -1);
     luaL_argcheck(L, lua_getfield(L, index, "rotation") == LUA_TNUMBER, index, "Expected Camera2D.rotation");
     result.rotation = LuaGetArgument_float(L, -1);
@@ -502,9 +1789,9 @@ static BoundingBox LuaGetArgument_BoundingBox(lua_State *L, int index)
 {
     BoundingBox result = { 0 };
     index = lua_absindex(L, index); // Makes sure we use absolute indices because we push multiple values
-    luaL_argcheck(L, lua_getfield(L, index, "min") == LUA_TNUMBER, index, "Expected BoundingBox.min");
+    luaL_argcheck(L, LuaIsVectorType(lua_getfield(L, index, "min")), index, "Expected BoundingBox.min");
     result.min = LuaGetArgument_Vector3(L, -1);
-    luaL_argcheck(L, lua_getfield(L, index, "max") == LUA_TNUMBER, index, "Expected BoundingBox.max");
+    luaL_argcheck(L, LuaIsVectorType(lua_getfield(L, index, "max")), index, "Expected BoundingBox.max");
     result.max = LuaGetArgument_Vector3(L, -1);
     lua_pop(L, 2);
     return result;
@@ -712,16 +1999,12 @@ static void LuaPush_Quaternion(lua_State* L, Quaternion vec)
     lua_setfield(L, -2, "w");
 }
 
+// NOTE: Matrix is pushed as userdata, indexed as the 16 numbers table it replaces (see Matrix userdata)
 static void LuaPush_Matrix(lua_State* L, Matrix *matrix)
 {
-    int i;
-    lua_createtable(L, 16, 0);
-    float* num = (&matrix->m0);
-    for (i = 0; i < 16; i++)
-    {
-        LuaPush_float(L, num[i]);
-        lua_rawseti(L, -2, i + 1);
-    }
+    Matrix *result = (Matrix *)lua_newuserdata(L, sizeof(Matrix));
+    *result = *matrix;
+    luaL_setmetatable(L, "Matrix");
 }
 
 static void LuaPush_Rectangle(lua_State* L, Rectangle rect)
@@ -838,15 +2121,20 @@ static int lua_Color(lua_State* L)
     return 1;
 }
 
+// NOTE: Vector2, Vector3 and Quaternion are userdata with arithmetic metamethods (see Vector userdata)
 static int lua_Vector2(lua_State* L)
 {
-    LuaPush_Vector2(L, (Vector2) { (float)luaL_checknumber(L, 1), (float)luaL_checknumber(L, 2) });
+    Vector2 *vector = (Vector2 *)lua_newuserdata(L, sizeof(Vector2));
+    *vector = (Vector2) { (float)luaL_checknumber(L, 1), (float)luaL_checknumber(L, 2) };
+    luaL_setmetatable(L, "Vector2");
     return 1;
 }
 
 static int lua_Vector3(lua_State* L)
 {
-    LuaPush_Vector3(L, (Vector3) { (float)luaL_checknumber(L, 1), (float)luaL_checknumber(L, 2), (float)luaL_checknumber(L, 3) });
+    Vector3 *vector = (Vector3 *)lua_newuserdata(L, sizeof(Vector3));
+    *vector = (Vector3) { (float)luaL_checknumber(L, 1), (float)luaL_checknumber(L, 2), (float)luaL_checknumber(L, 3) };
+    luaL_setmetatable(L, "Vector3");
     return 1;
 }
 
@@ -858,7 +2146,25 @@ static int lua_Vector4(lua_State* L)
 
 static int lua_Quaternion(lua_State* L)
 {
-    LuaPush_Quaternion(L, (Quaternion) { (float)luaL_checknumber(L, 1), (float)luaL_checknumber(L, 2), (float)luaL_checknumber(L, 3), (float)luaL_checknumber(L, 4) });
+    Quaternion *quaternion = (Quaternion *)lua_newuserdata(L, sizeof(Quaternion));
+    *quaternion = (Quaternion) { (float)luaL_checknumber(L, 1), (float)luaL_checknumber(L, 2), (float)luaL_checknumber(L, 3), (float)luaL_checknumber(L, 4) };
+    luaL_setmetatable(L, "Quaternion");
+    return 1;
+}
+
+// Matrix() -> identity, Matrix(values) -> from table of 16 numbers, Matrix(m0, m4, m8, m12, m1...) -> from 16 numbers
+static int lua_Matrix(lua_State* L)
+{
+    Matrix result = MatrixIdentity();
+    float *values = &result.m0;
+
+    if (lua_type(L, 1) == LUA_TTABLE) result = LuaGetArgument_Matrix(L, 1);
+    else if (!lua_isnone(L, 1))
+    {
+        for (int i = 0; i < 16; i++) values[i] = LuaGetArgument_float(L, i + 1);
+    }
+
+    LuaPush_Matrix(L, &result);
     return 1;
 }
 
@@ -914,6 +2220,17 @@ static int lua_Camera2D(lua_State* L)
     return 1;
 }
 
+// Typed buffers: FloatBuffer(size) or FloatBuffer({ ... }), IntBuffer(size) or IntBuffer({ ... })
+static int lua_FloatBuffer(lua_State* L)
+{
+    return LuaCreateBuffer(L, BUFFER_FLOAT);
+}
+
+static int lua_IntBuffer(lua_State* L)
+{
+    return LuaCreateBuffer(L, BUFFER_INT);
+}
+
 /*************************************************************************************
 *
 *  raylib Lua Functions Bindings
@@ -1081,7 +2398,8 @@ int lua_DisableCursor(lua_State *L)
 int lua_ClearBackground(lua_State *L)
 {
     Color color = LuaGetArgument_Color(L, 1);
-    ClearBackground(color);
+    if (recordingList != NULL) RecordModeCommand(COMMAND_CLEAR_BACKGROUND, &color, sizeof(Color));
+    else ClearBackground(color);
     return 0;
 }
 
@@ -1095,7 +2413,10 @@ int lua_BeginDrawing(lua_State *L)
 // End canvas drawing and swap buffers (double buffering)
 int lua_EndDrawing(lua_State *L)
 {
+    if (renderQueue.active) RenderQueueEnd();
     EndDrawing();
+    dynamicFontsFrame++;
+    if (allocProfiler.enabled) allocProfiler.frames++;
     return 0;
 }
 
@@ -1103,14 +2424,16 @@ int lua_EndDrawing(lua_State *L)
 int lua_BeginMode2D(lua_State *L)
 {
     Camera2D camera = LuaGetArgument_Camera2D(L, 1);
-    BeginMode2D(camera);
+    if (recordingList != NULL) RecordModeCommand(COMMAND_BEGIN_MODE_2D, &camera, sizeof(Camera2D));
+    else BeginMode2D(camera);
     return 0;
 }
 
 // Ends 2D mode with custom camera
 int lua_EndMode2D(lua_State *L)
 {
-    EndMode2D();
+    if (recordingList != NULL) RecordModeCommand(COMMAND_END_MODE_2D, NULL, 0);
+    else EndMode2D();
     return 0;
 }
 
@@ -1118,14 +2441,16 @@ int lua_EndMode2D(lua_State *L)
 int lua_BeginMode3D(lua_State *L)
 {
     Camera3D camera = LuaGetArgument_Camera3D(L, 1);
-    BeginMode3D(camera);
+    if (recordingList != NULL) RecordModeCommand(COMMAND_BEGIN_MODE_3D, &camera, sizeof(Camera3D));
+    else BeginMode3D(camera);
     return 0;
 }
 
 // Ends 3D mode and returns to default 2D orthographic mode
 int lua_EndMode3D(lua_State *L)
 {
-    EndMode3D();
+    if (recordingList != NULL) RecordModeCommand(COMMAND_END_MODE_3D, NULL, 0);
+    else EndMode3D();
     return 0;
 }
 
@@ -1133,14 +2458,16 @@ int lua_EndMode3D(lua_State *L)
 int lua_BeginTextureMode(lua_State *L)
 {
     RenderTexture2D target = LuaGetArgument_RenderTexture2D(L, 1);
-    BeginTextureMode(target);
+    if (recordingList != NULL) RecordModeCommand(COMMAND_BEGIN_TEXTURE_MODE, &target, sizeof(RenderTexture2D));
+    else BeginTextureMode(target);
     return 0;
 }
 
 // Ends drawing to render texture
 int lua_EndTextureMode(lua_State *L)
 {
-    EndTextureMode();
+    if (recordingList != NULL) RecordModeCommand(COMMAND_END_TEXTURE_MODE, NULL, 0);
+    else EndTextureMode();
     return 0;
 }
 
@@ -1203,7 +2530,7 @@ int lua_GetFrameTime(lua_State *L)
 int lua_GetTime(lua_State *L)
 {
     double result = GetTime();
-    LuaPush_double(L, result);
+    lua_pushnumber(L, result);
     return 1;
 }
 
@@ -1355,23 +2682,14 @@ int lua_MatrixToFloat(lua_State* L)
 }
 */
 
-// WARNING: Show trace log messages (INFO, WARNING, ERROR, DEBUG)
+// Show trace log messages (INFO, WARNING, ERROR, DEBUG)
+// NOTE: Format conversions as string.format(), formatted into a stack buffer (no Lua strings created)
 int lua_TraceLog(lua_State* L)
 {
-    int num_args = lua_gettop(L) - 1;
+    char buffer[RLUA_TEXT_FORMAT_SIZE];
     int arg1 = LuaGetArgument_int(L, 1);
-
-    /// type, fmt, args...
-
-    lua_rotate(L, 1, -1); /// fmt, args..., type
-    lua_pop(L, 1); /// fmt, args...
-
-    lua_getglobal(L, "string"); /// fmt, args..., [string]
-    lua_getfield(L, 1, "format"); /// fmt, args..., [string], format()
-    lua_rotate(L, 1, 2); /// [string], format(), fmt, args...
-    lua_call(L, num_args, 1); /// [string], formatted_string
-
-    TraceLog(arg1, "%s", luaL_checkstring(L,-1));
+    const char *arg2 = LuaGetArgument_string(L, 2);
+    TraceLog(arg1, "%s", LuaFormatText(L, arg2, 3, buffer, RLUA_TEXT_FORMAT_SIZE));
     return 0;
 }
 
@@ -1893,2940 +3211,8480 @@ int lua_SetCameraMoveControls(lua_State *L)
 }
 
 //------------------------------------------------------------------------------------
-// raylib [shapes] module functions - Basic Shapes Drawing
+// raylib-lua [core] module functions - Random streams
 //------------------------------------------------------------------------------------
 
-// Draw a pixel
-int lua_DrawPixel(lua_State *L)
+// Next 32bit random number (PCG32, XSH RR output)
+static unsigned int RandomNext(RandomStream *rng)
 {
-    int posX = LuaGetArgument_int(L, 1);
-    int posY = LuaGetArgument_int(L, 2);
-    Color color = LuaGetArgument_Color(L, 3);
-    DrawPixel(posX, posY, color);
-    return 0;
+    unsigned long long state = rng->state;
+    rng->state = state*6364136223846793005ULL + rng->increment;
+
+    unsigned int xorshifted = (unsigned int)(((state >> 18) ^ state) >> 27);
+    unsigned int rotation = (unsigned int)(state >> 59);
+
+    return (xorshifted >> rotation) | (xorshifted << ((-rotation) & 31));
 }
 
-// Draw a pixel (Vector version)
-int lua_DrawPixelV(lua_State *L)
+// Seed random stream, streams with same seed and different stream id give independent sequences
+static void RandomSeed(RandomStream *rng, unsigned long long seed, unsigned long long stream)
 {
-    Vector2 position = LuaGetArgument_Vector2(L, 1);
-    Color color = LuaGetArgument_Color(L, 2);
-    DrawPixelV(position, color);
-    return 0;
+    rng->state = 0;
+    rng->increment = (stream << 1) | 1;
+    RandomNext(rng);
+    rng->state += seed;
+    RandomNext(rng);
 }
 
-// Draw a line
-int lua_DrawLine(lua_State *L)
+// Random integer in [min, max] (both included), without modulo bias (Lemire's method)
+static int RandomInt(RandomStream *rng, int min, int max)
 {
-    int startPosX = LuaGetArgument_int(L, 1);
-    int startPosY = LuaGetArgument_int(L, 2);
-    int endPosX = LuaGetArgument_int(L, 3);
-    int endPosY = LuaGetArgument_int(L, 4);
-    Color color = LuaGetArgument_Color(L, 5);
-    DrawLine(startPosX, startPosY, endPosX, endPosY, color);
-    return 0;
-}
+    if (min > max) { int tmp = max; max = min; min = tmp; }
 
-// Draw a line (Vector version)
-int lua_DrawLineV(lua_State *L)
-{
-    Vector2 startPos = LuaGetArgument_Vector2(L, 1);
-    Vector2 endPos = LuaGetArgument_Vector2(L, 2);
-    Color color = LuaGetArgument_Color(L, 3);
-    DrawLineV(startPos, endPos, color);
-    return 0;
-}
+    unsigned int range = (unsigned int)max - (unsigned int)min + 1;     // 0 for full 32bit range
+    if (range == 0) return (int)RandomNext(rng);
 
-// Draw a line defining thickness
-int lua_DrawLineEx(lua_State *L)
-{
-    Vector2 startPos = LuaGetArgument_Vector2(L, 1);
-    Vector2 endPos = LuaGetArgument_Vector2(L, 2);
-    float thick = LuaGetArgument_float(L, 3);
-    Color color = LuaGetArgument_Color(L, 4);
-    DrawLineEx(startPos, endPos, thick, color);
-    return 0;
+    unsigned long long product = (unsigned long long)RandomNext(rng)*range;
+
+    if ((unsigned int)product < range)
+    {
+        unsigned int threshold = (0u - range)%range;
+        while ((unsigned int)product < threshold) product = (unsigned long long)RandomNext(rng)*range;
+    }
+
+    return (int)((unsigned int)min + (unsigned int)(product >> 32));
 }
 
-// Draw a line using cubic-bezier curves in-out
-int lua_DrawLineBezier(lua_State *L)
+// Random float in [0, 1), 24 bits of precision
+static float RandomFloat(RandomStream *rng)
 {
-    Vector2 startPos = LuaGetArgument_Vector2(L, 1);
-    Vector2 endPos = LuaGetArgument_Vector2(L, 2);
-    float thick = LuaGetArgument_float(L, 3);
-    Color color = LuaGetArgument_Color(L, 4);
-    DrawLineBezier(startPos, endPos, thick, color);
-    return 0;
+    return (float)(RandomNext(rng) >> 8)*(1.0f/16777216.0f);
 }
 
-// Draw a color-filled circle
-int lua_DrawCircle(lua_State *L)
+// Pair of standard normal distributed floats (Box-Muller transform)
+static void RandomGaussianPair(RandomStream *rng, float *a, float *b)
 {
-    int centerX = LuaGetArgument_int(L, 1);
-    int centerY = LuaGetArgument_int(L, 2);
-    float radius = LuaGetArgument_float(L, 3);
-    Color color = LuaGetArgument_Color(L, 4);
-    DrawCircle(centerX, centerY, radius, color);
-    return 0;
+    float u = (float)((RandomNext(rng) >> 8) + 1)*(1.0f/16777216.0f);     // (0, 1], log(u) defined
+    float radius = sqrtf(-2.0f*logf(u));
+    float angle = 2.0f*PI*RandomFloat(rng);
+
+    *a = radius*cosf(angle);
+    *b = radius*sinf(angle);
 }
 
-// Draw a gradient-filled circle
-int lua_DrawCircleGradient(lua_State *L)
+// Get random stream argument
+static RandomStream *LuaGetArgument_RandomStream(lua_State *L, int index)
 {
-    int centerX = LuaGetArgument_int(L, 1);
-    int centerY = LuaGetArgument_int(L, 2);
-    float radius = LuaGetArgument_float(L, 3);
-    Color color1 = LuaGetArgument_Color(L, 4);
-    Color color2 = LuaGetArgument_Color(L, 5);
-    DrawCircleGradient(centerX, centerY, radius, color1, color2);
-    return 0;
+    return (RandomStream *)luaL_checkudata(L, index, "Random");
 }
 
-// Draw a color-filled circle (Vector version)
-int lua_DrawCircleV(lua_State *L)
+// Create a random stream: Random([seed[, stream]]), seed defaults to current time
+// NOTE: Streams are not shared, use one stream per worker (stream id) for reproducible parallel generation
+int lua_Random(lua_State *L)
 {
-    Vector2 center = LuaGetArgument_Vector2(L, 1);
-    float radius = LuaGetArgument_float(L, 2);
-    Color color = LuaGetArgument_Color(L, 3);
-    DrawCircleV(center, radius, color);
-    return 0;
+    lua_Integer seed = lua_isnoneornil(L, 1)? (lua_Integer)time(NULL) : luaL_checkinteger(L, 1);
+    lua_Integer stream = luaL_optinteger(L, 2, 0);
+
+    RandomStream *rng = (RandomStream *)lua_newuserdata(L, sizeof(RandomStream));
+    luaL_setmetatable(L, "Random");
+    RandomSeed(rng, (unsigned long long)seed, (unsigned long long)stream);
+
+    return 1;
 }
 
-// Draw circle outline
-int lua_DrawCircleLines(lua_State *L)
+// Reset stream sequence: rng:seed(seed[, stream])
+static int LuaRandomSeed(lua_State *L)
 {
-    int centerX = LuaGetArgument_int(L, 1);
-    int centerY = LuaGetArgument_int(L, 2);
-    float radius = LuaGetArgument_float(L, 3);
-    Color color = LuaGetArgument_Color(L, 4);
-    DrawCircleLines(centerX, centerY, radius, color);
+    RandomStream *rng = LuaGetArgument_RandomStream(L, 1);
+    RandomSeed(rng, (unsigned long long)luaL_checkinteger(L, 2), (unsigned long long)luaL_optinteger(L, 3, 0));
     return 0;
 }
 
-// Draw a color-filled rectangle
-int lua_DrawRectangle(lua_State *L)
+// Random integer in [min, max] (both included): rng:int(min, max)
+static int LuaRandomInt(lua_State *L)
 {
-    int posX = LuaGetArgument_int(L, 1);
-    int posY = LuaGetArgument_int(L, 2);
-    int width = LuaGetArgument_int(L, 3);
-    int height = LuaGetArgument_int(L, 4);
-    Color color = LuaGetArgument_Color(L, 5);
-    DrawRectangle(posX, posY, width, height, color);
-    return 0;
+    RandomStream *rng = LuaGetArgument_RandomStream(L, 1);
+    LuaPush_int(L, RandomInt(rng, LuaGetArgument_int(L, 2), LuaGetArgument_int(L, 3)));
+    return 1;
 }
 
-// Draw a color-filled rectangle (Vector version)
-int lua_DrawRectangleV(lua_State *L)
+// Random float in [min, max), [0, 1) by default: rng:float([min, max])
+static int LuaRandomFloat(lua_State *L)
 {
-    Vector2 position = LuaGetArgument_Vector2(L, 1);
-    Vector2 size = LuaGetArgument_Vector2(L, 2);
-    Color color = LuaGetArgument_Color(L, 3);
-    DrawRectangleV(position, size, color);
-    return 0;
+    RandomStream *rng = LuaGetArgument_RandomStream(L, 1);
+    float min = (float)luaL_optnumber(L, 2, 0.0);
+    float max = (float)luaL_optnumber(L, 3, 1.0);
+
+    LuaPush_float(L, min + (max - min)*RandomFloat(rng));
+    return 1;
 }
 
-// Draw a color-filled rectangle
-int lua_DrawRectangleRec(lua_State *L)
+// Normal distributed random float: rng:gaussian([mean[, deviation]]), standard normal by default
+static int LuaRandomGaussian(lua_State *L)
 {
-    Rectangle rec = LuaGetArgument_Rectangle(L, 1);
-    Color color = LuaGetArgument_Color(L, 2);
-    DrawRectangleRec(rec, color);
-    return 0;
+    RandomStream *rng = LuaGetArgument_RandomStream(L, 1);
+    float mean = (float)luaL_optnumber(L, 2, 0.0);
+    float deviation = (float)luaL_optnumber(L, 3, 1.0);
+    float value = 0.0f, unused = 0.0f;
+
+    RandomGaussianPair(rng, &value, &unused);
+
+    LuaPush_float(L, mean + deviation*value);
+    return 1;
 }
 
-// Draw a color-filled rectangle with pro parameters
-int lua_DrawRectanglePro(lua_State *L)
+// Get stream state (replay): rng:getState() -> state, increment
+static int LuaRandomGetState(lua_State *L)
 {
-    Rectangle rec = LuaGetArgument_Rectangle(L, 1);
-    Vector2 origin = LuaGetArgument_Vector2(L, 2);
-    float rotation = LuaGetArgument_float(L, 3);
-    Color color = LuaGetArgument_Color(L, 4);
-    DrawRectanglePro(rec, origin, rotation, color);
-    return 0;
+    RandomStream *rng = LuaGetArgument_RandomStream(L, 1);
+    lua_pushinteger(L, (lua_Integer)rng->state);
+    lua_pushinteger(L, (lua_Integer)rng->increment);
+    return 2;
 }
 
-// Draw a vertical-gradient-filled rectangle
-int lua_DrawRectangleGradientV(lua_State *L)
+// Restore stream state returned by rng:getState(): rng:setState(state, increment)
+static int LuaRandomSetState(lua_State *L)
 {
-    int posX = LuaGetArgument_int(L, 1);
-    int posY = LuaGetArgument_int(L, 2);
-    int width = LuaGetArgument_int(L, 3);
-    int height = LuaGetArgument_int(L, 4);
-    Color color1 = LuaGetArgument_Color(L, 5);
-    Color color2 = LuaGetArgument_Color(L, 6);
-    DrawRectangleGradientV(posX, posY, width, height, color1, color2);
+    RandomStream *rng = LuaGetArgument_RandomStream(L, 1);
+    rng->state = (unsigned long long)luaL_checkinteger(L, 2);
+    rng->increment = (unsigned long long)luaL_checkinteger(L, 3) | 1;
     return 0;
 }
 
-// Draw a horizontal-gradient-filled rectangle
-int lua_DrawRectangleGradientH(lua_State *L)
+// Fill IntBuffer with random integers in [min, max] (both included): FillRandomInts(rng, buffer, min, max)
+int lua_FillRandomInts(lua_State *L)
 {
-    int posX = LuaGetArgument_int(L, 1);
-    int posY = LuaGetArgument_int(L, 2);
-    int width = LuaGetArgument_int(L, 3);
-    int height = LuaGetArgument_int(L, 4);
-    Color color1 = LuaGetArgument_Color(L, 5);
-    Color color2 = LuaGetArgument_Color(L, 6);
-    DrawRectangleGradientH(posX, posY, width, height, color1, color2);
+    RandomStream *rng = LuaGetArgument_RandomStream(L, 1);
+    TypedBuffer *buffer = LuaGetArgument_Buffer(L, 2, BUFFER_INT);
+    int min = LuaGetArgument_int(L, 3);
+    int max = LuaGetArgument_int(L, 4);
+
+    // NOTE: Local copy of stream state, kept in a register along the loop
+    RandomStream stream = *rng;
+    for (int i = 0; i < buffer->count; i++) buffer->ints[i] = RandomInt(&stream, min, max);
+    *rng = stream;
+
     return 0;
 }
 
-// Draw a gradient-filled rectangle with custom vertex colors
-int lua_DrawRectangleGradientEx(lua_State *L)
+// Fill FloatBuffer with random floats in [min, max), [0, 1) by default: FillRandomFloats(rng, buffer[, min, max])
+int lua_FillRandomFloats(lua_State *L)
 {
-    Rectangle rec = LuaGetArgument_Rectangle(L, 1);
-    Color col1 = LuaGetArgument_Color(L, 2);
-    Color col2 = LuaGetArgument_Color(L, 3);
-    Color col3 = LuaGetArgument_Color(L, 4);
-    Color col4 = LuaGetArgument_Color(L, 5);
-    DrawRectangleGradientEx(rec, col1, col2, col3, col4);
+    RandomStream *rng = LuaGetArgument_RandomStream(L, 1);
+    TypedBuffer *buffer = LuaGetArgument_Buffer(L, 2, BUFFER_FLOAT);
+    float min = (float)luaL_optnumber(L, 3, 0.0);
+    float range = (float)luaL_optnumber(L, 4, 1.0) - min;
+
+    RandomStream stream = *rng;
+    for (int i = 0; i < buffer->count; i++) buffer->floats[i] = min + range*RandomFloat(&stream);
+    *rng = stream;
+
     return 0;
 }
 
-// Draw rectangle outline
-int lua_DrawRectangleLines(lua_State *L)
+// Fill FloatBuffer with normal distributed floats: FillRandomGaussian(rng, buffer[, mean[, deviation]])
+int lua_FillRandomGaussian(lua_State *L)
 {
-    int posX = LuaGetArgument_int(L, 1);
-    int posY = LuaGetArgument_int(L, 2);
-    int width = LuaGetArgument_int(L, 3);
-    int height = LuaGetArgument_int(L, 4);
-    Color color = LuaGetArgument_Color(L, 5);
-    DrawRectangleLines(posX, posY, width, height, color);
+    RandomStream *rng = LuaGetArgument_RandomStream(L, 1);
+    TypedBuffer *buffer = LuaGetArgument_Buffer(L, 2, BUFFER_FLOAT);
+    float mean = (float)luaL_optnumber(L, 3, 0.0);
+    float deviation = (float)luaL_optnumber(L, 4, 1.0);
+
+    RandomStream stream = *rng;
+    float a = 0.0f, b = 0.0f;
+
+    // Both Box-Muller values are used, last one dropped for odd counts
+    for (int i = 0; i < buffer->count; i += 2)
+    {
+        RandomGaussianPair(&stream, &a, &b);
+        buffer->floats[i] = mean + deviation*a;
+        if (i + 1 < buffer->count) buffer->floats[i + 1] = mean + deviation*b;
+    }
+
+    *rng = stream;
+
     return 0;
 }
 
-// Draw rectangle outline with extended parameters
-int lua_DrawRectangleLinesEx(lua_State *L)
+//------------------------------------------------------------------------------------
+// raylib-lua [core] module functions - Draw command lists (recording and replay)
+//------------------------------------------------------------------------------------
+
+// Reserve command list data capacity (bytes)
+static void CommandListReserve(CommandList *list, int required)
 {
-    Rectangle rec = LuaGetArgument_Rectangle(L, 1);
-    int lineThick = LuaGetArgument_int(L, 2);
-    Color color = LuaGetArgument_Color(L, 3);
-    DrawRectangleLinesEx(rec, lineThick, color);
-    return 0;
+    if (required > list->capacity)
+    {
+        int capacity = (list->capacity > 0)? list->capacity : 1024;
+        while (capacity < required) capacity *= 2;
+
+        list->data = (unsigned char *)realloc(list->data, capacity);
+        list->capacity = capacity;
+    }
 }
 
-// Draw a color-filled triangle
-int lua_DrawTriangle(lua_State *L)
+// Append a command to command list (text is optional)
+static void CommandListAppend(CommandList *list, int type, const void *params, int size, const char *text)
 {
-    Vector2 v1 = LuaGetArgument_Vector2(L, 1);
-    Vector2 v2 = LuaGetArgument_Vector2(L, 2);
-    Vector2 v3 = LuaGetArgument_Vector2(L, 3);
-    Color color = LuaGetArgument_Color(L, 4);
-    DrawTriangle(v1, v2, v3, color);
-    return 0;
+    int textSize = (text != NULL)? (int)strlen(text) + 1 : 0;
+    int required = list->size + sizeof(int) + COMMAND_ALIGN(size + textSize);
+
+    CommandListReserve(list, required);
+
+    memcpy(list->data + list->size, &type, sizeof(int));
+    if (size > 0) memcpy(list->data + list->size + sizeof(int), params, size);
+    if (textSize > 0) memcpy(list->data + list->size + sizeof(int) + size, text, textSize);
+
+    list->size = required;
+    list->count++;
 }
 
-// Draw triangle outline
-int lua_DrawTriangleLines(lua_State *L)
+// Append all commands of another command list, displaced by offset
+static void CommandListAppendList(CommandList *list, const CommandList *commands, Vector2 offset)
 {
-    Vector2 v1 = LuaGetArgument_Vector2(L, 1);
-    Vector2 v2 = LuaGetArgument_Vector2(L, 2);
-    Vector2 v3 = LuaGetArgument_Vector2(L, 3);
-    Color color = LuaGetArgument_Color(L, 4);
-    DrawTriangleLines(v1, v2, v3, color);
-    return 0;
+    RenderQueuePush(list, 0, true);
+
+    Vector2 restore = { -offset.x, -offset.y };
+    int count = list->count + commands->count;
+
+    CommandListAppend(list, COMMAND_OFFSET, &offset, sizeof(Vector2), NULL);
+
+    CommandListReserve(list, list->size + commands->size);
+    if (commands->size > 0) memcpy(list->data + list->size, commands->data, commands->size);
+    list->size += commands->size;
+
+    CommandListAppend(list, COMMAND_OFFSET, &restore, sizeof(Vector2), NULL);
+
+    list->count = count;
 }
 
-// Draw a regular polygon (Vector version)
-int lua_DrawPoly(lua_State *L)
+// Record sprite batch quads displaced by offset (vertex data copied)
+static void RecordSpritesCommand(const SpriteBatch *batch, Vector2 offset)
 {
-    Vector2 center = LuaGetArgument_Vector2(L, 1);
-    int sides = LuaGetArgument_int(L, 2);
-    float radius = LuaGetArgument_float(L, 3);
-    float rotation = LuaGetArgument_float(L, 4);
-    Color color = LuaGetArgument_Color(L, 5);
-    DrawPoly(center, sides, radius, rotation, color);
-    return 0;
-}
+    SpritesCommand cmd = { batch->texture, batch->count };
+    int verticesSize = 4*batch->count*sizeof(Vector2);
+    int colorsSize = batch->count*sizeof(Color);
 
+    RenderQueuePush(recordingList, batch->texture.id, false);
+    CommandListAppend(recordingList, COMMAND_SPRITES, &cmd, sizeof(SpritesCommand), NULL);
+    CommandListReserve(recordingList, recordingList->size + 2*verticesSize + colorsSize);
 
-// TODO: This thing should be here?
-#define GET_TABLE(type, name, index) \
-    type* name = 0; \
-    size_t name##_size = 0; \
-    { \
-        size_t sz = 0; \
-        luaL_checktype(L, index, LUA_TTABLE); \
-        lua_pushnil(L); \
-        while (lua_next(L, index)) { \
-            LuaGetArgument_##type(L, -1); \
-            sz++; \
-            lua_pop(L, 1); \
-        } \
-        name = calloc(sz, sizeof(type)); \
-        sz = 0; \
-        lua_pushnil(L); \
-        while (lua_next(L, index)) { \
-            name[sz] = LuaGetArgument_##type(L, -1); \
-            sz++; \
-            lua_pop(L, 1); \
-        } \
-        lua_pop(L, 1); \
-        name##_size = sz; \
+    unsigned char *data = recordingList->data + recordingList->size;
+
+    if ((offset.x == 0.0f) && (offset.y == 0.0f)) memcpy(data, batch->vertices, verticesSize);
+    else
+    {
+        Vector2 *vertices = (Vector2 *)data;
+        for (int i = 0; i < 4*batch->count; i++) vertices[i] = (Vector2){ batch->vertices[i].x + offset.x, batch->vertices[i].y + offset.y };
     }
 
-// WARNING: Draw a closed polygon defined by points
-int lua_DrawPolyEx(lua_State* L)
-{
-    GET_TABLE(Vector2, arg1, 1);
-    Color arg2 = LuaGetArgument_Color(L, 2);
-    DrawPolyEx(arg1, arg1_size, arg2);
-    free(arg1);
-    return 0;
+    memcpy(data + verticesSize, batch->texcoords, verticesSize);
+    memcpy(data + 2*verticesSize, batch->colors, colorsSize);
+
+    recordingList->size += 2*verticesSize + colorsSize;
 }
 
-// WARNING: Draw polygon lines
-int lua_DrawPolyExLines(lua_State* L)
+// Record commands on list being recorded
+static void RecordShapeCommand(int type, ShapeCommand command)
 {
-    GET_TABLE(Vector2, arg1, 1);
-    Color arg2 = LuaGetArgument_Color(L, 2);
-    DrawPolyExLines(arg1, arg1_size, arg2);
-    free(arg1);
-    return 0;
+    RenderQueuePush(recordingList, 0, false);
+    CommandListAppend(recordingList, type, &command, sizeof(ShapeCommand), NULL);
 }
 
-// Check collision between two rectangles
-int lua_CheckCollisionRecs(lua_State *L)
+static void RecordTextureCommand(TextureCommand command)
 {
-    Rectangle rec1 = LuaGetArgument_Rectangle(L, 1);
-    Rectangle rec2 = LuaGetArgument_Rectangle(L, 2);
-    bool result = CheckCollisionRecs(rec1, rec2);
-    LuaPush_bool(L, result);
-    return 1;
+    RenderQueuePush(recordingList, command.texture.id, false);
+    CommandListAppend(recordingList, COMMAND_TEXTURE, &command, sizeof(TextureCommand), NULL);
 }
 
-// Check collision between two circles
-int lua_CheckCollisionCircles(lua_State *L)
+static void RecordTextCommand(int type, TextCommand command, const char *text)
 {
-    Vector2 center1 = LuaGetArgument_Vector2(L, 1);
-    float radius1 = LuaGetArgument_float(L, 2);
-    Vector2 center2 = LuaGetArgument_Vector2(L, 3);
-    float radius2 = LuaGetArgument_float(L, 4);
-    bool result = CheckCollisionCircles(center1, radius1, center2, radius2);
-    LuaPush_bool(L, result);
-    return 1;
+    RenderQueuePush(recordingList, command.font.texture.id, false);
+    CommandListAppend(recordingList, type, &command, sizeof(TextCommand), text);
 }
 
-// Check collision between circle and rectangle
-int lua_CheckCollisionCircleRec(lua_State *L)
+// Record polygon points (points array copied)
+static void RecordPolyCommand(int type, const Vector2 *points, int count, Color color)
 {
-    Vector2 center = LuaGetArgument_Vector2(L, 1);
-    float radius = LuaGetArgument_float(L, 2);
-    Rectangle rec = LuaGetArgument_Rectangle(L, 3);
-    bool result = CheckCollisionCircleRec(center, radius, rec);
-    LuaPush_bool(L, result);
-    return 1;
+    PolyCommand cmd = { count, color };
+
+    RenderQueuePush(recordingList, 0, false);
+    CommandListAppend(recordingList, type, &cmd, sizeof(PolyCommand), NULL);
+    CommandListReserve(recordingList, recordingList->size + count*sizeof(Vector2));
+    if (count > 0) memcpy(recordingList->data + recordingList->size, points, count*sizeof(Vector2));
+    recordingList->size += count*sizeof(Vector2);
 }
 
-// Get collision rectangle for two rectangles collision
-int lua_GetCollisionRec(lua_State *L)
+static void RecordShape3DCommand(int type, Shape3DCommand command)
 {
-    Rectangle rec1 = LuaGetArgument_Rectangle(L, 1);
-    Rectangle rec2 = LuaGetArgument_Rectangle(L, 2);
-    Rectangle result = GetCollisionRec(rec1, rec2);
-    LuaPush_Rectangle(L, result);
-    return 1;
+    RenderQueuePush(recordingList, command.texture.id, false);
+    CommandListAppend(recordingList, type, &command, sizeof(Shape3DCommand), NULL);
 }
 
-// Check if point is inside rectangle
-int lua_CheckCollisionPointRec(lua_State *L)
+static void RecordModelCommand(int type, ModelCommand command)
 {
-    Vector2 point = LuaGetArgument_Vector2(L, 1);
-    Rectangle rec = LuaGetArgument_Rectangle(L, 2);
-    bool result = CheckCollisionPointRec(point, rec);
-    LuaPush_bool(L, result);
-    return 1;
+    RenderQueuePush(recordingList, command.model.material.maps[MAP_DIFFUSE].texture.id, false);
+    CommandListAppend(recordingList, type, &command, sizeof(ModelCommand), NULL);
 }
 
-// Check if point is inside circle
-int lua_CheckCollisionPointCircle(lua_State *L)
+// Record mesh instances (transforms array copied)
+static void RecordMeshInstancesCommand(Mesh mesh, Material material, const Matrix *transforms, int count)
 {
-    Vector2 point = LuaGetArgument_Vector2(L, 1);
-    Vector2 center = LuaGetArgument_Vector2(L, 2);
-    float radius = LuaGetArgument_float(L, 3);
-    bool result = CheckCollisionPointCircle(point, center, radius);
-    LuaPush_bool(L, result);
-    return 1;
-}
+    MeshInstancesCommand cmd = { mesh, material, count };
 
-// Check if point is inside a triangle
-int lua_CheckCollisionPointTriangle(lua_State *L)
-{
-    Vector2 point = LuaGetArgument_Vector2(L, 1);
-    Vector2 p1 = LuaGetArgument_Vector2(L, 2);
-    Vector2 p2 = LuaGetArgument_Vector2(L, 3);
-    Vector2 p3 = LuaGetArgument_Vector2(L, 4);
-    bool result = CheckCollisionPointTriangle(point, p1, p2, p3);
-    LuaPush_bool(L, result);
-    return 1;
+    RenderQueuePush(recordingList, material.maps[MAP_DIFFUSE].texture.id, false);
+    CommandListAppend(recordingList, COMMAND_MESH_INSTANCES, &cmd, sizeof(MeshInstancesCommand), NULL);
+    CommandListReserve(recordingList, recordingList->size + count*sizeof(Matrix));
+    if (count > 0) memcpy(recordingList->data + recordingList->size, transforms, count*sizeof(Matrix));
+    recordingList->size += count*sizeof(Matrix);
 }
 
-//------------------------------------------------------------------------------------
-// raylib [textures] module functions - Texture Loading and Drawing
-//------------------------------------------------------------------------------------
-
-// Load image from file into CPU memory (RAM)
-int lua_LoadImage(lua_State *L)
+// NOTE: Render queue keeps shader and blend modes as sorting state, other modes are barriers
+static void RecordModeCommand(int type, const void *params, int size)
 {
-    const char *fileName = LuaGetArgument_string(L, 1);
-    Image result = LoadImage(fileName);
-    LuaPush_Image(L, result);
-    return 1;
-}
+    if (recordingList == &renderQueue.list)
+    {
+        switch (type)
+        {
+            case COMMAND_BEGIN_SHADER_MODE: renderQueue.shader = RenderQueueShaderIndex((const Shader *)params); return;
+            case COMMAND_END_SHADER_MODE: renderQueue.shader = 0; return;
+            case COMMAND_BEGIN_BLEND_MODE: memcpy(&renderQueue.blend, params, sizeof(int)); return;
+            case COMMAND_END_BLEND_MODE: renderQueue.blend = BLEND_ALPHA; return;
+            default: RenderQueuePush(recordingList, 0, true); break;
+        }
+    }
 
-// WARNING: Load image from Color array data (RGBA - 32bit)
-int lua_LoadImageEx(lua_State* L)
-{
-    // TODO: arg1 parameter is a Color array...
-    
-    GET_TABLE(Color, arg1, 1);              // Color *pixels
-    int arg2 = LuaGetArgument_int(L, 2);
-    int arg3 = LuaGetArgument_int(L, 3);
-    Image result = LoadImageEx(arg1, arg2, arg3); // ISSUE: #3 number expected, got no value
-    LuaPush_Image(L, result);
-    free(arg1);
-    return 1;
+    CommandListAppend(recordingList, type, params, size, NULL);
 }
 
-// WARNING: Load image from raw data with pro parameters
-int lua_LoadImagePro(lua_State* L)
+// Get mode command parameters size
+static int GetModeCommandSize(int type)
 {
-    // TODO: arg1 parameter is a void pointer...
-    
-    void *arg1 = LuaGetArgument_ptr(L, 1);
-    int arg2 = LuaGetArgument_int(L, 2);
-    int arg3 = LuaGetArgument_int(L, 3);
-    int arg4 = LuaGetArgument_int(L, 4);
-    Image result = LoadImagePro(arg1, arg2, arg3, arg4);
-    LuaPush_Image(L, result);
-    free(arg1);
-    return 1;
+    switch (type)
+    {
+        case COMMAND_CLEAR_BACKGROUND: return sizeof(Color);
+        case COMMAND_BEGIN_MODE_2D: return sizeof(Camera2D);
+        case COMMAND_BEGIN_MODE_3D: return sizeof(Camera3D);
+        case COMMAND_BEGIN_TEXTURE_MODE: return sizeof(RenderTexture2D);
+        case COMMAND_BEGIN_SHADER_MODE: return sizeof(Shader);
+        case COMMAND_BEGIN_BLEND_MODE: return sizeof(int);
+        case COMMAND_OFFSET: return sizeof(Vector2);
+        default: return 0;
+    }
 }
 
-// Load image from RAW file data
-int lua_LoadImageRaw(lua_State *L)
+// Replay mode command (drawing state changes are not displaced by offset)
+static void DrawModeCommand(int type, const unsigned char *data, Vector2 *offset)
 {
-    const char *fileName = LuaGetArgument_string(L, 1);
-    int width = LuaGetArgument_int(L, 2);
-    int height = LuaGetArgument_int(L, 3);
-    int format = LuaGetArgument_int(L, 4);
-    int headerSize = LuaGetArgument_int(L, 5);
-    Image result = LoadImageRaw(fileName, width, height, format, headerSize);
-    LuaPush_Image(L, result);
-    return 1;
+    switch (type)
+    {
+        case COMMAND_CLEAR_BACKGROUND: { Color color; memcpy(&color, data, sizeof(Color)); ClearBackground(color); } break;
+        case COMMAND_BEGIN_MODE_2D: { Camera2D camera; memcpy(&camera, data, sizeof(Camera2D)); BeginMode2D(camera); } break;
+        case COMMAND_END_MODE_2D: EndMode2D(); break;
+        case COMMAND_BEGIN_MODE_3D: { Camera3D camera; memcpy(&camera, data, sizeof(Camera3D)); BeginMode3D(camera); } break;
+        case COMMAND_END_MODE_3D: EndMode3D(); break;
+        case COMMAND_BEGIN_TEXTURE_MODE: { RenderTexture2D target; memcpy(&target, data, sizeof(RenderTexture2D)); BeginTextureMode(target); } break;
+        case COMMAND_END_TEXTURE_MODE: EndTextureMode(); break;
+        case COMMAND_BEGIN_SHADER_MODE: { Shader shader; memcpy(&shader, data, sizeof(Shader)); BeginShaderMode(shader); } break;
+        case COMMAND_END_SHADER_MODE: EndShaderMode(); break;
+        case COMMAND_BEGIN_BLEND_MODE: { int mode; memcpy(&mode, data, sizeof(int)); BeginBlendMode(mode); } break;
+        case COMMAND_END_BLEND_MODE: EndBlendMode(); break;
+        case COMMAND_BEGIN_VR_DRAWING: BeginVrDrawing(); break;
+        case COMMAND_END_VR_DRAWING: EndVrDrawing(); break;
+        case COMMAND_OFFSET:
+        {
+            Vector2 delta;
+            memcpy(&delta, data, sizeof(Vector2));
+            offset->x += delta.x;
+            offset->y += delta.y;
+        } break;
+        default: break;
+    }
 }
 
-// Export image as a PNG file
-int lua_ExportImage(lua_State *L)
+// Replay shape command, positions displaced by offset
+static void DrawShapeCommand(int type, ShapeCommand cmd, Vector2 offset)
 {
-    const char *fileName = LuaGetArgument_string(L, 1);
-    Image image = LuaGetArgument_Image(L, 2);
-    ExportImage(fileName, image);
-    return 0;
-}
+    for (int i = 0; i < 3; i++)
+    {
+        cmd.points[i].x += offset.x;
+        cmd.points[i].y += offset.y;
+    }
 
-// Load texture from file into GPU memory (VRAM)
-int lua_LoadTexture(lua_State *L)
-{
-    const char *fileName = LuaGetArgument_string(L, 1);
-    Texture2D result = LoadTexture(fileName);
-    LuaPush_Texture2D(L, result);
-    return 1;
-}
+    Vector2 *p = cmd.points;
+    Color *c = cmd.colors;
 
-// Load texture from image data
-int lua_LoadTextureFromImage(lua_State *L)
-{
-    Image image = LuaGetArgument_Image(L, 1);
-    Texture2D result = LoadTextureFromImage(image);
-    LuaPush_Texture2D(L, result);
-    return 1;
+    switch (type)
+    {
+        case COMMAND_PIXEL: DrawPixel((int)p[0].x, (int)p[0].y, c[0]); break;
+        case COMMAND_PIXEL_V: DrawPixelV(p[0], c[0]); break;
+        case COMMAND_LINE: DrawLine((int)p[0].x, (int)p[0].y, (int)p[1].x, (int)p[1].y, c[0]); break;
+        case COMMAND_LINE_V: DrawLineV(p[0], p[1], c[0]); break;
+        case COMMAND_LINE_EX: DrawLineEx(p[0], p[1], cmd.values[0], c[0]); break;
+        case COMMAND_LINE_BEZIER: DrawLineBezier(p[0], p[1], cmd.values[0], c[0]); break;
+        case COMMAND_CIRCLE: DrawCircle((int)p[0].x, (int)p[0].y, cmd.values[0], c[0]); break;
+        case COMMAND_CIRCLE_GRADIENT: DrawCircleGradient((int)p[0].x, (int)p[0].y, cmd.values[0], c[0], c[1]); break;
+        case COMMAND_CIRCLE_V: DrawCircleV(p[0], cmd.values[0], c[0]); break;
+        case COMMAND_CIRCLE_LINES: DrawCircleLines((int)p[0].x, (int)p[0].y, cmd.values[0], c[0]); break;
+        case COMMAND_RECTANGLE: DrawRectangle((int)p[0].x, (int)p[0].y, (int)cmd.size.x, (int)cmd.size.y, c[0]); break;
+        case COMMAND_RECTANGLE_V: DrawRectangleV(p[0], cmd.size, c[0]); break;
+        case COMMAND_RECTANGLE_REC: DrawRectangleRec((Rectangle){ p[0].x, p[0].y, cmd.size.x, cmd.size.y }, c[0]); break;
+        case COMMAND_RECTANGLE_PRO: DrawRectanglePro((Rectangle){ p[0].x, p[0].y, cmd.size.x, cmd.size.y }, (Vector2){ cmd.values[1], cmd.values[2] }, cmd.values[0], c[0]); break;
+        case COMMAND_RECTANGLE_GRADIENT_V: DrawRectangleGradientV((int)p[0].x, (int)p[0].y, (int)cmd.size.x, (int)cmd.size.y, c[0], c[1]); break;
+        case COMMAND_RECTANGLE_GRADIENT_H: DrawRectangleGradientH((int)p[0].x, (int)p[0].y, (int)cmd.size.x, (int)cmd.size.y, c[0], c[1]); break;
+        case COMMAND_RECTANGLE_GRADIENT_EX: DrawRectangleGradientEx((Rectangle){ p[0].x, p[0].y, cmd.size.x, cmd.size.y }, c[0], c[1], c[2], c[3]); break;
+        case COMMAND_RECTANGLE_LINES: DrawRectangleLines((int)p[0].x, (int)p[0].y, (int)cmd.size.x, (int)cmd.size.y, c[0]); break;
+        case COMMAND_RECTANGLE_LINES_EX: DrawRectangleLinesEx((Rectangle){ p[0].x, p[0].y, cmd.size.x, cmd.size.y }, (int)cmd.values[0], c[0]); break;
+        case COMMAND_TRIANGLE: DrawTriangle(p[0], p[1], p[2], c[0]); break;
+        case COMMAND_TRIANGLE_LINES: DrawTriangleLines(p[0], p[1], p[2], c[0]); break;
+        case COMMAND_POLY: DrawPoly(p[0], (int)cmd.values[0], cmd.values[1], cmd.values[2], c[0]); break;
+        case COMMAND_FPS: DrawFPS((int)p[0].x, (int)p[0].y); break;
+        default: break;
+    }
 }
 
-// Load texture for rendering (framebuffer)
-int lua_LoadRenderTexture(lua_State *L)
+// Replay 3D shape command (3D positions are not displaced by offset)
+static void DrawShape3DCommand(int type, const Shape3DCommand *cmd)
 {
-    int width = LuaGetArgument_int(L, 1);
-    int height = LuaGetArgument_int(L, 2);
-    RenderTexture2D result = LoadRenderTexture(width, height);
-    LuaPush_RenderTexture2D(L, result);
-    return 1;
-}
+    const Vector3 *p = cmd->points;
+    const float *v = cmd->values;
 
-// Unload image from CPU memory (RAM)
-int lua_UnloadImage(lua_State *L)
-{
-    Image image = LuaGetArgument_Image(L, 1);
-    UnloadImage(image);
-    return 0;
+    switch (type)
+    {
+        case COMMAND_LINE_3D: DrawLine3D(p[0], p[1], cmd->color); break;
+        case COMMAND_CIRCLE_3D: DrawCircle3D(p[0], v[0], p[1], v[1], cmd->color); break;
+        case COMMAND_CUBE: DrawCubeV(p[0], cmd->size, cmd->color); break;
+        case COMMAND_CUBE_WIRES: DrawCubeWires(p[0], cmd->size.x, cmd->size.y, cmd->size.z, cmd->color); break;
+        case COMMAND_CUBE_TEXTURE: DrawCubeTexture(cmd->texture, p[0], cmd->size.x, cmd->size.y, cmd->size.z, cmd->color); break;
+        case COMMAND_SPHERE: DrawSphereEx(p[0], v[0], (int)v[1], (int)v[2], cmd->color); break;
+        case COMMAND_SPHERE_WIRES: DrawSphereWires(p[0], v[0], (int)v[1], (int)v[2], cmd->color); break;
+        case COMMAND_CYLINDER: DrawCylinder(p[0], v[0], v[1], v[2], (int)v[3], cmd->color); break;
+        case COMMAND_CYLINDER_WIRES: DrawCylinderWires(p[0], v[0], v[1], v[2], (int)v[3], cmd->color); break;
+        case COMMAND_PLANE: DrawPlane(p[0], (Vector2){ cmd->size.x, cmd->size.z }, cmd->color); break;
+        case COMMAND_RAY: DrawRay((Ray){ p[0], p[1] }, cmd->color); break;
+        case COMMAND_GRID: DrawGrid((int)v[0], v[1]); break;
+        case COMMAND_GIZMO: DrawGizmo(p[0]); break;
+        case COMMAND_BOUNDING_BOX: DrawBoundingBox((BoundingBox){ p[0], p[1] }, cmd->color); break;
+        case COMMAND_BILLBOARD: DrawBillboardRec(cmd->camera, cmd->texture, cmd->sourceRec, p[0], v[0], cmd->color); break;
+        default: break;
+    }
 }
 
-// Unload texture from GPU memory (VRAM)
-int lua_UnloadTexture(lua_State *L)
+// Draw mesh instances, one draw call per instance (GPU instancing with RLUA_SUPPORT_MESH_INSTANCING)
+static void DrawMeshTransforms(Mesh mesh, Material material, const Matrix *transforms, int count)
 {
-    Texture2D texture = LuaGetArgument_Texture2D(L, 1);
-    UnloadTexture(texture);
-    return 0;
+#if defined(RLUA_SUPPORT_MESH_INSTANCING)
+    DrawMeshInstanced(mesh, material, (Matrix *)transforms, count);
+#else
+    for (int i = 0; i < count; i++) rlDrawMesh(mesh, material, transforms[i]);
+#endif
 }
 
-// Unload render texture from GPU memory (VRAM)
-int lua_UnloadRenderTexture(lua_State *L)
+// Replay one command, positions displaced by offset (updated by offset commands)
+// NOTE: Returns next command data
+static const unsigned char *DrawCommand(const unsigned char *data, Vector2 *offset)
 {
-    RenderTexture2D target = LuaGetArgument_RenderTexture2D(L, 1);
-    UnloadRenderTexture(target);
-    return 0;
-}
+    int type = 0;
+    memcpy(&type, data, sizeof(int));
+    data += sizeof(int);
 
-// WARNING: Get pixel data from image as a Color struct array
-int lua_GetImageData(lua_State* L)
-{
-    // TODO: return value is a Color array
+    if (type == COMMAND_TEXTURE)
+    {
+        TextureCommand cmd;
+        memcpy(&cmd, data, sizeof(TextureCommand));
+        data += COMMAND_ALIGN(sizeof(TextureCommand));
 
-    Image arg1 = LuaGetArgument_Image(L, 1);
-    Color *result = GetImageData(arg1);
-    lua_createtable(L, arg1.width*arg1.height, 0);
-    for (int i = 0; i < arg1.width*arg1.height; i++)
+        cmd.destRec.x += offset->x;
+        cmd.destRec.y += offset->y;
+        DrawTexturePro(cmd.texture, cmd.sourceRec, cmd.destRec, cmd.origin, cmd.rotation, cmd.tint);
+    }
+    else if ((type == COMMAND_TEXT) || (type == COMMAND_TEXT_EX))
     {
-        LuaPush_Color(L, result[i]);
-        lua_rawseti(L, -2, i + 1);
+        TextCommand cmd;
+        memcpy(&cmd, data, sizeof(TextCommand));
+
+        const char *text = (const char *)(data + sizeof(TextCommand));
+        data += COMMAND_ALIGN(sizeof(TextCommand) + strlen(text) + 1);
+
+        if (type == COMMAND_TEXT) DrawText(text, (int)(cmd.position.x + offset->x), (int)(cmd.position.y + offset->y), (int)cmd.fontSize, cmd.color);
+        else DrawTextEx(cmd.font, text, (Vector2){ cmd.position.x + offset->x, cmd.position.y + offset->y }, cmd.fontSize, cmd.spacing, cmd.color);
     }
-    free(result);
-    return 1;
-}
+    else if (type == COMMAND_SPRITES)
+    {
+        SpritesCommand cmd;
+        memcpy(&cmd, data, sizeof(SpritesCommand));
+        data += COMMAND_ALIGN(sizeof(SpritesCommand));
 
-// WARNING: Get pixel data from image as Vector4 array (float normalized)
-int lua_GetImageDataNormalized(lua_State *L)
-{
-    // TODO.
-    
-    return 1;
+        // NOTE: Sprites arrays are 4-byte aligned, accessed in place
+        SpriteBatch batch = { cmd.texture, cmd.count, cmd.count, (Vector2 *)data, (Vector2 *)(data + 4*cmd.count*sizeof(Vector2)), (Color *)(data + 8*cmd.count*sizeof(Vector2)) };
+        data += cmd.count*(8*sizeof(Vector2) + sizeof(Color));
+
+        SpriteBatchSubmit(&batch, *offset);
+    }
+    else if ((type == COMMAND_POLY_EX) || (type == COMMAND_POLY_EX_LINES))
+    {
+        PolyCommand cmd;
+        memcpy(&cmd, data, sizeof(PolyCommand));
+        data += COMMAND_ALIGN(sizeof(PolyCommand));
+
+        // NOTE: Points are displaced on a copy, recorded command list is not modified
+        Vector2 *points = (Vector2 *)malloc(cmd.count*sizeof(Vector2));
+        memcpy(points, data, cmd.count*sizeof(Vector2));
+        data += cmd.count*sizeof(Vector2);
+
+        for (int i = 0; i < cmd.count; i++)
+        {
+            points[i].x += offset->x;
+            points[i].y += offset->y;
+        }
+
+        if (type == COMMAND_POLY_EX) DrawPolyEx(points, cmd.count, cmd.color);
+        else DrawPolyExLines(points, cmd.count, cmd.color);
+
+        free(points);
+    }
+    else if ((type >= COMMAND_LINE_3D) && (type <= COMMAND_BILLBOARD))
+    {
+        Shape3DCommand cmd;
+        memcpy(&cmd, data, sizeof(Shape3DCommand));
+        data += COMMAND_ALIGN(sizeof(Shape3DCommand));
+
+        DrawShape3DCommand(type, &cmd);
+    }
+    else if ((type == COMMAND_MODEL) || (type == COMMAND_MODEL_WIRES))
+    {
+        ModelCommand cmd;
+        memcpy(&cmd, data, sizeof(ModelCommand));
+        data += COMMAND_ALIGN(sizeof(ModelCommand));
+
+        if (type == COMMAND_MODEL) DrawModelEx(cmd.model, cmd.position, cmd.rotationAxis, cmd.rotationAngle, cmd.scale, cmd.tint);
+        else DrawModelWiresEx(cmd.model, cmd.position, cmd.rotationAxis, cmd.rotationAngle, cmd.scale, cmd.tint);
+    }
+    else if (type == COMMAND_MESH_INSTANCES)
+    {
+        MeshInstancesCommand cmd;
+        memcpy(&cmd, data, sizeof(MeshInstancesCommand));
+        data += COMMAND_ALIGN(sizeof(MeshInstancesCommand));
+
+        // NOTE: Transforms array is 4-byte aligned, accessed in place
+        DrawMeshTransforms(cmd.mesh, cmd.material, (const Matrix *)data, cmd.count);
+        data += cmd.count*sizeof(Matrix);
+    }
+    else if (type >= COMMAND_CLEAR_BACKGROUND)
+    {
+        DrawModeCommand(type, data, offset);
+        data += COMMAND_ALIGN(GetModeCommandSize(type));
+    }
+    else
+    {
+        ShapeCommand cmd;
+        memcpy(&cmd, data, sizeof(ShapeCommand));
+        data += COMMAND_ALIGN(sizeof(ShapeCommand));
+
+        DrawShapeCommand(type, cmd, *offset);
+    }
+
+    return data;
 }
 
-// Get pixel data size in bytes (image or texture)
-int lua_GetPixelDataSize(lua_State *L)
+// Replay all commands of a command list, positions displaced by offset
+static void DrawCommandListEx(const CommandList *list, Vector2 offset)
 {
-    int width = LuaGetArgument_int(L, 1);
-    int height = LuaGetArgument_int(L, 2);
-    int format = LuaGetArgument_int(L, 3);
-    int result = GetPixelDataSize(width, height, format);
-    LuaPush_int(L, result);
-    return 1;
+    const unsigned char *data = list->data;
+    const unsigned char *end = list->data + list->size;
+
+    while (data < end) data = DrawCommand(data, &offset);
 }
 
-// Get pixel data from GPU texture and return an Image
-int lua_GetTextureData(lua_State *L)
+// Create an empty command list
+int lua_CommandList(lua_State *L)
 {
-    Texture2D texture = LuaGetArgument_Texture2D(L, 1);
-    Image result = GetTextureData(texture);
-    LuaPush_Image(L, result);
+    CommandList *list = (CommandList *)lua_newuserdata(L, sizeof(CommandList));
+    memset(list, 0, sizeof(CommandList));
+    luaL_setmetatable(L, "CommandList");
     return 1;
 }
 
-
-// WARNING: Update GPU texture with new data
-int lua_UpdateTexture(lua_State* L)
+// Begin recording a command list (previous commands are removed)
+// NOTE: While recording, shapes, textures, text, 3D shapes, models and drawing modes functions are recorded instead of drawn
+int lua_BeginRecording(lua_State *L)
 {
-    // TODO: arg2 parameters is a void pointer...
-    
-    Texture2D arg1 = LuaGetArgument_Texture2D(L, 1);
-    void *arg2 = LuaGetArgument_ptr(L, 2);
-    UpdateTexture(arg1, arg2);      // ISSUE: #2 string expected, got table -> GetImageData() returns a table!
-    return 0;
-}
+    CommandList *list = (CommandList *)luaL_checkudata(L, 1, "CommandList");
+    luaL_argcheck(L, recordingListRef == LUA_NOREF, 1, "Command list already being recorded, call EndRecording() first");
 
-//----------------------------------------------------------------------------------
-// Image manipulation functions
-//----------------------------------------------------------------------------------
+    list->size = 0;
+    list->count = 0;
 
-// Create an image duplicate (useful for transformations)
-int lua_ImageCopy(lua_State *L)
-{
-    Image image = LuaGetArgument_Image(L, 1);
-    Image result = ImageCopy(image);
-    LuaPush_Image(L, result);
-    return 1;
-}
+    lua_pushvalue(L, 1);
+    recordingListRef = luaL_ref(L, LUA_REGISTRYINDEX);
+    recordingParent = recordingList;
+    recordingList = list;
 
-// Convert image to POT (power-of-two)
-int lua_ImageToPOT(lua_State *L)
-{
-    Image image = LuaGetArgument_Image(L, 1);
-    Color fillColor = LuaGetArgument_Color(L, 2);
-    ImageToPOT(image, fillColor);
     return 0;
 }
 
-// Convert image data to desired format
-int lua_ImageFormat(lua_State *L)
+// End recording current command list
+int lua_EndRecording(lua_State *L)
 {
-    Image image = LuaGetArgument_Image(L, 1);
-    int newFormat = LuaGetArgument_int(L, 2);
-    ImageFormat(image, newFormat);
+    if (recordingListRef == LUA_NOREF) return 0;
+
+    luaL_unref(L, LUA_REGISTRYINDEX, recordingListRef);
+    recordingListRef = LUA_NOREF;
+    recordingList = recordingParent;
+    recordingParent = NULL;
     return 0;
 }
 
-// Apply alpha mask to image
-int lua_ImageAlphaMask(lua_State *L)
+// Draw a recorded command list: DrawCommandList(list[, offset])
+// NOTE: If another list is being recorded, commands are copied into it
+int lua_DrawCommandList(lua_State *L)
 {
-    Image image = LuaGetArgument_Image(L, 1);
-    Image alphaMask = LuaGetArgument_Image(L, 2);
-    ImageAlphaMask(image, alphaMask);
+    CommandList *list = (CommandList *)luaL_checkudata(L, 1, "CommandList");
+    Vector2 offset = lua_isnoneornil(L, 2)? (Vector2){ 0.0f, 0.0f } : LuaGetArgument_Vector2(L, 2);
+    luaL_argcheck(L, list != recordingList, 1, "Command list is being recorded");
+
+    if (recordingList != NULL) CommandListAppendList(recordingList, list, offset);
+    else DrawCommandListEx(list, offset);
+
     return 0;
 }
 
-// Clear alpha channel to desired color
-int lua_ImageAlphaClear(lua_State *L)
+// Commands recorded: #list
+static int LuaCommandListCount(lua_State *L)
 {
-    Image image = LuaGetArgument_Image(L, 1);
-    Color color = LuaGetArgument_Color(L, 2);
-    float threshold = LuaGetArgument_float(L, 3);
-    ImageAlphaClear(image, color, threshold);
-    return 0;
+    CommandList *list = (CommandList *)luaL_checkudata(L, 1, "CommandList");
+    LuaPush_int(L, list->count);
+    return 1;
 }
 
-// Crop image depending on alpha value
-int lua_ImageAlphaCrop(lua_State *L)
+// Free command list data
+static int LuaCommandListGC(lua_State *L)
 {
-    Image image = LuaGetArgument_Image(L, 1);
-    float threshold = LuaGetArgument_float(L, 2);
-    ImageAlphaCrop(image, threshold);
+    CommandList *list = (CommandList *)luaL_checkudata(L, 1, "CommandList");
+    free(list->data);
+    list->data = NULL;
+    list->size = 0;
+    list->capacity = 0;
+    list->count = 0;
     return 0;
 }
 
-// Premultiply alpha channel
-int lua_ImageAlphaPremultiply(lua_State *L)
+//------------------------------------------------------------------------------------
+// raylib-lua [core] module functions - Render queue (draw commands sorted by state)
+//------------------------------------------------------------------------------------
+
+// Get shader index in render queue shaders table (index 0 is default shader)
+static int RenderQueueShaderIndex(const Shader *shader)
 {
-    Image image = LuaGetArgument_Image(L, 1);
-    ImageAlphaPremultiply(image);
-    return 0;
+    for (int i = 1; i < renderQueue.shadersCount; i++)
+    {
+        if (renderQueue.shaders[i].id == shader->id) return i;
+    }
+
+    // Shaders table full: commands recorded are drawn and table restarts
+    if (renderQueue.shadersCount == RLUA_RENDERQUEUE_MAX_SHADERS)
+    {
+        RenderQueueFlush();
+        renderQueue.shadersCount = 1;
+    }
+
+    renderQueue.shaders[renderQueue.shadersCount] = *shader;
+    return renderQueue.shadersCount++;
 }
 
-// Crop an image to a defined rectangle
-int lua_ImageCrop(lua_State *L)
+// Add render queue entry for the command about to be recorded on list
+// NOTE: Barriers (drawing modes, nested command lists) keep submission order, starting a new key segment
+static void RenderQueuePush(CommandList *list, unsigned int textureId, bool barrier)
 {
-    Image image = LuaGetArgument_Image(L, 1);
-    Rectangle crop = LuaGetArgument_Rectangle(L, 2);
-    ImageCrop(image, crop);
-    return 0;
+    if (list != &renderQueue.list) return;
+
+    if (barrier && (renderQueue.segment == RLUA_RENDERQUEUE_MAX_SEGMENTS - 1)) RenderQueueFlush();
+
+    if (renderQueue.count == renderQueue.capacity)
+    {
+        renderQueue.capacity = (renderQueue.capacity > 0)? 2*renderQueue.capacity : 256;
+        renderQueue.entries = (RenderQueueEntry *)realloc(renderQueue.entries, renderQueue.capacity*sizeof(RenderQueueEntry));
+        renderQueue.items = (RenderQueueItem *)realloc(renderQueue.items, 2*renderQueue.capacity*sizeof(RenderQueueItem));
+    }
+
+    RenderQueueEntry *entry = &renderQueue.entries[renderQueue.count];
+    RenderQueueItem *item = &renderQueue.items[renderQueue.count];
+
+    entry->offset = list->size;
+    entry->barrier = barrier;
+    entry->shader = renderQueue.shader;
+    entry->blend = renderQueue.blend;
+    entry->texture = textureId;
+
+    if (barrier)
+    {
+        renderQueue.segment++;
+        item->key = (unsigned long long)renderQueue.segment << RENDERQUEUE_KEY_SEGMENT;
+    }
+    else
+    {
+        item->key = ((unsigned long long)renderQueue.segment << RENDERQUEUE_KEY_SEGMENT) |
+                    ((unsigned long long)renderQueue.layer << RENDERQUEUE_KEY_LAYER) |
+                    ((unsigned long long)renderQueue.shader << RENDERQUEUE_KEY_SHADER) |
+                    ((unsigned long long)(renderQueue.blend & 0xf) << RENDERQUEUE_KEY_BLEND) |
+                    ((unsigned long long)(textureId & 0xffff) << RENDERQUEUE_KEY_TEXTURE) |
+                    (unsigned long long)renderQueue.depth;
+    }
+
+    item->index = renderQueue.count;
+    renderQueue.count++;
 }
 
-// Resize image (bilinear filtering)
-int lua_ImageResize(lua_State *L)
+// Sort render queue items by key: stable LSD radix sort, 8-bit digits (passes with a single digit value skipped)
+static void RenderQueueSort(RenderQueueItem *items, RenderQueueItem *temp, int count)
 {
-    Image image = LuaGetArgument_Image(L, 1);
-    int newWidth = LuaGetArgument_int(L, 2);
-    int newHeight = LuaGetArgument_int(L, 3);
-    ImageResize(image, newWidth, newHeight);
-    return 0;
+    static unsigned int histograms[8][256];
+    RenderQueueItem *src = items;
+    RenderQueueItem *dst = temp;
+
+    memset(histograms, 0, sizeof(histograms));
+
+    for (int i = 0; i < count; i++)
+    {
+        for (int d = 0; d < 8; d++) histograms[d][(items[i].key >> 8*d) & 0xff]++;
+    }
+
+    for (int d = 0; d < 8; d++)
+    {
+        unsigned int *histogram = histograms[d];
+
+        if (histogram[(src[0].key >> 8*d) & 0xff] == (unsigned int)count) continue;
+
+        unsigned int offsets[256];
+        unsigned int sum = 0;
+
+        for (int k = 0; k < 256; k++)
+        {
+            offsets[k] = sum;
+            sum += histogram[k];
+        }
+
+        for (int i = 0; i < count; i++) dst[offsets[(src[i].key >> 8*d) & 0xff]++] = src[i];
+
+        RenderQueueItem *swap = src;
+        src = dst;
+        dst = swap;
+    }
+
+    if (src != items) memcpy(items, src, count*sizeof(RenderQueueItem));
 }
 
-// Resize image (Nearest-Neighbor scaling algorithm)
-int lua_ImageResizeNN(lua_State *L)
+// Count state changes (shader, blend mode or texture) drawing entries in items order
+// NOTE: Barriers set shader and blend mode too, their texture is not tracked
+static int RenderQueueStateChanges(const RenderQueueItem *items, int count)
 {
-    Image image = LuaGetArgument_Image(L, 1);
-    int newWidth = LuaGetArgument_int(L, 2);
-    int newHeight = LuaGetArgument_int(L, 3);
-    ImageResizeNN(image, newWidth, newHeight);
-    return 0;
+    int changes = 0;
+    int shader = 0;
+    int blend = BLEND_ALPHA;
+    unsigned int texture = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        const RenderQueueEntry *entry = &renderQueue.entries[items[i].index];
+
+        if ((entry->shader != shader) || (entry->blend != blend) || (!entry->barrier && (entry->texture != texture))) changes++;
+
+        shader = entry->shader;
+        blend = entry->blend;
+        if (!entry->barrier) texture = entry->texture;
+    }
+
+    return changes;
 }
 
-// Resize canvas and fill with color
-int lua_ImageResizeCanvas(lua_State *L)
+// Set render queue drawing state: draw it or record it on parent command list
+static void RenderQueueSetState(CommandList *target, int *shader, int *blend, int newShader, int newBlend)
 {
-    Image image = LuaGetArgument_Image(L, 1);
-    int newWidth = LuaGetArgument_int(L, 2);
-    int newHeight = LuaGetArgument_int(L, 3);
-    int offsetX = LuaGetArgument_int(L, 4);
-    int offsetY = LuaGetArgument_int(L, 5);
-    Color color = LuaGetArgument_Color(L, 6);
-    ImageResizeCanvas(image, newWidth, newHeight, offsetX, offsetY, color);
-    return 0;
+    if (newShader != *shader)
+    {
+        if (target != NULL)
+        {
+            if (newShader == 0) CommandListAppend(target, COMMAND_END_SHADER_MODE, NULL, 0, NULL);
+            else CommandListAppend(target, COMMAND_BEGIN_SHADER_MODE, &renderQueue.shaders[newShader], sizeof(Shader), NULL);
+        }
+        else
+        {
+            if (newShader == 0) EndShaderMode();
+            else BeginShaderMode(renderQueue.shaders[newShader]);
+        }
+
+        *shader = newShader;
+    }
+
+    if (newBlend != *blend)
+    {
+        if (target != NULL) CommandListAppend(target, COMMAND_BEGIN_BLEND_MODE, &newBlend, sizeof(int), NULL);
+        else BeginBlendMode(newBlend);
+
+        *blend = newBlend;
+    }
 }
 
-// Generate all mipmap levels for a provided image
-int lua_ImageMipmaps(lua_State *L)
+// Sort render queue commands and draw them (or record them on parent command list), queue is emptied
+static void RenderQueueFlush(void)
 {
-    Image image = LuaGetArgument_Image(L, 1);
-    ImageMipmaps(image);
-    return 0;
+    RenderQueue *queue = &renderQueue;
+    CommandList *target = queue->parent;
+    int count = queue->count;
+
+    if (count > 0)
+    {
+        for (int i = 0; i < count; i++) queue->entries[i].size = ((i + 1 < count)? queue->entries[i + 1].offset : queue->list.size) - queue->entries[i].offset;
+
+        queue->stats.commands += count;
+        queue->stats.changesSubmitted += RenderQueueStateChanges(queue->items, count);
+
+        RenderQueueSort(queue->items, queue->items + queue->capacity, count);
+
+        queue->stats.changesSorted += RenderQueueStateChanges(queue->items, count);
+
+        int shader = 0;
+        int blend = BLEND_ALPHA;
+        Vector2 offset = { 0.0f, 0.0f };
+
+        for (int i = 0; i < count; i++)
+        {
+            const RenderQueueEntry *entry = &queue->entries[queue->items[i].index];
+            const unsigned char *data = queue->list.data + entry->offset;
+
+            // NOTE: Barriers are drawn with their own shader and blend mode too (i.e. nested command list inside shader mode)
+            RenderQueueSetState(target, &shader, &blend, entry->shader, entry->blend);
+
+            if (target != NULL)
+            {
+                CommandListReserve(target, target->size + entry->size);
+                memcpy(target->data + target->size, data, entry->size);
+                target->size += entry->size;
+                target->count++;
+            }
+            else
+            {
+                const unsigned char *end = data + entry->size;
+                while (data < end) data = DrawCommand(data, &offset);
+            }
+        }
+
+        RenderQueueSetState(target, &shader, &blend, 0, BLEND_ALPHA);
+    }
+
+    queue->list.size = 0;
+    queue->list.count = 0;
+    queue->count = 0;
+    queue->segment = 0;
 }
 
-// Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
-int lua_ImageDither(lua_State *L)
+// End render queue: draw commands sorted and restore previous recording state
+static void RenderQueueEnd(void)
 {
-    Image image = LuaGetArgument_Image(L, 1);
-    int rBpp = LuaGetArgument_int(L, 2);
-    int gBpp = LuaGetArgument_int(L, 3);
-    int bBpp = LuaGetArgument_int(L, 4);
-    int aBpp = LuaGetArgument_int(L, 5);
-    ImageDither(image, rBpp, gBpp, bBpp, aBpp);
-    return 0;
+    RenderQueueFlush();
+
+    recordingList = renderQueue.parent;
+    renderQueue.parent = NULL;
+    renderQueue.active = false;
 }
 
-// Create an image from text (default font)
-int lua_ImageText(lua_State *L)
+// Begin render queue: drawing commands are sorted by layer, shader, blend mode, texture and depth
+// NOTE: Commands are drawn at EndRenderQueue() (or EndDrawing()), or recorded if a command list is being recorded
+int lua_BeginRenderQueue(lua_State *L)
 {
-    const char *text = LuaGetArgument_string(L, 1);
-    int fontSize = LuaGetArgument_int(L, 2);
-    Color color = LuaGetArgument_Color(L, 3);
-    Image result = ImageText(text, fontSize, color);
-    LuaPush_Image(L, result);
-    return 1;
+    if (renderQueue.active) return luaL_error(L, "Render queue already begun, call EndRenderQueue() first");
+
+    renderQueue.active = true;
+    renderQueue.parent = recordingList;
+    renderQueue.layer = 0;
+    renderQueue.depth = 0;
+    renderQueue.shader = 0;
+    renderQueue.blend = BLEND_ALPHA;
+    renderQueue.shadersCount = 1;
+    memset(&renderQueue.stats, 0, sizeof(renderQueue.stats));
+
+    recordingList = &renderQueue.list;
+
+    return 0;
 }
 
-// Create an image from text (custom sprite font)
-int lua_ImageTextEx(lua_State *L)
+// End render queue, commands are sorted and drawn
+int lua_EndRenderQueue(lua_State *L)
 {
-    Font font = LuaGetArgument_Font(L, 1);
-    const char *text = LuaGetArgument_string(L, 2);
-    float fontSize = LuaGetArgument_float(L, 3);
-    float spacing = LuaGetArgument_float(L, 4);
-    Color tint = LuaGetArgument_Color(L, 5);
-    Image result = ImageTextEx(font, text, fontSize, spacing, tint);
-    LuaPush_Image(L, result);
-    return 1;
+    if (renderQueue.active) RenderQueueEnd();
+    return 0;
 }
 
-// Draw a source image within a destination image
-int lua_ImageDraw(lua_State *L)
+// Set render queue layer for next commands (0..255, lower layers drawn first)
+int lua_SetRenderLayer(lua_State *L)
 {
-    Image dst = LuaGetArgument_Image(L, 1);
-    Image src = LuaGetArgument_Image(L, 2);
-    Rectangle srcRec = LuaGetArgument_Rectangle(L, 3);
-    Rectangle dstRec = LuaGetArgument_Rectangle(L, 4);
-    ImageDraw(&dst, src, srcRec, dstRec);                   // WARNING: & required!
+    int layer = LuaGetArgument_int(L, 1);
+    renderQueue.layer = (layer < 0)? 0 : (layer > 255)? 255 : layer;
     return 0;
 }
 
-// Draw rectangle within an image
-int lua_ImageDrawRectangle(lua_State *L)
+// Set render queue depth for next commands (0..65535, lower depth drawn first on same state)
+int lua_SetRenderDepth(lua_State *L)
 {
-    Image dst = LuaGetArgument_Image(L, 1);
-    Vector2 position = LuaGetArgument_Vector2(L, 2);
-    Rectangle rec = LuaGetArgument_Rectangle(L, 3);
-    Color color = LuaGetArgument_Color(L, 4);
-    ImageDrawRectangle(dst, position, rec, color);
+    int depth = LuaGetArgument_int(L, 1);
+    renderQueue.depth = (depth < 0)? 0 : (depth > 65535)? 65535 : depth;
     return 0;
 }
 
-// Draw text (default font) within an image (destination)
-int lua_ImageDrawText(lua_State *L)
+// Get render queue stats since BeginRenderQueue(): commands, state changes in submission order, state changes sorted
+// NOTE: State changes (shader, blend mode or texture switches) break rlgl batching
+int lua_GetRenderQueueStats(lua_State *L)
 {
-    Image dst = LuaGetArgument_Image(L, 1);
-    Vector2 position = LuaGetArgument_Vector2(L, 2);
-    const char *text = LuaGetArgument_string(L, 3);         // WARNING: all const char require *
-    int fontSize = LuaGetArgument_int(L, 4);
-    Color color = LuaGetArgument_Color(L, 5);
-    ImageDrawText(&dst, position, text, fontSize, color);
-    return 0;
+    LuaPush_int(L, renderQueue.stats.commands);
+    LuaPush_int(L, renderQueue.stats.changesSubmitted);
+    LuaPush_int(L, renderQueue.stats.changesSorted);
+    return 3;
 }
 
-// Draw text (custom sprite font) within an image (destination)
-int lua_ImageDrawTextEx(lua_State *L)
+//------------------------------------------------------------------------------------
+// raylib [shapes] module functions - Basic Shapes Drawing
+//------------------------------------------------------------------------------------
+
+// Draw a pixel
+int lua_DrawPixel(lua_State *L)
 {
-    Image dst = LuaGetArgument_Image(L, 1);
-    Vector2 position = LuaGetArgument_Vector2(L, 2);
-    Font font = LuaGetArgument_Font(L, 3);
-    const char *text = LuaGetArgument_string(L, 4);
-    float fontSize = LuaGetArgument_float(L, 5);
-    float spacing = LuaGetArgument_float(L, 6);
-    Color color = LuaGetArgument_Color(L, 7);
-    ImageDrawTextEx(&dst, position, font, text, fontSize, spacing, color);
+    int posX = LuaGetArgument_int(L, 1);
+    int posY = LuaGetArgument_int(L, 2);
+    Color color = LuaGetArgument_Color(L, 3);
+    if (recordingList != NULL) RecordShapeCommand(COMMAND_PIXEL, (ShapeCommand){ .points = { { posX, posY } }, .colors = { color } });
+    else DrawPixel(posX, posY, color);
     return 0;
 }
 
-// Flip image vertically
-int lua_ImageFlipVertical(lua_State *L)
+// Draw a pixel (Vector version)
+int lua_DrawPixelV(lua_State *L)
 {
-    Image image = LuaGetArgument_Image(L, 1);
-    ImageFlipVertical(image);
+    Vector2 position = LuaGetArgument_Vector2(L, 1);
+    Color color = LuaGetArgument_Color(L, 2);
+    if (recordingList != NULL) RecordShapeCommand(COMMAND_PIXEL_V, (ShapeCommand){ .points = { position }, .colors = { color } });
+    else DrawPixelV(position, color);
     return 0;
 }
 
-// Flip image horizontally
-int lua_ImageFlipHorizontal(lua_State *L)
+// Draw a line
+int lua_DrawLine(lua_State *L)
 {
-    Image image = LuaGetArgument_Image(L, 1);
-    ImageFlipHorizontal(image);
+    int startPosX = LuaGetArgument_int(L, 1);
+    int startPosY = LuaGetArgument_int(L, 2);
+    int endPosX = LuaGetArgument_int(L, 3);
+    int endPosY = LuaGetArgument_int(L, 4);
+    Color color = LuaGetArgument_Color(L, 5);
+    if (recordingList != NULL) RecordShapeCommand(COMMAND_LINE, (ShapeCommand){ .points = { { startPosX, startPosY }, { endPosX, endPosY } }, .colors = { color } });
+    else DrawLine(startPosX, startPosY, endPosX, endPosY, color);
     return 0;
 }
 
-// Rotate image clockwise 90deg
-int lua_ImageRotateCW(lua_State *L)
+// Draw a line (Vector version)
+int lua_DrawLineV(lua_State *L)
 {
-    Image image = LuaGetArgument_Image(L, 1);
-    ImageRotateCW(image);
+    Vector2 startPos = LuaGetArgument_Vector2(L, 1);
+    Vector2 endPos = LuaGetArgument_Vector2(L, 2);
+    Color color = LuaGetArgument_Color(L, 3);
+    if (recordingList != NULL) RecordShapeCommand(COMMAND_LINE_V, (ShapeCommand){ .points = { startPos, endPos }, .colors = { color } });
+    else DrawLineV(startPos, endPos, color);
     return 0;
 }
 
-// Rotate image counter-clockwise 90deg
-int lua_ImageRotateCCW(lua_State *L)
+// Draw a line defining thickness
+int lua_DrawLineEx(lua_State *L)
 {
-    Image image = LuaGetArgument_Image(L, 1);
-    ImageRotateCCW(image);
+    Vector2 startPos = LuaGetArgument_Vector2(L, 1);
+    Vector2 endPos = LuaGetArgument_Vector2(L, 2);
+    float thick = LuaGetArgument_float(L, 3);
+    Color color = LuaGetArgument_Color(L, 4);
+    if (recordingList != NULL) RecordShapeCommand(COMMAND_LINE_EX, (ShapeCommand){ .points = { startPos, endPos }, .values = { thick }, .colors = { color } });
+    else DrawLineEx(startPos, endPos, thick, color);
     return 0;
 }
 
-// Modify image color: tint
-int lua_ImageColorTint(lua_State *L)
+// Draw a line using cubic-bezier curves in-out
+int lua_DrawLineBezier(lua_State *L)
 {
-    Image image = LuaGetArgument_Image(L, 1);
-    Color color = LuaGetArgument_Color(L, 2);
-    ImageColorTint(image, color);
+    Vector2 startPos = LuaGetArgument_Vector2(L, 1);
+    Vector2 endPos = LuaGetArgument_Vector2(L, 2);
+    float thick = LuaGetArgument_float(L, 3);
+    Color color = LuaGetArgument_Color(L, 4);
+    if (recordingList != NULL) RecordShapeCommand(COMMAND_LINE_BEZIER, (ShapeCommand){ .points = { startPos, endPos }, .values = { thick }, .colors = { color } });
+    else DrawLineBezier(startPos, endPos, thick, color);
     return 0;
 }
 
-// Modify image color: invert
-int lua_ImageColorInvert(lua_State *L)
+// Draw a color-filled circle
+int lua_DrawCircle(lua_State *L)
 {
-    Image image = LuaGetArgument_Image(L, 1);
-    ImageColorInvert(image);
+    int centerX = LuaGetArgument_int(L, 1);
+    int centerY = LuaGetArgument_int(L, 2);
+    float radius = LuaGetArgument_float(L, 3);
+    Color color = LuaGetArgument_Color(L, 4);
+    if (recordingList != NULL) RecordShapeCommand(COMMAND_CIRCLE, (ShapeCommand){ .points = { { centerX, centerY } }, .values = { radius }, .colors = { color } });
+    else DrawCircle(centerX, centerY, radius, color);
     return 0;
 }
 
-// Modify image color: grayscale
-int lua_ImageColorGrayscale(lua_State *L)
+// Draw a gradient-filled circle
+int lua_DrawCircleGradient(lua_State *L)
 {
-    Image image = LuaGetArgument_Image(L, 1);
-    ImageColorGrayscale(image);
+    int centerX = LuaGetArgument_int(L, 1);
+    int centerY = LuaGetArgument_int(L, 2);
+    float radius = LuaGetArgument_float(L, 3);
+    Color color1 = LuaGetArgument_Color(L, 4);
+    Color color2 = LuaGetArgument_Color(L, 5);
+    if (recordingList != NULL) RecordShapeCommand(COMMAND_CIRCLE_GRADIENT, (ShapeCommand){ .points = { { centerX, centerY } }, .values = { radius }, .colors = { color1, color2 } });
+    else DrawCircleGradient(centerX, centerY, radius, color1, color2);
     return 0;
 }
 
-// Modify image color: contrast (-100 to 100)
-int lua_ImageColorContrast(lua_State *L)
+// Draw a color-filled circle (Vector version)
+int lua_DrawCircleV(lua_State *L)
 {
-    Image image = LuaGetArgument_Image(L, 1);
-    float contrast = LuaGetArgument_float(L, 2);
-    ImageColorContrast(image, contrast);
+    Vector2 center = LuaGetArgument_Vector2(L, 1);
+    float radius = LuaGetArgument_float(L, 2);
+    Color color = LuaGetArgument_Color(L, 3);
+    if (recordingList != NULL) RecordShapeCommand(COMMAND_CIRCLE_V, (ShapeCommand){ .points = { center }, .values = { radius }, .colors = { color } });
+    else DrawCircleV(center, radius, color);
     return 0;
 }
 
-// Modify image color: brightness (-255 to 255)
-int lua_ImageColorBrightness(lua_State *L)
+// Draw circle outline
+int lua_DrawCircleLines(lua_State *L)
 {
-    Image image = LuaGetArgument_Image(L, 1);
-    int brightness = LuaGetArgument_int(L, 2);
-    ImageColorBrightness(image, brightness);
+    int centerX = LuaGetArgument_int(L, 1);
+    int centerY = LuaGetArgument_int(L, 2);
+    float radius = LuaGetArgument_float(L, 3);
+    Color color = LuaGetArgument_Color(L, 4);
+    if (recordingList != NULL) RecordShapeCommand(COMMAND_CIRCLE_LINES, (ShapeCommand){ .points = { { centerX, centerY } }, .values = { radius }, .colors = { color } });
+    else DrawCircleLines(centerX, centerY, radius, color);
     return 0;
 }
 
-// Modify image color: replace color
-int lua_ImageColorReplace(lua_State *L)
+// Draw a color-filled rectangle
+int lua_DrawRectangle(lua_State *L)
 {
-    Image image = LuaGetArgument_Image(L, 1);
-    Color color = LuaGetArgument_Color(L, 2);
-    Color replace = LuaGetArgument_Color(L, 3);
-    ImageColorReplace(image, color, replace);
+    int posX = LuaGetArgument_int(L, 1);
+    int posY = LuaGetArgument_int(L, 2);
+    int width = LuaGetArgument_int(L, 3);
+    int height = LuaGetArgument_int(L, 4);
+    Color color = LuaGetArgument_Color(L, 5);
+    if (recordingList != NULL) RecordShapeCommand(COMMAND_RECTANGLE, (ShapeCommand){ .points = { { posX, posY } }, .size = { width, height }, .colors = { color } });
+    else DrawRectangle(posX, posY, width, height, color);
     return 0;
 }
 
-// Image generation functions
-// Generate image: plain color
-int lua_GenImageColor(lua_State *L)
+// Draw a color-filled rectangle (Vector version)
+int lua_DrawRectangleV(lua_State *L)
 {
-    int width = LuaGetArgument_int(L, 1);
-    int height = LuaGetArgument_int(L, 2);
+    Vector2 position = LuaGetArgument_Vector2(L, 1);
+    Vector2 size = LuaGetArgument_Vector2(L, 2);
     Color color = LuaGetArgument_Color(L, 3);
-    Image result = GenImageColor(width, height, color);
-    LuaPush_Image(L, result);
-    return 1;
+    if (recordingList != NULL) RecordShapeCommand(COMMAND_RECTANGLE_V, (ShapeCommand){ .points = { position }, .size = size, .colors = { color } });
+    else DrawRectangleV(position, size, color);
+    return 0;
 }
 
-// Generate image: vertical gradient
-int lua_GenImageGradientV(lua_State *L)
+// Draw a color-filled rectangle
+int lua_DrawRectangleRec(lua_State *L)
 {
-    int width = LuaGetArgument_int(L, 1);
-    int height = LuaGetArgument_int(L, 2);
-    Color top = LuaGetArgument_Color(L, 3);
-    Color bottom = LuaGetArgument_Color(L, 4);
-    Image result = GenImageGradientV(width, height, top, bottom);
-    LuaPush_Image(L, result);
-    return 1;
+    Rectangle rec = LuaGetArgument_Rectangle(L, 1);
+    Color color = LuaGetArgument_Color(L, 2);
+    if (recordingList != NULL) RecordShapeCommand(COMMAND_RECTANGLE_REC, (ShapeCommand){ .points = { { rec.x, rec.y } }, .size = { rec.width, rec.height }, .colors = { color } });
+    else DrawRectangleRec(rec, color);
+    return 0;
 }
 
-// Generate image: horizontal gradient
-int lua_GenImageGradientH(lua_State *L)
+// Draw a color-filled rectangle with pro parameters
+int lua_DrawRectanglePro(lua_State *L)
 {
-    int width = LuaGetArgument_int(L, 1);
-    int height = LuaGetArgument_int(L, 2);
-    Color left = LuaGetArgument_Color(L, 3);
-    Color right = LuaGetArgument_Color(L, 4);
-    Image result = GenImageGradientH(width, height, left, right);
-    LuaPush_Image(L, result);
-    return 1;
+    Rectangle rec = LuaGetArgument_Rectangle(L, 1);
+    Vector2 origin = LuaGetArgument_Vector2(L, 2);
+    float rotation = LuaGetArgument_float(L, 3);
+    Color color = LuaGetArgument_Color(L, 4);
+    if (recordingList != NULL) RecordShapeCommand(COMMAND_RECTANGLE_PRO, (ShapeCommand){ .points = { { rec.x, rec.y } }, .size = { rec.width, rec.height }, .values = { rotation, origin.x, origin.y }, .colors = { color } });
+    else DrawRectanglePro(rec, origin, rotation, color);
+    return 0;
 }
 
-// Generate image: radial gradient
-int lua_GenImageGradientRadial(lua_State *L)
+// Draw a vertical-gradient-filled rectangle
+int lua_DrawRectangleGradientV(lua_State *L)
 {
-    int width = LuaGetArgument_int(L, 1);
-    int height = LuaGetArgument_int(L, 2);
-    float density = LuaGetArgument_float(L, 3);
-    Color inner = LuaGetArgument_Color(L, 4);
-    Color outer = LuaGetArgument_Color(L, 5);
-    Image result = GenImageGradientRadial(width, height, density, inner, outer);
-    LuaPush_Image(L, result);
-    return 1;
+    int posX = LuaGetArgument_int(L, 1);
+    int posY = LuaGetArgument_int(L, 2);
+    int width = LuaGetArgument_int(L, 3);
+    int height = LuaGetArgument_int(L, 4);
+    Color color1 = LuaGetArgument_Color(L, 5);
+    Color color2 = LuaGetArgument_Color(L, 6);
+    if (recordingList != NULL) RecordShapeCommand(COMMAND_RECTANGLE_GRADIENT_V, (ShapeCommand){ .points = { { posX, posY } }, .size = { width, height }, .colors = { color1, color2 } });
+    else DrawRectangleGradientV(posX, posY, width, height, color1, color2);
+    return 0;
 }
 
-// Generate image: checked
-int lua_GenImageChecked(lua_State *L)
+// Draw a horizontal-gradient-filled rectangle
+int lua_DrawRectangleGradientH(lua_State *L)
 {
-    int width = LuaGetArgument_int(L, 1);
-    int height = LuaGetArgument_int(L, 2);
-    int checksX = LuaGetArgument_int(L, 3);
-    int checksY = LuaGetArgument_int(L, 4);
-    Color col1 = LuaGetArgument_Color(L, 5);
-    Color col2 = LuaGetArgument_Color(L, 6);
-    Image result = GenImageChecked(width, height, checksX, checksY, col1, col2);
-    LuaPush_Image(L, result);
-    return 1;
+    int posX = LuaGetArgument_int(L, 1);
+    int posY = LuaGetArgument_int(L, 2);
+    int width = LuaGetArgument_int(L, 3);
+    int height = LuaGetArgument_int(L, 4);
+    Color color1 = LuaGetArgument_Color(L, 5);
+    Color color2 = LuaGetArgument_Color(L, 6);
+    if (recordingList != NULL) RecordShapeCommand(COMMAND_RECTANGLE_GRADIENT_H, (ShapeCommand){ .points = { { posX, posY } }, .size = { width, height }, .colors = { color1, color2 } });
+    else DrawRectangleGradientH(posX, posY, width, height, color1, color2);
+    return 0;
 }
 
-// Generate image: white noise
-int lua_GenImageWhiteNoise(lua_State *L)
+// Draw a gradient-filled rectangle with custom vertex colors
+int lua_DrawRectangleGradientEx(lua_State *L)
 {
-    int width = LuaGetArgument_int(L, 1);
-    int height = LuaGetArgument_int(L, 2);
-    float factor = LuaGetArgument_float(L, 3);
-    Image result = GenImageWhiteNoise(width, height, factor);
-    LuaPush_Image(L, result);
-    return 1;
+    Rectangle rec = LuaGetArgument_Rectangle(L, 1);
+    Color col1 = LuaGetArgument_Color(L, 2);
+    Color col2 = LuaGetArgument_Color(L, 3);
+    Color col3 = LuaGetArgument_Color(L, 4);
+    Color col4 = LuaGetArgument_Color(L, 5);
+    if (recordingList != NULL) RecordShapeCommand(COMMAND_RECTANGLE_GRADIENT_EX, (ShapeCommand){ .points = { { rec.x, rec.y } }, .size = { rec.width, rec.height }, .colors = { col1, col2, col3, col4 } });
+    else DrawRectangleGradientEx(rec, col1, col2, col3, col4);
+    return 0;
 }
 
-// Generate image: perlin noise
-int lua_GenImagePerlinNoise(lua_State *L)
+// Draw rectangle outline
+int lua_DrawRectangleLines(lua_State *L)
 {
-    int width = LuaGetArgument_int(L, 1);
-    int height = LuaGetArgument_int(L, 2);
-    int offsetX = LuaGetArgument_int(L, 3);
-    int offsetY = LuaGetArgument_int(L, 4);
-    float scale = LuaGetArgument_float(L, 5);
-    Image result = GenImagePerlinNoise(width, height, offsetX, offsetY, scale);
-    LuaPush_Image(L, result);
-    return 1;
+    int posX = LuaGetArgument_int(L, 1);
+    int posY = LuaGetArgument_int(L, 2);
+    int width = LuaGetArgument_int(L, 3);
+    int height = LuaGetArgument_int(L, 4);
+    Color color = LuaGetArgument_Color(L, 5);
+    if (recordingList != NULL) RecordShapeCommand(COMMAND_RECTANGLE_LINES, (ShapeCommand){ .points = { { posX, posY } }, .size = { width, height }, .colors = { color } });
+    else DrawRectangleLines(posX, posY, width, height, color);
+    return 0;
 }
 
-// Generate image: cellular algorithm. Bigger tileSize means bigger cells
-int lua_GenImageCellular(lua_State *L)
+// Draw rectangle outline with extended parameters
+int lua_DrawRectangleLinesEx(lua_State *L)
 {
-    int width = LuaGetArgument_int(L, 1);
-    int height = LuaGetArgument_int(L, 2);
-    int tileSize = LuaGetArgument_int(L, 3);
-    Image result = GenImageCellular(width, height, tileSize);
-    LuaPush_Image(L, result);
-    return 1;
+    Rectangle rec = LuaGetArgument_Rectangle(L, 1);
+    int lineThick = LuaGetArgument_int(L, 2);
+    Color color = LuaGetArgument_Color(L, 3);
+    if (recordingList != NULL) RecordShapeCommand(COMMAND_RECTANGLE_LINES_EX, (ShapeCommand){ .points = { { rec.x, rec.y } }, .size = { rec.width, rec.height }, .values = { lineThick }, .colors = { color } });
+    else DrawRectangleLinesEx(rec, lineThick, color);
+    return 0;
 }
 
-// Texture2D configuration functions
-
-// Generate GPU mipmaps for a texture
-int lua_GenTextureMipmaps(lua_State *L)
+// Draw a color-filled triangle
+int lua_DrawTriangle(lua_State *L)
 {
-    Texture2D texture = LuaGetArgument_Texture2D(L, 1);
-    GenTextureMipmaps(texture);
+    Vector2 v1 = LuaGetArgument_Vector2(L, 1);
+    Vector2 v2 = LuaGetArgument_Vector2(L, 2);
+    Vector2 v3 = LuaGetArgument_Vector2(L, 3);
+    Color color = LuaGetArgument_Color(L, 4);
+    if (recordingList != NULL) RecordShapeCommand(COMMAND_TRIANGLE, (ShapeCommand){ .points = { v1, v2, v3 }, .colors = { color } });
+    else DrawTriangle(v1, v2, v3, color);
     return 0;
 }
 
-// Set texture scaling filter mode
-int lua_SetTextureFilter(lua_State *L)
+// Draw triangle outline
+int lua_DrawTriangleLines(lua_State *L)
 {
-    Texture2D texture = LuaGetArgument_Texture2D(L, 1);
-    int filterMode = LuaGetArgument_int(L, 2);
-    SetTextureFilter(texture, filterMode);
+    Vector2 v1 = LuaGetArgument_Vector2(L, 1);
+    Vector2 v2 = LuaGetArgument_Vector2(L, 2);
+    Vector2 v3 = LuaGetArgument_Vector2(L, 3);
+    Color color = LuaGetArgument_Color(L, 4);
+    if (recordingList != NULL) RecordShapeCommand(COMMAND_TRIANGLE_LINES, (ShapeCommand){ .points = { v1, v2, v3 }, .colors = { color } });
+    else DrawTriangleLines(v1, v2, v3, color);
     return 0;
 }
 
-// Set texture wrapping mode
-int lua_SetTextureWrap(lua_State *L)
+// Draw a regular polygon (Vector version)
+int lua_DrawPoly(lua_State *L)
 {
-    Texture2D texture = LuaGetArgument_Texture2D(L, 1);
-    int wrapMode = LuaGetArgument_int(L, 2);
-    SetTextureWrap(texture, wrapMode);
+    Vector2 center = LuaGetArgument_Vector2(L, 1);
+    int sides = LuaGetArgument_int(L, 2);
+    float radius = LuaGetArgument_float(L, 3);
+    float rotation = LuaGetArgument_float(L, 4);
+    Color color = LuaGetArgument_Color(L, 5);
+    if (recordingList != NULL) RecordShapeCommand(COMMAND_POLY, (ShapeCommand){ .points = { center }, .values = { sides, radius, rotation }, .colors = { color } });
+    else DrawPoly(center, sides, radius, rotation, color);
     return 0;
 }
 
-// Texture2D drawing functions
 
-// Draw a Texture2D
-int lua_DrawTexture(lua_State *L)
+// TODO: This thing should be here?
+#define GET_TABLE(type, name, index) \
+    type* name = 0; \
+    size_t name##_size = 0; \
+    { \
+        size_t sz = 0; \
+        luaL_checktype(L, index, LUA_TTABLE); \
+        lua_pushnil(L); \
+        while (lua_next(L, index)) { \
+            LuaGetArgument_##type(L, -1); \
+            sz++; \
+            lua_pop(L, 1); \
+        } \
+        name = calloc(sz, sizeof(type)); \
+        sz = 0; \
+        lua_pushnil(L); \
+        while (lua_next(L, index)) { \
+            name[sz] = LuaGetArgument_##type(L, -1); \
+            sz++; \
+            lua_pop(L, 1); \
+        } \
+        lua_pop(L, 1); \
+        name##_size = sz; \
+    }
+
+// WARNING: Draw a closed polygon defined by points
+int lua_DrawPolyEx(lua_State* L)
 {
-    Texture2D texture = LuaGetArgument_Texture2D(L, 1);
-    int posX = LuaGetArgument_int(L, 2);
-    int posY = LuaGetArgument_int(L, 3);
-    Color tint = LuaGetArgument_Color(L, 4);
-    DrawTexture(texture, posX, posY, tint);
+    GET_TABLE(Vector2, arg1, 1);
+    Color arg2 = LuaGetArgument_Color(L, 2);
+    if (recordingList != NULL) RecordPolyCommand(COMMAND_POLY_EX, arg1, (int)arg1_size, arg2);
+    else DrawPolyEx(arg1, arg1_size, arg2);
+    free(arg1);
     return 0;
 }
 
-// Draw a Texture2D with position defined as Vector2
-int lua_DrawTextureV(lua_State *L)
+// WARNING: Draw polygon lines
+int lua_DrawPolyExLines(lua_State* L)
 {
-    Texture2D texture = LuaGetArgument_Texture2D(L, 1);
-    Vector2 position = LuaGetArgument_Vector2(L, 2);
-    Color tint = LuaGetArgument_Color(L, 3);
-    DrawTextureV(texture, position, tint);
+    GET_TABLE(Vector2, arg1, 1);
+    Color arg2 = LuaGetArgument_Color(L, 2);
+    if (recordingList != NULL) RecordPolyCommand(COMMAND_POLY_EX_LINES, arg1, (int)arg1_size, arg2);
+    else DrawPolyExLines(arg1, arg1_size, arg2);
+    free(arg1);
     return 0;
 }
 
-// Draw a Texture2D with extended parameters
-int lua_DrawTextureEx(lua_State *L)
+//------------------------------------------------------------------------------------
+// raylib-lua [shapes] module functions - Batched Shapes Drawing (typed buffers)
+//------------------------------------------------------------------------------------
+
+// NOTE: While recording a command list, every batch element is recorded as its Vector version shape command
+
+// Get batch elements count: optional count argument, limited by smallest buffer
+static int LuaGetBatchCount(lua_State *L, int index, TypedBuffer **buffers, int buffersCount)
 {
-    Texture2D texture = LuaGetArgument_Texture2D(L, 1);
-    Vector2 position = LuaGetArgument_Vector2(L, 2);
-    float rotation = LuaGetArgument_float(L, 3);
-    float scale = LuaGetArgument_float(L, 4);
-    Color tint = LuaGetArgument_Color(L, 5);
-    DrawTextureEx(texture, position, rotation, scale, tint);
-    return 0;
+    int count = buffers[0]->count;
+
+    for (int i = 1; i < buffersCount; i++)
+    {
+        if ((buffers[i] != NULL) && (buffers[i]->count < count)) count = buffers[i]->count;
+    }
+
+    if (!lua_isnoneornil(L, index))
+    {
+        int requested = LuaGetArgument_int(L, index);
+        luaL_argcheck(L, (requested >= 0) && (requested <= count), index, "Batch count exceeds buffers size");
+        count = requested;
+    }
+
+    return count;
 }
 
-// Draw a part of a texture defined by a rectangle
-int lua_DrawTextureRec(lua_State *L)
+// Get batch colors: IntBuffer of packed colors (0xRRGGBBAA), NULL if a single Color is provided
+static TypedBuffer *LuaGetBatchColors(lua_State *L, int index, Color *color)
 {
-    Texture2D texture = LuaGetArgument_Texture2D(L, 1);
-    Rectangle sourceRec = LuaGetArgument_Rectangle(L, 2);
-    Vector2 position = LuaGetArgument_Vector2(L, 3);
-    Color tint = LuaGetArgument_Color(L, 4);
-    DrawTextureRec(texture, sourceRec, position, tint);
-    return 0;
+    if (lua_type(L, index) == LUA_TTABLE)
+    {
+        *color = LuaGetArgument_Color(L, index);
+        return NULL;
+    }
+
+    return LuaGetArgument_Buffer(L, index, BUFFER_INT);
 }
 
-// Draw a part of a texture defined by a rectangle with 'pro' parameters
-int lua_DrawTexturePro(lua_State *L)
+// Draw color-filled rectangles: DrawRectanglesBatch(x, y, width, height, colors[, count])
+int lua_DrawRectanglesBatch(lua_State *L)
 {
-    Texture2D texture = LuaGetArgument_Texture2D(L, 1);
-    Rectangle sourceRec = LuaGetArgument_Rectangle(L, 2);
-    Rectangle destRec = LuaGetArgument_Rectangle(L, 3);
-    Vector2 origin = LuaGetArgument_Vector2(L, 4);
-    float rotation = LuaGetArgument_float(L, 5);
-    Color tint = LuaGetArgument_Color(L, 6);
-    DrawTexturePro(texture, sourceRec, destRec, origin, rotation, tint);
+    Color color = { 0 };
+    TypedBuffer *buffers[5] = {
+        LuaGetArgument_Buffer(L, 1, BUFFER_FLOAT), LuaGetArgument_Buffer(L, 2, BUFFER_FLOAT),
+        LuaGetArgument_Buffer(L, 3, BUFFER_FLOAT), LuaGetArgument_Buffer(L, 4, BUFFER_FLOAT),
+        LuaGetBatchColors(L, 5, &color) };
+    int count = LuaGetBatchCount(L, 6, buffers, 5);
+
+    const float *x = buffers[0]->floats, *y = buffers[1]->floats, *width = buffers[2]->floats, *height = buffers[3]->floats;
+    const int *colors = (buffers[4] != NULL)? buffers[4]->ints : NULL;
+
+    for (int i = 0; i < count; i++)
+    {
+        Vector2 position = { x[i], y[i] };
+        Vector2 size = { width[i], height[i] };
+        Color tint = (colors != NULL)? GetColor(colors[i]) : color;
+
+        if (recordingList != NULL) RecordShapeCommand(COMMAND_RECTANGLE_V, (ShapeCommand){ .points = { position }, .size = size, .colors = { tint } });
+        else DrawRectangleV(position, size, tint);
+    }
+
     return 0;
 }
 
-//------------------------------------------------------------------------------------
-// raylib [text] module functions - Font Loading and Text Drawing
+// Draw color-filled circles: DrawCirclesBatch(centerX, centerY, radius, colors[, count])
+int lua_DrawCirclesBatch(lua_State *L)
+{
+    Color color = { 0 };
+    TypedBuffer *buffers[4] = {
+        LuaGetArgument_Buffer(L, 1, BUFFER_FLOAT), LuaGetArgument_Buffer(L, 2, BUFFER_FLOAT),
+        LuaGetArgument_Buffer(L, 3, BUFFER_FLOAT), LuaGetBatchColors(L, 4, &color) };
+    int count = LuaGetBatchCount(L, 5, buffers, 4);
+
+    const float *x = buffers[0]->floats, *y = buffers[1]->floats, *radius = buffers[2]->floats;
+    const int *colors = (buffers[3] != NULL)? buffers[3]->ints : NULL;
+
+    for (int i = 0; i < count; i++)
+    {
+        Vector2 center = { x[i], y[i] };
+        Color tint = (colors != NULL)? GetColor(colors[i]) : color;
+
+        if (recordingList != NULL) RecordShapeCommand(COMMAND_CIRCLE_V, (ShapeCommand){ .points = { center }, .values = { radius[i] }, .colors = { tint } });
+        else DrawCircleV(center, radius[i], tint);
+    }
+
+    return 0;
+}
+
+// Draw lines: DrawLinesBatch(startX, startY, endX, endY, colors[, count])
+int lua_DrawLinesBatch(lua_State *L)
+{
+    Color color = { 0 };
+    TypedBuffer *buffers[5] = {
+        LuaGetArgument_Buffer(L, 1, BUFFER_FLOAT), LuaGetArgument_Buffer(L, 2, BUFFER_FLOAT),
+        LuaGetArgument_Buffer(L, 3, BUFFER_FLOAT), LuaGetArgument_Buffer(L, 4, BUFFER_FLOAT),
+        LuaGetBatchColors(L, 5, &color) };
+    int count = LuaGetBatchCount(L, 6, buffers, 5);
+
+    const float *startX = buffers[0]->floats, *startY = buffers[1]->floats, *endX = buffers[2]->floats, *endY = buffers[3]->floats;
+    const int *colors = (buffers[4] != NULL)? buffers[4]->ints : NULL;
+
+    for (int i = 0; i < count; i++)
+    {
+        Vector2 startPos = { startX[i], startY[i] };
+        Vector2 endPos = { endX[i], endY[i] };
+        Color tint = (colors != NULL)? GetColor(colors[i]) : color;
+
+        if (recordingList != NULL) RecordShapeCommand(COMMAND_LINE_V, (ShapeCommand){ .points = { startPos, endPos }, .colors = { tint } });
+        else DrawLineV(startPos, endPos, tint);
+    }
+
+    return 0;
+}
+
+// Draw pixels: DrawPixelsBatch(x, y, colors[, count])
+int lua_DrawPixelsBatch(lua_State *L)
+{
+    Color color = { 0 };
+    TypedBuffer *buffers[3] = {
+        LuaGetArgument_Buffer(L, 1, BUFFER_FLOAT), LuaGetArgument_Buffer(L, 2, BUFFER_FLOAT),
+        LuaGetBatchColors(L, 3, &color) };
+    int count = LuaGetBatchCount(L, 4, buffers, 3);
+
+    const float *x = buffers[0]->floats, *y = buffers[1]->floats;
+    const int *colors = (buffers[2] != NULL)? buffers[2]->ints : NULL;
+
+    for (int i = 0; i < count; i++)
+    {
+        Vector2 position = { x[i], y[i] };
+        Color tint = (colors != NULL)? GetColor(colors[i]) : color;
+
+        if (recordingList != NULL) RecordShapeCommand(COMMAND_PIXEL_V, (ShapeCommand){ .points = { position }, .colors = { tint } });
+        else DrawPixelV(position, tint);
+    }
+
+    return 0;
+}
+
+// Check collision between two rectangles
+int lua_CheckCollisionRecs(lua_State *L)
+{
+    Rectangle rec1 = LuaGetArgument_Rectangle(L, 1);
+    Rectangle rec2 = LuaGetArgument_Rectangle(L, 2);
+    bool result = CheckCollisionRecs(rec1, rec2);
+    LuaPush_bool(L, result);
+    return 1;
+}
+
+// Check collision between two circles
+int lua_CheckCollisionCircles(lua_State *L)
+{
+    Vector2 center1 = LuaGetArgument_Vector2(L, 1);
+    float radius1 = LuaGetArgument_float(L, 2);
+    Vector2 center2 = LuaGetArgument_Vector2(L, 3);
+    float radius2 = LuaGetArgument_float(L, 4);
+    bool result = CheckCollisionCircles(center1, radius1, center2, radius2);
+    LuaPush_bool(L, result);
+    return 1;
+}
+
+// Check collision between circle and rectangle
+int lua_CheckCollisionCircleRec(lua_State *L)
+{
+    Vector2 center = LuaGetArgument_Vector2(L, 1);
+    float radius = LuaGetArgument_float(L, 2);
+    Rectangle rec = LuaGetArgument_Rectangle(L, 3);
+    bool result = CheckCollisionCircleRec(center, radius, rec);
+    LuaPush_bool(L, result);
+    return 1;
+}
+
+// Get collision rectangle for two rectangles collision
+int lua_GetCollisionRec(lua_State *L)
+{
+    Rectangle rec1 = LuaGetArgument_Rectangle(L, 1);
+    Rectangle rec2 = LuaGetArgument_Rectangle(L, 2);
+    Rectangle result = GetCollisionRec(rec1, rec2);
+    LuaPush_Rectangle(L, result);
+    return 1;
+}
+
+// Check if point is inside rectangle
+int lua_CheckCollisionPointRec(lua_State *L)
+{
+    Vector2 point = LuaGetArgument_Vector2(L, 1);
+    Rectangle rec = LuaGetArgument_Rectangle(L, 2);
+    bool result = CheckCollisionPointRec(point, rec);
+    LuaPush_bool(L, result);
+    return 1;
+}
+
+// Check if point is inside circle
+int lua_CheckCollisionPointCircle(lua_State *L)
+{
+    Vector2 point = LuaGetArgument_Vector2(L, 1);
+    Vector2 center = LuaGetArgument_Vector2(L, 2);
+    float radius = LuaGetArgument_float(L, 3);
+    bool result = CheckCollisionPointCircle(point, center, radius);
+    LuaPush_bool(L, result);
+    return 1;
+}
+
+// Check if point is inside a triangle
+int lua_CheckCollisionPointTriangle(lua_State *L)
+{
+    Vector2 point = LuaGetArgument_Vector2(L, 1);
+    Vector2 p1 = LuaGetArgument_Vector2(L, 2);
+    Vector2 p2 = LuaGetArgument_Vector2(L, 3);
+    Vector2 p3 = LuaGetArgument_Vector2(L, 4);
+    bool result = CheckCollisionPointTriangle(point, p1, p2, p3);
+    LuaPush_bool(L, result);
+    return 1;
+}
+
+//------------------------------------------------------------------------------------
+// raylib [textures] module functions - Texture Loading and Drawing
+//------------------------------------------------------------------------------------
+
+// Load image from file into CPU memory (RAM)
+int lua_LoadImage(lua_State *L)
+{
+    const char *fileName = LuaGetArgument_string(L, 1);
+    Image result = LoadImage(fileName);
+    LuaPush_Image(L, result);
+    return 1;
+}
+
+// WARNING: Load image from Color array data (RGBA - 32bit)
+int lua_LoadImageEx(lua_State* L)
+{
+    // TODO: arg1 parameter is a Color array...
+    
+    GET_TABLE(Color, arg1, 1);              // Color *pixels
+    int arg2 = LuaGetArgument_int(L, 2);
+    int arg3 = LuaGetArgument_int(L, 3);
+    Image result = LoadImageEx(arg1, arg2, arg3); // ISSUE: #3 number expected, got no value
+    LuaPush_Image(L, result);
+    free(arg1);
+    return 1;
+}
+
+// WARNING: Load image from raw data with pro parameters
+int lua_LoadImagePro(lua_State* L)
+{
+    // TODO: arg1 parameter is a void pointer...
+    
+    void *arg1 = LuaGetArgument_ptr(L, 1);
+    int arg2 = LuaGetArgument_int(L, 2);
+    int arg3 = LuaGetArgument_int(L, 3);
+    int arg4 = LuaGetArgument_int(L, 4);
+    Image result = LoadImagePro(arg1, arg2, arg3, arg4);
+    LuaPush_Image(L, result);
+    free(arg1);
+    return 1;
+}
+
+// Load image from RAW file data
+int lua_LoadImageRaw(lua_State *L)
+{
+    const char *fileName = LuaGetArgument_string(L, 1);
+    int width = LuaGetArgument_int(L, 2);
+    int height = LuaGetArgument_int(L, 3);
+    int format = LuaGetArgument_int(L, 4);
+    int headerSize = LuaGetArgument_int(L, 5);
+    Image result = LoadImageRaw(fileName, width, height, format, headerSize);
+    LuaPush_Image(L, result);
+    return 1;
+}
+
+// Export image as a PNG file
+int lua_ExportImage(lua_State *L)
+{
+    const char *fileName = LuaGetArgument_string(L, 1);
+    Image image = LuaGetArgument_Image(L, 2);
+    ExportImage(fileName, image);
+    return 0;
+}
+
+// Load texture from file into GPU memory (VRAM)
+int lua_LoadTexture(lua_State *L)
+{
+    const char *fileName = LuaGetArgument_string(L, 1);
+    Texture2D result = LoadTexture(fileName);
+    LuaPush_Texture2D(L, result);
+    return 1;
+}
+
+// Load texture from image data
+int lua_LoadTextureFromImage(lua_State *L)
+{
+    Image image = LuaGetArgument_Image(L, 1);
+    Texture2D result = LoadTextureFromImage(image);
+    LuaPush_Texture2D(L, result);
+    return 1;
+}
+
+// Load texture for rendering (framebuffer)
+int lua_LoadRenderTexture(lua_State *L)
+{
+    int width = LuaGetArgument_int(L, 1);
+    int height = LuaGetArgument_int(L, 2);
+    RenderTexture2D result = LoadRenderTexture(width, height);
+    LuaPush_RenderTexture2D(L, result);
+    return 1;
+}
+
+// Unload image from CPU memory (RAM)
+int lua_UnloadImage(lua_State *L)
+{
+    Image image = LuaGetArgument_Image(L, 1);
+    UnloadImage(image);
+    return 0;
+}
+
+// Unload texture from GPU memory (VRAM)
+int lua_UnloadTexture(lua_State *L)
+{
+    Texture2D texture = LuaGetArgument_Texture2D(L, 1);
+    UnloadTexture(texture);
+    return 0;
+}
+
+// Unload render texture from GPU memory (VRAM)
+int lua_UnloadRenderTexture(lua_State *L)
+{
+    RenderTexture2D target = LuaGetArgument_RenderTexture2D(L, 1);
+    UnloadRenderTexture(target);
+    return 0;
+}
+
+// WARNING: Get pixel data from image as a Color struct array
+int lua_GetImageData(lua_State* L)
+{
+    // TODO: return value is a Color array
+
+    Image arg1 = LuaGetArgument_Image(L, 1);
+    Color *result = GetImageData(arg1);
+    lua_createtable(L, arg1.width*arg1.height, 0);
+    for (int i = 0; i < arg1.width*arg1.height; i++)
+    {
+        LuaPush_Color(L, result[i]);
+        lua_rawseti(L, -2, i + 1);
+    }
+    free(result);
+    return 1;
+}
+
+// WARNING: Get pixel data from image as Vector4 array (float normalized)
+int lua_GetImageDataNormalized(lua_State *L)
+{
+    // TODO.
+    
+    return 1;
+}
+
+// Get pixel data size in bytes (image or texture)
+int lua_GetPixelDataSize(lua_State *L)
+{
+    int width = LuaGetArgument_int(L, 1);
+    int height = LuaGetArgument_int(L, 2);
+    int format = LuaGetArgument_int(L, 3);
+    int result = GetPixelDataSize(width, height, format);
+    LuaPush_int(L, result);
+    return 1;
+}
+
+// Get pixel data from GPU texture and return an Image
+int lua_GetTextureData(lua_State *L)
+{
+    Texture2D texture = LuaGetArgument_Texture2D(L, 1);
+    Image result = GetTextureData(texture);
+    LuaPush_Image(L, result);
+    return 1;
+}
+
+
+// WARNING: Update GPU texture with new data
+int lua_UpdateTexture(lua_State* L)
+{
+    // TODO: arg2 parameters is a void pointer...
+    
+    Texture2D arg1 = LuaGetArgument_Texture2D(L, 1);
+    void *arg2 = LuaGetArgument_ptr(L, 2);
+    UpdateTexture(arg1, arg2);      // ISSUE: #2 string expected, got table -> GetImageData() returns a table!
+    return 0;
+}
+
+//----------------------------------------------------------------------------------
+// Image manipulation functions
+//----------------------------------------------------------------------------------
+
+// Create an image duplicate (useful for transformations)
+int lua_ImageCopy(lua_State *L)
+{
+    Image image = LuaGetArgument_Image(L, 1);
+    Image result = ImageCopy(image);
+    LuaPush_Image(L, result);
+    return 1;
+}
+
+// Convert image to POT (power-of-two)
+int lua_ImageToPOT(lua_State *L)
+{
+    Image image = LuaGetArgument_Image(L, 1);
+    Color fillColor = LuaGetArgument_Color(L, 2);
+    ImageToPOT(image, fillColor);
+    return 0;
+}
+
+// Convert image data to desired format
+int lua_ImageFormat(lua_State *L)
+{
+    Image image = LuaGetArgument_Image(L, 1);
+    int newFormat = LuaGetArgument_int(L, 2);
+    ImageFormat(image, newFormat);
+    return 0;
+}
+
+// Apply alpha mask to image
+int lua_ImageAlphaMask(lua_State *L)
+{
+    Image image = LuaGetArgument_Image(L, 1);
+    Image alphaMask = LuaGetArgument_Image(L, 2);
+    ImageAlphaMask(image, alphaMask);
+    return 0;
+}
+
+// Clear alpha channel to desired color
+int lua_ImageAlphaClear(lua_State *L)
+{
+    Image image = LuaGetArgument_Image(L, 1);
+    Color color = LuaGetArgument_Color(L, 2);
+    float threshold = LuaGetArgument_float(L, 3);
+    ImageAlphaClear(image, color, threshold);
+    return 0;
+}
+
+// Crop image depending on alpha value
+int lua_ImageAlphaCrop(lua_State *L)
+{
+    Image image = LuaGetArgument_Image(L, 1);
+    float threshold = LuaGetArgument_float(L, 2);
+    ImageAlphaCrop(image, threshold);
+    return 0;
+}
+
+// Premultiply alpha channel
+int lua_ImageAlphaPremultiply(lua_State *L)
+{
+    Image image = LuaGetArgument_Image(L, 1);
+    ImageAlphaPremultiply(image);
+    return 0;
+}
+
+// Crop an image to a defined rectangle
+int lua_ImageCrop(lua_State *L)
+{
+    Image image = LuaGetArgument_Image(L, 1);
+    Rectangle crop = LuaGetArgument_Rectangle(L, 2);
+    ImageCrop(image, crop);
+    return 0;
+}
+
+// Resize image (bilinear filtering)
+int lua_ImageResize(lua_State *L)
+{
+    Image image = LuaGetArgument_Image(L, 1);
+    int newWidth = LuaGetArgument_int(L, 2);
+    int newHeight = LuaGetArgument_int(L, 3);
+    ImageResize(image, newWidth, newHeight);
+    return 0;
+}
+
+// Resize image (Nearest-Neighbor scaling algorithm)
+int lua_ImageResizeNN(lua_State *L)
+{
+    Image image = LuaGetArgument_Image(L, 1);
+    int newWidth = LuaGetArgument_int(L, 2);
+    int newHeight = LuaGetArgument_int(L, 3);
+    ImageResizeNN(image, newWidth, newHeight);
+    return 0;
+}
+
+// Resize canvas and fill with color
+int lua_ImageResizeCanvas(lua_State *L)
+{
+    Image image = LuaGetArgument_Image(L, 1);
+    int newWidth = LuaGetArgument_int(L, 2);
+    int newHeight = LuaGetArgument_int(L, 3);
+    int offsetX = LuaGetArgument_int(L, 4);
+    int offsetY = LuaGetArgument_int(L, 5);
+    Color color = LuaGetArgument_Color(L, 6);
+    ImageResizeCanvas(image, newWidth, newHeight, offsetX, offsetY, color);
+    return 0;
+}
+
+// Generate all mipmap levels for a provided image
+int lua_ImageMipmaps(lua_State *L)
+{
+    Image image = LuaGetArgument_Image(L, 1);
+    ImageMipmaps(image);
+    return 0;
+}
+
+// Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
+int lua_ImageDither(lua_State *L)
+{
+    Image image = LuaGetArgument_Image(L, 1);
+    int rBpp = LuaGetArgument_int(L, 2);
+    int gBpp = LuaGetArgument_int(L, 3);
+    int bBpp = LuaGetArgument_int(L, 4);
+    int aBpp = LuaGetArgument_int(L, 5);
+    ImageDither(image, rBpp, gBpp, bBpp, aBpp);
+    return 0;
+}
+
+// Create an image from text (default font)
+int lua_ImageText(lua_State *L)
+{
+    const char *text = LuaGetArgument_string(L, 1);
+    int fontSize = LuaGetArgument_int(L, 2);
+    Color color = LuaGetArgument_Color(L, 3);
+    Image result = ImageText(text, fontSize, color);
+    LuaPush_Image(L, result);
+    return 1;
+}
+
+// Create an image from text (custom sprite font)
+int lua_ImageTextEx(lua_State *L)
+{
+    Font font = LuaGetArgument_Font(L, 1);
+    const char *text = LuaGetArgument_string(L, 2);
+    float fontSize = LuaGetArgument_float(L, 3);
+    float spacing = LuaGetArgument_float(L, 4);
+    Color tint = LuaGetArgument_Color(L, 5);
+    Image result = ImageTextEx(font, text, fontSize, spacing, tint);
+    LuaPush_Image(L, result);
+    return 1;
+}
+
+// Draw a source image within a destination image
+int lua_ImageDraw(lua_State *L)
+{
+    Image dst = LuaGetArgument_Image(L, 1);
+    Image src = LuaGetArgument_Image(L, 2);
+    Rectangle srcRec = LuaGetArgument_Rectangle(L, 3);
+    Rectangle dstRec = LuaGetArgument_Rectangle(L, 4);
+    ImageDraw(&dst, src, srcRec, dstRec);                   // WARNING: & required!
+    return 0;
+}
+
+// Draw rectangle within an image
+int lua_ImageDrawRectangle(lua_State *L)
+{
+    Image dst = LuaGetArgument_Image(L, 1);
+    Vector2 position = LuaGetArgument_Vector2(L, 2);
+    Rectangle rec = LuaGetArgument_Rectangle(L, 3);
+    Color color = LuaGetArgument_Color(L, 4);
+    ImageDrawRectangle(dst, position, rec, color);
+    return 0;
+}
+
+// Draw text (default font) within an image (destination)
+int lua_ImageDrawText(lua_State *L)
+{
+    Image dst = LuaGetArgument_Image(L, 1);
+    Vector2 position = LuaGetArgument_Vector2(L, 2);
+    const char *text = LuaGetArgument_string(L, 3);         // WARNING: all const char require *
+    int fontSize = LuaGetArgument_int(L, 4);
+    Color color = LuaGetArgument_Color(L, 5);
+    ImageDrawText(&dst, position, text, fontSize, color);
+    return 0;
+}
+
+// Draw text (custom sprite font) within an image (destination)
+int lua_ImageDrawTextEx(lua_State *L)
+{
+    Image dst = LuaGetArgument_Image(L, 1);
+    Vector2 position = LuaGetArgument_Vector2(L, 2);
+    Font font = LuaGetArgument_Font(L, 3);
+    const char *text = LuaGetArgument_string(L, 4);
+    float fontSize = LuaGetArgument_float(L, 5);
+    float spacing = LuaGetArgument_float(L, 6);
+    Color color = LuaGetArgument_Color(L, 7);
+    ImageDrawTextEx(&dst, position, font, text, fontSize, spacing, color);
+    return 0;
+}
+
+// Flip image vertically
+int lua_ImageFlipVertical(lua_State *L)
+{
+    Image image = LuaGetArgument_Image(L, 1);
+    ImageFlipVertical(image);
+    return 0;
+}
+
+// Flip image horizontally
+int lua_ImageFlipHorizontal(lua_State *L)
+{
+    Image image = LuaGetArgument_Image(L, 1);
+    ImageFlipHorizontal(image);
+    return 0;
+}
+
+// Rotate image clockwise 90deg
+int lua_ImageRotateCW(lua_State *L)
+{
+    Image image = LuaGetArgument_Image(L, 1);
+    ImageRotateCW(image);
+    return 0;
+}
+
+// Rotate image counter-clockwise 90deg
+int lua_ImageRotateCCW(lua_State *L)
+{
+    Image image = LuaGetArgument_Image(L, 1);
+    ImageRotateCCW(image);
+    return 0;
+}
+
+// Modify image color: tint
+int lua_ImageColorTint(lua_State *L)
+{
+    Image image = LuaGetArgument_Image(L, 1);
+    Color color = LuaGetArgument_Color(L, 2);
+    ImageColorTint(image, color);
+    return 0;
+}
+
+// Modify image color: invert
+int lua_ImageColorInvert(lua_State *L)
+{
+    Image image = LuaGetArgument_Image(L, 1);
+    ImageColorInvert(image);
+    return 0;
+}
+
+// Modify image color: grayscale
+int lua_ImageColorGrayscale(lua_State *L)
+{
+    Image image = LuaGetArgument_Image(L, 1);
+    ImageColorGrayscale(image);
+    return 0;
+}
+
+// Modify image color: contrast (-100 to 100)
+int lua_ImageColorContrast(lua_State *L)
+{
+    Image image = LuaGetArgument_Image(L, 1);
+    float contrast = LuaGetArgument_float(L, 2);
+    ImageColorContrast(image, contrast);
+    return 0;
+}
+
+// Modify image color: brightness (-255 to 255)
+int lua_ImageColorBrightness(lua_State *L)
+{
+    Image image = LuaGetArgument_Image(L, 1);
+    int brightness = LuaGetArgument_int(L, 2);
+    ImageColorBrightness(image, brightness);
+    return 0;
+}
+
+// Modify image color: replace color
+int lua_ImageColorReplace(lua_State *L)
+{
+    Image image = LuaGetArgument_Image(L, 1);
+    Color color = LuaGetArgument_Color(L, 2);
+    Color replace = LuaGetArgument_Color(L, 3);
+    ImageColorReplace(image, color, replace);
+    return 0;
+}
+
+// Image generation functions
+// Generate image: plain color
+int lua_GenImageColor(lua_State *L)
+{
+    int width = LuaGetArgument_int(L, 1);
+    int height = LuaGetArgument_int(L, 2);
+    Color color = LuaGetArgument_Color(L, 3);
+    Image result = GenImageColor(width, height, color);
+    LuaPush_Image(L, result);
+    return 1;
+}
+
+// Generate image: vertical gradient
+int lua_GenImageGradientV(lua_State *L)
+{
+    int width = LuaGetArgument_int(L, 1);
+    int height = LuaGetArgument_int(L, 2);
+    Color top = LuaGetArgument_Color(L, 3);
+    Color bottom = LuaGetArgument_Color(L, 4);
+    Image result = GenImageGradientV(width, height, top, bottom);
+    LuaPush_Image(L, result);
+    return 1;
+}
+
+// Generate image: horizontal gradient
+int lua_GenImageGradientH(lua_State *L)
+{
+    int width = LuaGetArgument_int(L, 1);
+    int height = LuaGetArgument_int(L, 2);
+    Color left = LuaGetArgument_Color(L, 3);
+    Color right = LuaGetArgument_Color(L, 4);
+    Image result = GenImageGradientH(width, height, left, right);
+    LuaPush_Image(L, result);
+    return 1;
+}
+
+// Generate image: radial gradient
+int lua_GenImageGradientRadial(lua_State *L)
+{
+    int width = LuaGetArgument_int(L, 1);
+    int height = LuaGetArgument_int(L, 2);
+    float density = LuaGetArgument_float(L, 3);
+    Color inner = LuaGetArgument_Color(L, 4);
+    Color outer = LuaGetArgument_Color(L, 5);
+    Image result = GenImageGradientRadial(width, height, density, inner, outer);
+    LuaPush_Image(L, result);
+    return 1;
+}
+
+// Generate image: checked
+int lua_GenImageChecked(lua_State *L)
+{
+    int width = LuaGetArgument_int(L, 1);
+    int height = LuaGetArgument_int(L, 2);
+    int checksX = LuaGetArgument_int(L, 3);
+    int checksY = LuaGetArgument_int(L, 4);
+    Color col1 = LuaGetArgument_Color(L, 5);
+    Color col2 = LuaGetArgument_Color(L, 6);
+    Image result = GenImageChecked(width, height, checksX, checksY, col1, col2);
+    LuaPush_Image(L, result);
+    return 1;
+}
+
+// Generate image: white noise
+int lua_GenImageWhiteNoise(lua_State *L)
+{
+    int width = LuaGetArgument_int(L, 1);
+    int height = LuaGetArgument_int(L, 2);
+    float factor = LuaGetArgument_float(L, 3);
+    Image result = GenImageWhiteNoise(width, height, factor);
+    LuaPush_Image(L, result);
+    return 1;
+}
+
+// Generate image: perlin noise
+int lua_GenImagePerlinNoise(lua_State *L)
+{
+    int width = LuaGetArgument_int(L, 1);
+    int height = LuaGetArgument_int(L, 2);
+    int offsetX = LuaGetArgument_int(L, 3);
+    int offsetY = LuaGetArgument_int(L, 4);
+    float scale = LuaGetArgument_float(L, 5);
+    Image result = GenImagePerlinNoise(width, height, offsetX, offsetY, scale);
+    LuaPush_Image(L, result);
+    return 1;
+}
+
+// Generate image: cellular algorithm. Bigger tileSize means bigger cells
+int lua_GenImageCellular(lua_State *L)
+{
+    int width = LuaGetArgument_int(L, 1);
+    int height = LuaGetArgument_int(L, 2);
+    int tileSize = LuaGetArgument_int(L, 3);
+    Image result = GenImageCellular(width, height, tileSize);
+    LuaPush_Image(L, result);
+    return 1;
+}
+
+// Texture2D configuration functions
+
+// Generate GPU mipmaps for a texture
+int lua_GenTextureMipmaps(lua_State *L)
+{
+    Texture2D texture = LuaGetArgument_Texture2D(L, 1);
+    GenTextureMipmaps(texture);
+    return 0;
+}
+
+// Set texture scaling filter mode
+int lua_SetTextureFilter(lua_State *L)
+{
+    Texture2D texture = LuaGetArgument_Texture2D(L, 1);
+    int filterMode = LuaGetArgument_int(L, 2);
+    SetTextureFilter(texture, filterMode);
+    return 0;
+}
+
+// Set texture wrapping mode
+int lua_SetTextureWrap(lua_State *L)
+{
+    Texture2D texture = LuaGetArgument_Texture2D(L, 1);
+    int wrapMode = LuaGetArgument_int(L, 2);
+    SetTextureWrap(texture, wrapMode);
+    return 0;
+}
+
+// Texture2D drawing functions
+
+// Draw a Texture2D
+int lua_DrawTexture(lua_State *L)
+{
+    Texture2D texture = LuaGetArgument_Texture2D(L, 1);
+    int posX = LuaGetArgument_int(L, 2);
+    int posY = LuaGetArgument_int(L, 3);
+    Color tint = LuaGetArgument_Color(L, 4);
+    if (recordingList != NULL) RecordTextureCommand((TextureCommand){ texture, { 0, 0, texture.width, texture.height }, { posX, posY, texture.width, texture.height }, { 0, 0 }, 0, tint });
+    else DrawTexture(texture, posX, posY, tint);
+    return 0;
+}
+
+// Draw a Texture2D with position defined as Vector2
+int lua_DrawTextureV(lua_State *L)
+{
+    Texture2D texture = LuaGetArgument_Texture2D(L, 1);
+    Vector2 position = LuaGetArgument_Vector2(L, 2);
+    Color tint = LuaGetArgument_Color(L, 3);
+    if (recordingList != NULL) RecordTextureCommand((TextureCommand){ texture, { 0, 0, texture.width, texture.height }, { position.x, position.y, texture.width, texture.height }, { 0, 0 }, 0, tint });
+    else DrawTextureV(texture, position, tint);
+    return 0;
+}
+
+// Draw a Texture2D with extended parameters
+int lua_DrawTextureEx(lua_State *L)
+{
+    Texture2D texture = LuaGetArgument_Texture2D(L, 1);
+    Vector2 position = LuaGetArgument_Vector2(L, 2);
+    float rotation = LuaGetArgument_float(L, 3);
+    float scale = LuaGetArgument_float(L, 4);
+    Color tint = LuaGetArgument_Color(L, 5);
+    if (recordingList != NULL) RecordTextureCommand((TextureCommand){ texture, { 0, 0, texture.width, texture.height }, { position.x, position.y, texture.width*scale, texture.height*scale }, { 0, 0 }, rotation, tint });
+    else DrawTextureEx(texture, position, rotation, scale, tint);
+    return 0;
+}
+
+// Draw a part of a texture defined by a rectangle
+int lua_DrawTextureRec(lua_State *L)
+{
+    Texture2D texture = LuaGetArgument_Texture2D(L, 1);
+    Rectangle sourceRec = LuaGetArgument_Rectangle(L, 2);
+    Vector2 position = LuaGetArgument_Vector2(L, 3);
+    Color tint = LuaGetArgument_Color(L, 4);
+    if (recordingList != NULL) RecordTextureCommand((TextureCommand){ texture, sourceRec, { position.x, position.y, fabsf(sourceRec.width), fabsf(sourceRec.height) }, { 0, 0 }, 0, tint });
+    else DrawTextureRec(texture, sourceRec, position, tint);
+    return 0;
+}
+
+// Draw a part of a texture defined by a rectangle with 'pro' parameters
+int lua_DrawTexturePro(lua_State *L)
+{
+    Texture2D texture = LuaGetArgument_Texture2D(L, 1);
+    Rectangle sourceRec = LuaGetArgument_Rectangle(L, 2);
+    Rectangle destRec = LuaGetArgument_Rectangle(L, 3);
+    Vector2 origin = LuaGetArgument_Vector2(L, 4);
+    float rotation = LuaGetArgument_float(L, 5);
+    Color tint = LuaGetArgument_Color(L, 6);
+    if (recordingList != NULL) RecordTextureCommand((TextureCommand){ texture, sourceRec, destRec, origin, rotation, tint });
+    else DrawTexturePro(texture, sourceRec, destRec, origin, rotation, tint);
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// raylib-lua [textures] module functions - Sprite batches
+//------------------------------------------------------------------------------------
+
+// Grow sprite batch vertex arrays to fit count sprites (capacity doubles)
+static void SpriteBatchReserve(SpriteBatch *batch, int count)
+{
+    if (count <= batch->capacity) return;
+
+    int capacity = (batch->capacity > 0)? batch->capacity : RLUA_SPRITEBATCH_CAPACITY;
+    while (capacity < count) capacity *= 2;
+
+    batch->vertices = (Vector2 *)realloc(batch->vertices, 4*capacity*sizeof(Vector2));
+    batch->texcoords = (Vector2 *)realloc(batch->texcoords, 4*capacity*sizeof(Vector2));
+    batch->colors = (Color *)realloc(batch->colors, capacity*sizeof(Color));
+    batch->capacity = capacity;
+}
+
+// Append one sprite, same transformation as DrawTexturePro()
+static void SpriteBatchPush(SpriteBatch *batch, Rectangle sourceRec, Rectangle destRec, Vector2 origin, float rotation, Color tint)
+{
+    SpriteBatchReserve(batch, batch->count + 1);
+
+    float width = (float)batch->texture.width;
+    float height = (float)batch->texture.height;
+
+    if (sourceRec.width < 0) sourceRec.x -= sourceRec.width;
+    if (sourceRec.height < 0) sourceRec.y -= sourceRec.height;
+
+    // Quad corners (local space): bottom-left, bottom-right, top-right, top-left (as DrawTexturePro)
+    float cornersX[4] = { 0.0f, 0.0f, destRec.width, destRec.width };
+    float cornersY[4] = { 0.0f, destRec.height, destRec.height, 0.0f };
+    float texcoordsX[4] = { sourceRec.x/width, sourceRec.x/width, (sourceRec.x + sourceRec.width)/width, (sourceRec.x + sourceRec.width)/width };
+    float texcoordsY[4] = { sourceRec.y/height, (sourceRec.y + sourceRec.height)/height, (sourceRec.y + sourceRec.height)/height, sourceRec.y/height };
+
+    float sinRotation = sinf(rotation*DEG2RAD);
+    float cosRotation = cosf(rotation*DEG2RAD);
+
+    Vector2 *vertices = batch->vertices + 4*batch->count;
+    Vector2 *texcoords = batch->texcoords + 4*batch->count;
+
+    for (int i = 0; i < 4; i++)
+    {
+        float x = cornersX[i] - origin.x;
+        float y = cornersY[i] - origin.y;
+
+        vertices[i] = (Vector2){ destRec.x + x*cosRotation - y*sinRotation, destRec.y + x*sinRotation + y*cosRotation };
+        texcoords[i] = (Vector2){ texcoordsX[i], texcoordsY[i] };
+    }
+
+    batch->colors[batch->count] = tint;
+    batch->count++;
+}
+
+// Create a sprite batch for a texture: SpriteBatch(texture[, capacity])
+int lua_SpriteBatch(lua_State *L)
+{
+    Texture2D texture = LuaGetArgument_Texture2D(L, 1);
+    int capacity = (int)luaL_optinteger(L, 2, RLUA_SPRITEBATCH_CAPACITY);
+    luaL_argcheck(L, capacity > 0, 2, "Expected capacity > 0");
+
+    SpriteBatch *batch = (SpriteBatch *)lua_newuserdata(L, sizeof(SpriteBatch));
+    memset(batch, 0, sizeof(SpriteBatch));
+    batch->texture = texture;
+    luaL_setmetatable(L, "SpriteBatch");
+
+    SpriteBatchReserve(batch, capacity);
+
+    return 1;
+}
+
+// Add a sprite, same parameters as DrawTexturePro(): batch:add(sourceRec, destRec, origin, rotation, tint)
+static int LuaSpriteBatchAdd(lua_State *L)
+{
+    SpriteBatch *batch = (SpriteBatch *)luaL_checkudata(L, 1, "SpriteBatch");
+    Rectangle sourceRec = LuaGetArgument_Rectangle(L, 2);
+    Rectangle destRec = LuaGetArgument_Rectangle(L, 3);
+    Vector2 origin = LuaGetArgument_Vector2(L, 4);
+    float rotation = LuaGetArgument_float(L, 5);
+    Color tint = LuaGetArgument_Color(L, 6);
+    SpriteBatchPush(batch, sourceRec, destRec, origin, rotation, tint);
+    return 0;
+}
+
+// Add sprites from typed buffers, full texture as source and sprites centered on (x, y)
+// batch:addBuffers(x, y, width, height, rotation, colors[, count]), rotation can be nil
+static int LuaSpriteBatchAddBuffers(lua_State *L)
+{
+    SpriteBatch *batch = (SpriteBatch *)luaL_checkudata(L, 1, "SpriteBatch");
+    Color color = { 0 };
+    TypedBuffer *buffers[6] = {
+        LuaGetArgument_Buffer(L, 2, BUFFER_FLOAT), LuaGetArgument_Buffer(L, 3, BUFFER_FLOAT),
+        LuaGetArgument_Buffer(L, 4, BUFFER_FLOAT), LuaGetArgument_Buffer(L, 5, BUFFER_FLOAT),
+        lua_isnoneornil(L, 6)? NULL : LuaGetArgument_Buffer(L, 6, BUFFER_FLOAT), LuaGetBatchColors(L, 7, &color) };
+    int count = LuaGetBatchCount(L, 8, buffers, 6);
+
+    const float *x = buffers[0]->floats, *y = buffers[1]->floats, *width = buffers[2]->floats, *height = buffers[3]->floats;
+    const float *rotation = (buffers[4] != NULL)? buffers[4]->floats : NULL;
+    const int *colors = (buffers[5] != NULL)? buffers[5]->ints : NULL;
+    Rectangle sourceRec = { 0.0f, 0.0f, (float)batch->texture.width, (float)batch->texture.height };
+
+    SpriteBatchReserve(batch, batch->count + count);
+
+    for (int i = 0; i < count; i++)
+    {
+        SpriteBatchPush(batch, sourceRec, (Rectangle){ x[i], y[i], width[i], height[i] }, (Vector2){ width[i]/2, height[i]/2 },
+                        (rotation != NULL)? rotation[i] : 0.0f, (colors != NULL)? GetColor(colors[i]) : color);
+    }
+
+    return 0;
+}
+
+// Submit sprites to rlgl, displaced by offset
+// NOTE: Sprites are submitted in chunks to rlgl, flushing rlgl internal batch between chunks
+static void SpriteBatchSubmit(const SpriteBatch *batch, Vector2 offset)
+{
+    for (int start = 0; start < batch->count; start += RLUA_SPRITEBATCH_CHUNK)
+    {
+        int end = (start + RLUA_SPRITEBATCH_CHUNK < batch->count)? (start + RLUA_SPRITEBATCH_CHUNK) : batch->count;
+
+        if (start > 0) rlglDraw();
+
+        rlEnableTexture(batch->texture.id);
+        rlBegin(RL_QUADS);
+        rlNormal3f(0.0f, 0.0f, 1.0f);
+
+        for (int i = start; i < end; i++)
+        {
+            Color tint = batch->colors[i];
+
+            for (int v = 4*i; v < 4*i + 4; v++)
+            {
+                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+                rlTexCoord2f(batch->texcoords[v].x, batch->texcoords[v].y);
+                rlVertex2f(batch->vertices[v].x + offset.x, batch->vertices[v].y + offset.y);
+            }
+        }
+
+        rlEnd();
+        rlDisableTexture();
+    }
+}
+
+// Draw all sprites added and clear batch (vertex arrays are kept)
+// NOTE: While a command list is being recorded, sprites are recorded instead
+static void SpriteBatchDraw(SpriteBatch *batch)
+{
+    if (recordingList != NULL) RecordSpritesCommand(batch, (Vector2){ 0.0f, 0.0f });
+    else SpriteBatchSubmit(batch, (Vector2){ 0.0f, 0.0f });
+
+    batch->count = 0;
+}
+
+// Draw all sprites added and clear batch: batch:flush()
+static int LuaSpriteBatchFlush(lua_State *L)
+{
+    SpriteBatch *batch = (SpriteBatch *)luaL_checkudata(L, 1, "SpriteBatch");
+    SpriteBatchDraw(batch);
+    return 0;
+}
+
+// Remove all sprites added without drawing them: batch:clear()
+static int LuaSpriteBatchClear(lua_State *L)
+{
+    SpriteBatch *batch = (SpriteBatch *)luaL_checkudata(L, 1, "SpriteBatch");
+    batch->count = 0;
+    return 0;
+}
+
+// Sprites added since last flush: #batch
+static int LuaSpriteBatchCount(lua_State *L)
+{
+    SpriteBatch *batch = (SpriteBatch *)luaL_checkudata(L, 1, "SpriteBatch");
+    LuaPush_int(L, batch->count);
+    return 1;
+}
+
+// Free sprite batch vertex arrays (texture is not unloaded)
+static void SpriteBatchFree(SpriteBatch *batch)
+{
+    free(batch->vertices);
+    free(batch->texcoords);
+    free(batch->colors);
+    batch->vertices = NULL;
+    batch->texcoords = NULL;
+    batch->colors = NULL;
+    batch->capacity = 0;
+    batch->count = 0;
+}
+
+static int LuaSpriteBatchGC(lua_State *L)
+{
+    SpriteBatch *batch = (SpriteBatch *)luaL_checkudata(L, 1, "SpriteBatch");
+    SpriteBatchFree(batch);
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// raylib-lua [textures] module functions - Particle systems
+//------------------------------------------------------------------------------------
+
+// Particle system random value in range [min, max] (xorshift32, one state per system)
+static float ParticlesRandom(ParticleSystem *system, float min, float max)
+{
+    unsigned int x = system->randomState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    system->randomState = x;
+
+    return min + (max - min)*((x >> 8)*(1.0f/16777216.0f));
+}
+
+// Spawn particles from an emitter (as many as free capacity allows)
+static void ParticlesSpawn(ParticleSystem *system, int emitterIndex, int count)
+{
+    ParticleEmitter *emitter = &system->emitters[emitterIndex];
+
+    if (count > system->capacity - system->count) count = system->capacity - system->count;
+    if (count <= 0) return;
+
+    for (int i = system->count; i < system->count + count; i++)
+    {
+        float angle = (emitter->direction + ParticlesRandom(system, -emitter->spread/2, emitter->spread/2))*DEG2RAD;
+        float speed = ParticlesRandom(system, emitter->speedMin, emitter->speedMax);
+
+        system->x[i] = emitter->position.x;
+        system->y[i] = emitter->position.y;
+        system->vx[i] = cosf(angle)*speed;
+        system->vy[i] = sinf(angle)*speed;
+        system->ax[i] = emitter->gravity.x;
+        system->ay[i] = emitter->gravity.y;
+        system->rotation[i] = ParticlesRandom(system, 0.0f, 360.0f);
+        system->spin[i] = ParticlesRandom(system, emitter->spinMin, emitter->spinMax);
+        system->age[i] = 0.0f;
+        system->life[i] = ParticlesRandom(system, emitter->lifeMin, emitter->lifeMax);
+        system->emitter[i] = (unsigned char)emitterIndex;
+    }
+
+    system->count += count;
+}
+
+// Integrate particles in range [start, end)
+// NOTE: Struct-of-arrays loop without branches, vectorized by compilers (SSE/NEON)
+static void ParticlesIntegrate(ParticleSystem *system, int start, int end, float dt)
+{
+    float *x = system->x, *y = system->y;
+    float *vx = system->vx, *vy = system->vy;
+    const float *ax = system->ax, *ay = system->ay;
+    float *rotation = system->rotation, *age = system->age;
+    const float *spin = system->spin;
+
+    for (int i = start; i < end; i++)
+    {
+        vx[i] += ax[i]*dt;
+        vy[i] += ay[i]*dt;
+        x[i] += vx[i]*dt;
+        y[i] += vy[i]*dt;
+        rotation[i] += spin[i]*dt;
+        age[i] += dt;
+    }
+}
+
+#if defined(RLUA_THREADS) && (RLUA_PARTICLES_THREADS > 1)
+// Particles integration job, run by a worker thread
+typedef struct ParticlesJob {
+    ParticleSystem *system;
+    int start;
+    int end;
+    float dt;
+} ParticlesJob;
+
+// Particles integration workers, started on first big update and kept waiting for jobs (shared by all systems)
+typedef struct ParticlesWorkers {
+    bool started;                   // Workers start attempted
+    bool quit;                      // Workers must exit (device closed)
+    int count;                      // Workers running
+    pthread_t threads[RLUA_PARTICLES_THREADS - 1];
+    pthread_mutex_t mutex;          // Protects jobs and counters
+    pthread_cond_t jobsReady;       // Signaled when jobs are posted (or on quit)
+    pthread_cond_t jobsDone;        // Signaled when last pending job is done
+    ParticlesJob jobs[RLUA_PARTICLES_THREADS - 1];
+    unsigned int generation;        // Jobs posted counter, workers run their job once per generation
+    int active;                     // Workers with a job in current generation (first ones)
+    int pending;                    // Jobs not done in current generation
+} ParticlesWorkers;
+
+static ParticlesWorkers particlesWorkers = { 0 };
+
+// Particles worker: wait for a new jobs generation, integrate its job range (if any), repeat until quit
+static void *ParticlesWorker(void *arg)
+{
+    ParticlesWorkers *workers = &particlesWorkers;
+    int index = (int)(size_t)arg;
+    unsigned int generation = 0;
+
+    pthread_mutex_lock(&workers->mutex);
+
+    while (true)
+    {
+        while (!workers->quit && (workers->generation == generation)) pthread_cond_wait(&workers->jobsReady, &workers->mutex);
+        if (workers->quit) break;
+
+        generation = workers->generation;
+        if (index >= workers->active) continue;
+
+        ParticlesJob job = workers->jobs[index];
+
+        pthread_mutex_unlock(&workers->mutex);
+        ParticlesIntegrate(job.system, job.start, job.end, job.dt);
+        pthread_mutex_lock(&workers->mutex);
+
+        if (--workers->pending == 0) pthread_cond_signal(&workers->jobsDone);
+    }
+
+    pthread_mutex_unlock(&workers->mutex);
+    return NULL;
+}
+
+// Start particles workers (first call only), returns workers running
+static int ParticlesWorkersStart(void)
+{
+    ParticlesWorkers *workers = &particlesWorkers;
+
+    if (!workers->started)
+    {
+        workers->started = true;
+        pthread_mutex_init(&workers->mutex, NULL);
+        pthread_cond_init(&workers->jobsReady, NULL);
+        pthread_cond_init(&workers->jobsDone, NULL);
+
+        for (int t = 0; t < RLUA_PARTICLES_THREADS - 1; t++)
+        {
+            if (pthread_create(&workers->threads[workers->count], NULL, ParticlesWorker, (void *)(size_t)workers->count) == 0) workers->count++;
+        }
+    }
+
+    return workers->count;
+}
+
+// Stop particles workers (waits for them to exit)
+static void ParticlesWorkersStop(void)
+{
+    ParticlesWorkers *workers = &particlesWorkers;
+    if (!workers->started) return;
+
+    pthread_mutex_lock(&workers->mutex);
+    workers->quit = true;
+    pthread_cond_broadcast(&workers->jobsReady);
+    pthread_mutex_unlock(&workers->mutex);
+
+    for (int t = 0; t < workers->count; t++) pthread_join(workers->threads[t], NULL);
+
+    pthread_mutex_destroy(&workers->mutex);
+    pthread_cond_destroy(&workers->jobsReady);
+    pthread_cond_destroy(&workers->jobsDone);
+    memset(workers, 0, sizeof(ParticlesWorkers));
+}
+
+// Integrate particles on workers, first ranges posted as jobs, last range integrated by this thread
+static void ParticlesIntegrateParallel(ParticleSystem *system, int threads, float dt)
+{
+    ParticlesWorkers *workers = &particlesWorkers;
+    int rangeSize = (system->count + threads - 1)/threads;
+
+    pthread_mutex_lock(&workers->mutex);
+
+    for (int t = 0; t < threads - 1; t++)
+    {
+        int start = t*rangeSize;
+        int end = (start + rangeSize < system->count)? (start + rangeSize) : system->count;
+        workers->jobs[t] = (ParticlesJob){ system, start, end, dt };
+    }
+
+    workers->active = threads - 1;
+    workers->pending = threads - 1;
+    workers->generation++;
+    pthread_cond_broadcast(&workers->jobsReady);
+    pthread_mutex_unlock(&workers->mutex);
+
+    int start = (threads - 1)*rangeSize;
+    if (start < system->count) ParticlesIntegrate(system, start, system->count, dt);
+
+    pthread_mutex_lock(&workers->mutex);
+    while (workers->pending > 0) pthread_cond_wait(&workers->jobsDone, &workers->mutex);
+    pthread_mutex_unlock(&workers->mutex);
+}
+#endif
+
+// Update particle system: spawn, integrate (multi-threaded for big systems) and remove dead particles
+static void ParticlesUpdate(ParticleSystem *system, float dt)
+{
+    for (int e = 0; e < system->emittersCount; e++)
+    {
+        ParticleEmitter *emitter = &system->emitters[e];
+
+        if (!emitter->active || (emitter->rate <= 0.0f)) continue;
+
+        emitter->spawnAccumulator += emitter->rate*dt;
+        int spawnCount = (int)emitter->spawnAccumulator;
+        emitter->spawnAccumulator -= spawnCount;
+
+        ParticlesSpawn(system, e, spawnCount);
+    }
+
+    int threads = 1;
+
+#if defined(RLUA_THREADS) && (RLUA_PARTICLES_THREADS > 1)
+    threads = system->count/RLUA_PARTICLES_THREAD_MIN;
+    if (threads > RLUA_PARTICLES_THREADS) threads = RLUA_PARTICLES_THREADS;
+
+    // Workers are persistent, thread creation cost is paid once
+    if (threads > 1)
+    {
+        int workersCount = ParticlesWorkersStart();
+        if (threads > workersCount + 1) threads = workersCount + 1;
+        if (threads > 1) ParticlesIntegrateParallel(system, threads, dt);
+    }
+#endif
+
+    if (threads <= 1) ParticlesIntegrate(system, 0, system->count, dt);
+
+    // Remove dead particles, last particle is moved into its slot (order is not kept)
+    for (int i = 0; i < system->count; )
+    {
+        if (system->age[i] >= system->life[i])
+        {
+            int last = --system->count;
+
+            system->x[i] = system->x[last];
+            system->y[i] = system->y[last];
+            system->vx[i] = system->vx[last];
+            system->vy[i] = system->vy[last];
+            system->ax[i] = system->ax[last];
+            system->ay[i] = system->ay[last];
+            system->rotation[i] = system->rotation[last];
+            system->spin[i] = system->spin[last];
+            system->age[i] = system->age[last];
+            system->life[i] = system->life[last];
+            system->emitter[i] = system->emitter[last];
+        }
+        else i++;
+    }
+}
+
+// Draw particle system, size and color interpolated over particles life
+static void ParticlesDraw(ParticleSystem *system)
+{
+    Rectangle sourceRec = { 0.0f, 0.0f, (float)system->texture.width, (float)system->texture.height };
+
+    system->batch.count = 0;
+    SpriteBatchReserve(&system->batch, system->count);
+
+    for (int i = 0; i < system->count; i++)
+    {
+        const ParticleEmitter *emitter = &system->emitters[system->emitter[i]];
+        float t = (system->life[i] > 0.0f)? (system->age[i]/system->life[i]) : 1.0f;
+        float size = emitter->sizeStart + (emitter->sizeEnd - emitter->sizeStart)*t;
+        Color color = {
+            (unsigned char)(emitter->colorStart.r + (emitter->colorEnd.r - emitter->colorStart.r)*t),
+            (unsigned char)(emitter->colorStart.g + (emitter->colorEnd.g - emitter->colorStart.g)*t),
+            (unsigned char)(emitter->colorStart.b + (emitter->colorEnd.b - emitter->colorStart.b)*t),
+            (unsigned char)(emitter->colorStart.a + (emitter->colorEnd.a - emitter->colorStart.a)*t) };
+
+        SpriteBatchPush(&system->batch, sourceRec, (Rectangle){ system->x[i], system->y[i], size, size },
+                        (Vector2){ size/2, size/2 }, system->rotation[i], color);
+    }
+
+    SpriteBatchDraw(&system->batch);
+}
+
+// Read emitter configuration from table, only fields defined are changed
+static void LuaGetArgument_ParticleEmitter(lua_State *L, int index, ParticleEmitter *emitter)
+{
+    luaL_checktype(L, index, LUA_TTABLE);
+    index = lua_absindex(L, index);
+
+    #define GET_EMITTER_FLOAT(name) if (lua_getfield(L, index, #name) != LUA_TNIL) emitter->name = LuaGetArgument_float(L, -1); lua_pop(L, 1);
+
+    GET_EMITTER_FLOAT(rate)
+    GET_EMITTER_FLOAT(lifeMin)
+    GET_EMITTER_FLOAT(lifeMax)
+    GET_EMITTER_FLOAT(speedMin)
+    GET_EMITTER_FLOAT(speedMax)
+    GET_EMITTER_FLOAT(direction)
+    GET_EMITTER_FLOAT(spread)
+    GET_EMITTER_FLOAT(spinMin)
+    GET_EMITTER_FLOAT(spinMax)
+    GET_EMITTER_FLOAT(sizeStart)
+    GET_EMITTER_FLOAT(sizeEnd)
+
+    #undef GET_EMITTER_FLOAT
+
+    if (lua_getfield(L, index, "x") != LUA_TNIL) emitter->position.x = LuaGetArgument_float(L, -1);
+    if (lua_getfield(L, index, "y") != LUA_TNIL) emitter->position.y = LuaGetArgument_float(L, -1);
+    if (lua_getfield(L, index, "gravity") != LUA_TNIL) emitter->gravity = LuaGetArgument_Vector2(L, -1);
+    if (lua_getfield(L, index, "colorStart") != LUA_TNIL) emitter->colorStart = LuaGetArgument_Color(L, -1);
+    if (lua_getfield(L, index, "colorEnd") != LUA_TNIL) emitter->colorEnd = LuaGetArgument_Color(L, -1);
+    if (lua_getfield(L, index, "active") != LUA_TNIL) emitter->active = lua_toboolean(L, -1);
+    lua_pop(L, 6);
+}
+
+// Get emitter argument (1-based index)
+static ParticleEmitter *LuaGetArgumentEmitter(lua_State *L, ParticleSystem *system, int index)
+{
+    int emitter = LuaGetArgument_int(L, index);
+    luaL_argcheck(L, (emitter >= 1) && (emitter <= system->emittersCount), index, "Invalid emitter");
+    return &system->emitters[emitter - 1];
+}
+
+// Create a particle system: ParticleSystem(texture, maxParticles)
+int lua_ParticleSystem(lua_State *L)
+{
+    Texture2D texture = LuaGetArgument_Texture2D(L, 1);
+    int capacity = LuaGetArgument_int(L, 2);
+    luaL_argcheck(L, capacity > 0, 2, "Expected maxParticles > 0");
+
+    ParticleSystem *system = (ParticleSystem *)lua_newuserdata(L, sizeof(ParticleSystem));
+    memset(system, 0, sizeof(ParticleSystem));
+    luaL_setmetatable(L, "ParticleSystem");
+
+    system->texture = texture;
+    system->batch.texture = texture;
+    system->capacity = capacity;
+    system->randomState = 0x9e3779b9u;
+
+    // All particles arrays are allocated in one block
+    float *data = (float *)calloc(10*capacity, sizeof(float));
+    system->x = data;
+    system->y = data + capacity;
+    system->vx = data + 2*capacity;
+    system->vy = data + 3*capacity;
+    system->ax = data + 4*capacity;
+    system->ay = data + 5*capacity;
+    system->rotation = data + 6*capacity;
+    system->spin = data + 7*capacity;
+    system->age = data + 8*capacity;
+    system->life = data + 9*capacity;
+    system->emitter = (unsigned char *)calloc(capacity, sizeof(unsigned char));
+
+    return 1;
+}
+
+// Add an emitter, returns emitter index: system:addEmitter(config)
+// config: { x, y, rate, lifeMin, lifeMax, speedMin, speedMax, direction, spread, gravity,
+//           spinMin, spinMax, sizeStart, sizeEnd, colorStart, colorEnd, active }
+static int LuaParticleSystemAddEmitter(lua_State *L)
+{
+    ParticleSystem *system = (ParticleSystem *)luaL_checkudata(L, 1, "ParticleSystem");
+    luaL_argcheck(L, system->emittersCount < RLUA_MAX_PARTICLE_EMITTERS, 1, "Too many emitters");
+
+    ParticleEmitter *emitter = &system->emitters[system->emittersCount];
+
+    // Default emitter: 10 particles/second, 1 second life, upwards fountain fading out
+    *emitter = (ParticleEmitter){ 0 };
+    emitter->active = true;
+    emitter->rate = 10.0f;
+    emitter->lifeMin = 1.0f;
+    emitter->lifeMax = 1.0f;
+    emitter->speedMax = 50.0f;
+    emitter->direction = -90.0f;
+    emitter->spread = 30.0f;
+    emitter->sizeStart = 16.0f;
+    emitter->sizeEnd = 16.0f;
+    emitter->colorStart = WHITE;
+    emitter->colorEnd = (Color){ 255, 255, 255, 0 };
+
+    if (!lua_isnoneornil(L, 2)) LuaGetArgument_ParticleEmitter(L, 2, emitter);
+
+    system->emittersCount++;
+    LuaPush_int(L, system->emittersCount);
+
+    return 1;
+}
+
+// Change emitter configuration (only fields defined): system:setEmitter(emitter, config)
+static int LuaParticleSystemSetEmitter(lua_State *L)
+{
+    ParticleSystem *system = (ParticleSystem *)luaL_checkudata(L, 1, "ParticleSystem");
+    LuaGetArgument_ParticleEmitter(L, 3, LuaGetArgumentEmitter(L, system, 2));
+    return 0;
+}
+
+// Move emitter: system:moveEmitter(emitter, x, y)
+static int LuaParticleSystemMoveEmitter(lua_State *L)
+{
+    ParticleSystem *system = (ParticleSystem *)luaL_checkudata(L, 1, "ParticleSystem");
+    ParticleEmitter *emitter = LuaGetArgumentEmitter(L, system, 2);
+    emitter->position.x = LuaGetArgument_float(L, 3);
+    emitter->position.y = LuaGetArgument_float(L, 4);
+    return 0;
+}
+
+// Spawn a burst of particles: system:emit(emitter, count)
+static int LuaParticleSystemEmit(lua_State *L)
+{
+    ParticleSystem *system = (ParticleSystem *)luaL_checkudata(L, 1, "ParticleSystem");
+    ParticleEmitter *emitter = LuaGetArgumentEmitter(L, system, 2);
+    ParticlesSpawn(system, (int)(emitter - system->emitters), LuaGetArgument_int(L, 3));
+    return 0;
+}
+
+// Update particles: system:update([dt]), dt defaults to GetFrameTime()
+static int LuaParticleSystemUpdate(lua_State *L)
+{
+    ParticleSystem *system = (ParticleSystem *)luaL_checkudata(L, 1, "ParticleSystem");
+    ParticlesUpdate(system, (float)luaL_optnumber(L, 2, GetFrameTime()));
+    return 0;
+}
+
+// Draw particles with one batched quads submission: system:draw([blendMode])
+static int LuaParticleSystemDraw(lua_State *L)
+{
+    ParticleSystem *system = (ParticleSystem *)luaL_checkudata(L, 1, "ParticleSystem");
+    bool blending = !lua_isnoneornil(L, 2);
+
+    int mode = blending? LuaGetArgument_int(L, 2) : BLEND_ALPHA;
+
+    if (blending)
+    {
+        if (recordingList != NULL) RecordModeCommand(COMMAND_BEGIN_BLEND_MODE, &mode, sizeof(int));
+        else BeginBlendMode(mode);
+    }
+
+    ParticlesDraw(system);
+
+    if (blending)
+    {
+        if (recordingList != NULL) RecordModeCommand(COMMAND_END_BLEND_MODE, NULL, 0);
+        else EndBlendMode();
+    }
+
+    return 0;
+}
+
+// Remove all particles: system:clear()
+static int LuaParticleSystemClear(lua_State *L)
+{
+    ParticleSystem *system = (ParticleSystem *)luaL_checkudata(L, 1, "ParticleSystem");
+    system->count = 0;
+    return 0;
+}
+
+// Alive particles: #system
+static int LuaParticleSystemCount(lua_State *L)
+{
+    ParticleSystem *system = (ParticleSystem *)luaL_checkudata(L, 1, "ParticleSystem");
+    LuaPush_int(L, system->count);
+    return 1;
+}
+
+// Free particle system arrays (texture is not unloaded)
+static int LuaParticleSystemGC(lua_State *L)
+{
+    ParticleSystem *system = (ParticleSystem *)luaL_checkudata(L, 1, "ParticleSystem");
+    free(system->x);
+    free(system->emitter);
+    system->x = NULL;
+    system->emitter = NULL;
+    system->count = 0;
+    system->capacity = 0;
+    SpriteBatchFree(&system->batch);
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// raylib-lua [textures] module functions - Tilemaps
+//------------------------------------------------------------------------------------
+
+// Get tilemap chunk containing tile
+static TilemapChunk *TilemapGetChunk(Tilemap *map, int x, int y)
+{
+    return &map->chunks[(y/RLUA_TILEMAP_CHUNK)*map->chunksX + x/RLUA_TILEMAP_CHUNK];
+}
+
+// Rebuild chunk tiles quads (world space)
+static void TilemapBuildChunk(Tilemap *map, int chunkX, int chunkY)
+{
+    TilemapChunk *chunk = &map->chunks[chunkY*map->chunksX + chunkX];
+    int startX = chunkX*RLUA_TILEMAP_CHUNK;
+    int startY = chunkY*RLUA_TILEMAP_CHUNK;
+    int endX = (startX + RLUA_TILEMAP_CHUNK < map->width)? (startX + RLUA_TILEMAP_CHUNK) : map->width;
+    int endY = (startY + RLUA_TILEMAP_CHUNK < map->height)? (startY + RLUA_TILEMAP_CHUNK) : map->height;
+
+    chunk->batch.count = 0;
+    chunk->dirty = false;
+
+    for (int y = startY; y < endY; y++)
+    {
+        for (int x = startX; x < endX; x++)
+        {
+            int tile = map->tiles[y*map->width + x];
+            if ((tile <= 0) || (tile > map->tilesCount)) continue;
+
+            // Vertex arrays sized for a full chunk, allocated only for chunks with tiles
+            if (chunk->batch.capacity == 0)
+            {
+                chunk->batch.capacity = RLUA_TILEMAP_CHUNK*RLUA_TILEMAP_CHUNK;
+                chunk->batch.vertices = (Vector2 *)malloc(4*chunk->batch.capacity*sizeof(Vector2));
+                chunk->batch.texcoords = (Vector2 *)malloc(4*chunk->batch.capacity*sizeof(Vector2));
+                chunk->batch.colors = (Color *)malloc(chunk->batch.capacity*sizeof(Color));
+            }
+
+            Rectangle sourceRec = { (float)(((tile - 1)%map->columns)*map->tileWidth), (float)(((tile - 1)/map->columns)*map->tileHeight),
+                                    (float)map->tileWidth, (float)map->tileHeight };
+            Rectangle destRec = { map->position.x + x*map->tileWidth, map->position.y + y*map->tileHeight,
+                                  (float)map->tileWidth, (float)map->tileHeight };
+
+            SpriteBatchPush(&chunk->batch, sourceRec, destRec, (Vector2){ 0.0f, 0.0f }, 0.0f, WHITE);
+        }
+    }
+}
+
+// Get world space area visible through a 2d camera (bounding rectangle of screen corners)
+// NOTE: Inverse of BeginMode2D() transform: screen = rotate(zoom*(world - target)) + offset + target
+static Rectangle GetCamera2DVisibleArea(Camera2D camera)
+{
+    float width = (float)GetScreenWidth();
+    float height = (float)GetScreenHeight();
+    float cornersX[4] = { 0.0f, width, width, 0.0f };
+    float cornersY[4] = { 0.0f, 0.0f, height, height };
+    float sinRotation = sinf(-camera.rotation*DEG2RAD);
+    float cosRotation = cosf(-camera.rotation*DEG2RAD);
+    float zoom = (camera.zoom != 0.0f)? camera.zoom : 1.0f;
+    Vector2 min = { 0 }, max = { 0 };
+
+    for (int i = 0; i < 4; i++)
+    {
+        float x = cornersX[i] - camera.offset.x - camera.target.x;
+        float y = cornersY[i] - camera.offset.y - camera.target.y;
+        Vector2 world = { (x*cosRotation - y*sinRotation)/zoom + camera.target.x, (x*sinRotation + y*cosRotation)/zoom + camera.target.y };
+
+        if ((i == 0) || (world.x < min.x)) min.x = world.x;
+        if ((i == 0) || (world.y < min.y)) min.y = world.y;
+        if ((i == 0) || (world.x > max.x)) max.x = world.x;
+        if ((i == 0) || (world.y > max.y)) max.y = world.y;
+    }
+
+    return (Rectangle){ min.x, min.y, max.x - min.x, max.y - min.y };
+}
+
+// Create a tilemap from an image or a tiles IntBuffer
+// Tilemap(tileset, tileWidth, tileHeight, image[, palette]) -> pixel color index in palette (1-based, 0 if not found),
+//                                                                without palette any non-black pixel is tile 1
+// Tilemap(tileset, tileWidth, tileHeight, tiles, width) -> tiles IntBuffer, row-major, width tiles per row
+int lua_Tilemap(lua_State *L)
+{
+    Texture2D tileset = LuaGetArgument_Texture2D(L, 1);
+    int tileWidth = LuaGetArgument_int(L, 2);
+    int tileHeight = LuaGetArgument_int(L, 3);
+    luaL_argcheck(L, (tileWidth > 0) && (tileWidth <= tileset.width), 2, "Expected tileWidth in tileset width");
+    luaL_argcheck(L, (tileHeight > 0) && (tileHeight <= tileset.height), 3, "Expected tileHeight in tileset height");
+
+    TypedBuffer *buffer = (TypedBuffer *)luaL_testudata(L, 4, "Buffer");
+    Image image = { 0 };
+    Color *palette = NULL;
+    int paletteCount = 0;
+    int width = 0, height = 0;
+
+    if (buffer != NULL)
+    {
+        luaL_argcheck(L, buffer->type == BUFFER_INT, 4, "Expected IntBuffer");
+        width = LuaGetArgument_int(L, 5);
+        luaL_argcheck(L, (width > 0) && (buffer->count%width == 0), 5, "Expected width dividing tiles count");
+        height = buffer->count/width;
+    }
+    else
+    {
+        image = LuaGetArgument_Image(L, 4);
+        width = image.width;
+        height = image.height;
+
+        // Palette colors read before any allocation (scratch userdata, collected by Lua)
+        if (!lua_isnoneornil(L, 5))
+        {
+            luaL_checktype(L, 5, LUA_TTABLE);
+            paletteCount = (int)luaL_len(L, 5);
+            palette = (Color *)lua_newuserdata(L, (paletteCount + 1)*sizeof(Color));
+
+            for (int i = 0; i < paletteCount; i++)
+            {
+                lua_geti(L, 5, i + 1);
+                palette[i] = LuaGetArgument_Color(L, -1);
+                lua_pop(L, 1);
+            }
+        }
+    }
+
+    luaL_argcheck(L, (width > 0) && (height > 0), 4, "Expected non-empty map");
+
+    Tilemap *map = (Tilemap *)lua_newuserdata(L, sizeof(Tilemap));
+    memset(map, 0, sizeof(Tilemap));
+    map->tileset = tileset;
+    map->tileWidth = tileWidth;
+    map->tileHeight = tileHeight;
+    map->columns = tileset.width/tileWidth;
+    map->tilesCount = map->columns*(tileset.height/tileHeight);
+    map->width = width;
+    map->height = height;
+    map->chunksX = (width + RLUA_TILEMAP_CHUNK - 1)/RLUA_TILEMAP_CHUNK;
+    map->chunksY = (height + RLUA_TILEMAP_CHUNK - 1)/RLUA_TILEMAP_CHUNK;
+    map->tiles = (int *)malloc(width*height*sizeof(int));
+    map->chunks = (TilemapChunk *)calloc(map->chunksX*map->chunksY, sizeof(TilemapChunk));
+    luaL_setmetatable(L, "Tilemap");
+
+    for (int i = 0; i < map->chunksX*map->chunksY; i++)
+    {
+        map->chunks[i].batch.texture = tileset;
+        map->chunks[i].dirty = true;
+    }
+
+    if (buffer != NULL) memcpy(map->tiles, buffer->ints, width*height*sizeof(int));
+    else
+    {
+        Color *pixels = GetImageData(image);
+
+        for (int i = 0; i < width*height; i++)
+        {
+            Color pixel = pixels[i];
+            int tile = 0;
+
+            if (paletteCount == 0) tile = ((pixel.r != 0) || (pixel.g != 0) || (pixel.b != 0))? 1 : 0;
+            else
+            {
+                for (int k = 0; k < paletteCount; k++)
+                {
+                    if ((palette[k].r == pixel.r) && (palette[k].g == pixel.g) && (palette[k].b == pixel.b) && (palette[k].a == pixel.a))
+                    {
+                        tile = k + 1;
+                        break;
+                    }
+                }
+            }
+
+            map->tiles[i] = tile;
+        }
+
+        free(pixels);
+    }
+
+    return 1;
+}
+
+// Set a tile, only its chunk is rebuilt on next draw: map:setTile(x, y, tile)
+static int LuaTilemapSetTile(lua_State *L)
+{
+    Tilemap *map = (Tilemap *)luaL_checkudata(L, 1, "Tilemap");
+    int x = LuaGetArgument_int(L, 2);
+    int y = LuaGetArgument_int(L, 3);
+    int tile = LuaGetArgument_int(L, 4);
+    luaL_argcheck(L, (x >= 0) && (x < map->width), 2, "Tile x out of map");
+    luaL_argcheck(L, (y >= 0) && (y < map->height), 3, "Tile y out of map");
+    luaL_argcheck(L, (tile >= 0) && (tile <= map->tilesCount), 4, "Tile out of tileset");
+
+    if (map->tiles[y*map->width + x] != tile)
+    {
+        map->tiles[y*map->width + x] = tile;
+        TilemapGetChunk(map, x, y)->dirty = true;
+    }
+
+    return 0;
+}
+
+// Get a tile, 0 if out of map: map:getTile(x, y)
+static int LuaTilemapGetTile(lua_State *L)
+{
+    Tilemap *map = (Tilemap *)luaL_checkudata(L, 1, "Tilemap");
+    int x = LuaGetArgument_int(L, 2);
+    int y = LuaGetArgument_int(L, 3);
+
+    if ((x >= 0) && (x < map->width) && (y >= 0) && (y < map->height)) LuaPush_int(L, map->tiles[y*map->width + x]);
+    else LuaPush_int(L, 0);
+
+    return 1;
+}
+
+// Move tilemap top-left corner, all chunks are rebuilt on next draw: map:setPosition(position)
+static int LuaTilemapSetPosition(lua_State *L)
+{
+    Tilemap *map = (Tilemap *)luaL_checkudata(L, 1, "Tilemap");
+    map->position = LuaGetArgument_Vector2(L, 2);
+
+    for (int i = 0; i < map->chunksX*map->chunksY; i++) map->chunks[i].dirty = true;
+
+    return 0;
+}
+
+// Get tilemap size in tiles: map:getSize() -> width, height
+static int LuaTilemapGetSize(lua_State *L)
+{
+    Tilemap *map = (Tilemap *)luaL_checkudata(L, 1, "Tilemap");
+    LuaPush_int(L, map->width);
+    LuaPush_int(L, map->height);
+    return 2;
+}
+
+// Draw chunks visible on screen (through camera if provided): map:draw([camera2D]) -> chunks drawn
+// NOTE: Camera is only used to find visible chunks, draw it inside BeginMode2D()/EndMode2D()
+static int LuaTilemapDraw(lua_State *L)
+{
+    Tilemap *map = (Tilemap *)luaL_checkudata(L, 1, "Tilemap");
+    Rectangle area = { 0.0f, 0.0f, (float)GetScreenWidth(), (float)GetScreenHeight() };
+
+    if (!lua_isnoneornil(L, 2)) area = GetCamera2DVisibleArea(LuaGetArgument_Camera2D(L, 2));
+
+    // Visible chunks range (clamped to map)
+    float chunkWidth = (float)(RLUA_TILEMAP_CHUNK*map->tileWidth);
+    float chunkHeight = (float)(RLUA_TILEMAP_CHUNK*map->tileHeight);
+    int startX = (int)floorf((area.x - map->position.x)/chunkWidth);
+    int startY = (int)floorf((area.y - map->position.y)/chunkHeight);
+    int endX = (int)floorf((area.x + area.width - map->position.x)/chunkWidth);
+    int endY = (int)floorf((area.y + area.height - map->position.y)/chunkHeight);
+
+    if (startX < 0) startX = 0;
+    if (startY < 0) startY = 0;
+    if (endX > map->chunksX - 1) endX = map->chunksX - 1;
+    if (endY > map->chunksY - 1) endY = map->chunksY - 1;
+
+    int drawn = 0;
+
+    for (int y = startY; y <= endY; y++)
+    {
+        for (int x = startX; x <= endX; x++)
+        {
+            TilemapChunk *chunk = &map->chunks[y*map->chunksX + x];
+
+            if (chunk->dirty) TilemapBuildChunk(map, x, y);
+            if (chunk->batch.count == 0) continue;
+
+            // Chunk quads are kept cached, not cleared as SpriteBatchDraw() does
+            if (recordingList != NULL) RecordSpritesCommand(&chunk->batch, (Vector2){ 0.0f, 0.0f });
+            else SpriteBatchSubmit(&chunk->batch, (Vector2){ 0.0f, 0.0f });
+
+            drawn++;
+        }
+    }
+
+    LuaPush_int(L, drawn);
+    return 1;
+}
+
+// Free tilemap tiles and chunks (tileset is not unloaded)
+static int LuaTilemapGC(lua_State *L)
+{
+    Tilemap *map = (Tilemap *)luaL_checkudata(L, 1, "Tilemap");
+
+    if (map->chunks != NULL)
+    {
+        for (int i = 0; i < map->chunksX*map->chunksY; i++) SpriteBatchFree(&map->chunks[i].batch);
+    }
+
+    free(map->tiles);
+    free(map->chunks);
+    map->tiles = NULL;
+    map->chunks = NULL;
+    map->chunksX = 0;
+    map->chunksY = 0;
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// raylib-lua [text] module functions - Glyphs lookup
+//------------------------------------------------------------------------------------
+
+// Get glyphs lookup hash slot for a codepoint out of BMP (size is a power of two)
+static unsigned int GlyphLookupHash(int codepoint, int size)
+{
+    return ((unsigned int)codepoint*2654435761u) & (size - 1);
+}
+
+static void GlyphLookupResize(GlyphLookup *lookup, int size);
+
+// Set glyph index for a codepoint, an existing entry is only replaced if requested
+static void GlyphLookupSet(GlyphLookup *lookup, int codepoint, int index, bool replace)
+{
+    if ((codepoint >= 0) && (codepoint <= 0xffff))
+    {
+        int **page = &lookup->pages[codepoint/RLUA_GLYPH_PAGE_SIZE];
+        if (*page == NULL) *page = (int *)calloc(RLUA_GLYPH_PAGE_SIZE, sizeof(int));
+        if (replace || ((*page)[codepoint%RLUA_GLYPH_PAGE_SIZE] == 0)) (*page)[codepoint%RLUA_GLYPH_PAGE_SIZE] = index + 1;
+        return;
+    }
+
+    // Hash table kept at most half full, linear probing
+    if (2*(lookup->hashCount + 1) > lookup->hashSize) GlyphLookupResize(lookup, (lookup->hashSize > 0)? 2*lookup->hashSize : 16);
+
+    unsigned int slot = GlyphLookupHash(codepoint, lookup->hashSize);
+    while ((lookup->hashCodepoints[slot] != 0) && (lookup->hashCodepoints[slot] != codepoint)) slot = (slot + 1) & (lookup->hashSize - 1);
+
+    if (lookup->hashCodepoints[slot] == 0)
+    {
+        lookup->hashCodepoints[slot] = codepoint;
+        lookup->hashIndices[slot] = index + 1;
+        lookup->hashCount++;
+    }
+    else if (replace) lookup->hashIndices[slot] = index + 1;
+}
+
+// Resize glyphs lookup hash table, entries inserted again
+static void GlyphLookupResize(GlyphLookup *lookup, int size)
+{
+    int *codepoints = lookup->hashCodepoints;
+    int *indices = lookup->hashIndices;
+    int previousSize = lookup->hashSize;
+
+    lookup->hashCodepoints = (int *)calloc(size, sizeof(int));
+    lookup->hashIndices = (int *)calloc(size, sizeof(int));
+    lookup->hashSize = size;
+    lookup->hashCount = 0;
+
+    for (int i = 0; i < previousSize; i++)
+    {
+        if (codepoints[i] != 0) GlyphLookupSet(lookup, codepoints[i], indices[i] - 1, true);
+    }
+
+    free(codepoints);
+    free(indices);
+}
+
+// Remove codepoint from glyphs lookup
+// NOTE: Hash entries following removed one are moved back (no tombstones)
+static void GlyphLookupRemove(GlyphLookup *lookup, int codepoint)
+{
+    if ((codepoint >= 0) && (codepoint <= 0xffff))
+    {
+        int *page = lookup->pages[codepoint/RLUA_GLYPH_PAGE_SIZE];
+        if (page != NULL) page[codepoint%RLUA_GLYPH_PAGE_SIZE] = 0;
+        return;
+    }
+
+    if (lookup->hashSize == 0) return;
+
+    unsigned int mask = lookup->hashSize - 1;
+    unsigned int slot = GlyphLookupHash(codepoint, lookup->hashSize);
+
+    while (lookup->hashCodepoints[slot] != codepoint)
+    {
+        if (lookup->hashCodepoints[slot] == 0) return;
+        slot = (slot + 1) & mask;
+    }
+
+    lookup->hashCount--;
+
+    for (unsigned int next = (slot + 1) & mask; lookup->hashCodepoints[next] != 0; next = (next + 1) & mask)
+    {
+        unsigned int home = GlyphLookupHash(lookup->hashCodepoints[next], lookup->hashSize);
+
+        // Entry stays if its home slot is cyclically in (slot, next]
+        if ((slot <= next)? ((slot < home) && (home <= next)) : ((slot < home) || (home <= next))) continue;
+
+        lookup->hashCodepoints[slot] = lookup->hashCodepoints[next];
+        lookup->hashIndices[slot] = lookup->hashIndices[next];
+        slot = next;
+    }
+
+    lookup->hashCodepoints[slot] = 0;
+    lookup->hashIndices[slot] = 0;
+}
+
+// Build font glyphs lookup: BMP direct table pages and higher planes hash (invalid codepoints also hashed)
+// NOTE: First glyph wins on duplicated codepoints, as GetGlyphIndex()
+static void GlyphLookupBuild(GlyphLookup *lookup, Font font)
+{
+    memset(lookup, 0, sizeof(GlyphLookup));
+    lookup->chars = font.chars;
+    lookup->charsCount = font.charsCount;
+
+    for (int i = 0; i < font.charsCount; i++) GlyphLookupSet(lookup, font.chars[i].value, i, false);
+}
+
+// Get glyph index for a codepoint, 0 if not found (same result as GetGlyphIndex())
+static int GlyphLookupIndex(const GlyphLookup *lookup, int codepoint)
+{
+    if ((codepoint >= 0) && (codepoint <= 0xffff))
+    {
+        const int *page = lookup->pages[codepoint/RLUA_GLYPH_PAGE_SIZE];
+        return ((page != NULL) && (page[codepoint%RLUA_GLYPH_PAGE_SIZE] != 0))? page[codepoint%RLUA_GLYPH_PAGE_SIZE] - 1 : 0;
+    }
+    else if (lookup->hashSize > 0)
+    {
+        unsigned int slot = ((unsigned int)codepoint*2654435761u) & (lookup->hashSize - 1);
+
+        while (lookup->hashCodepoints[slot] != 0)
+        {
+            if (lookup->hashCodepoints[slot] == codepoint) return lookup->hashIndices[slot] - 1;
+            slot = (slot + 1) & (lookup->hashSize - 1);
+        }
+    }
+
+    return 0;
+}
+
+// Free glyphs lookup tables
+static void GlyphLookupFree(GlyphLookup *lookup)
+{
+    for (int i = 0; i < RLUA_GLYPH_PAGES; i++) free(lookup->pages[i]);
+    free(lookup->hashCodepoints);
+    free(lookup->hashIndices);
+    memset(lookup, 0, sizeof(GlyphLookup));
+}
+
+// Get font glyphs lookup, built on first use (fonts are identified by glyphs array)
+static GlyphLookup *GetFontGlyphLookup(Font font)
+{
+    for (int i = 0; i < glyphLookupsCount; i++)
+    {
+        if ((glyphLookups[i].chars == font.chars) && (glyphLookups[i].charsCount == font.charsCount)) return &glyphLookups[i];
+    }
+
+    glyphLookups = (GlyphLookup *)realloc(glyphLookups, (glyphLookupsCount + 1)*sizeof(GlyphLookup));
+    GlyphLookupBuild(&glyphLookups[glyphLookupsCount], font);
+
+    return &glyphLookups[glyphLookupsCount++];
+}
+
+// Remove font glyphs lookup (font being unloaded)
+static void RemoveFontGlyphLookup(Font font)
+{
+    for (int i = 0; i < glyphLookupsCount; i++)
+    {
+        if (glyphLookups[i].chars == font.chars)
+        {
+            GlyphLookupFree(&glyphLookups[i]);
+            glyphLookups[i] = glyphLookups[--glyphLookupsCount];
+            break;
+        }
+    }
+}
+
+// Push Font, building its glyphs lookup
+static void LuaPush_Font(lua_State *L, Font font)
+{
+    GetFontGlyphLookup(font);
+    LuaPushOpaqueTypeWithMetatable(L, font, Font);
+}
+
+//------------------------------------------------------------------------------------
+// raylib-lua [text] module functions - Dynamic fonts
+//------------------------------------------------------------------------------------
+
+// Get codepoint from UTF-8 sequence, invalid sequences return first byte (Latin-1)
+static int GetUTF8Codepoint(const unsigned char *text, int *bytes)
+{
+    int length = (text[0] >= 0xf0)? 4 : (text[0] >= 0xe0)? 3 : (text[0] >= 0xc0)? 2 : 1;
+    int codepoint = (length == 1)? text[0] : (text[0] & (0x3f >> (length - 1)));
+
+    for (int i = 1; i < length; i++)
+    {
+        if ((text[i] & 0xc0) != 0x80)
+        {
+            *bytes = 1;
+            return text[0];
+        }
+
+        codepoint = (codepoint << 6) | (text[i] & 0x3f);
+    }
+
+    *bytes = length;
+    return codepoint;
+}
+
+// Evict dynamic font atlas row: glyphs released and row pixels cleared
+static void DynamicFontEvictRow(DynamicFont *font, GlyphLookup *lookup, int row)
+{
+    for (int i = 1; i < font->slotsCount; i++)
+    {
+        if (font->slotRows[i] != row) continue;
+
+        GlyphLookupRemove(lookup, font->chars[i].value);
+        font->chars[i].value = -1;
+        font->slotRows[i] = -1;
+        font->freeSlots[font->freeCount++] = i;
+    }
+
+    memset((unsigned char *)font->atlas.data + 2*row*font->rowHeight*font->atlas.width, 0, 2*font->rowHeight*font->atlas.width);
+    font->rowWidths[row] = 0;
+    font->generation++;
+    font->evictions++;
+    font->dirty = true;
+}
+
+// Get atlas row with space for a glyph: current row, a row never used or least recently used row (evicted)
+// NOTE: Rows used in current frame are never evicted (already submitted or recorded text uses them), -1 if atlas full
+static int DynamicFontGetRow(DynamicFont *font, GlyphLookup *lookup, int width)
+{
+    if ((font->currentRow >= 0) && (font->rowWidths[font->currentRow] + width <= font->atlas.width) && (font->freeCount > 0)) return font->currentRow;
+
+    int row = -1;
+
+    if ((font->rowsUsed < font->rowsCount) && (font->freeCount > 0)) row = font->rowsUsed++;
+    else
+    {
+        for (int i = 0; i < font->rowsCount; i++)
+        {
+            if ((font->rowFrames[i] != dynamicFontsFrame) && ((row == -1) || (font->rowFrames[i] < font->rowFrames[row]))) row = i;
+        }
+
+        if (row == -1) return -1;
+
+        DynamicFontEvictRow(font, lookup, row);
+    }
+
+    font->currentRow = row;
+    return row;
+}
+
+// Rasterize dynamic font glyph, same metrics as LoadFontData() (glyph data allocated, coverage bytes)
+static CharInfo DynamicFontRasterize(DynamicFont *font, int codepoint)
+{
+    CharInfo glyph = { 0 };
+    int width = 0, height = 0;
+
+    glyph.value = codepoint;
+    glyph.data = stbtt_GetCodepointBitmap(&font->fontInfo, font->scaleFactor, font->scaleFactor, codepoint, &width, &height, &glyph.offsetX, &glyph.offsetY);
+    glyph.rec.width = (float)width;
+    glyph.rec.height = (float)height;
+    glyph.offsetY += (int)((float)font->ascent*font->scaleFactor);
+
+    stbtt_GetCodepointHMetrics(&font->fontInfo, codepoint, &glyph.advanceX, NULL);
+    glyph.advanceX = (int)((float)glyph.advanceX*font->scaleFactor);
+
+    return glyph;
+}
+
+// Load glyphs missing for text (rasterized from font data) and mark glyphs rows as used in current frame
+// NOTE: Returns false if some glyphs could not be loaded (atlas full), text uses fallback glyph for them
+static bool DynamicFontLoadGlyphs(DynamicFont *font, GlyphLookup *lookup, const char *text)
+{
+    const unsigned char *bytes = (const unsigned char *)text;
+    int missingCount = 0;
+
+    for (int i = 0, length = 1; bytes[i] != '\0'; i += length)
+    {
+        int codepoint = GetUTF8Codepoint(bytes + i, &length);
+        if (codepoint == '\n') continue;
+
+        int index = GlyphLookupIndex(lookup, codepoint);
+
+        if (index > 0) font->rowFrames[font->slotRows[index]] = dynamicFontsFrame;
+        else if (codepoint != font->chars[0].value)
+        {
+            bool listed = false;
+            for (int k = 0; (k < missingCount) && !listed; k++) listed = (font->missing[k] == codepoint);
+            if (listed) continue;
+
+            if (missingCount == font->missingCapacity)
+            {
+                font->missingCapacity = (font->missingCapacity > 0)? 2*font->missingCapacity : 64;
+                font->missing = (int *)realloc(font->missing, font->missingCapacity*sizeof(int));
+            }
+
+            font->missing[missingCount++] = codepoint;
+        }
+    }
+
+    // Atlas already full in current frame, glyphs missing drawn as fallback glyph
+    if (missingCount == 0) return true;
+    if (font->fullFrame == dynamicFontsFrame + 1) return false;
+
+    bool complete = true;
+
+    for (int i = 0; i < missingCount; i++)
+    {
+        CharInfo glyph = DynamicFontRasterize(font, font->missing[i]);
+        int width = (int)glyph.rec.width;
+        int height = ((int)glyph.rec.height < font->rowHeight - 1)? (int)glyph.rec.height : font->rowHeight - 1;
+        int row = (width + 1 <= font->atlas.width)? DynamicFontGetRow(font, lookup, width + 1) : -1;
+
+        if ((row >= 0) && (font->freeCount > 0))
+        {
+            int slot = font->freeSlots[--font->freeCount];
+            int x = font->rowWidths[row];
+            int y = row*font->rowHeight;
+            unsigned char *pixels = (unsigned char *)font->atlas.data;
+
+            // Gray-alpha pixels (white, glyph coverage as alpha), as fonts atlas
+            for (int py = 0; py < height; py++)
+            {
+                for (int px = 0; px < width; px++)
+                {
+                    pixels[2*((y + py)*font->atlas.width + x + px)] = 255;
+                    pixels[2*((y + py)*font->atlas.width + x + px) + 1] = glyph.data[py*width + px];
+                }
+            }
+
+            font->chars[slot] = glyph;
+            font->chars[slot].rec = (Rectangle){ (float)x, (float)y, (float)width, (float)height };
+            font->chars[slot].data = NULL;
+            font->slotRows[slot] = row;
+            font->rowWidths[row] += width + 1;
+            font->rowFrames[row] = dynamicFontsFrame;
+            font->dirty = true;
+
+            GlyphLookupSet(lookup, glyph.value, slot, true);
+        }
+        else
+        {
+            if (font->fullFrame == 0) TraceLog(WARNING, "[%s] Dynamic font atlas full, glyphs used in one frame do not fit", font->fileName);
+            font->fullFrame = dynamicFontsFrame + 1;
+            complete = false;
+        }
+
+        stbtt_FreeBitmap(glyph.data, NULL);
+    }
+
+    return complete;
+}
+
+// Upload dynamic font atlas if changed
+static void DynamicFontUpload(DynamicFont *font)
+{
+    if (!font->dirty) return;
+
+    UpdateTexture(font->texture, font->atlas.data);
+    font->dirty = false;
+}
+
+// Upload all dynamic fonts atlases changed (pipelined mode, main thread with worker waiting)
+static void DynamicFontsUpload(void)
+{
+    for (int i = 0; i < glyphLookupsCount; i++)
+    {
+        if (glyphLookups[i].dynamic != NULL) DynamicFontUpload(glyphLookups[i].dynamic);
+    }
+}
+
+// Prepare dynamic font glyphs for text drawing or measuring, atlas uploaded unless pipelined (uploaded on frame pickup)
+// NOTE: Returns false if text uses fallback glyph for glyphs not loaded (text metrics and quads must not be kept)
+static bool DynamicFontPrepareText(DynamicFont *font, GlyphLookup *lookup, const char *text)
+{
+    bool complete = DynamicFontLoadGlyphs(font, lookup, text);
+    if (!pipeline.enabled) DynamicFontUpload(font);
+    return complete;
+}
+
+// Mark rows used by a text run quads as used in current frame (run drawn without layout)
+static void DynamicFontTouchQuads(DynamicFont *font, const SpriteBatch *quads)
+{
+    for (int i = 0; i < quads->count; i++)
+    {
+        int row = (int)(quads->texcoords[4*i].y*font->atlas.height + 0.5f)/font->rowHeight;
+        if ((row >= 0) && (row < font->rowsCount)) font->rowFrames[row] = dynamicFontsFrame;
+    }
+}
+
+// Free dynamic font memory (atlas texture is not unloaded)
+static void DynamicFontFree(DynamicFont *font)
+{
+    UnloadImage(font->atlas);
+    free(font->fileName);
+    free(font->fileData);
+    free(font->chars);
+    free(font->slotRows);
+    free(font->freeSlots);
+    free(font->rowWidths);
+    free(font->rowFrames);
+    free(font->missing);
+    free(font);
+}
+
+// Load font with glyphs rasterized on first use: LoadFontDynamic(fileName, fontSize[, atlasSize])
+// NOTE: Glyphs are packed in atlas rows, least recently used row is evicted when atlas is full.
+// Text drawn with dynamic fonts is decoded as UTF-8. Command lists replayed frames after being recorded
+// could show glyphs evicted meanwhile
+int lua_LoadFontDynamic(lua_State *L)
+{
+    const char *fileName = LuaGetArgument_string(L, 1);
+    int fontSize = LuaGetArgument_int(L, 2);
+    int atlasSize = (int)luaL_optinteger(L, 3, RLUA_DYNAMIC_FONT_ATLAS);
+    luaL_argcheck(L, fontSize > 0, 2, "Expected fontSize > 0");
+    luaL_argcheck(L, atlasSize >= 2*fontSize, 3, "Expected atlasSize >= 2*fontSize");
+
+    // Font file loaded and parsed once, glyphs are rasterized from it
+    FILE *file = fopen(fileName, "rb");
+    luaL_argcheck(L, file != NULL, 1, "Font could not be loaded");
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    unsigned char *fileData = (size > 0)? (unsigned char *)malloc(size) : NULL;
+    bool loaded = (fileData != NULL) && (fread(fileData, 1, size, file) == (size_t)size);
+    fclose(file);
+
+    stbtt_fontinfo fontInfo = { 0 };
+    if (loaded) loaded = (stbtt_InitFont(&fontInfo, fileData, stbtt_GetFontOffsetForIndex(fileData, 0)) != 0);
+
+    if (!loaded)
+    {
+        free(fileData);
+        luaL_argerror(L, 1, "Font could not be loaded");
+    }
+
+    DynamicFont *font = (DynamicFont *)calloc(1, sizeof(DynamicFont));
+    font->fileName = (char *)malloc(strlen(fileName) + 1);
+    strcpy(font->fileName, fileName);
+    font->fontSize = fontSize;
+    font->fileData = fileData;
+    font->fontInfo = fontInfo;
+    font->scaleFactor = stbtt_ScaleForPixelHeight(&font->fontInfo, (float)fontSize);
+    stbtt_GetFontVMetrics(&font->fontInfo, &font->ascent, NULL, NULL);
+    font->rowHeight = fontSize + fontSize/4 + 1;
+    font->rowsCount = atlasSize/font->rowHeight;
+    font->slotsCount = font->rowsCount*(atlasSize/(fontSize/2 + 1)) + 1;
+    font->chars = (CharInfo *)calloc(font->slotsCount, sizeof(CharInfo));
+    font->slotRows = (int *)malloc(font->slotsCount*sizeof(int));
+    font->freeSlots = (int *)malloc(font->slotsCount*sizeof(int));
+    font->rowWidths = (int *)calloc(font->rowsCount, sizeof(int));
+    font->rowFrames = (unsigned int *)calloc(font->rowsCount, sizeof(unsigned int));
+    font->currentRow = -1;
+
+    for (int i = font->slotsCount - 1; i > 0; i--)
+    {
+        font->chars[i].value = -1;
+        font->slotRows[i] = -1;
+        font->freeSlots[font->freeCount++] = i;
+    }
+
+    // Space glyph (slot 0) is also the fallback glyph, no pixels
+    CharInfo space = DynamicFontRasterize(font, ' ');
+    stbtt_FreeBitmap(space.data, NULL);
+
+    font->chars[0] = space;
+    font->chars[0].rec = (Rectangle){ 0 };
+    font->chars[0].data = NULL;
+    font->slotRows[0] = -1;
+
+    font->atlas.data = calloc(atlasSize*atlasSize, 2);
+    font->atlas.width = atlasSize;
+    font->atlas.height = atlasSize;
+    font->atlas.mipmaps = 1;
+    font->atlas.format = UNCOMPRESSED_GRAY_ALPHA;
+    font->texture = LoadTextureFromImage(font->atlas);
+
+    Font result = { font->texture, fontSize, font->slotsCount, font->chars };
+
+    // Glyphs lookup registered before pushing, updated as glyphs are loaded and evicted
+    glyphLookups = (GlyphLookup *)realloc(glyphLookups, (glyphLookupsCount + 1)*sizeof(GlyphLookup));
+    GlyphLookup *lookup = &glyphLookups[glyphLookupsCount++];
+    memset(lookup, 0, sizeof(GlyphLookup));
+    lookup->chars = font->chars;
+    lookup->charsCount = font->slotsCount;
+    lookup->dynamic = font;
+    GlyphLookupSet(lookup, font->chars[0].value, 0, true);
+
+    LuaPush_Font(L, result);
+    return 1;
+}
+
+// Get dynamic font glyphs loaded and atlas rows evicted: GetFontDynamicStats(font) -> glyphs, evictions
+int lua_GetFontDynamicStats(lua_State *L)
+{
+    Font font = LuaGetArgument_Font(L, 1);
+    DynamicFont *dynamic = GetFontGlyphLookup(font)->dynamic;
+    luaL_argcheck(L, dynamic != NULL, 1, "Expected dynamic font");
+
+    LuaPush_int(L, dynamic->slotsCount - 1 - dynamic->freeCount);
+    LuaPush_int(L, dynamic->evictions);
+    return 2;
+}
+
+//------------------------------------------------------------------------------------
+// raylib-lua [text] module functions - SDF fonts
+//------------------------------------------------------------------------------------
+
+// Squared distance transform of a sampled function (Felzenszwalb-Huttenlocher lower envelope of parabolas)
+// NOTE: v (n ints) and z (n + 1 floats) are scratch buffers
+static void DistanceTransform1D(const float *f, float *d, int *v, float *z, int n)
+{
+    int k = 0;
+    v[0] = 0;
+    z[0] = -RLUA_SDF_INFINITY;
+    z[1] = RLUA_SDF_INFINITY;
+
+    for (int q = 1; q < n; q++)
+    {
+        float s = ((f[q] + q*q) - (f[v[k]] + v[k]*v[k]))/(2*q - 2*v[k]);
+
+        while (s <= z[k])
+        {
+            k--;
+            s = ((f[q] + q*q) - (f[v[k]] + v[k]*v[k]))/(2*q - 2*v[k]);
+        }
+
+        k++;
+        v[k] = q;
+        z[k] = s;
+        z[k + 1] = RLUA_SDF_INFINITY;
+    }
+
+    k = 0;
+
+    for (int q = 0; q < n; q++)
+    {
+        while (z[k + 1] < q) k++;
+        d[q] = (q - v[k])*(q - v[k]) + f[v[k]];
+    }
+}
+
+// Squared distance transform of a grid, grid holds 0 on features and RLUA_SDF_INFINITY elsewhere
+// NOTE: scratch holds 3*size + 1 floats and indices size ints, size is max(width, height)
+static void DistanceTransform2D(float *grid, int width, int height, float *scratch, int *indices)
+{
+    int size = (width > height)? width : height;
+    float *f = scratch;
+    float *d = scratch + size;
+    float *z = scratch + 2*size;
+
+    for (int x = 0; x < width; x++)
+    {
+        for (int y = 0; y < height; y++) f[y] = grid[y*width + x];
+        DistanceTransform1D(f, d, indices, z, height);
+        for (int y = 0; y < height; y++) grid[y*width + x] = d[y];
+    }
+
+    for (int y = 0; y < height; y++)
+    {
+        DistanceTransform1D(grid + y*width, d, indices, z, width);
+        memcpy(grid + y*width, d, width*sizeof(float));
+    }
+}
+
+// Replace glyph coverage bitmap by its signed distance field (padded), same layout as raylib SDF glyphs
+static void GenGlyphSDF(CharInfo *glyph)
+{
+    int glyphWidth = (int)glyph->rec.width;
+    int glyphHeight = (int)glyph->rec.height;
+    if ((glyph->data == NULL) || (glyphWidth <= 0) || (glyphHeight <= 0)) return;
+
+    int width = glyphWidth + 2*RLUA_SDF_PADDING;
+    int height = glyphHeight + 2*RLUA_SDF_PADDING;
+    int size = (width > height)? width : height;
+
+    float *outside = (float *)malloc(2*width*height*sizeof(float));
+    float *inside = outside + width*height;
+    float *scratch = (float *)malloc((3*size + 1)*sizeof(float));
+    int *indices = (int *)malloc(size*sizeof(int));
+    unsigned char *sdf = (unsigned char *)malloc(width*height);
+
+    // Glyph pixels (coverage >= 50%) are features for outside distance, background for inside distance
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            int gx = x - RLUA_SDF_PADDING;
+            int gy = y - RLUA_SDF_PADDING;
+            bool filled = (gx >= 0) && (gx < glyphWidth) && (gy >= 0) && (gy < glyphHeight) && (glyph->data[gy*glyphWidth + gx] >= 128);
+
+            outside[y*width + x] = filled? 0.0f : RLUA_SDF_INFINITY;
+            inside[y*width + x] = filled? RLUA_SDF_INFINITY : 0.0f;
+        }
+    }
+
+    DistanceTransform2D(outside, width, height, scratch, indices);
+    DistanceTransform2D(inside, width, height, scratch, indices);
+
+    // Edge is half a pixel away from pixel centers on both sides
+    for (int i = 0; i < width*height; i++)
+    {
+        float distance = (inside[i] > 0.0f)? (sqrtf(inside[i]) - 0.5f) : -(sqrtf(outside[i]) - 0.5f);
+        float value = RLUA_SDF_ON_EDGE + distance*RLUA_SDF_DIST_SCALE;
+        sdf[i] = (unsigned char)((value < 0.0f)? 0.0f : (value > 255.0f)? 255.0f : value);
+    }
+
+    free(glyph->data);
+    free(outside);
+    free(scratch);
+    free(indices);
+
+    glyph->data = sdf;
+    glyph->rec.width = (float)width;
+    glyph->rec.height = (float)height;
+    glyph->offsetX -= RLUA_SDF_PADDING;
+    glyph->offsetY -= RLUA_SDF_PADDING;
+}
+
+// SDF glyphs generation worker: glyphs are taken one at a time until none left
+static void *FontLoaderWorker(void *arg)
+{
+    FontLoader *loader = (FontLoader *)arg;
+
+    while (true)
+    {
+        pthread_mutex_lock(&loader->mutex);
+        int index = loader->nextGlyph++;
+        pthread_mutex_unlock(&loader->mutex);
+
+        if (index >= loader->charsCount) break;
+
+        GenGlyphSDF(&loader->chars[index]);
+
+        pthread_mutex_lock(&loader->mutex);
+        loader->glyphsDone++;
+        pthread_mutex_unlock(&loader->mutex);
+    }
+
+    return NULL;
+}
+
+// Rasterize font glyphs and generate their SDF on worker threads (loader thread also generates)
+static void *FontLoaderThread(void *arg)
+{
+    FontLoader *loader = (FontLoader *)arg;
+
+    loader->chars = LoadFontData(loader->fileName, loader->fontSize, loader->codepoints, loader->charsCount, false);
+
+    if (loader->chars != NULL)
+    {
+        pthread_t workers[RLUA_SDF_THREADS];
+        bool started[RLUA_SDF_THREADS] = { 0 };
+
+        for (int t = 0; t < RLUA_SDF_THREADS - 1; t++) started[t] = (pthread_create(&workers[t], NULL, FontLoaderWorker, loader) == 0);
+
+        FontLoaderWorker(loader);
+
+        for (int t = 0; t < RLUA_SDF_THREADS - 1; t++)
+        {
+            if (started[t]) pthread_join(workers[t], NULL);
+        }
+    }
+
+    pthread_mutex_lock(&loader->mutex);
+    loader->done = true;
+    pthread_mutex_unlock(&loader->mutex);
+
+    return NULL;
+}
+
+// Wait until font loader finished
+static void FontLoaderWait(FontLoader *loader)
+{
+    if (!loader->joined)
+    {
+        pthread_join(loader->thread, NULL);
+        loader->joined = true;
+    }
+}
+
+// Start SDF font loading in background: FontLoader(fileName, fontSize[, chars]) -> loader
+// NOTE: chars is a table or IntBuffer of codepoints, default is ASCII printable characters (32..126)
+int lua_FontLoader(lua_State *L)
+{
+    const char *fileName = LuaGetArgument_string(L, 1);
+    int fontSize = LuaGetArgument_int(L, 2);
+    luaL_argcheck(L, fontSize > 0, 2, "Expected fontSize > 0");
+
+    TypedBuffer *buffer = (TypedBuffer *)luaL_testudata(L, 3, "Buffer");
+    int charsCount = 95;
+
+    if (buffer != NULL)
+    {
+        luaL_argcheck(L, buffer->type == BUFFER_INT, 3, "Expected IntBuffer");
+        charsCount = buffer->count;
+    }
+    else if (!lua_isnoneornil(L, 3))
+    {
+        luaL_checktype(L, 3, LUA_TTABLE);
+        charsCount = (int)luaL_len(L, 3);
+    }
+
+    luaL_argcheck(L, charsCount > 0, 3, "Expected chars");
+
+    FontLoader *loader = (FontLoader *)lua_newuserdata(L, sizeof(FontLoader));
+    memset(loader, 0, sizeof(FontLoader));
+    luaL_setmetatable(L, "FontLoader");
+
+    loader->codepoints = (int *)malloc(charsCount*sizeof(int));
+    loader->charsCount = charsCount;
+    loader->fontSize = fontSize;
+    loader->fileName = (char *)malloc(strlen(fileName) + 1);
+    strcpy(loader->fileName, fileName);
+
+    for (int i = 0; i < charsCount; i++)
+    {
+        if (buffer != NULL) loader->codepoints[i] = buffer->ints[i];
+        else if (lua_isnoneornil(L, 3)) loader->codepoints[i] = 32 + i;
+        else
+        {
+            lua_geti(L, 3, i + 1);
+            loader->codepoints[i] = (int)lua_tointeger(L, -1);
+            lua_pop(L, 1);
+        }
+    }
+
+    pthread_mutex_init(&loader->mutex, NULL);
+    loader->initialized = true;
+
+    // Without loader thread, font is loaded now
+    if (pthread_create(&loader->thread, NULL, FontLoaderThread, loader) != 0)
+    {
+        FontLoaderThread(loader);
+        loader->joined = true;
+    }
+
+    return 1;
+}
+
+// Get SDF glyphs generated fraction: loader:progress() -> [0.0..1.0]
+static int LuaFontLoaderProgress(lua_State *L)
+{
+    FontLoader *loader = (FontLoader *)luaL_checkudata(L, 1, "FontLoader");
+
+    pthread_mutex_lock(&loader->mutex);
+    float progress = loader->done? 1.0f : (float)loader->glyphsDone/loader->charsCount;
+    pthread_mutex_unlock(&loader->mutex);
+
+    LuaPush_float(L, progress);
+    return 1;
+}
+
+// Check if font loader finished: loader:isReady()
+static int LuaFontLoaderIsReady(lua_State *L)
+{
+    FontLoader *loader = (FontLoader *)luaL_checkudata(L, 1, "FontLoader");
+
+    pthread_mutex_lock(&loader->mutex);
+    bool done = loader->done;
+    pthread_mutex_unlock(&loader->mutex);
+
+    LuaPush_bool(L, done);
+    return 1;
+}
+
+// Wait for font loader and free its data (glyphs not loaded into a font are freed)
+static int LuaFontLoaderGC(lua_State *L)
+{
+    FontLoader *loader = (FontLoader *)luaL_checkudata(L, 1, "FontLoader");
+    if (!loader->initialized) return 0;
+
+    FontLoaderWait(loader);
+
+    if (loader->chars != NULL)
+    {
+        for (int i = 0; i < loader->charsCount; i++) free(loader->chars[i].data);
+        free(loader->chars);
+    }
+
+    pthread_mutex_destroy(&loader->mutex);
+    free(loader->codepoints);
+    free(loader->fileName);
+    loader->chars = NULL;
+    loader->initialized = false;
+    return 0;
+}
+
+// Load font from finished loader (waits if not ready), glyphs atlas packed and uploaded: LoadFontFromLoader(loader)
+int lua_LoadFontFromLoader(lua_State *L)
+{
+    FontLoader *loader = (FontLoader *)luaL_checkudata(L, 1, "FontLoader");
+    luaL_argcheck(L, loader->initialized && !loader->consumed, 1, "FontLoader already loaded");
+
+    FontLoaderWait(loader);
+    luaL_argcheck(L, loader->chars != NULL, 1, "Font could not be loaded");
+
+    // Same atlas as raylib SDF fonts: no padding (SDF glyphs are padded), skyline packing
+    Font font = { 0 };
+    font.baseSize = loader->fontSize;
+    font.charsCount = loader->charsCount;
+    font.chars = loader->chars;
+
+    Image atlas = GenImageFontAtlas(font.chars, font.baseSize, font.charsCount, 0, 1);
+    font.texture = LoadTextureFromImage(atlas);
+    UnloadImage(atlas);
+
+    // Glyphs are owned by font (freed by UnloadFont())
+    loader->chars = NULL;
+    loader->consumed = true;
+
+    LuaPush_Font(L, font);
+    return 1;
+}
+
+// Load SDF font, glyphs generated on worker threads: LoadFontSDF(fileName, fontSize[, chars])
+int lua_LoadFontSDF(lua_State *L)
+{
+    lua_settop(L, 3);
+    lua_FontLoader(L);
+    lua_replace(L, 1);
+    lua_settop(L, 1);
+    return lua_LoadFontFromLoader(L);
+}
+
+//------------------------------------------------------------------------------------
+// raylib-lua [text] module functions - Text runs cache
+//------------------------------------------------------------------------------------
+
+// Text runs cache key hash: Lua string address, font and size parameters
+static unsigned int TextCacheHash(const char *text, Font font, float fontSize, float spacing)
+{
+    unsigned int sizeBits = 0, spacingBits = 0;
+    memcpy(&sizeBits, &fontSize, sizeof(float));
+    memcpy(&spacingBits, &spacing, sizeof(float));
+
+    unsigned int hash = (unsigned int)((size_t)text >> 3);
+    hash = hash*31 + (unsigned int)((size_t)font.chars >> 3);
+    hash = hash*31 + font.texture.id;
+    hash = hash*31 + sizeBits;
+    hash = hash*31 + spacingBits;
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6b;
+    hash ^= hash >> 13;
+
+    return hash%RLUA_TEXT_CACHE_BUCKETS;
+}
+
+// Unlink text run from LRU list (indices are 1-based, 0 is none)
+static void TextCacheUnlink(int index)
+{
+    TextRun *run = &textCache.runs[index - 1];
+
+    if (run->prev != 0) textCache.runs[run->prev - 1].next = run->next;
+    else textCache.head = run->next;
+    if (run->next != 0) textCache.runs[run->next - 1].prev = run->prev;
+    else textCache.tail = run->prev;
+
+    run->prev = 0;
+    run->next = 0;
+}
+
+// Link text run as most recently used
+static void TextCacheLinkHead(int index)
+{
+    TextRun *run = &textCache.runs[index - 1];
+
+    run->prev = 0;
+    run->next = textCache.head;
+    if (textCache.head != 0) textCache.runs[textCache.head - 1].prev = index;
+    textCache.head = index;
+    if (textCache.tail == 0) textCache.tail = index;
+}
+
+// Remove text run from cache, releasing its Lua string (slot and quads arrays are kept for reuse)
+static void TextCacheRemove(lua_State *L, int index)
+{
+    TextRun *run = &textCache.runs[index - 1];
+    int *link = &textCache.buckets[run->bucket];
+
+    while (*link != index) link = &textCache.runs[*link - 1].hashNext;
+    *link = run->hashNext;
+
+    TextCacheUnlink(index);
+    luaL_unref(L, LUA_REGISTRYINDEX, run->textRef);
+
+    run->text = NULL;
+    run->textRef = LUA_NOREF;
+    run->hashNext = textCache.free;
+    textCache.free = index;
+    textCache.count--;
+}
+
+// Get cached text run for Lua string at index, a new run is created on miss (least recently used evicted)
+// NOTE: String is referenced while cached, so its address can not be reused by another string
+static TextRun *TextCacheGet(lua_State *L, int index, Font font, float fontSize, float spacing)
+{
+    const char *text = lua_tostring(L, index);
+    unsigned int bucket = TextCacheHash(text, font, fontSize, spacing);
+
+    for (int i = textCache.buckets[bucket]; i != 0; i = textCache.runs[i - 1].hashNext)
+    {
+        TextRun *run = &textCache.runs[i - 1];
+
+        if ((run->text == text) && (run->fontChars == font.chars) && (run->fontTextureId == font.texture.id) &&
+            (run->fontSize == fontSize) && (run->spacing == spacing))
+        {
+            if (textCache.head != i)
+            {
+                TextCacheUnlink(i);
+                TextCacheLinkHead(i);
+            }
+
+            textCache.hits++;
+            return run;
+        }
+    }
+
+    textCache.misses++;
+
+    // Free slot: released slots first, then never used slots, then least recently used run
+    int slot = 0;
+
+    if ((textCache.free == 0) && (textCache.used < RLUA_TEXT_CACHE_SIZE)) slot = ++textCache.used;
+    else
+    {
+        if (textCache.free == 0)
+        {
+            TextCacheRemove(L, textCache.tail);
+            textCache.evictions++;
+        }
+
+        slot = textCache.free;
+        textCache.free = textCache.runs[slot - 1].hashNext;
+    }
+
+    TextRun *run = &textCache.runs[slot - 1];
+    lua_pushvalue(L, index);
+    run->textRef = luaL_ref(L, LUA_REGISTRYINDEX);
+    run->text = text;
+    run->fontChars = font.chars;
+    run->fontTextureId = font.texture.id;
+    run->fontSize = fontSize;
+    run->spacing = spacing;
+    run->measured = false;
+    run->laidOut = false;
+    run->bucket = bucket;
+    run->hashNext = textCache.buckets[bucket];
+    textCache.buckets[bucket] = slot;
+    textCache.count++;
+    TextCacheLinkHead(slot);
+
+    return run;
+}
+
+// Measure text run, same metrics as MeasureTextEx()
+static Vector2 TextRunMeasure(TextRun *run, Font font)
+{
+    if (run->measured) return run->size;
+
+    int tempLen = 0;
+    int lenCounter = 0;
+    float textWidth = 0.0f;
+    float tempTextWidth = 0.0f;
+    float textHeight = (float)font.baseSize;
+    float scaleFactor = run->fontSize/(float)font.baseSize;
+    GlyphLookup *glyphs = GetFontGlyphLookup(font);
+    bool complete = true;
+
+    if (glyphs->dynamic != NULL) complete = DynamicFontPrepareText(glyphs->dynamic, glyphs, run->text);
+
+    for (const char *c = run->text; *c != '\0'; c++)
+    {
+        lenCounter++;
+
+        if (*c != '\n')
+        {
+            int codepoint = (int)*c;
+
+            // Dynamic fonts text is decoded as UTF-8
+            if (glyphs->dynamic != NULL)
+            {
+                int bytes = 1;
+                codepoint = GetUTF8Codepoint((const unsigned char *)c, &bytes);
+                c += bytes - 1;
+            }
+
+            int index = GlyphLookupIndex(glyphs, codepoint);
+
+            if (font.chars[index].advanceX != 0) textWidth += font.chars[index].advanceX;
+            else textWidth += (font.chars[index].rec.width + font.chars[index].offsetX);
+        }
+        else
+        {
+            if (tempTextWidth < textWidth) tempTextWidth = textWidth;
+            lenCounter = 0;
+            textWidth = 0.0f;
+            textHeight += ((float)font.baseSize*1.5f);      // NOTE: Fixed line spacing of 1.5 lines
+        }
+
+        if (tempLen < lenCounter) tempLen = lenCounter;
+    }
+
+    if (tempTextWidth < textWidth) tempTextWidth = textWidth;
+
+    run->size = (Vector2){ tempTextWidth*scaleFactor + (float)((tempLen - 1)*run->spacing), textHeight*scaleFactor };
+
+    // NOTE: Size measured with fallback glyph widths (dynamic font atlas full) is measured again on next use
+    run->measured = complete;
+
+    return run->size;
+}
+
+// Get font glyph index of character at text, same decoding as DrawTextEx(), bytes read returned
+// NOTE: Latin-1 supplement UTF-8 sequences [0xc2 0x80..0xbf] and [0xc3 0x80..0xbf] are decoded (as DrawTextEx()),
+// dynamic fonts text is decoded as UTF-8
+static int GetTextGlyphIndex(const GlyphLookup *glyphs, const unsigned char *text, int *bytes)
+{
+    *bytes = 1;
+
+    if (glyphs->dynamic != NULL) return GlyphLookupIndex(glyphs, GetUTF8Codepoint(text, bytes));
+
+    if ((text[0] == 0xc2) && (text[1] != '\0'))
+    {
+        *bytes = 2;
+        return GlyphLookupIndex(glyphs, (int)text[1]);
+    }
+
+    if ((text[0] == 0xc3) && (text[1] != '\0'))
+    {
+        *bytes = 2;
+        return GlyphLookupIndex(glyphs, (int)text[1] + 64);
+    }
+
+    return GlyphLookupIndex(glyphs, (int)text[0]);
+}
+
+// Lay out text run glyph quads (relative to text position), same placement as DrawTextEx()
+static void TextRunLayout(TextRun *run, Font font, Color tint)
+{
+    if (!run->laidOut)
+    {
+        const unsigned char *text = (const unsigned char *)run->text;
+        float scaleFactor = run->fontSize/(float)font.baseSize;
+        const GlyphLookup *glyphs = GetFontGlyphLookup(font);
+        int textOffsetX = 0;
+        int bytes = 1;
+        int textOffsetY = 0;
+
+        run->quads.texture = font.texture;
+        run->quads.count = 0;
+
+        for (int i = 0; text[i] != '\0'; i++)
+        {
+            if (text[i] == '\n')
+            {
+                textOffsetY += (int)((font.baseSize + font.baseSize/2)*scaleFactor);   // NOTE: Fixed line spacing of 1.5 lines
+                textOffsetX = 0;
+                continue;
+            }
+
+            int index = GetTextGlyphIndex(glyphs, text + i, &bytes);
+            i += bytes - 1;
+
+            CharInfo glyph = font.chars[index];
+
+            if (text[i] != ' ')
+            {
+                SpriteBatchPush(&run->quads, glyph.rec, (Rectangle){ textOffsetX + glyph.offsetX*scaleFactor, textOffsetY + glyph.offsetY*scaleFactor,
+                                glyph.rec.width*scaleFactor, glyph.rec.height*scaleFactor }, (Vector2){ 0.0f, 0.0f }, 0.0f, tint);
+            }
+
+            if (glyph.advanceX == 0) textOffsetX += (int)(glyph.rec.width*scaleFactor + run->spacing);
+            else textOffsetX += (int)(glyph.advanceX*scaleFactor + run->spacing);
+        }
+
+        run->tint = tint;
+        run->laidOut = true;
+    }
+    else if (memcmp(&run->tint, &tint, sizeof(Color)) != 0)
+    {
+        for (int i = 0; i < run->quads.count; i++) run->quads.colors[i] = tint;
+        run->tint = tint;
+    }
+}
+
+// Prepare text run glyph quads for drawing, laid out if required (or dynamic font atlas changed)
+static void TextRunPrepare(TextRun *run, Font font, GlyphLookup *glyphs, Color tint)
+{
+    DynamicFont *dynamic = glyphs->dynamic;
+    bool complete = true;
+
+    if (dynamic != NULL)
+    {
+        if (run->laidOut && (run->fontGeneration == dynamic->generation)) DynamicFontTouchQuads(dynamic, &run->quads);
+        else
+        {
+            complete = DynamicFontPrepareText(dynamic, glyphs, run->text);
+            run->laidOut = false;
+        }
+    }
+
+    TextRunLayout(run, font, tint);
+
+    // NOTE: Quads using fallback glyph are laid out again on next draw (glyphs could fit then)
+    if (dynamic != NULL) run->fontGeneration = complete? dynamic->generation : (dynamic->generation - 1);
+}
+
+// Draw text run glyph quads
+static void DrawTextRun(TextRun *run, Font font, GlyphLookup *glyphs, Vector2 position, Color tint)
+{
+    TextRunPrepare(run, font, glyphs, tint);
+
+    if (run->quads.count > 0)
+    {
+        if (recordingList != NULL) RecordSpritesCommand(&run->quads, position);
+        else SpriteBatchSubmit(&run->quads, position);
+    }
+}
+
+// Draw text string at index through text runs cache (layout skipped on hits)
+// NOTE: While a command list is being recorded, text is recorded instead (laid out on replay),
+// dynamic fonts text is recorded as glyph quads (atlas changes over time)
+static void DrawTextCached(lua_State *L, int index, Font font, Vector2 position, float fontSize, float spacing, Color tint)
+{
+    GlyphLookup *glyphs = GetFontGlyphLookup(font);
+
+    if ((recordingList != NULL) && (glyphs->dynamic == NULL))
+    {
+        RecordTextCommand(COMMAND_TEXT_EX, (TextCommand){ font, position, fontSize, spacing, tint }, lua_tostring(L, index));
+        return;
+    }
+
+    DrawTextRun(TextCacheGet(L, index, font, fontSize, spacing), font, glyphs, position, tint);
+}
+
+// Remove all cached text runs of a font (font being unloaded)
+static void TextCacheRemoveFont(lua_State *L, Font font)
+{
+    for (int i = 1; i <= textCache.used; i++)
+    {
+        TextRun *run = &textCache.runs[i - 1];
+        if ((run->text != NULL) && (run->fontChars == font.chars)) TextCacheRemove(L, i);
+    }
+}
+
+// Free text runs cache (Lua state closed, strings references are not released)
+static void TextCacheFree(void)
+{
+    for (int i = 0; i < textCache.used; i++) SpriteBatchFree(&textCache.runs[i].quads);
+    memset(&textCache, 0, sizeof(TextCache));
+
+    SpriteBatchFree(&textFormatRun.quads);
+    memset(&textFormatRun, 0, sizeof(TextRun));
+}
+
+// Get text runs cache counters: GetTextCacheStats() -> hits, misses, evictions, cached
+int lua_GetTextCacheStats(lua_State *L)
+{
+    LuaPush_int(L, textCache.hits);
+    LuaPush_int(L, textCache.misses);
+    LuaPush_int(L, textCache.evictions);
+    LuaPush_int(L, textCache.count);
+    return 4;
+}
+
+//------------------------------------------------------------------------------------
+// raylib-lua [text] module functions - Text formatting
+//------------------------------------------------------------------------------------
+
+// Format Lua values on stack (from first index) into buffer, same conversions as string.format()
+// NOTE: Numbers and strings are written directly into buffer, Lua strings are only created
+// for %s conversion of values other than strings, numbers, booleans and nil (luaL_tolstring()).
+// Buffer must be owned by caller (stack buffer): __tostring metamethods can format text meanwhile
+static const char *LuaFormatText(lua_State *L, const char *format, int first, char *buffer, int size)
+{
+    int length = 0;
+    int arg = first;
+
+    for (const char *c = format; (*c != '\0') && (length < size - 1); c++)
+    {
+        if (*c != '%') { buffer[length++] = *c; continue; }
+        if (*(++c) == '%') { buffer[length++] = '%'; continue; }
+
+        // Conversion specification: %[flags][width][.precision]conversion
+        char spec[32] = "%";
+        const char *start = c;
+
+        while ((*c != '\0') && (strchr("-+ #0", *c) != NULL)) c++;
+        for (int digits = 0; (*c >= '0') && (*c <= '9') && (digits < 2); digits++) c++;
+        if (*c == '.')
+        {
+            c++;
+            for (int digits = 0; (*c >= '0') && (*c <= '9') && (digits < 2); digits++) c++;
+        }
+
+        if (((c - start) > 12) || ((*c >= '0') && (*c <= '9'))) return (luaL_error(L, "invalid format (width or precision too long)"), buffer);
+
+        memcpy(spec + 1, start, c - start);
+        spec[c - start + 1] = '\0';
+
+        char *output = buffer + length;
+        int available = size - length;
+        int written = 0;
+
+        switch (*c)
+        {
+            case 'c':
+            {
+                strcat(spec, "c");
+                written = snprintf(output, available, spec, (int)luaL_checkinteger(L, arg));
+            } break;
+            case 'd': case 'i': case 'o': case 'u': case 'x': case 'X':
+            {
+                strcat(spec, LUA_INTEGER_FRMLEN);
+                strncat(spec, c, 1);
+                written = snprintf(output, available, spec, (LUAI_UACINT)luaL_checkinteger(L, arg));
+            } break;
+            case 'a': case 'A': case 'e': case 'E': case 'f': case 'F': case 'g': case 'G':
+            {
+                strcat(spec, LUA_NUMBER_FRMLEN);
+                strncat(spec, c, 1);
+                written = snprintf(output, available, spec, (LUAI_UACNUMBER)luaL_checknumber(L, arg));
+            } break;
+            case 's':
+            {
+                char number[64] = { 0 };
+                const char *text = NULL;
+                bool pushed = false;
+
+                strcat(spec, "s");
+
+                switch (lua_type(L, arg))
+                {
+                    case LUA_TSTRING: text = lua_tostring(L, arg); break;
+                    case LUA_TBOOLEAN: text = lua_toboolean(L, arg)? "true" : "false"; break;
+                    case LUA_TNIL: text = "nil"; break;
+                    case LUA_TNUMBER:
+                    {
+                        // NOTE: Same number to string conversion as tostring(), floats keep a decimal point
+                        if (lua_isinteger(L, arg)) snprintf(number, sizeof(number), LUA_INTEGER_FMT, (LUAI_UACINT)lua_tointeger(L, arg));
+                        else
+                        {
+                            snprintf(number, sizeof(number), LUA_NUMBER_FMT, (LUAI_UACNUMBER)lua_tonumber(L, arg));
+                            if (number[strspn(number, "-0123456789")] == '\0') strcat(number, ".0");
+                        }
+
+                        text = number;
+                    } break;
+                    case LUA_TNONE: luaL_argerror(L, arg, "no value"); break;
+                    default:
+                    {
+                        text = luaL_tolstring(L, arg, NULL);
+                        pushed = true;
+                    } break;
+                }
+
+                written = snprintf(output, available, spec, text);
+                if (pushed) lua_pop(L, 1);
+            } break;
+            default: return (luaL_error(L, "invalid conversion '%%%c' to format", *c), buffer);
+        }
+
+        if (written > 0) length += (written < available)? written : available - 1;
+        arg++;
+    }
+
+    buffer[length] = '\0';
+
+    return buffer;
+}
+
+// Draw formatted text, laid out on every call into the same run (no Lua string to cache it by)
+static void DrawTextFormatted(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint)
+{
+    GlyphLookup *glyphs = GetFontGlyphLookup(font);
+
+    if ((recordingList != NULL) && (glyphs->dynamic == NULL))
+    {
+        RecordTextCommand(COMMAND_TEXT_EX, (TextCommand){ font, position, fontSize, spacing, tint }, text);
+        return;
+    }
+
+    textFormatRun.text = text;
+    textFormatRun.fontChars = font.chars;
+    textFormatRun.fontTextureId = font.texture.id;
+    textFormatRun.fontSize = fontSize;
+    textFormatRun.spacing = spacing;
+    textFormatRun.measured = false;
+    textFormatRun.laidOut = false;
+
+    DrawTextRun(&textFormatRun, font, glyphs, position, tint);
+}
+
+//------------------------------------------------------------------------------------
+// raylib-lua [text] module functions - Text buffers
+//------------------------------------------------------------------------------------
+
+// Create a text buffer (log/console scrollback): TextBuffer(font, fontSize, spacing, color, capacity)
+// NOTE: Line height is the same as DrawTextEx() line breaks (1.5 lines)
+int lua_TextBuffer(lua_State *L)
+{
+    Font font = LuaGetArgument_Font(L, 1);
+    float fontSize = LuaGetArgument_float(L, 2);
+    float spacing = LuaGetArgument_float(L, 3);
+    Color color = LuaGetArgument_Color(L, 4);
+    int capacity = LuaGetArgument_int(L, 5);
+    luaL_argcheck(L, font.baseSize > 0, 1, "Expected loaded font");
+    luaL_argcheck(L, capacity > 0, 5, "Expected positive lines capacity");
+
+    TextBuffer *buffer = (TextBuffer *)lua_newuserdata(L, sizeof(TextBuffer));
+    memset(buffer, 0, sizeof(TextBuffer));
+    buffer->font = font;
+    buffer->fontSize = fontSize;
+    buffer->spacing = spacing;
+    buffer->lineHeight = (float)(int)((font.baseSize + font.baseSize/2)*(fontSize/(float)font.baseSize));
+    buffer->color = color;
+    buffer->capacity = capacity;
+    buffer->lines = (TextBufferLine *)calloc(capacity, sizeof(TextBufferLine));
+    buffer->visible.texture = font.texture;
+    luaL_setmetatable(L, "TextBuffer");
+    return 1;
+}
+
+// Add one line to text buffer, replacing oldest line if full
+static void TextBufferAddLine(TextBuffer *buffer, const char *text, int length, Color color)
+{
+    TextBufferLine *line = NULL;
+
+    if (buffer->count < buffer->capacity) line = &buffer->lines[(buffer->first + buffer->count++)%buffer->capacity];
+    else
+    {
+        line = &buffer->lines[buffer->first];
+        buffer->first = (buffer->first + 1)%buffer->capacity;
+    }
+
+    if (line->textSize < length + 1)
+    {
+        line->textSize = (length + 1 > 32)? length + 1 : 32;
+        line->text = (char *)realloc(line->text, line->textSize);
+    }
+
+    memcpy(line->text, text, length);
+    line->text[length] = '\0';
+    line->color = color;
+
+    TextRun *run = &line->run;
+    run->text = line->text;
+    run->textRef = LUA_NOREF;
+    run->fontChars = buffer->font.chars;
+    run->fontTextureId = buffer->font.texture.id;
+    run->fontSize = buffer->fontSize;
+    run->spacing = buffer->spacing;
+    run->measured = false;
+    run->laidOut = false;
+
+    TextRunMeasure(run, buffer->font);
+}
+
+// Get text buffer line from index (1 is oldest line, negative indices count from newest line), NULL if out of range
+static TextBufferLine *TextBufferGetLine(TextBuffer *buffer, int index)
+{
+    if (index < 0) index += buffer->count + 1;
+    if ((index < 1) || (index > buffer->count)) return NULL;
+
+    return &buffer->lines[(buffer->first + index - 1)%buffer->capacity];
+}
+
+// Append text to buffer, one line per line break: buffer:append(text[, color])
+// NOTE: Lines are measured on append, glyph quads are laid out on first draw
+static int LuaTextBufferAppend(lua_State *L)
+{
+    TextBuffer *buffer = (TextBuffer *)luaL_checkudata(L, 1, "TextBuffer");
+    size_t length = 0;
+    const char *text = luaL_checklstring(L, 2, &length);
+    Color color = lua_isnoneornil(L, 3)? buffer->color : LuaGetArgument_Color(L, 3);
+    const char *end = text + length;
+
+    for (const char *start = text; ; )
+    {
+        const char *lineEnd = (const char *)memchr(start, '\n', end - start);
+        if (lineEnd == NULL) lineEnd = end;
+
+        TextBufferAddLine(buffer, start, (int)(lineEnd - start), color);
+
+        if (lineEnd == end) break;
+        start = lineEnd + 1;
+    }
+
+    return 0;
+}
+
+// Get text buffer line text and measured width: buffer:getLine(index) -> text, width (nil if out of range)
+static int LuaTextBufferGetLine(lua_State *L)
+{
+    TextBuffer *buffer = (TextBuffer *)luaL_checkudata(L, 1, "TextBuffer");
+    TextBufferLine *line = TextBufferGetLine(buffer, LuaGetArgument_int(L, 2));
+
+    if (line == NULL) return 0;
+
+    lua_pushstring(L, line->text);
+    LuaPush_float(L, line->run.size.x);
+    return 2;
+}
+
+// Get distance between text buffer lines: buffer:getLineHeight()
+static int LuaTextBufferGetLineHeight(lua_State *L)
+{
+    TextBuffer *buffer = (TextBuffer *)luaL_checkudata(L, 1, "TextBuffer");
+    LuaPush_float(L, buffer->lineHeight);
+    return 1;
+}
+
+// Remove all text buffer lines (lines memory is kept): buffer:clear()
+static int LuaTextBufferClear(lua_State *L)
+{
+    TextBuffer *buffer = (TextBuffer *)luaL_checkudata(L, 1, "TextBuffer");
+    buffer->first = 0;
+    buffer->count = 0;
+    return 0;
+}
+
+// Draw text buffer lines window in one batch: buffer:draw(position, firstLine, linesCount) -> lines drawn
+// NOTE: First line is 1 for oldest line (window is clamped to lines in buffer), lines are never measured again
+static int LuaTextBufferDraw(lua_State *L)
+{
+    TextBuffer *buffer = (TextBuffer *)luaL_checkudata(L, 1, "TextBuffer");
+    Vector2 position = LuaGetArgument_Vector2(L, 2);
+    int firstLine = LuaGetArgument_int(L, 3);
+    int linesCount = LuaGetArgument_int(L, 4);
+    GlyphLookup *glyphs = GetFontGlyphLookup(buffer->font);
+    SpriteBatch *visible = &buffer->visible;
+
+    int start = (firstLine < 1)? 1 : firstLine;
+    int end = firstLine + linesCount - 1;
+    if (end > buffer->count) end = buffer->count;
+
+    visible->count = 0;
+
+    for (int i = start; i <= end; i++)
+    {
+        TextBufferLine *line = TextBufferGetLine(buffer, i);
+        const SpriteBatch *quads = &line->run.quads;
+        float offsetY = (i - firstLine)*buffer->lineHeight;
+
+        TextRunPrepare(&line->run, buffer->font, glyphs, line->color);
+        SpriteBatchReserve(visible, visible->count + quads->count);
+
+        for (int v = 0; v < 4*quads->count; v++)
+        {
+            visible->vertices[4*visible->count + v] = (Vector2){ quads->vertices[v].x, quads->vertices[v].y + offsetY };
+        }
+
+        memcpy(visible->texcoords + 4*visible->count, quads->texcoords, 4*quads->count*sizeof(Vector2));
+        memcpy(visible->colors + visible->count, quads->colors, quads->count*sizeof(Color));
+        visible->count += quads->count;
+    }
+
+    if (visible->count > 0)
+    {
+        if (recordingList != NULL) RecordSpritesCommand(visible, position);
+        else SpriteBatchSubmit(visible, position);
+    }
+
+    LuaPush_int(L, (end >= start)? (end - start + 1) : 0);
+    return 1;
+}
+
+// Lines in text buffer: #buffer
+static int LuaTextBufferCount(lua_State *L)
+{
+    TextBuffer *buffer = (TextBuffer *)luaL_checkudata(L, 1, "TextBuffer");
+    LuaPush_int(L, buffer->count);
+    return 1;
+}
+
+// Free text buffer lines (font is not unloaded)
+static int LuaTextBufferGC(lua_State *L)
+{
+    TextBuffer *buffer = (TextBuffer *)luaL_checkudata(L, 1, "TextBuffer");
+
+    if (buffer->lines != NULL)
+    {
+        for (int i = 0; i < buffer->capacity; i++)
+        {
+            free(buffer->lines[i].text);
+            SpriteBatchFree(&buffer->lines[i].run.quads);
+        }
+    }
+
+    free(buffer->lines);
+    SpriteBatchFree(&buffer->visible);
+    buffer->lines = NULL;
+    buffer->capacity = 0;
+    buffer->count = 0;
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// raylib-lua [text] module functions - Text layouts (word wrap)
+//------------------------------------------------------------------------------------
+
+// Set text layout text, glyph advances are computed (lines wrapped on next use)
+static void TextLayoutSetText(TextLayout *layout, const char *text, int length)
+{
+    GlyphLookup *glyphs = GetFontGlyphLookup(layout->font);
+    float scaleFactor = layout->fontSize/(float)layout->font.baseSize;
+
+    if (layout->textSize < length + 1)
+    {
+        layout->textSize = length + 1;
+        layout->text = (char *)realloc(layout->text, layout->textSize);
+    }
+
+    memcpy(layout->text, text, length);
+    layout->text[length] = '\0';
+
+    if (glyphs->dynamic != NULL) DynamicFontPrepareText(glyphs->dynamic, glyphs, layout->text);
+
+    // NOTE: Glyphs are never more than text bytes
+    if (layout->glyphsCapacity < length)
+    {
+        layout->glyphsCapacity = length;
+        layout->offsets = (int *)realloc(layout->offsets, length*sizeof(int));
+        layout->advances = (float *)realloc(layout->advances, length*sizeof(float));
+    }
+
+    layout->glyphsCount = 0;
+
+    for (int i = 0, bytes = 1; i < length; i += bytes)
+    {
+        float advance = 0.0f;
+        bytes = 1;
+
+        if (layout->text[i] != '\n')
+        {
+            CharInfo glyph = layout->font.chars[GetTextGlyphIndex(glyphs, (const unsigned char *)layout->text + i, &bytes)];
+
+            // NOTE: Same integer advance as DrawTextEx()
+            if (glyph.advanceX == 0) advance = (float)(int)(glyph.rec.width*scaleFactor + layout->spacing);
+            else advance = (float)(int)(glyph.advanceX*scaleFactor + layout->spacing);
+        }
+
+        layout->offsets[layout->glyphsCount] = i;
+        layout->advances[layout->glyphsCount] = advance;
+        layout->glyphsCount++;
+    }
+
+    layout->wrapped = false;
+    layout->laidOut = false;
+}
+
+// Add text layout line from glyphs range, width without last glyph spacing
+static void TextLayoutAddLine(TextLayout *layout, int start, int end, float width)
+{
+    if (layout->linesCount == layout->linesCapacity)
+    {
+        layout->linesCapacity = (layout->linesCapacity > 0)? 2*layout->linesCapacity : 8;
+        layout->lines = (TextLayoutLine *)realloc(layout->lines, layout->linesCapacity*sizeof(TextLayoutLine));
+    }
+
+    if (end > start) width -= layout->spacing;
+    if (width < 0.0f) width = 0.0f;
+
+    layout->lines[layout->linesCount++] = (TextLayoutLine){ start, end, width };
+    if (layout->size.x < width) layout->size.x = width;
+}
+
+// Wrap text layout lines at spaces (words longer than a line are broken), line breaks are kept
+static void TextLayoutWrap(TextLayout *layout)
+{
+    int start = 0;
+    int space = -1;                 // Last space glyph in line (-1 if none)
+    float width = 0.0f;
+    float spaceWidth = 0.0f;        // Line width before last space
+
+    layout->linesCount = 0;
+    layout->size = (Vector2){ 0.0f, 0.0f };
+
+    for (int i = 0; i <= layout->glyphsCount; i++)
+    {
+        char c = (i < layout->glyphsCount)? layout->text[layout->offsets[i]] : '\n';
+
+        if (c == '\n')
+        {
+            TextLayoutAddLine(layout, start, i, width);
+            start = i + 1;
+            space = -1;
+            width = 0.0f;
+            continue;
+        }
+
+        // Line overflow: break at last space, or before glyph if there is no space (trailing spaces never break)
+        while ((layout->maxWidth > 0.0f) && (c != ' ') && (i > start) && (width + layout->advances[i] - layout->spacing > layout->maxWidth))
+        {
+            if (space >= 0)
+            {
+                TextLayoutAddLine(layout, start, space, spaceWidth);
+                width -= spaceWidth + layout->advances[space];
+                start = space + 1;
+                space = -1;
+            }
+            else
+            {
+                TextLayoutAddLine(layout, start, i, width);
+                start = i;
+                width = 0.0f;
+            }
+        }
+
+        if (c == ' ')
+        {
+            space = i;
+            spaceWidth = width;
+        }
+
+        width += layout->advances[i];
+    }
+
+    layout->size.y = layout->fontSize + (layout->linesCount - 1)*layout->lineHeight;
+    layout->wrapped = true;
+    layout->laidOut = false;
+}
+
+// Lay out text layout glyph quads (relative to text position), same placement as DrawTextEx() for every line
+static void TextLayoutBuild(TextLayout *layout, const GlyphLookup *glyphs, Color tint)
+{
+    float scaleFactor = layout->fontSize/(float)layout->font.baseSize;
+    const unsigned char *text = (const unsigned char *)layout->text;
+    int bytes = 1;
+
+    layout->quads.texture = layout->font.texture;
+    layout->quads.count = 0;
+
+    for (int l = 0; l < layout->linesCount; l++)
+    {
+        float offsetX = 0.0f;
+        float offsetY = l*layout->lineHeight;
+
+        for (int i = layout->lines[l].start; i < layout->lines[l].end; i++)
+        {
+            const unsigned char *c = text + layout->offsets[i];
+
+            if (*c != ' ')
+            {
+                CharInfo glyph = layout->font.chars[GetTextGlyphIndex(glyphs, c, &bytes)];
+
+                SpriteBatchPush(&layout->quads, glyph.rec, (Rectangle){ offsetX + glyph.offsetX*scaleFactor, offsetY + glyph.offsetY*scaleFactor,
+                                glyph.rec.width*scaleFactor, glyph.rec.height*scaleFactor }, (Vector2){ 0.0f, 0.0f }, 0.0f, tint);
+            }
+
+            offsetX += layout->advances[i];
+        }
+    }
+
+    layout->tint = tint;
+    layout->laidOut = true;
+}
+
+// Create a text layout, text lines word wrapped to maximum width: TextLayout(font, text, fontSize, spacing, maxWidth)
+// NOTE: Maximum width 0 disables wrapping (only line breaks), line height is the same as DrawTextEx() (1.5 lines)
+int lua_TextLayout(lua_State *L)
+{
+    Font font = LuaGetArgument_Font(L, 1);
+    size_t length = 0;
+    const char *text = luaL_checklstring(L, 2, &length);
+    float fontSize = LuaGetArgument_float(L, 3);
+    float spacing = LuaGetArgument_float(L, 4);
+    float maxWidth = LuaGetArgument_float(L, 5);
+    luaL_argcheck(L, font.baseSize > 0, 1, "Expected loaded font");
+
+    TextLayout *layout = (TextLayout *)lua_newuserdata(L, sizeof(TextLayout));
+    memset(layout, 0, sizeof(TextLayout));
+    layout->font = font;
+    layout->fontSize = fontSize;
+    layout->spacing = spacing;
+    layout->maxWidth = maxWidth;
+    layout->lineHeight = (float)(int)((font.baseSize + font.baseSize/2)*(fontSize/(float)font.baseSize));
+    luaL_setmetatable(L, "TextLayout");
+
+    TextLayoutSetText(layout, text, (int)length);
+    return 1;
+}
+
+// Draw text layout: DrawTextLayout(layout, position, tint)
+// NOTE: Lines are wrapped again only after text or maximum width changes, glyph quads are cached
+int lua_DrawTextLayout(lua_State *L)
+{
+    TextLayout *layout = (TextLayout *)luaL_checkudata(L, 1, "TextLayout");
+    Vector2 position = LuaGetArgument_Vector2(L, 2);
+    Color tint = LuaGetArgument_Color(L, 3);
+    GlyphLookup *glyphs = GetFontGlyphLookup(layout->font);
+    DynamicFont *dynamic = glyphs->dynamic;
+
+    if (!layout->wrapped) TextLayoutWrap(layout);
+
+    bool complete = true;
+
+    if (dynamic != NULL)
+    {
+        if (layout->laidOut && (layout->fontGeneration == dynamic->generation)) DynamicFontTouchQuads(dynamic, &layout->quads);
+        else
+        {
+            complete = DynamicFontPrepareText(dynamic, glyphs, layout->text);
+            layout->laidOut = false;
+        }
+    }
+
+    if (!layout->laidOut) TextLayoutBuild(layout, glyphs, tint);
+    else if (memcmp(&layout->tint, &tint, sizeof(Color)) != 0)
+    {
+        for (int i = 0; i < layout->quads.count; i++) layout->quads.colors[i] = tint;
+        layout->tint = tint;
+    }
+
+    if (dynamic != NULL) layout->fontGeneration = complete? dynamic->generation : (dynamic->generation - 1);
+
+    if (layout->quads.count > 0)
+    {
+        if (recordingList != NULL) RecordSpritesCommand(&layout->quads, position);
+        else SpriteBatchSubmit(&layout->quads, position);
+    }
+
+    return 0;
+}
+
+// Set text layout text (lines wrapped again only if text changed): layout:setText(text)
+static int LuaTextLayoutSetText(lua_State *L)
+{
+    TextLayout *layout = (TextLayout *)luaL_checkudata(L, 1, "TextLayout");
+    size_t length = 0;
+    const char *text = luaL_checklstring(L, 2, &length);
+
+    if ((strlen(layout->text) != length) || (memcmp(layout->text, text, length) != 0)) TextLayoutSetText(layout, text, (int)length);
+    return 0;
+}
+
+// Set text layout maximum lines width (lines wrapped again only if width changed): layout:setMaxWidth(maxWidth)
+static int LuaTextLayoutSetMaxWidth(lua_State *L)
+{
+    TextLayout *layout = (TextLayout *)luaL_checkudata(L, 1, "TextLayout");
+    float maxWidth = LuaGetArgument_float(L, 2);
+
+    if (layout->maxWidth != maxWidth)
+    {
+        layout->maxWidth = maxWidth;
+        layout->wrapped = false;
+    }
+
+    return 0;
+}
+
+// Get text layout size after wrapping: layout:getSize() -> Vector2
+static int LuaTextLayoutGetSize(lua_State *L)
+{
+    TextLayout *layout = (TextLayout *)luaL_checkudata(L, 1, "TextLayout");
+    if (!layout->wrapped) TextLayoutWrap(layout);
+    LuaPush_Vector2(L, layout->size);
+    return 1;
+}
+
+// Get text layout line text and width: layout:getLine(index) -> text, width (nil if out of range)
+static int LuaTextLayoutGetLine(lua_State *L)
+{
+    TextLayout *layout = (TextLayout *)luaL_checkudata(L, 1, "TextLayout");
+    int index = LuaGetArgument_int(L, 2);
+
+    if (!layout->wrapped) TextLayoutWrap(layout);
+    if ((index < 1) || (index > layout->linesCount)) return 0;
+
+    TextLayoutLine line = layout->lines[index - 1];
+    int start = (line.start < layout->glyphsCount)? layout->offsets[line.start] : (int)strlen(layout->text);
+    int end = (line.end < layout->glyphsCount)? layout->offsets[line.end] : (int)strlen(layout->text);
+
+    lua_pushlstring(L, layout->text + start, end - start);
+    LuaPush_float(L, line.width);
+    return 2;
+}
+
+// Lines in text layout after wrapping: #layout
+static int LuaTextLayoutCount(lua_State *L)
+{
+    TextLayout *layout = (TextLayout *)luaL_checkudata(L, 1, "TextLayout");
+    if (!layout->wrapped) TextLayoutWrap(layout);
+    LuaPush_int(L, layout->linesCount);
+    return 1;
+}
+
+// Free text layout memory (font is not unloaded)
+static int LuaTextLayoutGC(lua_State *L)
+{
+    TextLayout *layout = (TextLayout *)luaL_checkudata(L, 1, "TextLayout");
+    free(layout->text);
+    free(layout->offsets);
+    free(layout->advances);
+    free(layout->lines);
+    SpriteBatchFree(&layout->quads);
+    layout->text = NULL;
+    layout->offsets = NULL;
+    layout->advances = NULL;
+    layout->lines = NULL;
+    layout->textSize = 0;
+    layout->glyphsCapacity = 0;
+    layout->linesCapacity = 0;
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// raylib [text] module functions - Font Loading and Text Drawing
+//------------------------------------------------------------------------------------
+
+// Get the default Font
+int lua_GetFontDefault(lua_State *L)
+{
+    Font result = GetFontDefault();
+    LuaPush_Font(L, result);
+    return 1;
+}
+
+// Load font from file into GPU memory (VRAM)
+int lua_LoadFont(lua_State *L)
+{
+    const char *fileName = LuaGetArgument_string(L, 1);
+    Font result = LoadFont(fileName);
+    LuaPush_Font(L, result);
+    return 1;
+}
+
+// Load font from file with extended parameters
+int lua_LoadFontEx(lua_State *L)
+{
+    const char *fileName = LuaGetArgument_string(L, 1);
+    int fontSize = LuaGetArgument_int(L, 2);
+    int charsCount = LuaGetArgument_int(L, 3);
+    int fontChars = LuaGetArgument_int(L, 4);
+    Font result = LoadFontEx(fileName, fontSize, charsCount, fontChars);
+    LuaPush_Font(L, result);
+    return 1;
+}
+
+// Load font data for further use
+int lua_LoadFontData(lua_State *L)
+{
+    const char *fileName = LuaGetArgument_string(L, 1);
+    int fontSize = LuaGetArgument_int(L, 2);
+    int fontChars = LuaGetArgument_int(L, 3);
+    int charsCount = LuaGetArgument_int(L, 4);
+    bool sdf = LuaGetArgument_bool(L, 5);
+    CharInfo result = LoadFontData(fileName, fontSize, fontChars, charsCount, sdf);
+    LuaPush_CharInfo(L, result);
+    return 1;
+}
+
+// Generate image font atlas using chars info
+int lua_GenImageFontAtlas(lua_State *L)
+{
+    CharInfo chars = LuaGetArgument_CharInfo(L, 1);
+    int fontSize = LuaGetArgument_int(L, 2);
+    int charsCount = LuaGetArgument_int(L, 3);
+    int padding = LuaGetArgument_int(L, 4);
+    int packMethod = LuaGetArgument_int(L, 5);
+    Image result = GenImageFontAtlas(chars, fontSize, charsCount, padding, packMethod);
+    LuaPush_Image(L, result);
+    return 1;
+}
+
+// Unload Font from GPU memory (VRAM)
+int lua_UnloadFont(lua_State *L)
+{
+    Font font = LuaGetArgument_Font(L, 1);
+    DynamicFont *dynamic = GetFontGlyphLookup(font)->dynamic;
+    TextCacheRemoveFont(L, font);
+    RemoveFontGlyphLookup(font);
+
+    if (dynamic != NULL)
+    {
+        UnloadTexture(dynamic->texture);
+        DynamicFontFree(dynamic);
+    }
+    else UnloadFont(font);
+    return 0;
+}
+
+// Text drawing functions
+// Shows current FPS
+int lua_DrawFPS(lua_State *L)
+{
+    int posX = LuaGetArgument_int(L, 1);
+    int posY = LuaGetArgument_int(L, 2);
+    if (recordingList != NULL) RecordShapeCommand(COMMAND_FPS, (ShapeCommand){ .points = { { posX, posY } } });
+    else DrawFPS(posX, posY);
+    return 0;
+}
+
+// Draw text (using default font)
+int lua_DrawText(lua_State *L)
+{
+    const char *text = LuaGetArgument_string(L, 1);
+    int posX = LuaGetArgument_int(L, 2);
+    int posY = LuaGetArgument_int(L, 3);
+    int fontSize = LuaGetArgument_int(L, 4);
+    Color color = LuaGetArgument_Color(L, 5);
+    if (recordingList != NULL) RecordTextCommand(COMMAND_TEXT, (TextCommand){ .position = { posX, posY }, .fontSize = fontSize, .color = color }, text);
+    else
+    {
+        // NOTE: Same default font size and spacing as DrawText()
+        Font font = GetFontDefault();
+        if (fontSize < 10) fontSize = 10;
+        if (font.texture.id != 0) DrawTextCached(L, 1, font, (Vector2){ (float)posX, (float)posY }, (float)fontSize, (float)(fontSize/10), color);
+    }
+    return 0;
+}
+
+// WARNING: Draw text using font and additional parameters
+int lua_DrawTextEx(lua_State *L)
+{
+    Font font = LuaGetArgument_Font(L, 1);
+    LuaGetArgument_string(L, 2);
+    Vector2 position = LuaGetArgument_Vector2(L, 3);
+    float fontSize = LuaGetArgument_float(L, 4);
+    float spacing = LuaGetArgument_float(L, 5);
+    Color tint = LuaGetArgument_Color(L, 6);
+    DrawTextCached(L, 2, font, position, fontSize, spacing, tint);
+    return 0;
+}
+
+// Draw formatted text (using default font): DrawTextF(format, posX, posY, fontSize, color, ...)
+// NOTE: Format conversions as string.format(), formatted into a stack buffer (no Lua strings created)
+int lua_DrawTextF(lua_State *L)
+{
+    char buffer[RLUA_TEXT_FORMAT_SIZE];
+    const char *format = LuaGetArgument_string(L, 1);
+    int posX = LuaGetArgument_int(L, 2);
+    int posY = LuaGetArgument_int(L, 3);
+    int fontSize = LuaGetArgument_int(L, 4);
+    Color color = LuaGetArgument_Color(L, 5);
+    const char *text = LuaFormatText(L, format, 6, buffer, RLUA_TEXT_FORMAT_SIZE);
+    if (recordingList != NULL) RecordTextCommand(COMMAND_TEXT, (TextCommand){ .position = { posX, posY }, .fontSize = fontSize, .color = color }, text);
+    else
+    {
+        // NOTE: Same default font size and spacing as DrawText()
+        Font font = GetFontDefault();
+        if (fontSize < 10) fontSize = 10;
+        if (font.texture.id != 0) DrawTextFormatted(font, text, (Vector2){ (float)posX, (float)posY }, (float)fontSize, (float)(fontSize/10), color);
+    }
+    return 0;
+}
+
+// Draw formatted text using font: DrawTextExF(font, format, position, fontSize, spacing, tint, ...)
+int lua_DrawTextExF(lua_State *L)
+{
+    char buffer[RLUA_TEXT_FORMAT_SIZE];
+    Font font = LuaGetArgument_Font(L, 1);
+    const char *format = LuaGetArgument_string(L, 2);
+    Vector2 position = LuaGetArgument_Vector2(L, 3);
+    float fontSize = LuaGetArgument_float(L, 4);
+    float spacing = LuaGetArgument_float(L, 5);
+    Color tint = LuaGetArgument_Color(L, 6);
+    const char *text = LuaFormatText(L, format, 7, buffer, RLUA_TEXT_FORMAT_SIZE);
+    DrawTextFormatted(font, text, position, fontSize, spacing, tint);
+    return 0;
+}
+
+// Text misc. functions
+// Measure string width for default font
+int lua_MeasureText(lua_State *L)
+{
+    LuaGetArgument_string(L, 1);
+    int fontSize = LuaGetArgument_int(L, 2);
+    Font font = GetFontDefault();
+    int result = 0;
+    if (fontSize < 10) fontSize = 10;
+    if (font.texture.id != 0) result = (int)TextRunMeasure(TextCacheGet(L, 1, font, (float)fontSize, (float)(fontSize/10)), font).x;
+    LuaPush_int(L, result);
+    return 1;
+}
+
+// Measure string size for Font
+int lua_MeasureTextEx(lua_State *L)
+{
+    Font font = LuaGetArgument_Font(L, 1);
+    LuaGetArgument_string(L, 2);
+    float fontSize = LuaGetArgument_float(L, 3);
+    float spacing = LuaGetArgument_float(L, 4);
+    Vector2 result = TextRunMeasure(TextCacheGet(L, 2, font, fontSize, spacing), font);
+    LuaPush_Vector2(L, result);
+    return 1;
+}
+
+// Formatting of text with variables to 'embed', same conversions as string.format()
+int lua_FormatText(lua_State *L)
+{
+    char buffer[RLUA_TEXT_FORMAT_SIZE];
+    const char *text = LuaGetArgument_string(L, 1);
+    lua_pushstring(L, LuaFormatText(L, text, 2, buffer, RLUA_TEXT_FORMAT_SIZE));
+    return 1;
+}
+
+// WARNING: SubText() can be replaced by Lua function: string.sub()
+
+// Get index position for a unicode character on font
+int lua_GetGlyphIndex(lua_State *L)
+{
+    Font font = LuaGetArgument_Font(L, 1);
+    int character = LuaGetArgument_int(L, 2);
+    int result = GlyphLookupIndex(GetFontGlyphLookup(font), character);
+    LuaPush_int(L, result);
+    return 1;
+}
+
+//------------------------------------------------------------------------------------
+// raylib [models] module functions - Basic 3d Shapes Drawing Functions
+//------------------------------------------------------------------------------------
+
+// Draw a line in 3D world space
+int lua_DrawLine3D(lua_State *L)
+{
+    Vector3 startPos = LuaGetArgument_Vector3(L, 1);
+    Vector3 endPos = LuaGetArgument_Vector3(L, 2);
+    Color color = LuaGetArgument_Color(L, 3);
+    if (recordingList != NULL) RecordShape3DCommand(COMMAND_LINE_3D, (Shape3DCommand){ .points = { startPos, endPos }, .color = color });
+    else DrawLine3D(startPos, endPos, color);
+    return 0;
+}
+
+// Draw a circle in 3D world space
+int lua_DrawCircle3D(lua_State *L)
+{
+    Vector3 center = LuaGetArgument_Vector3(L, 1);
+    float radius = LuaGetArgument_float(L, 2);
+    Vector3 rotationAxis = LuaGetArgument_Vector3(L, 3);
+    float rotationAngle = LuaGetArgument_float(L, 4);
+    Color color = LuaGetArgument_Color(L, 5);
+    if (recordingList != NULL) RecordShape3DCommand(COMMAND_CIRCLE_3D, (Shape3DCommand){ .points = { center, rotationAxis }, .values = { radius, rotationAngle }, .color = color });
+    else DrawCircle3D(center, radius, rotationAxis, rotationAngle, color);
+    return 0;
+}
+
+// Draw cube
+int lua_DrawCube(lua_State *L)
+{
+    Vector3 position = LuaGetArgument_Vector3(L, 1);
+    float width = LuaGetArgument_float(L, 2);
+    float height = LuaGetArgument_float(L, 3);
+    float length = LuaGetArgument_float(L, 4);
+    Color color = LuaGetArgument_Color(L, 5);
+    if (recordingList != NULL) RecordShape3DCommand(COMMAND_CUBE, (Shape3DCommand){ .points = { position }, .size = { width, height, length }, .color = color });
+    else DrawCube(position, width, height, length, color);
+    return 0;
+}
+
+// Draw cube (Vector version)
+int lua_DrawCubeV(lua_State *L)
+{
+    Vector3 position = LuaGetArgument_Vector3(L, 1);
+    Vector3 size = LuaGetArgument_Vector3(L, 2);
+    Color color = LuaGetArgument_Color(L, 3);
+    if (recordingList != NULL) RecordShape3DCommand(COMMAND_CUBE, (Shape3DCommand){ .points = { position }, .size = size, .color = color });
+    else DrawCubeV(position, size, color);
+    return 0;
+}
+
+// Draw cube wires
+int lua_DrawCubeWires(lua_State *L)
+{
+    Vector3 position = LuaGetArgument_Vector3(L, 1);
+    float width = LuaGetArgument_float(L, 2);
+    float height = LuaGetArgument_float(L, 3);
+    float length = LuaGetArgument_float(L, 4);
+    Color color = LuaGetArgument_Color(L, 5);
+    if (recordingList != NULL) RecordShape3DCommand(COMMAND_CUBE_WIRES, (Shape3DCommand){ .points = { position }, .size = { width, height, length }, .color = color });
+    else DrawCubeWires(position, width, height, length, color);
+    return 0;
+}
+
+// Draw cube textured
+int lua_DrawCubeTexture(lua_State *L)
+{
+    Texture2D texture = LuaGetArgument_Texture2D(L, 1);
+    Vector3 position = LuaGetArgument_Vector3(L, 2);
+    float width = LuaGetArgument_float(L, 3);
+    float height = LuaGetArgument_float(L, 4);
+    float length = LuaGetArgument_float(L, 5);
+    Color color = LuaGetArgument_Color(L, 6);
+    if (recordingList != NULL) RecordShape3DCommand(COMMAND_CUBE_TEXTURE, (Shape3DCommand){ .points = { position }, .size = { width, height, length }, .color = color, .texture = texture });
+    else DrawCubeTexture(texture, position, width, height, length, color);
+    return 0;
+}
+
+// Draw sphere
+int lua_DrawSphere(lua_State *L)
+{
+    Vector3 centerPos = LuaGetArgument_Vector3(L, 1);
+    float radius = LuaGetArgument_float(L, 2);
+    Color color = LuaGetArgument_Color(L, 3);
+    if (recordingList != NULL) RecordShape3DCommand(COMMAND_SPHERE, (Shape3DCommand){ .points = { centerPos }, .values = { radius, 16, 16 }, .color = color });
+    else DrawSphere(centerPos, radius, color);
+    return 0;
+}
+
+// Draw sphere with extended parameters
+int lua_DrawSphereEx(lua_State *L)
+{
+    Vector3 centerPos = LuaGetArgument_Vector3(L, 1);
+    float radius = LuaGetArgument_float(L, 2);
+    int rings = LuaGetArgument_int(L, 3);
+    int slices = LuaGetArgument_int(L, 4);
+    Color color = LuaGetArgument_Color(L, 5);
+    if (recordingList != NULL) RecordShape3DCommand(COMMAND_SPHERE, (Shape3DCommand){ .points = { centerPos }, .values = { radius, rings, slices }, .color = color });
+    else DrawSphereEx(centerPos, radius, rings, slices, color);
+    return 0;
+}
+
+// Draw sphere wires
+int lua_DrawSphereWires(lua_State *L)
+{
+    Vector3 centerPos = LuaGetArgument_Vector3(L, 1);
+    float radius = LuaGetArgument_float(L, 2);
+    int rings = LuaGetArgument_int(L, 3);
+    int slices = LuaGetArgument_int(L, 4);
+    Color color = LuaGetArgument_Color(L, 5);
+    if (recordingList != NULL) RecordShape3DCommand(COMMAND_SPHERE_WIRES, (Shape3DCommand){ .points = { centerPos }, .values = { radius, rings, slices }, .color = color });
+    else DrawSphereWires(centerPos, radius, rings, slices, color);
+    return 0;
+}
+
+// Draw a cylinder/cone
+int lua_DrawCylinder(lua_State *L)
+{
+    Vector3 position = LuaGetArgument_Vector3(L, 1);
+    float radiusTop = LuaGetArgument_float(L, 2);
+    float radiusBottom = LuaGetArgument_float(L, 3);
+    float height = LuaGetArgument_float(L, 4);
+    int slices = LuaGetArgument_int(L, 5);
+    Color color = LuaGetArgument_Color(L, 6);
+    if (recordingList != NULL) RecordShape3DCommand(COMMAND_CYLINDER, (Shape3DCommand){ .points = { position }, .values = { radiusTop, radiusBottom, height, slices }, .color = color });
+    else DrawCylinder(position, radiusTop, radiusBottom, height, slices, color);
+    return 0;
+}
+
+// Draw a cylinder/cone wires
+int lua_DrawCylinderWires(lua_State *L)
+{
+    Vector3 position = LuaGetArgument_Vector3(L, 1);
+    float radiusTop = LuaGetArgument_float(L, 2);
+    float radiusBottom = LuaGetArgument_float(L, 3);
+    float height = LuaGetArgument_float(L, 4);
+    int slices = LuaGetArgument_int(L, 5);
+    Color color = LuaGetArgument_Color(L, 6);
+    if (recordingList != NULL) RecordShape3DCommand(COMMAND_CYLINDER_WIRES, (Shape3DCommand){ .points = { position }, .values = { radiusTop, radiusBottom, height, slices }, .color = color });
+    else DrawCylinderWires(position, radiusTop, radiusBottom, height, slices, color);
+    return 0;
+}
+
+// Draw a plane XZ
+int lua_DrawPlane(lua_State *L)
+{
+    Vector3 centerPos = LuaGetArgument_Vector3(L, 1);
+    Vector2 size = LuaGetArgument_Vector2(L, 2);
+    Color color = LuaGetArgument_Color(L, 3);
+    if (recordingList != NULL) RecordShape3DCommand(COMMAND_PLANE, (Shape3DCommand){ .points = { centerPos }, .size = { size.x, 0.0f, size.y }, .color = color });
+    else DrawPlane(centerPos, size, color);
+    return 0;
+}
+
+// Draw a ray line
+int lua_DrawRay(lua_State *L)
+{
+    Ray ray = LuaGetArgument_Ray(L, 1);
+    Color color = LuaGetArgument_Color(L, 2);
+    if (recordingList != NULL) RecordShape3DCommand(COMMAND_RAY, (Shape3DCommand){ .points = { ray.position, ray.direction }, .color = color });
+    else DrawRay(ray, color);
+    return 0;
+}
+
+// Draw a grid (centered at (0, 0, 0))
+int lua_DrawGrid(lua_State *L)
+{
+    int slices = LuaGetArgument_int(L, 1);
+    float spacing = LuaGetArgument_float(L, 2);
+    if (recordingList != NULL) RecordShape3DCommand(COMMAND_GRID, (Shape3DCommand){ .values = { slices, spacing } });
+    else DrawGrid(slices, spacing);
+    return 0;
+}
+
+// Draw simple gizmo
+int lua_DrawGizmo(lua_State *L)
+{
+    Vector3 position = LuaGetArgument_Vector3(L, 1);
+    if (recordingList != NULL) RecordShape3DCommand(COMMAND_GIZMO, (Shape3DCommand){ .points = { position } });
+    else DrawGizmo(position);
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// raylib [models] module functions
+//------------------------------------------------------------------------------------
+
+// Load model from files (mesh and material)
+int lua_LoadModel(lua_State *L)
+{
+    const char *fileName = LuaGetArgument_string(L, 1);
+    Model result = LoadModel(fileName);
+    LuaPush_Model(L, result);
+    return 1;
+}
+
+// Load model from generated mesh
+int lua_LoadModelFromMesh(lua_State *L)
+{
+    Mesh mesh = LuaGetArgument_Mesh(L, 1);
+    Model result = LoadModelFromMesh(mesh);
+    LuaPush_Model(L, result);
+    return 1;
+}
+
+// Unload model from memory (RAM and/or VRAM)
+int lua_UnloadModel(lua_State *L)
+{
+    Model model = LuaGetArgument_Model(L, 1);
+    UnloadModel(model);
+    return 0;
+}
+
+// Mesh loading/unloading functions
+// Load mesh from file
+int lua_LoadMesh(lua_State *L)
+{
+    const char *fileName = LuaGetArgument_string(L, 1);
+    Mesh result = LoadMesh(fileName);
+    LuaPush_Mesh(L, result);
+    return 1;
+}
+
+// Unload mesh from memory (RAM and/or VRAM)
+int lua_UnloadMesh(lua_State *L)
+{
+    Mesh mesh = LuaGetArgument_Mesh(L, 1);
+    UnloadMesh(mesh);
+    return 0;
+}
+
+// Export mesh as an OBJ file
+int lua_ExportMesh(lua_State *L)
+{
+    const char *fileName = LuaGetArgument_string(L, 1);
+    Mesh mesh = LuaGetArgument_Mesh(L, 2);
+    ExportMesh(fileName, mesh);
+    return 0;
+}
+
+// Mesh manipulation functions
+// Compute mesh bounding box limits
+int lua_MeshBoundingBox(lua_State *L)
+{
+    Mesh mesh = LuaGetArgument_Mesh(L, 1);
+    BoundingBox result = MeshBoundingBox(mesh);
+    LuaPush_BoundingBox(L, result);
+    return 1;
+}
+
+// Compute mesh tangents
+int lua_MeshTangents(lua_State *L)
+{
+    Mesh mesh = LuaGetArgument_Mesh(L, 1);
+    MeshTangents(mesh);
+    return 0;
+}
+
+// Compute mesh binormals
+int lua_MeshBinormals(lua_State *L)
+{
+    Mesh mesh = LuaGetArgument_Mesh(L, 1);
+    MeshBinormals(mesh);
+    return 0;
+}
+
+// Mesh generation functions
+
+// Generate plane mesh (with subdivisions)
+int lua_GenMeshPlane(lua_State *L)
+{
+    float width = LuaGetArgument_float(L, 1);
+    float length = LuaGetArgument_float(L, 2);
+    int resX = LuaGetArgument_int(L, 3);
+    int resZ = LuaGetArgument_int(L, 4);
+    Mesh result = GenMeshPlane(width, length, resX, resZ);
+    LuaPush_Mesh(L, result);
+    return 1;
+}
+
+// Generate cuboid mesh
+int lua_GenMeshCube(lua_State *L)
+{
+    float width = LuaGetArgument_float(L, 1);
+    float height = LuaGetArgument_float(L, 2);
+    float length = LuaGetArgument_float(L, 3);
+    Mesh result = GenMeshCube(width, height, length);
+    LuaPush_Mesh(L, result);
+    return 1;
+}
+
+// Generate sphere mesh (standard sphere)
+int lua_GenMeshSphere(lua_State *L)
+{
+    float radius = LuaGetArgument_float(L, 1);
+    int rings = LuaGetArgument_int(L, 2);
+    int slices = LuaGetArgument_int(L, 3);
+    Mesh result = GenMeshSphere(radius, rings, slices);
+    LuaPush_Mesh(L, result);
+    return 1;
+}
+
+// Generate half-sphere mesh (no bottom cap)
+int lua_GenMeshHemiSphere(lua_State *L)
+{
+    float radius = LuaGetArgument_float(L, 1);
+    int rings = LuaGetArgument_int(L, 2);
+    int slices = LuaGetArgument_int(L, 3);
+    Mesh result = GenMeshHemiSphere(radius, rings, slices);
+    LuaPush_Mesh(L, result);
+    return 1;
+}
+
+// Generate cylinder mesh
+int lua_GenMeshCylinder(lua_State *L)
+{
+    float radius = LuaGetArgument_float(L, 1);
+    float height = LuaGetArgument_float(L, 2);
+    int slices = LuaGetArgument_int(L, 3);
+    Mesh result = GenMeshCylinder(radius, height, slices);
+    LuaPush_Mesh(L, result);
+    return 1;
+}
+
+// Generate torus mesh
+int lua_GenMeshTorus(lua_State *L)
+{
+    float radius = LuaGetArgument_float(L, 1);
+    float size = LuaGetArgument_float(L, 2);
+    int radSeg = LuaGetArgument_int(L, 3);
+    int sides = LuaGetArgument_int(L, 4);
+    Mesh result = GenMeshTorus(radius, size, radSeg, sides);
+    LuaPush_Mesh(L, result);
+    return 1;
+}
+
+// Generate trefoil knot mesh
+int lua_GenMeshKnot(lua_State *L)
+{
+    float radius = LuaGetArgument_float(L, 1);
+    float size = LuaGetArgument_float(L, 2);
+    int radSeg = LuaGetArgument_int(L, 3);
+    int sides = LuaGetArgument_int(L, 4);
+    Mesh result = GenMeshKnot(radius, size, radSeg, sides);
+    LuaPush_Mesh(L, result);
+    return 1;
+}
+
+// Generate heightmap mesh from image data
+int lua_GenMeshHeightmap(lua_State *L)
+{
+    Image heightmap = LuaGetArgument_Image(L, 1);
+    Vector3 size = LuaGetArgument_Vector3(L, 2);
+    Mesh result = GenMeshHeightmap(heightmap, size);
+    LuaPush_Mesh(L, result);
+    return 1;
+}
+
+// Generate cubes-based map mesh from image data
+int lua_GenMeshCubicmap(lua_State *L)
+{
+    Image cubicmap = LuaGetArgument_Image(L, 1);
+    Vector3 cubeSize = LuaGetArgument_Vector3(L, 2);
+    Mesh result = GenMeshCubicmap(cubicmap, cubeSize);
+    LuaPush_Mesh(L, result);
+    return 1;
+}
+
+// Material loading/unloading functions
+// Load material from file
+int lua_LoadMaterial(lua_State *L)
+{
+    const char *fileName = LuaGetArgument_string(L, 1);
+    Material result = LoadMaterial(fileName);
+    LuaPush_Material(L, result);
+    return 1;
+}
+
+// Load default material (Supports: DIFFUSE, SPECULAR, NORMAL maps)
+int lua_LoadMaterialDefault(lua_State *L)
+{
+    Material result = LoadMaterialDefault();
+    LuaPush_Material(L, result);
+    return 1;
+}
+
+// Unload material from GPU memory (VRAM)
+int lua_UnloadMaterial(lua_State *L)
+{
+    Material material = LuaGetArgument_Material(L, 1);
+    UnloadMaterial(material);
+    return 0;
+}
+
+// Model drawing functions
+// Draw a model (with texture if set)
+int lua_DrawModel(lua_State *L)
+{
+    Model model = LuaGetArgument_Model(L, 1);
+    Vector3 position = LuaGetArgument_Vector3(L, 2);
+    float scale = LuaGetArgument_float(L, 3);
+    Color tint = LuaGetArgument_Color(L, 4);
+    if (recordingList != NULL) RecordModelCommand(COMMAND_MODEL, (ModelCommand){ model, position, { 0.0f, 1.0f, 0.0f }, 0.0f, { scale, scale, scale }, tint });
+    else DrawModel(model, position, scale, tint);
+    return 0;
+}
+
+// Draw a model with extended parameters
+// NOTE: DrawModelEx(model, transform, tint) draws model with a Matrix transform (applied after model transform)
+int lua_DrawModelEx(lua_State *L)
+{
+    Model model = LuaGetArgument_Model(L, 1);
+    const Matrix *transform = (const Matrix *)luaL_testudata(L, 2, "Matrix");
+
+    if (transform != NULL)
+    {
+        Color tint = LuaGetArgument_Color(L, 3);
+        model.transform = MatrixMultiply(model.transform, *transform);
+        if (recordingList != NULL) RecordModelCommand(COMMAND_MODEL, (ModelCommand){ model, { 0.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, 0.0f, { 1.0f, 1.0f, 1.0f }, tint });
+        else DrawModel(model, (Vector3){ 0.0f, 0.0f, 0.0f }, 1.0f, tint);
+        return 0;
+    }
+
+    Vector3 position = LuaGetArgument_Vector3(L, 2);
+    Vector3 rotationAxis = LuaGetArgument_Vector3(L, 3);
+    float rotationAngle = LuaGetArgument_float(L, 4);
+    Vector3 scale = LuaGetArgument_Vector3(L, 5);
+    Color tint = LuaGetArgument_Color(L, 6);
+    if (recordingList != NULL) RecordModelCommand(COMMAND_MODEL, (ModelCommand){ model, position, rotationAxis, rotationAngle, scale, tint });
+    else DrawModelEx(model, position, rotationAxis, rotationAngle, scale, tint);
+    return 0;
+}
+
+// Draw a model wires (with texture if set)
+int lua_DrawModelWires(lua_State *L)
+{
+    Model model = LuaGetArgument_Model(L, 1);
+    Vector3 position = LuaGetArgument_Vector3(L, 2);
+    float scale = LuaGetArgument_float(L, 3);
+    Color tint = LuaGetArgument_Color(L, 4);
+    if (recordingList != NULL) RecordModelCommand(COMMAND_MODEL_WIRES, (ModelCommand){ model, position, { 0.0f, 1.0f, 0.0f }, 0.0f, { scale, scale, scale }, tint });
+    else DrawModelWires(model, position, scale, tint);
+    return 0;
+}
+
+// Draw a model wires (with texture if set) with extended parameters
+int lua_DrawModelWiresEx(lua_State *L)
+{
+    Model model = LuaGetArgument_Model(L, 1);
+    Vector3 position = LuaGetArgument_Vector3(L, 2);
+    Vector3 rotationAxis = LuaGetArgument_Vector3(L, 3);
+    float rotationAngle = LuaGetArgument_float(L, 4);
+    Vector3 scale = LuaGetArgument_Vector3(L, 5);
+    Color tint = LuaGetArgument_Color(L, 6);
+    if (recordingList != NULL) RecordModelCommand(COMMAND_MODEL_WIRES, (ModelCommand){ model, position, rotationAxis, rotationAngle, scale, tint });
+    else DrawModelWiresEx(model, position, rotationAxis, rotationAngle, scale, tint);
+    return 0;
+}
+
+// Get model instance transform from typed buffer: matrix (16 floats) or position/rotation/scale (9 floats)
+// NOTE: Rotation is defined as euler angles in degrees (applied X, Y, Z), same composition as DrawModelEx()
+static Matrix GetInstanceTransform(const float *data, bool matrixLayout)
+{
+    Matrix transform = { 0 };
+
+    if (matrixLayout) memcpy(&transform, data, sizeof(Matrix));
+    else
+    {
+        Matrix matScale = MatrixScale(data[6], data[7], data[8]);
+        Matrix matRotation = MatrixMultiply(MatrixMultiply(MatrixRotateX(data[3]*DEG2RAD), MatrixRotateY(data[4]*DEG2RAD)), MatrixRotateZ(data[5]*DEG2RAD));
+        Matrix matTranslation = MatrixTranslate(data[0], data[1], data[2]);
+
+        transform = MatrixMultiply(MatrixMultiply(matScale, matRotation), matTranslation);
+    }
+
+    return transform;
+}
+
+// Draw many instances of a model: DrawModelInstances(model, transforms[, tint[, layout]])
+// transforms is a FloatBuffer of matrices (layout "matrix", default) or position/rotation/scale triplets (layout "trs")
+// NOTE: Model is decoded once per call, GPU instancing requires raylib DrawMeshInstanced() (RLUA_SUPPORT_MESH_INSTANCING)
+int lua_DrawModelInstances(lua_State *L)
+{
+    static const char *layouts[] = { "matrix", "trs", NULL };
+
+    Model model = LuaGetArgument_Model(L, 1);
+    TypedBuffer *transforms = LuaGetArgument_Buffer(L, 2, BUFFER_FLOAT);
+    Color tint = lua_isnoneornil(L, 3)? WHITE : LuaGetArgument_Color(L, 3);
+    bool matrixLayout = (luaL_checkoption(L, 4, "matrix", layouts) == 0);
+    int stride = matrixLayout? 16 : 9;
+
+    luaL_argcheck(L, (transforms->count%stride) == 0, 2, matrixLayout? "Expected 16 floats per instance" : "Expected 9 floats per instance");
+
+    int count = transforms->count/stride;
+
+    model.material.maps[MAP_DIFFUSE].color = tint;
+
+    Matrix *instances = (Matrix *)malloc(count*sizeof(Matrix));
+
+    for (int i = 0; i < count; i++) instances[i] = MatrixMultiply(model.transform, GetInstanceTransform(transforms->floats + i*stride, matrixLayout));
+
+    if (recordingList != NULL) RecordMeshInstancesCommand(model.mesh, model.material, instances, count);
+    else DrawMeshTransforms(model.mesh, model.material, instances, count);
+
+    free(instances);
+
+    return 0;
+}
+
+// Get camera view frustum planes, same projection as BeginMode3D() for current screen size
+// NOTE: Planes extracted from view-projection matrix rows and normalized, box is inside if distance >= 0
+static Frustum GetCameraFrustum(Camera camera)
+{
+    Frustum frustum = { 0 };
+
+    // NOTE: Pipelined mode worker records frames for the screen size of its input snapshot
+    int screenWidth = pipeline.enabled? pipeline.input.screenWidth : GetScreenWidth();
+    int screenHeight = pipeline.enabled? pipeline.input.screenHeight : GetScreenHeight();
+    double aspect = (double)screenWidth/(double)screenHeight;
+    Matrix matProj = { 0 };
+
+    if (camera.type == CAMERA_PERSPECTIVE) matProj = MatrixPerspective(camera.fovy*DEG2RAD, aspect, 0.01, 1000.0);
+    else
+    {
+        double top = camera.fovy/2.0;
+        double right = top*aspect;
+        matProj = MatrixOrtho(-right, right, -top, top, 0.01, 1000.0);
+    }
+
+    Matrix m = MatrixMultiply(MatrixLookAt(camera.position, camera.target, camera.up), matProj);
+
+    float rows[4][4] = {
+        { m.m0, m.m4, m.m8, m.m12 },
+        { m.m1, m.m5, m.m9, m.m13 },
+        { m.m2, m.m6, m.m10, m.m14 },
+        { m.m3, m.m7, m.m11, m.m15 } };
+
+    // Left, right, bottom, top, near and far planes
+    for (int p = 0; p < 6; p++)
+    {
+        float sign = (p%2 == 0)? 1.0f : -1.0f;
+        float *plane = frustum.planes[p];
+
+        for (int k = 0; k < 4; k++) plane[k] = rows[3][k] + sign*rows[p/2][k];
+
+        float length = sqrtf(plane[0]*plane[0] + plane[1]*plane[1] + plane[2]*plane[2]);
+        if (length > 0.0f) for (int k = 0; k < 4; k++) plane[k] /= length;
+    }
+
+    return frustum;
+}
+
+// Check axis-aligned box (center and half extents) against frustum planes
+// NOTE: Branch-free on planes (no early out) to let compiler vectorize it
+static bool FrustumBoxVisible(const Frustum *frustum, Vector3 center, Vector3 extents)
+{
+    int visible = 1;
+
+    for (int p = 0; p < 6; p++)
+    {
+        const float *plane = frustum->planes[p];
+        float distance = plane[0]*center.x + plane[1]*center.y + plane[2]*center.z + plane[3];
+        float radius = fabsf(plane[0])*extents.x + fabsf(plane[1])*extents.y + fabsf(plane[2])*extents.z;
+
+        visible &= ((distance + radius) >= 0.0f);
+    }
+
+    return visible;
+}
+
+// Check boxes (6 floats per box: min, max) against frustum planes, visible boxes indices (1-based) stored in result
+// NOTE: With SIMD, 4 boxes are tested per iteration (boxes components as registers), remaining boxes one by one
+static int FrustumCullBoxes(const Frustum *frustum, const float *boxes, int count, int *result)
+{
+    int visible = 0;
+    int i = 0;
+
+#if defined(RLUA_SIMD)
+    Simd4 half = Simd4Set1(0.5f);
+    Simd4 planes[6][4], planesAbs[6][3];
+
+    for (int p = 0; p < 6; p++)
+    {
+        for (int k = 0; k < 4; k++) planes[p][k] = Simd4Set1(frustum->planes[p][k]);
+        for (int k = 0; k < 3; k++) planesAbs[p][k] = Simd4Abs(planes[p][k]);
+    }
+
+    for (; i + 4 <= count; i += 4)
+    {
+        // Boxes min and max components of 4 boxes (stride 6 floats)
+        float components[6][4];
+        for (int b = 0; b < 4; b++)
+        {
+            for (int k = 0; k < 6; k++) components[k][b] = boxes[6*(i + b) + k];
+        }
+
+        Simd4 center[3], extents[3];
+        for (int k = 0; k < 3; k++)
+        {
+            Simd4 min = Simd4Load(components[k]), max = Simd4Load(components[k + 3]);
+            center[k] = Simd4Mul(Simd4Add(min, max), half);
+            extents[k] = Simd4Mul(Simd4Sub(max, min), half);
+        }
+
+        int mask = 0xf;
+
+        for (int p = 0; p < 6; p++)
+        {
+            Simd4 distance = Simd4Add(Simd4Add(Simd4Add(Simd4Mul(planes[p][0], center[0]), Simd4Mul(planes[p][1], center[1])),
+                                               Simd4Mul(planes[p][2], center[2])), planes[p][3]);
+            Simd4 radius = Simd4Add(Simd4Add(Simd4Mul(planesAbs[p][0], extents[0]), Simd4Mul(planesAbs[p][1], extents[1])),
+                                    Simd4Mul(planesAbs[p][2], extents[2]));
+
+            mask &= Simd4MaskNonNegative(Simd4Add(distance, radius));
+        }
+
+        for (int b = 0; b < 4; b++)
+        {
+            if (mask & (1 << b)) result[visible++] = i + b + 1;
+        }
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        const float *data = boxes + 6*i;
+        Vector3 center = { (data[0] + data[3])*0.5f, (data[1] + data[4])*0.5f, (data[2] + data[5])*0.5f };
+        Vector3 extents = { (data[3] - data[0])*0.5f, (data[4] - data[1])*0.5f, (data[5] - data[2])*0.5f };
+
+        if (FrustumBoxVisible(frustum, center, extents)) result[visible++] = i + 1;
+    }
+
+    return visible;
+}
+
+// Check bounding box transformed by matrix against frustum planes
+// NOTE: Transformed box is the axis-aligned box enclosing it (center transformed, extents by absolute matrix)
+static bool FrustumTransformedBoxVisible(const Frustum *frustum, BoundingBox box, Matrix transform)
+{
+    Vector3 c = { (box.min.x + box.max.x)*0.5f, (box.min.y + box.max.y)*0.5f, (box.min.z + box.max.z)*0.5f };
+    Vector3 e = { (box.max.x - box.min.x)*0.5f, (box.max.y - box.min.y)*0.5f, (box.max.z - box.min.z)*0.5f };
+    Matrix m = transform;
+
+    Vector3 center = {
+        m.m0*c.x + m.m4*c.y + m.m8*c.z + m.m12,
+        m.m1*c.x + m.m5*c.y + m.m9*c.z + m.m13,
+        m.m2*c.x + m.m6*c.y + m.m10*c.z + m.m14 };
+
+    Vector3 extents = {
+        fabsf(m.m0)*e.x + fabsf(m.m4)*e.y + fabsf(m.m8)*e.z,
+        fabsf(m.m1)*e.x + fabsf(m.m5)*e.y + fabsf(m.m9)*e.z,
+        fabsf(m.m2)*e.x + fabsf(m.m6)*e.y + fabsf(m.m10)*e.z };
+
+    return FrustumBoxVisible(frustum, center, extents);
+}
+
+// Get bounding boxes count from argument: BoundingBox (1), array of BoundingBox or FloatBuffer (6 floats per box)
+static int LuaGetBoxesCount(lua_State *L, int index)
+{
+    if (lua_type(L, index) == LUA_TUSERDATA)
+    {
+        TypedBuffer *buffer = LuaGetArgument_Buffer(L, index, BUFFER_FLOAT);
+        luaL_argcheck(L, (buffer->count%6) == 0, index, "Expected 6 floats per box (min, max)");
+        return buffer->count/6;
+    }
+
+    luaL_checktype(L, index, LUA_TTABLE);
+
+    bool single = (lua_getfield(L, index, "min") != LUA_TNIL);
+    lua_pop(L, 1);
+
+    return single? 1 : (int)lua_rawlen(L, index);
+}
+
+// Get bounding box i (0-based) from argument, a single BoundingBox is returned for any i
+static BoundingBox LuaGetBox(lua_State *L, int index, int i)
+{
+    BoundingBox box = { 0 };
+
+    if (lua_type(L, index) == LUA_TUSERDATA)
+    {
+        const float *data = LuaGetArgument_Buffer(L, index, BUFFER_FLOAT)->floats + 6*i;
+        box = (BoundingBox){ { data[0], data[1], data[2] }, { data[3], data[4], data[5] } };
+    }
+    else if (lua_getfield(L, index, "min") != LUA_TNIL)
+    {
+        lua_pop(L, 1);
+        box = LuaGetArgument_BoundingBox(L, index);
+    }
+    else
+    {
+        lua_pop(L, 1);
+        lua_rawgeti(L, index, i + 1);
+        box = LuaGetArgument_BoundingBox(L, -1);
+        lua_pop(L, 1);
+    }
+
+    return box;
+}
+
+// Get visible boxes for camera: FrustumCull(camera, boxes[, result]) -> IntBuffer of visible indices, count
+// boxes is a BoundingBox array (i.e. MeshBoundingBox() results) or a FloatBuffer of boxes (min, max)
+// NOTE: result (IntBuffer, at least boxes count) is reused if provided, indices are 1-based
+int lua_FrustumCull(lua_State *L)
+{
+    Camera camera = LuaGetArgument_Camera(L, 1);
+    int count = LuaGetBoxesCount(L, 2);
+    TypedBuffer *result = NULL;
+
+    if (lua_isnoneornil(L, 3)) result = LuaPushBuffer(L, BUFFER_INT, count);
+    else
+    {
+        result = LuaGetArgument_Buffer(L, 3, BUFFER_INT);
+        luaL_argcheck(L, result->count >= count, 3, "IntBuffer smaller than boxes count");
+        lua_pushvalue(L, 3);
+    }
+
+    Frustum frustum = GetCameraFrustum(camera);
+    int visible = 0;
+
+    if (lua_type(L, 2) == LUA_TUSERDATA)
+    {
+        // Fast path: boxes data read in place
+        visible = FrustumCullBoxes(&frustum, LuaGetArgument_Buffer(L, 2, BUFFER_FLOAT)->floats, count, result->ints);
+    }
+    else
+    {
+        for (int i = 0; i < count; i++)
+        {
+            BoundingBox box = LuaGetBox(L, 2, i);
+            Vector3 center = { (box.min.x + box.max.x)*0.5f, (box.min.y + box.max.y)*0.5f, (box.min.z + box.max.z)*0.5f };
+            Vector3 extents = { (box.max.x - box.min.x)*0.5f, (box.max.y - box.min.y)*0.5f, (box.max.z - box.min.z)*0.5f };
+
+            if (FrustumBoxVisible(&frustum, center, extents)) result->ints[visible++] = i + 1;
+        }
+    }
+
+    LuaPush_int(L, visible);
+    return 2;
+}
+
+// Draw model instances inside camera view: DrawModelsCulled(camera, models, transforms, bounds[, tint[, layout]]) -> drawn
+// models is a Model (shared) or an array of Model (one per instance), transforms as DrawModelInstances(),
+// bounds are model space boxes: a BoundingBox (shared), an array of BoundingBox or a FloatBuffer (6 floats per instance)
+int lua_DrawModelsCulled(lua_State *L)
+{
+    static const char *layouts[] = { "matrix", "trs", NULL };
+
+    Camera camera = LuaGetArgument_Camera(L, 1);
+    bool sharedModel = (lua_type(L, 2) != LUA_TTABLE);
+    TypedBuffer *transforms = LuaGetArgument_Buffer(L, 3, BUFFER_FLOAT);
+    int boxesCount = LuaGetBoxesCount(L, 4);
+    Color tint = lua_isnoneornil(L, 5)? WHITE : LuaGetArgument_Color(L, 5);
+    bool matrixLayout = (luaL_checkoption(L, 6, "matrix", layouts) == 0);
+    int stride = matrixLayout? 16 : 9;
+
+    luaL_argcheck(L, (transforms->count%stride) == 0, 3, matrixLayout? "Expected 16 floats per instance" : "Expected 9 floats per instance");
+
+    int count = transforms->count/stride;
+
+    luaL_argcheck(L, sharedModel || ((int)lua_rawlen(L, 2) >= count), 2, "Expected a Model per instance");
+    luaL_argcheck(L, (boxesCount == 1) || (boxesCount >= count), 4, "Expected a BoundingBox per instance");
+
+    Frustum frustum = GetCameraFrustum(camera);
+    Model model = sharedModel? LuaGetArgument_Model(L, 2) : (Model){ 0 };
+    BoundingBox box = (boxesCount > 0)? LuaGetBox(L, 4, 0) : (BoundingBox){ 0 };     // No boxes only for no instances
+    int drawn = 0;
+
+    // Shared model visible instances are recorded as a single command
+    // NOTE: Transforms array is a userdata, collected if boxes reading raises an error
+    Matrix *visible = ((recordingList != NULL) && sharedModel)? (Matrix *)lua_newuserdata(L, count*sizeof(Matrix)) : NULL;
+
+    for (int i = 0; i < count; i++)
+    {
+        if (!sharedModel)
+        {
+            lua_rawgeti(L, 2, i + 1);
+            model = LuaGetArgument_Model(L, -1);
+            lua_pop(L, 1);
+        }
+
+        if ((boxesCount > 1) && (i > 0)) box = LuaGetBox(L, 4, i);
+
+        Matrix transform = MatrixMultiply(model.transform, GetInstanceTransform(transforms->floats + i*stride, matrixLayout));
+
+        if (FrustumTransformedBoxVisible(&frustum, box, transform))
+        {
+            model.material.maps[MAP_DIFFUSE].color = tint;
+
+            if (visible != NULL) visible[drawn] = transform;
+            else if (recordingList != NULL) RecordMeshInstancesCommand(model.mesh, model.material, &transform, 1);
+            else rlDrawMesh(model.mesh, model.material, transform);
+
+            drawn++;
+        }
+    }
+
+    if ((visible != NULL) && (drawn > 0)) RecordMeshInstancesCommand(model.mesh, model.material, visible, drawn);
+
+    LuaPush_int(L, drawn);
+    return 1;
+}
+
+// Draw bounding box (wires)
+int lua_DrawBoundingBox(lua_State *L)
+{
+    BoundingBox box = LuaGetArgument_BoundingBox(L, 1);
+    Color color = LuaGetArgument_Color(L, 2);
+    if (recordingList != NULL) RecordShape3DCommand(COMMAND_BOUNDING_BOX, (Shape3DCommand){ .points = { box.min, box.max }, .color = color });
+    else DrawBoundingBox(box, color);
+    return 0;
+}
+
+// Draw a billboard texture
+int lua_DrawBillboard(lua_State *L)
+{
+    Camera camera = LuaGetArgument_Camera(L, 1);
+    Texture2D texture = LuaGetArgument_Texture2D(L, 2);
+    Vector3 center = LuaGetArgument_Vector3(L, 3);
+    float size = LuaGetArgument_float(L, 4);
+    Color tint = LuaGetArgument_Color(L, 5);
+    Rectangle sourceRec = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
+    if (recordingList != NULL) RecordShape3DCommand(COMMAND_BILLBOARD, (Shape3DCommand){ .points = { center }, .values = { size }, .color = tint, .texture = texture, .sourceRec = sourceRec, .camera = camera });
+    else DrawBillboard(camera, texture, center, size, tint);
+    return 0;
+}
+
+// Draw a billboard texture defined by sourceRec
+int lua_DrawBillboardRec(lua_State *L)
+{
+    Camera camera = LuaGetArgument_Camera(L, 1);
+    Texture2D texture = LuaGetArgument_Texture2D(L, 2);
+    Rectangle sourceRec = LuaGetArgument_Rectangle(L, 3);
+    Vector3 center = LuaGetArgument_Vector3(L, 4);
+    float size = LuaGetArgument_float(L, 5);
+    Color tint = LuaGetArgument_Color(L, 6);
+    if (recordingList != NULL) RecordShape3DCommand(COMMAND_BILLBOARD, (Shape3DCommand){ .points = { center }, .values = { size }, .color = tint, .texture = texture, .sourceRec = sourceRec, .camera = camera });
+    else DrawBillboardRec(camera, texture, sourceRec, center, size, tint);
+    return 0;
+}
+
+// Collision detection functions
+// Detect collision between two spheres
+int lua_CheckCollisionSpheres(lua_State *L)
+{
+    Vector3 centerA = LuaGetArgument_Vector3(L, 1);
+    float radiusA = LuaGetArgument_float(L, 2);
+    Vector3 centerB = LuaGetArgument_Vector3(L, 3);
+    float radiusB = LuaGetArgument_float(L, 4);
+    bool result = CheckCollisionSpheres(centerA, radiusA, centerB, radiusB);
+    LuaPush_bool(L, result);
+    return 1;
+}
+
+// Detect collision between two bounding boxes
+int lua_CheckCollisionBoxes(lua_State *L)
+{
+    BoundingBox box1 = LuaGetArgument_BoundingBox(L, 1);
+    BoundingBox box2 = LuaGetArgument_BoundingBox(L, 2);
+    bool result = CheckCollisionBoxes(box1, box2);
+    LuaPush_bool(L, result);
+    return 1;
+}
+
+// Detect collision between box and sphere
+int lua_CheckCollisionBoxSphere(lua_State *L)
+{
+    BoundingBox box = LuaGetArgument_BoundingBox(L, 1);
+    Vector3 centerSphere = LuaGetArgument_Vector3(L, 2);
+    float radiusSphere = LuaGetArgument_float(L, 3);
+    bool result = CheckCollisionBoxSphere(box, centerSphere, radiusSphere);
+    LuaPush_bool(L, result);
+    return 1;
+}
+
+// Detect collision between ray and sphere
+int lua_CheckCollisionRaySphere(lua_State *L)
+{
+    Ray ray = LuaGetArgument_Ray(L, 1);
+    Vector3 spherePosition = LuaGetArgument_Vector3(L, 2);
+    float sphereRadius = LuaGetArgument_float(L, 3);
+    bool result = CheckCollisionRaySphere(ray, spherePosition, sphereRadius);
+    LuaPush_bool(L, result);
+    return 1;
+}
+
+// Detect collision between ray and sphere, returns collision point
+int lua_CheckCollisionRaySphereEx(lua_State *L)
+{
+    Ray ray = LuaGetArgument_Ray(L, 1);
+    Vector3 spherePosition = LuaGetArgument_Vector3(L, 2);
+    float sphereRadius = LuaGetArgument_float(L, 3);
+    Vector3 collisionPoint = LuaGetArgument_Vector3(L, 4);
+    bool result = CheckCollisionRaySphereEx(ray, spherePosition, sphereRadius, collisionPoint);
+    LuaPush_bool(L, result);
+    return 1;
+}
+
+// Detect collision between ray and box
+int lua_CheckCollisionRayBox(lua_State *L)
+{
+    Ray ray = LuaGetArgument_Ray(L, 1);
+    BoundingBox box = LuaGetArgument_BoundingBox(L, 2);
+    bool result = CheckCollisionRayBox(ray, box);
+    LuaPush_bool(L, result);
+    return 1;
+}
+
+// Get collision info between ray and model
+int lua_GetCollisionRayModel(lua_State *L)
+{
+    Ray ray = LuaGetArgument_Ray(L, 1);
+    Model model = LuaGetArgument_Model(L, 2);
+    RayHitInfo result = GetCollisionRayModel(ray, model);
+    LuaPush_RayHitInfo(L, result);
+    return 1;
+}
+
+// Get collision info between ray and triangle
+int lua_GetCollisionRayTriangle(lua_State *L)
+{
+    Ray ray = LuaGetArgument_Ray(L, 1);
+    Vector3 p1 = LuaGetArgument_Vector3(L, 2);
+    Vector3 p2 = LuaGetArgument_Vector3(L, 3);
+    Vector3 p3 = LuaGetArgument_Vector3(L, 4);
+    RayHitInfo result = GetCollisionRayTriangle(ray, p1, p2, p3);
+    LuaPush_RayHitInfo(L, result);
+    return 1;
+}
+
+// Get collision info between ray and ground plane (Y-normal plane)
+int lua_GetCollisionRayGround(lua_State *L)
+{
+    Ray ray = LuaGetArgument_Ray(L, 1);
+    float groundHeight = LuaGetArgument_float(L, 2);
+    RayHitInfo result = GetCollisionRayGround(ray, groundHeight);
+    LuaPush_RayHitInfo(L, result);
+    return 1;
+}
+
+//------------------------------------------------------------------------------------
+// raylib [raymath] module functions - Shaders
 //------------------------------------------------------------------------------------
 
-// Get the default Font
-int lua_GetFontDefault(lua_State *L)
+// WARNING: Load chars array from text file
+int lua_LoadText(lua_State *L)
 {
-    Font result = GetFontDefault();
-    LuaPush_Font(L, result);
+    const char *fileName = LuaGetArgument_string(L, 1);
+    char *result = LoadText(fileName);
+    LuaPush_string(L, result);              // WARNING_ LuaPush_char not valid
+    return 1;
+}
+
+// Load shader from files and bind default locations
+int lua_LoadShader(lua_State *L)
+{
+    const char *vsFileName = LuaGetArgument_string(L, 1);
+    const char *fsFileName = LuaGetArgument_string(L, 2);
+    Shader result = LoadShader(vsFileName, fsFileName);
+    LuaPush_Shader(L, result);
+    return 1;
+}
+
+// Load shader from code strings and bind default locations
+int lua_LoadShaderCode(lua_State *L)
+{
+    char *vsCode = LuaGetArgument_char(L, 1);
+    char *fsCode = LuaGetArgument_char(L, 2);
+    Shader result = LoadShaderCode(vsCode, fsCode);
+    LuaPush_Shader(L, result);
     return 1;
 }
 
-// Load font from file into GPU memory (VRAM)
-int lua_LoadFont(lua_State *L)
+// Unload shader from GPU memory (VRAM)
+int lua_UnloadShader(lua_State *L)
+{
+    Shader shader = LuaGetArgument_Shader(L, 1);
+    UnloadShader(shader);
+    return 0;
+}
+
+// Get default shader
+int lua_GetShaderDefault(lua_State *L)
 {
-    const char *fileName = LuaGetArgument_string(L, 1);
-    Font result = LoadFont(fileName);
-    LuaPush_Font(L, result);
+    Shader result = GetShaderDefault();
+    LuaPush_Shader(L, result);
     return 1;
 }
 
-// Load font from file with extended parameters
-int lua_LoadFontEx(lua_State *L)
+// Get default texture
+int lua_GetTextureDefault(lua_State *L)
 {
-    const char *fileName = LuaGetArgument_string(L, 1);
-    int fontSize = LuaGetArgument_int(L, 2);
-    int charsCount = LuaGetArgument_int(L, 3);
-    int fontChars = LuaGetArgument_int(L, 4);
-    Font result = LoadFontEx(fileName, fontSize, charsCount, fontChars);
-    LuaPush_Font(L, result);
+    Texture2D result = GetTextureDefault();
+    LuaPush_Texture2D(L, result);
     return 1;
 }
 
-// Load font data for further use
-int lua_LoadFontData(lua_State *L)
+// Shader configuration functions
+
+// Get shader uniform location
+int lua_GetShaderLocation(lua_State *L)
 {
-    const char *fileName = LuaGetArgument_string(L, 1);
-    int fontSize = LuaGetArgument_int(L, 2);
-    int fontChars = LuaGetArgument_int(L, 3);
-    int charsCount = LuaGetArgument_int(L, 4);
-    bool sdf = LuaGetArgument_bool(L, 5);
-    CharInfo result = LoadFontData(fileName, fontSize, fontChars, charsCount, sdf);
-    LuaPush_CharInfo(L, result);
+    Shader shader = LuaGetArgument_Shader(L, 1);
+    const char *uniformName = LuaGetArgument_string(L, 2);
+    int result = GetShaderLocation(shader, uniformName);
+    LuaPush_int(L, result);
     return 1;
 }
 
-// Generate image font atlas using chars info
-int lua_GenImageFontAtlas(lua_State *L)
+// WARNING: Set shader uniform values (float)
+int lua_SetShaderValue(lua_State* L)
 {
-    CharInfo chars = LuaGetArgument_CharInfo(L, 1);
-    int fontSize = LuaGetArgument_int(L, 2);
-    int charsCount = LuaGetArgument_int(L, 3);
-    int padding = LuaGetArgument_int(L, 4);
-    int packMethod = LuaGetArgument_int(L, 5);
-    Image result = GenImageFontAtlas(chars, fontSize, charsCount, padding, packMethod);
-    LuaPush_Image(L, result);
-    return 1;
+    Shader arg1 = LuaGetArgument_Shader(L, 1);
+    int arg2 = LuaGetArgument_int(L, 2);
+    GET_TABLE(float, arg3, 3);
+    SetShaderValue(arg1, arg2, arg3, arg3_size);
+    free(arg3);
+    return 0;
 }
 
-// Unload Font from GPU memory (VRAM)
-int lua_UnloadFont(lua_State *L)
+// WARNING: Set shader uniform values (int)
+int lua_SetShaderValuei(lua_State* L)
 {
-    Font font = LuaGetArgument_Font(L, 1);
-    UnloadFont(font);
+    Shader arg1 = LuaGetArgument_Shader(L, 1);
+    int arg2 = LuaGetArgument_int(L, 2);
+    GET_TABLE(int, arg3, 3);
+    SetShaderValuei(arg1, arg2, arg3, arg3_size);
+    free(arg3);
     return 0;
 }
 
-// Text drawing functions
-// Shows current FPS
-int lua_DrawFPS(lua_State *L)
+// Set shader uniform value (matrix 4x4)
+int lua_SetShaderValueMatrix(lua_State *L)
 {
-    int posX = LuaGetArgument_int(L, 1);
-    int posY = LuaGetArgument_int(L, 2);
-    DrawFPS(posX, posY);
+    Shader shader = LuaGetArgument_Shader(L, 1);
+    int uniformLoc = LuaGetArgument_int(L, 2);
+    Matrix mat = LuaGetArgument_Matrix(L, 3);
+    SetShaderValueMatrix(shader, uniformLoc, mat);
     return 0;
 }
 
-// Draw text (using default font)
-int lua_DrawText(lua_State *L)
+// Set a custom projection matrix (replaces internal projection matrix)
+int lua_SetMatrixProjection(lua_State *L)
 {
-    const char *text = LuaGetArgument_string(L, 1);
-    int posX = LuaGetArgument_int(L, 2);
-    int posY = LuaGetArgument_int(L, 3);
-    int fontSize = LuaGetArgument_int(L, 4);
-    Color color = LuaGetArgument_Color(L, 5);
-    DrawText(text, posX, posY, fontSize, color);
+    Matrix proj = LuaGetArgument_Matrix(L, 1);
+    SetMatrixProjection(proj);
     return 0;
 }
 
-// WARNING: Draw text using font and additional parameters
-int lua_DrawTextEx(lua_State *L)
+// Set a custom modelview matrix (replaces internal modelview matrix)
+int lua_SetMatrixModelview(lua_State *L)
 {
-    Font font = LuaGetArgument_Font(L, 1);
-    const char *text = LuaGetArgument_string(L, 2);
-    Vector2 position = LuaGetArgument_Vector2(L, 3);
-    float fontSize = LuaGetArgument_float(L, 4);
-    float spacing = LuaGetArgument_float(L, 5);
-    Color tint = LuaGetArgument_Color(L, 6);
-    DrawTextEx(font, text, position, fontSize, spacing, tint);
+    Matrix view = LuaGetArgument_Matrix(L, 1);
+    SetMatrixModelview(view);
     return 0;
 }
 
-// Text misc. functions
-// Measure string width for default font
-int lua_MeasureText(lua_State *L)
+// Get internal modelview matrix
+int lua_GetMatrixModelview(lua_State *L)
 {
-    const char *text = LuaGetArgument_string(L, 1);
-    int fontSize = LuaGetArgument_int(L, 2);
-    int result = MeasureText(text, fontSize);
-    LuaPush_int(L, result);
+    Matrix view = LuaGetArgument_Matrix(L, 1);
+    Matrix result = GetMatrixModelview(view);
+    LuaPush_Matrix(L, result);
     return 1;
 }
 
-// Measure string size for Font
-int lua_MeasureTextEx(lua_State *L)
+// Texture maps generation (PBR)
+// NOTE: Required shaders should be provided
+// Generate cubemap texture from HDR texture
+int lua_GenTextureCubemap(lua_State *L)
 {
-    Font font = LuaGetArgument_Font(L, 1);
-    const char *text = LuaGetArgument_string(L, 2);
-    float fontSize = LuaGetArgument_float(L, 3);
-    float spacing = LuaGetArgument_float(L, 4);
-    Vector2 result = MeasureTextEx(font, text, fontSize, spacing);
-    LuaPush_Vector2(L, result);
+    Shader shader = LuaGetArgument_Shader(L, 1);
+    Texture2D skyHDR = LuaGetArgument_Texture2D(L, 2);
+    int size = LuaGetArgument_int(L, 3);
+    Texture2D result = GenTextureCubemap(shader, skyHDR, size);
+    LuaPush_Texture2D(L, result);
     return 1;
 }
 
-// WARNING: FormatText() can be replaced by Lua function: string.format()
-// WARNING: SubText() can be replaced by Lua function: string.sub()
+// Generate irradiance texture using cubemap data
+int lua_GenTextureIrradiance(lua_State *L)
+{
+    Shader shader = LuaGetArgument_Shader(L, 1);
+    Texture2D cubemap = LuaGetArgument_Texture2D(L, 2);
+    int size = LuaGetArgument_int(L, 3);
+    Texture2D result = GenTextureIrradiance(shader, cubemap, size);
+    LuaPush_Texture2D(L, result);
+    return 1;
+}
 
-// Get index position for a unicode character on font
-int lua_GetGlyphIndex(lua_State *L)
+// Generate prefilter texture using cubemap data
+int lua_GenTexturePrefilter(lua_State *L)
 {
-    Font font = LuaGetArgument_Font(L, 1);
-    int character = LuaGetArgument_int(L, 2);
-    int result = GetGlyphIndex(font, character);
-    LuaPush_int(L, result);
+    Shader shader = LuaGetArgument_Shader(L, 1);
+    Texture2D cubemap = LuaGetArgument_Texture2D(L, 2);
+    int size = LuaGetArgument_int(L, 3);
+    Texture2D result = GenTexturePrefilter(shader, cubemap, size);
+    LuaPush_Texture2D(L, result);
     return 1;
 }
 
-//------------------------------------------------------------------------------------
-// raylib [models] module functions - Basic 3d Shapes Drawing Functions
-//------------------------------------------------------------------------------------
+// Generate BRDF texture using cubemap data
+int lua_GenTextureBRDF(lua_State *L)
+{
+    Shader shader = LuaGetArgument_Shader(L, 1);
+    Texture2D cubemap = LuaGetArgument_Texture2D(L, 2);
+    int size = LuaGetArgument_int(L, 3);
+    Texture2D result = GenTextureBRDF(shader, cubemap, size);
+    LuaPush_Texture2D(L, result);
+    return 1;
+}
 
-// Draw a line in 3D world space
-int lua_DrawLine3D(lua_State *L)
+// Shading begin/end functions
+// Begin custom shader drawing
+int lua_BeginShaderMode(lua_State *L)
 {
-    Vector3 startPos = LuaGetArgument_Vector3(L, 1);
-    Vector3 endPos = LuaGetArgument_Vector3(L, 2);
-    Color color = LuaGetArgument_Color(L, 3);
-    DrawLine3D(startPos, endPos, color);
+    Shader shader = LuaGetArgument_Shader(L, 1);
+    if (recordingList != NULL) RecordModeCommand(COMMAND_BEGIN_SHADER_MODE, &shader, sizeof(Shader));
+    else BeginShaderMode(shader);
     return 0;
 }
 
-// Draw a circle in 3D world space
-int lua_DrawCircle3D(lua_State *L)
+// End custom shader drawing (use default shader)
+int lua_EndShaderMode(lua_State *L)
 {
-    Vector3 center = LuaGetArgument_Vector3(L, 1);
-    float radius = LuaGetArgument_float(L, 2);
-    Vector3 rotationAxis = LuaGetArgument_Vector3(L, 3);
-    float rotationAngle = LuaGetArgument_float(L, 4);
-    Color color = LuaGetArgument_Color(L, 5);
-    DrawCircle3D(center, radius, rotationAxis, rotationAngle, color);
+    if (recordingList != NULL) RecordModeCommand(COMMAND_END_SHADER_MODE, NULL, 0);
+    else EndShaderMode();
     return 0;
 }
 
-// Draw cube
-int lua_DrawCube(lua_State *L)
+// Begin blending mode (alpha, additive, multiplied)
+int lua_BeginBlendMode(lua_State *L)
 {
-    Vector3 position = LuaGetArgument_Vector3(L, 1);
-    float width = LuaGetArgument_float(L, 2);
-    float height = LuaGetArgument_float(L, 3);
-    float length = LuaGetArgument_float(L, 4);
-    Color color = LuaGetArgument_Color(L, 5);
-    DrawCube(position, width, height, length, color);
+    int mode = LuaGetArgument_int(L, 1);
+    if (recordingList != NULL) RecordModeCommand(COMMAND_BEGIN_BLEND_MODE, &mode, sizeof(int));
+    else BeginBlendMode(mode);
     return 0;
 }
 
-// Draw cube (Vector version)
-int lua_DrawCubeV(lua_State *L)
+// End blending mode (reset to default: alpha blending)
+int lua_EndBlendMode(lua_State *L)
 {
-    Vector3 position = LuaGetArgument_Vector3(L, 1);
-    Vector3 size = LuaGetArgument_Vector3(L, 2);
-    Color color = LuaGetArgument_Color(L, 3);
-    DrawCubeV(position, size, color);
+    if (recordingList != NULL) RecordModeCommand(COMMAND_END_BLEND_MODE, NULL, 0);
+    else EndBlendMode();
     return 0;
 }
 
-// Draw cube wires
-int lua_DrawCubeWires(lua_State *L)
+//------------------------------------------------------------------------------------
+// raylib [rlgl] module functions - VR experience
+//------------------------------------------------------------------------------------
+
+// Get VR device information for some standard devices
+int lua_GetVrDeviceInfo(lua_State *L)
 {
-    Vector3 position = LuaGetArgument_Vector3(L, 1);
-    float width = LuaGetArgument_float(L, 2);
-    float height = LuaGetArgument_float(L, 3);
-    float length = LuaGetArgument_float(L, 4);
-    Color color = LuaGetArgument_Color(L, 5);
-    DrawCubeWires(position, width, height, length, color);
-    return 0;
+    int vrDeviceType = LuaGetArgument_int(L, 1);
+    VrDeviceInfo result = GetVrDeviceInfo(vrDeviceType);
+    LuaPush_VrDeviceInfo(L, result);
+    return 1;
 }
 
-// Draw cube textured
-int lua_DrawCubeTexture(lua_State *L)
+// Init VR simulator for selected device parameters
+int lua_InitVrSimulator(lua_State *L)
 {
-    Texture2D texture = LuaGetArgument_Texture2D(L, 1);
-    Vector3 position = LuaGetArgument_Vector3(L, 2);
-    float width = LuaGetArgument_float(L, 3);
-    float height = LuaGetArgument_float(L, 4);
-    float length = LuaGetArgument_float(L, 5);
-    Color color = LuaGetArgument_Color(L, 6);
-    DrawCubeTexture(texture, position, width, height, length, color);
+    VrDeviceInfo info = LuaGetArgument_VrDeviceInfo(L, 1);
+    InitVrSimulator(info);
     return 0;
 }
 
-// Draw sphere
-int lua_DrawSphere(lua_State *L)
+// Close VR simulator for current device
+int lua_CloseVrSimulator(lua_State *L)
 {
-    Vector3 centerPos = LuaGetArgument_Vector3(L, 1);
-    float radius = LuaGetArgument_float(L, 2);
-    Color color = LuaGetArgument_Color(L, 3);
-    DrawSphere(centerPos, radius, color);
+    CloseVrSimulator();
     return 0;
 }
 
-// Draw sphere with extended parameters
-int lua_DrawSphereEx(lua_State *L)
+// Detect if VR simulator is ready
+int lua_IsVrSimulatorReady(lua_State *L)
 {
-    Vector3 centerPos = LuaGetArgument_Vector3(L, 1);
-    float radius = LuaGetArgument_float(L, 2);
-    int rings = LuaGetArgument_int(L, 3);
-    int slices = LuaGetArgument_int(L, 4);
-    Color color = LuaGetArgument_Color(L, 5);
-    DrawSphereEx(centerPos, radius, rings, slices, color);
+    bool result = IsVrSimulatorReady();
+    LuaPush_bool(L, result);
+    return 1;
+}
+
+// Set VR distortion shader for stereoscopic rendering
+int lua_SetVrDistortionShader(lua_State *L)
+{
+    Shader shader = LuaGetArgument_Shader(L, 1);
+    SetVrDistortionShader(shader);
     return 0;
 }
 
-// Draw sphere wires
-int lua_DrawSphereWires(lua_State *L)
+// Update VR tracking (position and orientation) and camera
+int lua_UpdateVrTracking(lua_State *L)
 {
-    Vector3 centerPos = LuaGetArgument_Vector3(L, 1);
-    float radius = LuaGetArgument_float(L, 2);
-    int rings = LuaGetArgument_int(L, 3);
-    int slices = LuaGetArgument_int(L, 4);
-    Color color = LuaGetArgument_Color(L, 5);
-    DrawSphereWires(centerPos, radius, rings, slices, color);
+    Camera camera = LuaGetArgument_Camera(L, 1);
+    UpdateVrTracking(camera);
     return 0;
 }
 
-// Draw a cylinder/cone
-int lua_DrawCylinder(lua_State *L)
+// Enable/Disable VR experience
+int lua_ToggleVrMode(lua_State *L)
 {
-    Vector3 position = LuaGetArgument_Vector3(L, 1);
-    float radiusTop = LuaGetArgument_float(L, 2);
-    float radiusBottom = LuaGetArgument_float(L, 3);
-    float height = LuaGetArgument_float(L, 4);
-    int slices = LuaGetArgument_int(L, 5);
-    Color color = LuaGetArgument_Color(L, 6);
-    DrawCylinder(position, radiusTop, radiusBottom, height, slices, color);
+    ToggleVrMode();
     return 0;
 }
 
-// Draw a cylinder/cone wires
-int lua_DrawCylinderWires(lua_State *L)
+// Begin VR simulator stereo rendering
+int lua_BeginVrDrawing(lua_State *L)
 {
-    Vector3 position = LuaGetArgument_Vector3(L, 1);
-    float radiusTop = LuaGetArgument_float(L, 2);
-    float radiusBottom = LuaGetArgument_float(L, 3);
-    float height = LuaGetArgument_float(L, 4);
-    int slices = LuaGetArgument_int(L, 5);
-    Color color = LuaGetArgument_Color(L, 6);
-    DrawCylinderWires(position, radiusTop, radiusBottom, height, slices, color);
+    if (recordingList != NULL) RecordModeCommand(COMMAND_BEGIN_VR_DRAWING, NULL, 0);
+    else BeginVrDrawing();
     return 0;
 }
 
-// Draw a plane XZ
-int lua_DrawPlane(lua_State *L)
+// End VR simulator stereo rendering
+int lua_EndVrDrawing(lua_State *L)
 {
-    Vector3 centerPos = LuaGetArgument_Vector3(L, 1);
-    Vector2 size = LuaGetArgument_Vector2(L, 2);
-    Color color = LuaGetArgument_Color(L, 3);
-    DrawPlane(centerPos, size, color);
+    if (recordingList != NULL) RecordModeCommand(COMMAND_END_VR_DRAWING, NULL, 0);
+    else EndVrDrawing();
     return 0;
 }
 
-// Draw a ray line
-int lua_DrawRay(lua_State *L)
+//------------------------------------------------------------------------------------
+// raylib [audio] module functions - Audio Loading and Playing
+//------------------------------------------------------------------------------------
+
+// Initialize audio device and context
+int lua_InitAudioDevice(lua_State *L)
 {
-    Ray ray = LuaGetArgument_Ray(L, 1);
-    Color color = LuaGetArgument_Color(L, 2);
-    DrawRay(ray, color);
+    InitAudioDevice();
     return 0;
 }
 
-// Draw a grid (centered at (0, 0, 0))
-int lua_DrawGrid(lua_State *L)
+// Close the audio device and context
+int lua_CloseAudioDevice(lua_State *L)
 {
-    int slices = LuaGetArgument_int(L, 1);
-    float spacing = LuaGetArgument_float(L, 2);
-    DrawGrid(slices, spacing);
+    CloseAudioDevice();
     return 0;
 }
 
-// Draw simple gizmo
-int lua_DrawGizmo(lua_State *L)
+// Check if audio device has been initialized successfully
+int lua_IsAudioDeviceReady(lua_State *L)
 {
-    Vector3 position = LuaGetArgument_Vector3(L, 1);
-    DrawGizmo(position);
-    return 0;
+    bool result = IsAudioDeviceReady();
+    LuaPush_bool(L, result);
+    return 1;
 }
 
-//------------------------------------------------------------------------------------
-// raylib [models] module functions
-//------------------------------------------------------------------------------------
+// Set master volume (listener)
+int lua_SetMasterVolume(lua_State *L)
+{
+    float volume = LuaGetArgument_float(L, 1);
+    SetMasterVolume(volume);
+    return 0;
+}
 
-// Load model from files (mesh and material)
-int lua_LoadModel(lua_State *L)
+// Wave/Sound loading/unloading functions
+// Load wave data from file
+int lua_LoadWave(lua_State *L)
 {
     const char *fileName = LuaGetArgument_string(L, 1);
-    Model result = LoadModel(fileName);
-    LuaPush_Model(L, result);
+    Wave result = LoadWave(fileName);
+    LuaPush_Wave(L, result);
     return 1;
 }
 
-// Load model from generated mesh
-int lua_LoadModelFromMesh(lua_State *L)
+// WARNING: Load wave data from raw array data
+int lua_LoadWaveEx(lua_State* L)
 {
-    Mesh mesh = LuaGetArgument_Mesh(L, 1);
-    Model result = LoadModelFromMesh(mesh);
-    LuaPush_Model(L, result);
+    // TODO: arg1 parameter should be a float arrat...
+    
+    float *arg1 = 0;
+    int arg2 = LuaGetArgument_int(L, 2);
+    int arg3 = LuaGetArgument_int(L, 3);
+    int arg4 = LuaGetArgument_int(L, 4);
+    int arg5 = LuaGetArgument_int(L, 5);
+    Wave result = LoadWaveEx(arg1, arg2, arg3, arg4, arg5);
+    LuaPush_Wave(L, result);
     return 1;
 }
 
-// Unload model from memory (RAM and/or VRAM)
-int lua_UnloadModel(lua_State *L)
+// Load sound from file
+int lua_LoadSound(lua_State *L)
 {
-    Model model = LuaGetArgument_Model(L, 1);
-    UnloadModel(model);
-    return 0;
+    const char *fileName = LuaGetArgument_string(L, 1);
+    Sound result = LoadSound(fileName);
+    LuaPush_Sound(L, result);
+    return 1;
 }
 
-// Mesh loading/unloading functions
-// Load mesh from file
-int lua_LoadMesh(lua_State *L)
+// Load sound from wave data
+int lua_LoadSoundFromWave(lua_State *L)
 {
-    const char *fileName = LuaGetArgument_string(L, 1);
-    Mesh result = LoadMesh(fileName);
-    LuaPush_Mesh(L, result);
+    Wave wave = LuaGetArgument_Wave(L, 1);
+    Sound result = LoadSoundFromWave(wave);
+    LuaPush_Sound(L, result);
     return 1;
 }
 
-// Unload mesh from memory (RAM and/or VRAM)
-int lua_UnloadMesh(lua_State *L)
+// WARNING: Update sound buffer with new data
+int lua_UpdateSound(lua_State* L)
 {
-    Mesh mesh = LuaGetArgument_Mesh(L, 1);
-    UnloadMesh(mesh);
+    // TODO: arg2 parameter is a void pointer...
+    
+    Sound arg1 = LuaGetArgument_Sound(L, 1);
+    void *arg2 = LuaGetArgument_ptr(L, 2);
+    int arg3 = LuaGetArgument_int(L, 3);
+    UpdateSound(arg1, arg2, arg3);
     return 0;
 }
 
-// Export mesh as an OBJ file
-int lua_ExportMesh(lua_State *L)
+// Unload wave data
+int lua_UnloadWave(lua_State *L)
 {
-    const char *fileName = LuaGetArgument_string(L, 1);
-    Mesh mesh = LuaGetArgument_Mesh(L, 2);
-    ExportMesh(fileName, mesh);
+    Wave wave = LuaGetArgument_Wave(L, 1);
+    UnloadWave(wave);
     return 0;
 }
 
-// Mesh manipulation functions
-// Compute mesh bounding box limits
-int lua_MeshBoundingBox(lua_State *L)
+// Unload sound
+int lua_UnloadSound(lua_State *L)
 {
-    Mesh mesh = LuaGetArgument_Mesh(L, 1);
-    BoundingBox result = MeshBoundingBox(mesh);
-    LuaPush_BoundingBox(L, result);
-    return 1;
+    Sound sound = LuaGetArgument_Sound(L, 1);
+    UnloadSound(sound);
+    return 0;
 }
 
-// Compute mesh tangents
-int lua_MeshTangents(lua_State *L)
+// Wave/Sound management functions
+// Play a sound
+int lua_PlaySound(lua_State *L)
 {
-    Mesh mesh = LuaGetArgument_Mesh(L, 1);
-    MeshTangents(mesh);
+    Sound sound = LuaGetArgument_Sound(L, 1);
+    PlaySound(sound);
     return 0;
 }
 
-// Compute mesh binormals
-int lua_MeshBinormals(lua_State *L)
+// Pause a sound
+int lua_PauseSound(lua_State *L)
 {
-    Mesh mesh = LuaGetArgument_Mesh(L, 1);
-    MeshBinormals(mesh);
+    Sound sound = LuaGetArgument_Sound(L, 1);
+    PauseSound(sound);
     return 0;
 }
 
-// Mesh generation functions
-
-// Generate plane mesh (with subdivisions)
-int lua_GenMeshPlane(lua_State *L)
+// Resume a paused sound
+int lua_ResumeSound(lua_State *L)
 {
-    float width = LuaGetArgument_float(L, 1);
-    float length = LuaGetArgument_float(L, 2);
-    int resX = LuaGetArgument_int(L, 3);
-    int resZ = LuaGetArgument_int(L, 4);
-    Mesh result = GenMeshPlane(width, length, resX, resZ);
-    LuaPush_Mesh(L, result);
-    return 1;
+    Sound sound = LuaGetArgument_Sound(L, 1);
+    ResumeSound(sound);
+    return 0;
 }
 
-// Generate cuboid mesh
-int lua_GenMeshCube(lua_State *L)
+// Stop playing a sound
+int lua_StopSound(lua_State *L)
 {
-    float width = LuaGetArgument_float(L, 1);
-    float height = LuaGetArgument_float(L, 2);
-    float length = LuaGetArgument_float(L, 3);
-    Mesh result = GenMeshCube(width, height, length);
-    LuaPush_Mesh(L, result);
-    return 1;
+    Sound sound = LuaGetArgument_Sound(L, 1);
+    StopSound(sound);
+    return 0;
 }
 
-// Generate sphere mesh (standard sphere)
-int lua_GenMeshSphere(lua_State *L)
+// Check if a sound is currently playing
+int lua_IsSoundPlaying(lua_State *L)
 {
-    float radius = LuaGetArgument_float(L, 1);
-    int rings = LuaGetArgument_int(L, 2);
-    int slices = LuaGetArgument_int(L, 3);
-    Mesh result = GenMeshSphere(radius, rings, slices);
-    LuaPush_Mesh(L, result);
+    Sound sound = LuaGetArgument_Sound(L, 1);
+    bool result = IsSoundPlaying(sound);
+    LuaPush_bool(L, result);
     return 1;
 }
 
-// Generate half-sphere mesh (no bottom cap)
-int lua_GenMeshHemiSphere(lua_State *L)
+// Set volume for a sound (1.0 is max level)
+int lua_SetSoundVolume(lua_State *L)
 {
-    float radius = LuaGetArgument_float(L, 1);
-    int rings = LuaGetArgument_int(L, 2);
-    int slices = LuaGetArgument_int(L, 3);
-    Mesh result = GenMeshHemiSphere(radius, rings, slices);
-    LuaPush_Mesh(L, result);
-    return 1;
+    Sound sound = LuaGetArgument_Sound(L, 1);
+    float volume = LuaGetArgument_float(L, 2);
+    SetSoundVolume(sound, volume);
+    return 0;
 }
 
-// Generate cylinder mesh
-int lua_GenMeshCylinder(lua_State *L)
+// Set pitch for a sound (1.0 is base level)
+int lua_SetSoundPitch(lua_State *L)
 {
-    float radius = LuaGetArgument_float(L, 1);
-    float height = LuaGetArgument_float(L, 2);
-    int slices = LuaGetArgument_int(L, 3);
-    Mesh result = GenMeshCylinder(radius, height, slices);
-    LuaPush_Mesh(L, result);
-    return 1;
+    Sound sound = LuaGetArgument_Sound(L, 1);
+    float pitch = LuaGetArgument_float(L, 2);
+    SetSoundPitch(sound, pitch);
+    return 0;
 }
 
-// Generate torus mesh
-int lua_GenMeshTorus(lua_State *L)
+// Convert wave data to desired format
+int lua_WaveFormat(lua_State *L)
 {
-    float radius = LuaGetArgument_float(L, 1);
-    float size = LuaGetArgument_float(L, 2);
-    int radSeg = LuaGetArgument_int(L, 3);
-    int sides = LuaGetArgument_int(L, 4);
-    Mesh result = GenMeshTorus(radius, size, radSeg, sides);
-    LuaPush_Mesh(L, result);
-    return 1;
+    Wave wave = LuaGetArgument_Wave(L, 1);
+    int sampleRate = LuaGetArgument_int(L, 2);
+    int sampleSize = LuaGetArgument_int(L, 3);
+    int channels = LuaGetArgument_int(L, 4);
+    WaveFormat(wave, sampleRate, sampleSize, channels);
+    return 0;
 }
 
-// Generate trefoil knot mesh
-int lua_GenMeshKnot(lua_State *L)
+// Copy a wave to a new wave
+int lua_WaveCopy(lua_State *L)
 {
-    float radius = LuaGetArgument_float(L, 1);
-    float size = LuaGetArgument_float(L, 2);
-    int radSeg = LuaGetArgument_int(L, 3);
-    int sides = LuaGetArgument_int(L, 4);
-    Mesh result = GenMeshKnot(radius, size, radSeg, sides);
-    LuaPush_Mesh(L, result);
+    Wave wave = LuaGetArgument_Wave(L, 1);
+    Wave result = WaveCopy(wave);
+    LuaPush_Wave(L, result);
     return 1;
 }
 
-// Generate heightmap mesh from image data
-int lua_GenMeshHeightmap(lua_State *L)
+// Crop a wave to defined samples range
+int lua_WaveCrop(lua_State *L)
 {
-    Image heightmap = LuaGetArgument_Image(L, 1);
-    Vector3 size = LuaGetArgument_Vector3(L, 2);
-    Mesh result = GenMeshHeightmap(heightmap, size);
-    LuaPush_Mesh(L, result);
-    return 1;
+    Wave wave = LuaGetArgument_Wave(L, 1);
+    int initSample = LuaGetArgument_int(L, 2);
+    int finalSample = LuaGetArgument_int(L, 3);
+    WaveCrop(wave, initSample, finalSample);
+    return 0;
 }
 
-// Generate cubes-based map mesh from image data
-int lua_GenMeshCubicmap(lua_State *L)
+// WARNING: Get samples data from wave as a floats array
+int lua_GetWaveData(lua_State* L)
 {
-    Image cubicmap = LuaGetArgument_Image(L, 1);
-    Vector3 cubeSize = LuaGetArgument_Vector3(L, 2);
-    Mesh result = GenMeshCubicmap(cubicmap, cubeSize);
-    LuaPush_Mesh(L, result);
-    return 1;
+    // TODO: return value should be a float array...
+    
+    Wave arg1 = LuaGetArgument_Wave(L, 1);
+    float *result = GetWaveData(arg1);
+    //LuaPush_float(L, result);
+    //LuaPush_float(L, result);
+    return 0;
 }
 
-// Material loading/unloading functions
-// Load material from file
-int lua_LoadMaterial(lua_State *L)
+// Music management functions
+
+// Load music stream from file
+int lua_LoadMusicStream(lua_State *L)
 {
     const char *fileName = LuaGetArgument_string(L, 1);
-    Material result = LoadMaterial(fileName);
-    LuaPush_Material(L, result);
+    Music result = LoadMusicStream(fileName);
+    LuaPush_Music(L, result);
     return 1;
 }
 
-// Load default material (Supports: DIFFUSE, SPECULAR, NORMAL maps)
-int lua_LoadMaterialDefault(lua_State *L)
+// Unload music stream
+int lua_UnloadMusicStream(lua_State *L)
 {
-    Material result = LoadMaterialDefault();
-    LuaPush_Material(L, result);
-    return 1;
+    Music music = LuaGetArgument_Music(L, 1);
+    UnloadMusicStream(music);
+    return 0;
 }
 
-// Unload material from GPU memory (VRAM)
-int lua_UnloadMaterial(lua_State *L)
+// Start music playing
+int lua_PlayMusicStream(lua_State *L)
 {
-    Material material = LuaGetArgument_Material(L, 1);
-    UnloadMaterial(material);
+    Music music = LuaGetArgument_Music(L, 1);
+    PlayMusicStream(music);
     return 0;
 }
 
-// Model drawing functions
-// Draw a model (with texture if set)
-int lua_DrawModel(lua_State *L)
+// Updates buffers for music streaming
+int lua_UpdateMusicStream(lua_State *L)
 {
-    Model model = LuaGetArgument_Model(L, 1);
-    Vector3 position = LuaGetArgument_Vector3(L, 2);
-    float scale = LuaGetArgument_float(L, 3);
-    Color tint = LuaGetArgument_Color(L, 4);
-    DrawModel(model, position, scale, tint);
+    Music music = LuaGetArgument_Music(L, 1);
+    UpdateMusicStream(music);
     return 0;
 }
 
-// Draw a model with extended parameters
-int lua_DrawModelEx(lua_State *L)
+// Stop music playing
+int lua_StopMusicStream(lua_State *L)
 {
-    Model model = LuaGetArgument_Model(L, 1);
-    Vector3 position = LuaGetArgument_Vector3(L, 2);
-    Vector3 rotationAxis = LuaGetArgument_Vector3(L, 3);
-    float rotationAngle = LuaGetArgument_float(L, 4);
-    Vector3 scale = LuaGetArgument_Vector3(L, 5);
-    Color tint = LuaGetArgument_Color(L, 6);
-    DrawModelEx(model, position, rotationAxis, rotationAngle, scale, tint);
+    Music music = LuaGetArgument_Music(L, 1);
+    StopMusicStream(music);
     return 0;
 }
 
-// Draw a model wires (with texture if set)
-int lua_DrawModelWires(lua_State *L)
+// Pause music playing
+int lua_PauseMusicStream(lua_State *L)
 {
-    Model model = LuaGetArgument_Model(L, 1);
-    Vector3 position = LuaGetArgument_Vector3(L, 2);
-    float scale = LuaGetArgument_float(L, 3);
-    Color tint = LuaGetArgument_Color(L, 4);
-    DrawModelWires(model, position, scale, tint);
+    Music music = LuaGetArgument_Music(L, 1);
+    PauseMusicStream(music);
     return 0;
 }
 
-// Draw a model wires (with texture if set) with extended parameters
-int lua_DrawModelWiresEx(lua_State *L)
+// Resume playing paused music
+int lua_ResumeMusicStream(lua_State *L)
 {
-    Model model = LuaGetArgument_Model(L, 1);
-    Vector3 position = LuaGetArgument_Vector3(L, 2);
-    Vector3 rotationAxis = LuaGetArgument_Vector3(L, 3);
-    float rotationAngle = LuaGetArgument_float(L, 4);
-    Vector3 scale = LuaGetArgument_Vector3(L, 5);
-    Color tint = LuaGetArgument_Color(L, 6);
-    DrawModelWiresEx(model, position, rotationAxis, rotationAngle, scale, tint);
+    Music music = LuaGetArgument_Music(L, 1);
+    ResumeMusicStream(music);
     return 0;
 }
 
-// Draw bounding box (wires)
-int lua_DrawBoundingBox(lua_State *L)
+// Check if music is playing
+int lua_IsMusicPlaying(lua_State *L)
 {
-    BoundingBox box = LuaGetArgument_BoundingBox(L, 1);
-    Color color = LuaGetArgument_Color(L, 2);
-    DrawBoundingBox(box, color);
+    Music music = LuaGetArgument_Music(L, 1);
+    bool result = IsMusicPlaying(music);
+    LuaPush_bool(L, result);
+    return 1;
+}
+
+// Set volume for music (1.0 is max level)
+int lua_SetMusicVolume(lua_State *L)
+{
+    Music music = LuaGetArgument_Music(L, 1);
+    float volume = LuaGetArgument_float(L, 2);
+    SetMusicVolume(music, volume);
     return 0;
 }
 
-// Draw a billboard texture
-int lua_DrawBillboard(lua_State *L)
+// Set pitch for a music (1.0 is base level)
+int lua_SetMusicPitch(lua_State *L)
 {
-    Camera camera = LuaGetArgument_Camera(L, 1);
-    Texture2D texture = LuaGetArgument_Texture2D(L, 2);
-    Vector3 center = LuaGetArgument_Vector3(L, 3);
-    float size = LuaGetArgument_float(L, 4);
-    Color tint = LuaGetArgument_Color(L, 5);
-    DrawBillboard(camera, texture, center, size, tint);
+    Music music = LuaGetArgument_Music(L, 1);
+    float pitch = LuaGetArgument_float(L, 2);
+    SetMusicPitch(music, pitch);
     return 0;
 }
 
-// Draw a billboard texture defined by sourceRec
-int lua_DrawBillboardRec(lua_State *L)
+// Set music loop count (loop repeats)
+int lua_SetMusicLoopCount(lua_State *L)
 {
-    Camera camera = LuaGetArgument_Camera(L, 1);
-    Texture2D texture = LuaGetArgument_Texture2D(L, 2);
-    Rectangle sourceRec = LuaGetArgument_Rectangle(L, 3);
-    Vector3 center = LuaGetArgument_Vector3(L, 4);
-    float size = LuaGetArgument_float(L, 5);
-    Color tint = LuaGetArgument_Color(L, 6);
-    DrawBillboardRec(camera, texture, sourceRec, center, size, tint);
+    Music music = LuaGetArgument_Music(L, 1);
+    int count = LuaGetArgument_int(L, 2);
+    SetMusicLoopCount(music, count);
     return 0;
 }
 
-// Collision detection functions
-// Detect collision between two spheres
-int lua_CheckCollisionSpheres(lua_State *L)
+// Get music time length (in seconds)
+int lua_GetMusicTimeLength(lua_State *L)
 {
-    Vector3 centerA = LuaGetArgument_Vector3(L, 1);
-    float radiusA = LuaGetArgument_float(L, 2);
-    Vector3 centerB = LuaGetArgument_Vector3(L, 3);
-    float radiusB = LuaGetArgument_float(L, 4);
-    bool result = CheckCollisionSpheres(centerA, radiusA, centerB, radiusB);
-    LuaPush_bool(L, result);
+    Music music = LuaGetArgument_Music(L, 1);
+    float result = GetMusicTimeLength(music);
+    LuaPush_float(L, result);
     return 1;
 }
 
-// Detect collision between two bounding boxes
-int lua_CheckCollisionBoxes(lua_State *L)
+// Get current music time played (in seconds)
+int lua_GetMusicTimePlayed(lua_State *L)
 {
-    BoundingBox box1 = LuaGetArgument_BoundingBox(L, 1);
-    BoundingBox box2 = LuaGetArgument_BoundingBox(L, 2);
-    bool result = CheckCollisionBoxes(box1, box2);
-    LuaPush_bool(L, result);
+    Music music = LuaGetArgument_Music(L, 1);
+    float result = GetMusicTimePlayed(music);
+    LuaPush_float(L, result);
     return 1;
 }
 
-// Detect collision between box and sphere
-int lua_CheckCollisionBoxSphere(lua_State *L)
+// AudioStream management functions
+// Init audio stream (to stream raw audio pcm data)
+int lua_InitAudioStream(lua_State *L)
 {
-    BoundingBox box = LuaGetArgument_BoundingBox(L, 1);
-    Vector3 centerSphere = LuaGetArgument_Vector3(L, 2);
-    float radiusSphere = LuaGetArgument_float(L, 3);
-    bool result = CheckCollisionBoxSphere(box, centerSphere, radiusSphere);
-    LuaPush_bool(L, result);
+    unsigned int sampleRate = LuaGetArgument_unsigned(L, 1);
+    unsigned int sampleSize = LuaGetArgument_unsigned(L, 2);
+    unsigned int channels = LuaGetArgument_unsigned(L, 3);
+    AudioStream result = InitAudioStream(sampleRate, sampleSize, channels);
+    LuaPush_AudioStream(L, result);
     return 1;
 }
 
-// Detect collision between ray and sphere
-int lua_CheckCollisionRaySphere(lua_State *L)
+// WARNING: Update audio stream buffers with data
+int lua_UpdateAudioStream(lua_State* L)
 {
-    Ray ray = LuaGetArgument_Ray(L, 1);
-    Vector3 spherePosition = LuaGetArgument_Vector3(L, 2);
-    float sphereRadius = LuaGetArgument_float(L, 3);
-    bool result = CheckCollisionRaySphere(ray, spherePosition, sphereRadius);
-    LuaPush_bool(L, result);
-    return 1;
+    // TODO: arg2 parameter is a void pointer...
+    
+    AudioStream arg1 = LuaGetArgument_AudioStream(L, 1);
+    void *arg2 = LuaGetArgument_ptr(L, 2);
+    int arg3 = LuaGetArgument_int(L, 3);
+    UpdateAudioStream(arg1, arg2, arg3);
+    return 0;
 }
 
-// Detect collision between ray and sphere, returns collision point
-int lua_CheckCollisionRaySphereEx(lua_State *L)
+// Close audio stream and free memory
+int lua_CloseAudioStream(lua_State *L)
 {
-    Ray ray = LuaGetArgument_Ray(L, 1);
-    Vector3 spherePosition = LuaGetArgument_Vector3(L, 2);
-    float sphereRadius = LuaGetArgument_float(L, 3);
-    Vector3 collisionPoint = LuaGetArgument_Vector3(L, 4);
-    bool result = CheckCollisionRaySphereEx(ray, spherePosition, sphereRadius, collisionPoint);
-    LuaPush_bool(L, result);
-    return 1;
+    AudioStream stream = LuaGetArgument_AudioStream(L, 1);
+    CloseAudioStream(stream);
+    return 0;
 }
 
-// Detect collision between ray and box
-int lua_CheckCollisionRayBox(lua_State *L)
+// Check if any audio stream buffers requires refill
+int lua_IsAudioBufferProcessed(lua_State *L)
 {
-    Ray ray = LuaGetArgument_Ray(L, 1);
-    BoundingBox box = LuaGetArgument_BoundingBox(L, 2);
-    bool result = CheckCollisionRayBox(ray, box);
+    AudioStream stream = LuaGetArgument_AudioStream(L, 1);
+    bool result = IsAudioBufferProcessed(stream);
     LuaPush_bool(L, result);
     return 1;
 }
 
-// Get collision info between ray and model
-int lua_GetCollisionRayModel(lua_State *L)
+// Play audio stream
+int lua_PlayAudioStream(lua_State *L)
 {
-    Ray ray = LuaGetArgument_Ray(L, 1);
-    Model model = LuaGetArgument_Model(L, 2);
-    RayHitInfo result = GetCollisionRayModel(ray, model);
-    LuaPush_RayHitInfo(L, result);
-    return 1;
+    AudioStream stream = LuaGetArgument_AudioStream(L, 1);
+    PlayAudioStream(stream);
+    return 0;
 }
 
-// Get collision info between ray and triangle
-int lua_GetCollisionRayTriangle(lua_State *L)
+// Pause audio stream
+int lua_PauseAudioStream(lua_State *L)
 {
-    Ray ray = LuaGetArgument_Ray(L, 1);
-    Vector3 p1 = LuaGetArgument_Vector3(L, 2);
-    Vector3 p2 = LuaGetArgument_Vector3(L, 3);
-    Vector3 p3 = LuaGetArgument_Vector3(L, 4);
-    RayHitInfo result = GetCollisionRayTriangle(ray, p1, p2, p3);
-    LuaPush_RayHitInfo(L, result);
-    return 1;
+    AudioStream stream = LuaGetArgument_AudioStream(L, 1);
+    PauseAudioStream(stream);
+    return 0;
 }
 
-// Get collision info between ray and ground plane (Y-normal plane)
-int lua_GetCollisionRayGround(lua_State *L)
+// Resume audio stream
+int lua_ResumeAudioStream(lua_State *L)
 {
-    Ray ray = LuaGetArgument_Ray(L, 1);
-    float groundHeight = LuaGetArgument_float(L, 2);
-    RayHitInfo result = GetCollisionRayGround(ray, groundHeight);
-    LuaPush_RayHitInfo(L, result);
-    return 1;
+    AudioStream stream = LuaGetArgument_AudioStream(L, 1);
+    ResumeAudioStream(stream);
+    return 0;
 }
 
-//------------------------------------------------------------------------------------
-// raylib [raymath] module functions - Shaders
-//------------------------------------------------------------------------------------
-
-// WARNING: Load chars array from text file
-int lua_LoadText(lua_State *L)
+// Check if audio stream is playing
+int lua_IsAudioStreamPlaying(lua_State *L)
 {
-    const char *fileName = LuaGetArgument_string(L, 1);
-    char *result = LoadText(fileName);
-    LuaPush_string(L, result);              // WARNING_ LuaPush_char not valid
+    AudioStream stream = LuaGetArgument_AudioStream(L, 1);
+    bool result = IsAudioStreamPlaying(stream);
+    LuaPush_bool(L, result);
     return 1;
 }
 
-// Load shader from files and bind default locations
-int lua_LoadShader(lua_State *L)
+// Stop audio stream
+int lua_StopAudioStream(lua_State *L)
 {
-    const char *vsFileName = LuaGetArgument_string(L, 1);
-    const char *fsFileName = LuaGetArgument_string(L, 2);
-    Shader result = LoadShader(vsFileName, fsFileName);
-    LuaPush_Shader(L, result);
-    return 1;
+    AudioStream stream = LuaGetArgument_AudioStream(L, 1);
+    StopAudioStream(stream);
+    return 0;
 }
 
-// Load shader from code strings and bind default locations
-int lua_LoadShaderCode(lua_State *L)
+// Set volume for audio stream (1.0 is max level)
+int lua_SetAudioStreamVolume(lua_State *L)
 {
-    char *vsCode = LuaGetArgument_char(L, 1);
-    char *fsCode = LuaGetArgument_char(L, 2);
-    Shader result = LoadShaderCode(vsCode, fsCode);
-    LuaPush_Shader(L, result);
-    return 1;
+    AudioStream stream = LuaGetArgument_AudioStream(L, 1);
+    float volume = LuaGetArgument_float(L, 2);
+    SetAudioStreamVolume(stream, volume);
+    return 0;
 }
 
-// Unload shader from GPU memory (VRAM)
-int lua_UnloadShader(lua_State *L)
+// Set pitch for audio stream (1.0 is base level)
+int lua_SetAudioStreamPitch(lua_State *L)
 {
-    Shader shader = LuaGetArgument_Shader(L, 1);
-    UnloadShader(shader);
+    AudioStream stream = LuaGetArgument_AudioStream(L, 1);
+    float pitch = LuaGetArgument_float(L, 2);
+    SetAudioStreamPitch(stream, pitch);
     return 0;
 }
 
-// Get default shader
-int lua_GetShaderDefault(lua_State *L)
+// TODO: FROM HERE DOWN!
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Utils math
+//----------------------------------------------------------------------------------
+int lua_Clamp(lua_State* L)
 {
-    Shader result = GetShaderDefault();
-    LuaPush_Shader(L, result);
+    float arg1 = LuaGetArgument_float(L, 1);
+    float arg2 = LuaGetArgument_float(L, 2);
+    float arg3 = LuaGetArgument_float(L, 3);
+    float result = Clamp(arg1, arg2, arg3);
+    LuaPush_float(L, result);
     return 1;
 }
 
-// Get default texture
-int lua_GetTextureDefault(lua_State *L)
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Vector2 math
+//----------------------------------------------------------------------------------
+int lua_Vector2Zero(lua_State* L)
 {
-    Texture2D result = GetTextureDefault();
-    LuaPush_Texture2D(L, result);
+    Vector2 result = Vector2Zero();
+    LuaPush_Vector2(L, result);
     return 1;
 }
 
-// Shader configuration functions
+int lua_Vector2One(lua_State* L)
+{
+    Vector2 result = Vector2One();
+    LuaPush_Vector2(L, result);
+    return 1;
+}
 
-// Get shader uniform location
-int lua_GetShaderLocation(lua_State *L)
+int lua_Vector2Add(lua_State* L)
 {
-    Shader shader = LuaGetArgument_Shader(L, 1);
-    const char *uniformName = LuaGetArgument_string(L, 2);
-    int result = GetShaderLocation(shader, uniformName);
-    LuaPush_int(L, result);
+    Vector2 arg1 = LuaGetArgument_Vector2(L, 1);
+    Vector2 arg2 = LuaGetArgument_Vector2(L, 2);
+    Vector2 result = Vector2Add(arg1, arg2);
+    LuaPush_Vector2(L, result);
     return 1;
 }
 
-// WARNING: Set shader uniform values (float)
-int lua_SetShaderValue(lua_State* L)
+int lua_Vector2Subtract(lua_State* L)
 {
-    Shader arg1 = LuaGetArgument_Shader(L, 1);
-    int arg2 = LuaGetArgument_int(L, 2);
-    GET_TABLE(float, arg3, 3);
-    SetShaderValue(arg1, arg2, arg3, arg3_size);
-    free(arg3);
-    return 0;
+    Vector2 arg1 = LuaGetArgument_Vector2(L, 1);
+    Vector2 arg2 = LuaGetArgument_Vector2(L, 2);
+    Vector2 result = Vector2Subtract(arg1, arg2);
+    LuaPush_Vector2(L, result);
+    return 1;
 }
 
-// WARNING: Set shader uniform values (int)
-int lua_SetShaderValuei(lua_State* L)
+int lua_Vector2Lenght(lua_State* L)
 {
-    Shader arg1 = LuaGetArgument_Shader(L, 1);
-    int arg2 = LuaGetArgument_int(L, 2);
-    GET_TABLE(int, arg3, 3);
-    SetShaderValuei(arg1, arg2, arg3, arg3_size);
-    free(arg3);
-    return 0;
+    Vector2 arg1 = LuaGetArgument_Vector2(L, 1);
+    float result = Vector2Lenght(arg1);
+    LuaPush_float(L, result);
+    return 1;
 }
 
-// Set shader uniform value (matrix 4x4)
-int lua_SetShaderValueMatrix(lua_State *L)
+int lua_Vector2DotProduct(lua_State* L)
 {
-    Shader shader = LuaGetArgument_Shader(L, 1);
-    int uniformLoc = LuaGetArgument_int(L, 2);
-    Matrix mat = LuaGetArgument_Matrix(L, 3);
-    SetShaderValueMatrix(shader, uniformLoc, mat);
-    return 0;
+    Vector2 arg1 = LuaGetArgument_Vector2(L, 1);
+    Vector2 arg2 = LuaGetArgument_Vector2(L, 2);
+    float result = Vector2DotProduct(arg1, arg2);
+    LuaPush_float(L, result);
+    return 1;
 }
 
-// Set a custom projection matrix (replaces internal projection matrix)
-int lua_SetMatrixProjection(lua_State *L)
+int lua_Vector2Distance(lua_State* L)
 {
-    Matrix proj = LuaGetArgument_Matrix(L, 1);
-    SetMatrixProjection(proj);
-    return 0;
+    Vector2 arg1 = LuaGetArgument_Vector2(L, 1);
+    Vector2 arg2 = LuaGetArgument_Vector2(L, 2);
+    float result = Vector2Distance(arg1, arg2);
+    LuaPush_float(L, result);
+    return 1;
 }
 
-// Set a custom modelview matrix (replaces internal modelview matrix)
-int lua_SetMatrixModelview(lua_State *L)
+int lua_Vector2Angle(lua_State* L)
 {
-    Matrix view = LuaGetArgument_Matrix(L, 1);
-    SetMatrixModelview(view);
-    return 0;
+    Vector2 arg1 = LuaGetArgument_Vector2(L, 1);
+    Vector2 arg2 = LuaGetArgument_Vector2(L, 2);
+    float result = Vector2Angle(arg1, arg2);
+    LuaPush_float(L, result);
+    return 1;
 }
 
-// Get internal modelview matrix
-int lua_GetMatrixModelview(lua_State *L)
+int lua_Vector2Scale(lua_State* L)
 {
-    Matrix view = LuaGetArgument_Matrix(L, 1);
-    Matrix result = GetMatrixModelview(view);
-    LuaPush_Matrix(L, result);
+    Vector2 arg1 = LuaGetArgument_Vector2(L, 1);
+    float arg2 = LuaGetArgument_float(L, 2);
+    Vector2Scale(&arg1, arg2);
+    LuaPush_Vector2(L, arg1);
     return 1;
 }
 
-// Texture maps generation (PBR)
-// NOTE: Required shaders should be provided
-// Generate cubemap texture from HDR texture
-int lua_GenTextureCubemap(lua_State *L)
+int lua_Vector2Negate(lua_State* L)
 {
-    Shader shader = LuaGetArgument_Shader(L, 1);
-    Texture2D skyHDR = LuaGetArgument_Texture2D(L, 2);
-    int size = LuaGetArgument_int(L, 3);
-    Texture2D result = GenTextureCubemap(shader, skyHDR, size);
-    LuaPush_Texture2D(L, result);
+    Vector2 arg1 = LuaGetArgument_Vector2(L, 1);
+    Vector2Negate(&arg1);
+    LuaPush_Vector2(L, arg1);
     return 1;
 }
 
-// Generate irradiance texture using cubemap data
-int lua_GenTextureIrradiance(lua_State *L)
+int lua_Vector2Divide(lua_State* L)
 {
-    Shader shader = LuaGetArgument_Shader(L, 1);
-    Texture2D cubemap = LuaGetArgument_Texture2D(L, 2);
-    int size = LuaGetArgument_int(L, 3);
-    Texture2D result = GenTextureIrradiance(shader, cubemap, size);
-    LuaPush_Texture2D(L, result);
+    Vector2 arg1 = LuaGetArgument_Vector2(L, 1);
+    float arg2 = LuaGetArgument_float(L, 2);
+    Vector2Divide(&arg1, arg2);
+    LuaPush_Vector2(L, arg1);
     return 1;
 }
 
-// Generate prefilter texture using cubemap data
-int lua_GenTexturePrefilter(lua_State *L)
+int lua_Vector2Normalize(lua_State* L)
 {
-    Shader shader = LuaGetArgument_Shader(L, 1);
-    Texture2D cubemap = LuaGetArgument_Texture2D(L, 2);
-    int size = LuaGetArgument_int(L, 3);
-    Texture2D result = GenTexturePrefilter(shader, cubemap, size);
-    LuaPush_Texture2D(L, result);
+    Vector2 arg1 = LuaGetArgument_Vector2(L, 1);
+    Vector2Normalize(&arg1);
+    LuaPush_Vector2(L, arg1);
     return 1;
 }
 
-// Generate BRDF texture using cubemap data
-int lua_GenTextureBRDF(lua_State *L)
+//----------------------------------------------------------------------------------
+// raylib [raymath] module functions - Vector3 math
+//----------------------------------------------------------------------------------
+int lua_VectorZero(lua_State* L)
 {
-    Shader shader = LuaGetArgument_Shader(L, 1);
-    Texture2D cubemap = LuaGetArgument_Texture2D(L, 2);
-    int size = LuaGetArgument_int(L, 3);
-    Texture2D result = GenTextureBRDF(shader, cubemap, size);
-    LuaPush_Texture2D(L, result);
+    Vector3 result = VectorZero();
+    LuaPush_Vector3(L, result);
     return 1;
 }
 
-// Shading begin/end functions
-// Begin custom shader drawing
-int lua_BeginShaderMode(lua_State *L)
+int lua_VectorOne(lua_State* L)
 {
-    Shader shader = LuaGetArgument_Shader(L, 1);
-    BeginShaderMode(shader);
-    return 0;
+    Vector3 result = VectorOne();
+    LuaPush_Vector3(L, result);
+    return 1;
 }
 
-// End custom shader drawing (use default shader)
-int lua_EndShaderMode(lua_State *L)
+int lua_VectorAdd(lua_State* L)
 {
-    EndShaderMode();
-    return 0;
+    Vector3 arg1 = LuaGetArgument_Vector3(L, 1);
+    Vector3 arg2 = LuaGetArgument_Vector3(L, 2);
+    Vector3 result = VectorAdd(arg1, arg2);
+    LuaPush_Vector3(L, result);
+    return 1;
 }
 
-// Begin blending mode (alpha, additive, multiplied)
-int lua_BeginBlendMode(lua_State *L)
+int lua_VectorSubtract(lua_State* L)
 {
-    int mode = LuaGetArgument_int(L, 1);
-    BeginBlendMode(mode);
-    return 0;
+    Vector3 arg1 = LuaGetArgument_Vector3(L, 1);
+    Vector3 arg2 = LuaGetArgument_Vector3(L, 2);
+    Vector3 result = VectorSubtract(arg1, arg2);
+    LuaPush_Vector3(L, result);
+    return 1;
 }
 
-// End blending mode (reset to default: alpha blending)
-int lua_EndBlendMode(lua_State *L)
+int lua_VectorCrossProduct(lua_State* L)
 {
-    EndBlendMode();
-    return 0;
+    Vector3 arg1 = LuaGetArgument_Vector3(L, 1);
+    Vector3 arg2 = LuaGetArgument_Vector3(L, 2);
+    Vector3 result = VectorCrossProduct(arg1, arg2);
+    LuaPush_Vector3(L, result);
+    return 1;
 }
 
-//------------------------------------------------------------------------------------
-// raylib [rlgl] module functions - VR experience
-//------------------------------------------------------------------------------------
-
-// Get VR device information for some standard devices
-int lua_GetVrDeviceInfo(lua_State *L)
+int lua_VectorPerpendicular(lua_State* L)
 {
-    int vrDeviceType = LuaGetArgument_int(L, 1);
-    VrDeviceInfo result = GetVrDeviceInfo(vrDeviceType);
-    LuaPush_VrDeviceInfo(L, result);
+    Vector3 arg1 = LuaGetArgument_Vector3(L, 1);
+    Vector3 result = VectorPerpendicular(arg1);
+    LuaPush_Vector3(L, result);
     return 1;
 }
 
-// Init VR simulator for selected device parameters
-int lua_InitVrSimulator(lua_State *L)
+int lua_VectorDotProduct(lua_State* L)
 {
-    VrDeviceInfo info = LuaGetArgument_VrDeviceInfo(L, 1);
-    InitVrSimulator(info);
-    return 0;
+    Vector3 arg1 = LuaGetArgument_Vector3(L, 1);
+    Vector3 arg2 = LuaGetArgument_Vector3(L, 2);
+    float result = VectorDotProduct(arg1, arg2);
+    LuaPush_float(L, result);
+    return 1;
 }
 
-// Close VR simulator for current device
-int lua_CloseVrSimulator(lua_State *L)
+int lua_VectorLength(lua_State* L)
 {
-    CloseVrSimulator();
-    return 0;
+    const Vector3 arg1 = LuaGetArgument_Vector3(L, 1);
+    float result = VectorLength(arg1);
+    LuaPush_float(L, result);
+    return 1;
 }
 
-// Detect if VR simulator is ready
-int lua_IsVrSimulatorReady(lua_State *L)
+int lua_VectorScale(lua_State* L)
 {
-    bool result = IsVrSimulatorReady();
-    LuaPush_bool(L, result);
+    Vector3 arg1 = LuaGetArgument_Vector3(L, 1);
+    float arg2 = LuaGetArgument_float(L, 2);
+    VectorScale(&arg1, arg2);
+    LuaPush_Vector3(L, arg1);
     return 1;
 }
 
-// Set VR distortion shader for stereoscopic rendering
-int lua_SetVrDistortionShader(lua_State *L)
+int lua_VectorNegate(lua_State* L)
 {
-    Shader shader = LuaGetArgument_Shader(L, 1);
-    SetVrDistortionShader(shader);
-    return 0;
+    Vector3 arg1 = LuaGetArgument_Vector3(L, 1);
+    VectorNegate(&arg1);
+    LuaPush_Vector3(L, arg1);
+    return 1;
 }
 
-// Update VR tracking (position and orientation) and camera
-int lua_UpdateVrTracking(lua_State *L)
+int lua_VectorNormalize(lua_State* L)
 {
-    Camera camera = LuaGetArgument_Camera(L, 1);
-    UpdateVrTracking(camera);
-    return 0;
+    Vector3 arg1 = LuaGetArgument_Vector3(L, 1);
+    VectorNormalize(&arg1);
+    LuaPush_Vector3(L, arg1);
+    return 1;
 }
 
-// Enable/Disable VR experience
-int lua_ToggleVrMode(lua_State *L)
+int lua_VectorDistance(lua_State* L)
 {
-    ToggleVrMode();
-    return 0;
+    Vector3 arg1 = LuaGetArgument_Vector3(L, 1);
+    Vector3 arg2 = LuaGetArgument_Vector3(L, 2);
+    float result = VectorDistance(arg1, arg2);
+    LuaPush_float(L, result);
+    return 1;
 }
 
-// Begin VR simulator stereo rendering
-int lua_BeginVrDrawing(lua_State *L)
+int lua_VectorLerp(lua_State* L)
 {
-    BeginVrDrawing();
-    return 0;
+    Vector3 arg1 = LuaGetArgument_Vector3(L, 1);
+    Vector3 arg2 = LuaGetArgument_Vector3(L, 2);
+    float arg3 = LuaGetArgument_float(L, 3);
+    Vector3 result = VectorLerp(arg1, arg2, arg3);
+    LuaPush_Vector3(L, result);
+    return 1;
 }
 
-// End VR simulator stereo rendering
-int lua_EndVrDrawing(lua_State *L)
+int lua_VectorReflect(lua_State* L)
 {
-    EndVrDrawing();
-    return 0;
+    Vector3 arg1 = LuaGetArgument_Vector3(L, 1);
+    Vector3 arg2 = LuaGetArgument_Vector3(L, 2);
+    Vector3 result = VectorReflect(arg1, arg2);
+    LuaPush_Vector3(L, result);
+    return 1;
 }
 
-//------------------------------------------------------------------------------------
-// raylib [audio] module functions - Audio Loading and Playing
-//------------------------------------------------------------------------------------
-
-// Initialize audio device and context
-int lua_InitAudioDevice(lua_State *L)
+int lua_VectorTransform(lua_State* L)
 {
-    InitAudioDevice();
-    return 0;
+    Vector3 arg1 = LuaGetArgument_Vector3(L, 1);
+    Matrix arg2 = LuaGetArgument_Matrix(L, 2);
+    VectorTransform(&arg1, arg2);
+    LuaPush_Vector3(L, arg1);
+    return 1;
 }
 
-// Close the audio device and context
-int lua_CloseAudioDevice(lua_State *L)
+//----------------------------------------------------------------------------------
+// raylib [raymath] module functions - Matrix math
+//----------------------------------------------------------------------------------
+int lua_MatrixDeterminant(lua_State* L)
 {
-    CloseAudioDevice();
-    return 0;
+    Matrix arg1 = LuaGetArgument_Matrix(L, 1);
+    float result = MatrixDeterminant(arg1);
+    LuaPush_float(L, result);
+    return 1;
 }
 
-// Check if audio device has been initialized successfully
-int lua_IsAudioDeviceReady(lua_State *L)
+int lua_MatrixTrace(lua_State* L)
 {
-    bool result = IsAudioDeviceReady();
-    LuaPush_bool(L, result);
+    Matrix arg1 = LuaGetArgument_Matrix(L, 1);
+    float result = MatrixTrace(arg1);
+    LuaPush_float(L, result);
     return 1;
 }
 
-// Set master volume (listener)
-int lua_SetMasterVolume(lua_State *L)
+int lua_MatrixTranspose(lua_State* L)
 {
-    float volume = LuaGetArgument_float(L, 1);
-    SetMasterVolume(volume);
-    return 0;
+    Matrix arg1 = LuaGetArgument_Matrix(L, 1);
+    MatrixTranspose(&arg1);
+    LuaPush_Matrix(L, &arg1);
+    return 1;
 }
 
-// Wave/Sound loading/unloading functions
-// Load wave data from file
-int lua_LoadWave(lua_State *L)
+int lua_MatrixInvert(lua_State* L)
 {
-    const char *fileName = LuaGetArgument_string(L, 1);
-    Wave result = LoadWave(fileName);
-    LuaPush_Wave(L, result);
+    Matrix arg1 = LuaGetArgument_Matrix(L, 1);
+    MatrixInvert(&arg1);
+    LuaPush_Matrix(L, &arg1);
     return 1;
 }
 
-// WARNING: Load wave data from raw array data
-int lua_LoadWaveEx(lua_State* L)
+int lua_MatrixNormalize(lua_State* L)
 {
-    // TODO: arg1 parameter should be a float arrat...
-    
-    float *arg1 = 0;
-    int arg2 = LuaGetArgument_int(L, 2);
-    int arg3 = LuaGetArgument_int(L, 3);
-    int arg4 = LuaGetArgument_int(L, 4);
-    int arg5 = LuaGetArgument_int(L, 5);
-    Wave result = LoadWaveEx(arg1, arg2, arg3, arg4, arg5);
-    LuaPush_Wave(L, result);
+    Matrix arg1 = LuaGetArgument_Matrix(L, 1);
+    MatrixNormalize(&arg1);
+    LuaPush_Matrix(L, &arg1);
     return 1;
 }
 
-// Load sound from file
-int lua_LoadSound(lua_State *L)
+int lua_MatrixIdentity(lua_State* L)
 {
-    const char *fileName = LuaGetArgument_string(L, 1);
-    Sound result = LoadSound(fileName);
-    LuaPush_Sound(L, result);
+    Matrix result = MatrixIdentity();
+    LuaPush_Matrix(L, &result);
     return 1;
 }
 
-// Load sound from wave data
-int lua_LoadSoundFromWave(lua_State *L)
+int lua_MatrixAdd(lua_State* L)
 {
-    Wave wave = LuaGetArgument_Wave(L, 1);
-    Sound result = LoadSoundFromWave(wave);
-    LuaPush_Sound(L, result);
+    Matrix arg1 = LuaGetArgument_Matrix(L, 1);
+    Matrix arg2 = LuaGetArgument_Matrix(L, 2);
+    Matrix result = MatrixAdd(arg1, arg2);
+    LuaPush_Matrix(L, &result);
     return 1;
 }
 
-// WARNING: Update sound buffer with new data
-int lua_UpdateSound(lua_State* L)
+int lua_MatrixSubstract(lua_State* L)
 {
-    // TODO: arg2 parameter is a void pointer...
-    
-    Sound arg1 = LuaGetArgument_Sound(L, 1);
-    void *arg2 = LuaGetArgument_ptr(L, 2);
-    int arg3 = LuaGetArgument_int(L, 3);
-    UpdateSound(arg1, arg2, arg3);
-    return 0;
+    Matrix arg1 = LuaGetArgument_Matrix(L, 1);
+    Matrix arg2 = LuaGetArgument_Matrix(L, 2);
+    Matrix result = MatrixSubstract(arg1, arg2);
+    LuaPush_Matrix(L, &result);
+    return 1;
 }
 
-// Unload wave data
-int lua_UnloadWave(lua_State *L)
+int lua_MatrixTranslate(lua_State* L)
 {
-    Wave wave = LuaGetArgument_Wave(L, 1);
-    UnloadWave(wave);
-    return 0;
+    float arg1 = LuaGetArgument_float(L, 1);
+    float arg2 = LuaGetArgument_float(L, 2);
+    float arg3 = LuaGetArgument_float(L, 3);
+    Matrix result = MatrixTranslate(arg1, arg2, arg3);
+    LuaPush_Matrix(L, &result);
+    return 1;
 }
 
-// Unload sound
-int lua_UnloadSound(lua_State *L)
+int lua_MatrixRotate(lua_State* L)
 {
-    Sound sound = LuaGetArgument_Sound(L, 1);
-    UnloadSound(sound);
-    return 0;
+    Vector3 arg1 = LuaGetArgument_Vector3(L, 1);
+    float arg2 = LuaGetArgument_float(L, 2);
+    Matrix result = MatrixRotate(arg1, arg2);
+    LuaPush_Matrix(L, &result);
+    return 1;
 }
 
-// Wave/Sound management functions
-// Play a sound
-int lua_PlaySound(lua_State *L)
+int lua_MatrixRotateX(lua_State* L)
 {
-    Sound sound = LuaGetArgument_Sound(L, 1);
-    PlaySound(sound);
-    return 0;
+    float arg1 = LuaGetArgument_float(L, 1);
+    Matrix result = MatrixRotateX(arg1);
+    LuaPush_Matrix(L, &result);
+    return 1;
 }
 
-// Pause a sound
-int lua_PauseSound(lua_State *L)
+int lua_MatrixRotateY(lua_State* L)
 {
-    Sound sound = LuaGetArgument_Sound(L, 1);
-    PauseSound(sound);
-    return 0;
+    float arg1 = LuaGetArgument_float(L, 1);
+    Matrix result = MatrixRotateY(arg1);
+    LuaPush_Matrix(L, &result);
+    return 1;
 }
 
-// Resume a paused sound
-int lua_ResumeSound(lua_State *L)
+int lua_MatrixRotateZ(lua_State* L)
 {
-    Sound sound = LuaGetArgument_Sound(L, 1);
-    ResumeSound(sound);
-    return 0;
+    float arg1 = LuaGetArgument_float(L, 1);
+    Matrix result = MatrixRotateZ(arg1);
+    LuaPush_Matrix(L, &result);
+    return 1;
 }
 
-// Stop playing a sound
-int lua_StopSound(lua_State *L)
+int lua_MatrixScale(lua_State* L)
 {
-    Sound sound = LuaGetArgument_Sound(L, 1);
-    StopSound(sound);
-    return 0;
+    float arg1 = LuaGetArgument_float(L, 1);
+    float arg2 = LuaGetArgument_float(L, 2);
+    float arg3 = LuaGetArgument_float(L, 3);
+    Matrix result = MatrixScale(arg1, arg2, arg3);
+    LuaPush_Matrix(L, &result);
+    return 1;
 }
 
-// Check if a sound is currently playing
-int lua_IsSoundPlaying(lua_State *L)
+int lua_MatrixMultiply(lua_State* L)
 {
-    Sound sound = LuaGetArgument_Sound(L, 1);
-    bool result = IsSoundPlaying(sound);
-    LuaPush_bool(L, result);
+    Matrix arg1 = LuaGetArgument_Matrix(L, 1);
+    Matrix arg2 = LuaGetArgument_Matrix(L, 2);
+    Matrix result = MatrixMultiply(arg1, arg2);
+    LuaPush_Matrix(L, &result);
     return 1;
 }
 
-// Set volume for a sound (1.0 is max level)
-int lua_SetSoundVolume(lua_State *L)
+int lua_MatrixFrustum(lua_State* L)
 {
-    Sound sound = LuaGetArgument_Sound(L, 1);
-    float volume = LuaGetArgument_float(L, 2);
-    SetSoundVolume(sound, volume);
-    return 0;
+    double arg1 = LuaGetArgument_double(L, 1);
+    double arg2 = LuaGetArgument_double(L, 2);
+    double arg3 = LuaGetArgument_double(L, 3);
+    double arg4 = LuaGetArgument_double(L, 4);
+    double arg5 = LuaGetArgument_double(L, 5);
+    double arg6 = LuaGetArgument_double(L, 6);
+    Matrix result = MatrixFrustum(arg1, arg2, arg3, arg4, arg5, arg6);
+    LuaPush_Matrix(L, &result);
+    return 1;
 }
 
-// Set pitch for a sound (1.0 is base level)
-int lua_SetSoundPitch(lua_State *L)
+int lua_MatrixPerspective(lua_State* L)
 {
-    Sound sound = LuaGetArgument_Sound(L, 1);
-    float pitch = LuaGetArgument_float(L, 2);
-    SetSoundPitch(sound, pitch);
-    return 0;
+    double arg1 = LuaGetArgument_double(L, 1);
+    double arg2 = LuaGetArgument_double(L, 2);
+    double arg3 = LuaGetArgument_double(L, 3);
+    double arg4 = LuaGetArgument_double(L, 4);
+    Matrix result = MatrixPerspective(arg1, arg2, arg3, arg4);
+    LuaPush_Matrix(L, &result);
+    return 1;
 }
 
-// Convert wave data to desired format
-int lua_WaveFormat(lua_State *L)
+int lua_MatrixOrtho(lua_State* L)
 {
-    Wave wave = LuaGetArgument_Wave(L, 1);
-    int sampleRate = LuaGetArgument_int(L, 2);
-    int sampleSize = LuaGetArgument_int(L, 3);
-    int channels = LuaGetArgument_int(L, 4);
-    WaveFormat(wave, sampleRate, sampleSize, channels);
-    return 0;
+    double arg1 = LuaGetArgument_double(L, 1);
+    double arg2 = LuaGetArgument_double(L, 2);
+    double arg3 = LuaGetArgument_double(L, 3);
+    double arg4 = LuaGetArgument_double(L, 4);
+    double arg5 = LuaGetArgument_double(L, 5);
+    double arg6 = LuaGetArgument_double(L, 6);
+    Matrix result = MatrixOrtho(arg1, arg2, arg3, arg4, arg5, arg6);
+    LuaPush_Matrix(L, &result);
+    return 1;
 }
 
-// Copy a wave to a new wave
-int lua_WaveCopy(lua_State *L)
+int lua_MatrixLookAt(lua_State* L)
 {
-    Wave wave = LuaGetArgument_Wave(L, 1);
-    Wave result = WaveCopy(wave);
-    LuaPush_Wave(L, result);
+    Vector3 arg1 = LuaGetArgument_Vector3(L, 1);
+    Vector3 arg2 = LuaGetArgument_Vector3(L, 2);
+    Vector3 arg3 = LuaGetArgument_Vector3(L, 3);
+    Matrix result = MatrixLookAt(arg1, arg2, arg3);
+    LuaPush_Matrix(L, &result);
     return 1;
 }
 
-// Crop a wave to defined samples range
-int lua_WaveCrop(lua_State *L)
+//----------------------------------------------------------------------------------
+// raylib [raymath] module functions - Quaternion math
+//----------------------------------------------------------------------------------
+int lua_QuaternionLength(lua_State* L)
 {
-    Wave wave = LuaGetArgument_Wave(L, 1);
-    int initSample = LuaGetArgument_int(L, 2);
-    int finalSample = LuaGetArgument_int(L, 3);
-    WaveCrop(wave, initSample, finalSample);
-    return 0;
+    Quaternion arg1 = LuaGetArgument_Quaternion(L, 1);
+    float result = QuaternionLength(arg1);
+    LuaPush_float(L, result);
+    return 1;
 }
 
-// WARNING: Get samples data from wave as a floats array
-int lua_GetWaveData(lua_State* L)
+int lua_QuaternionNormalize(lua_State* L)
 {
-    // TODO: return value should be a float array...
-    
-    Wave arg1 = LuaGetArgument_Wave(L, 1);
-    float *result = GetWaveData(arg1);
-    //LuaPush_float(L, result);
-    //LuaPush_float(L, result);
-    return 0;
+    Quaternion arg1 = LuaGetArgument_Quaternion(L, 1);
+    QuaternionNormalize(&arg1);
+    LuaPush_Quaternion(L, arg1);
+    return 1;
 }
 
-// Music management functions
+int lua_QuaternionMultiply(lua_State* L)
+{
+    Quaternion arg1 = LuaGetArgument_Quaternion(L, 1);
+    Quaternion arg2 = LuaGetArgument_Quaternion(L, 2);
+    Quaternion result = QuaternionMultiply(arg1, arg2);
+    LuaPush_Quaternion(L, result);
+    return 1;
+}
 
-// Load music stream from file
-int lua_LoadMusicStream(lua_State *L)
+int lua_QuaternionSlerp(lua_State* L)
 {
-    const char *fileName = LuaGetArgument_string(L, 1);
-    Music result = LoadMusicStream(fileName);
-    LuaPush_Music(L, result);
+    Quaternion arg1 = LuaGetArgument_Quaternion(L, 1);
+    Quaternion arg2 = LuaGetArgument_Quaternion(L, 2);
+    float arg3 = LuaGetArgument_float(L, 3);
+    Quaternion result = QuaternionSlerp(arg1, arg2, arg3);
+    LuaPush_Quaternion(L, result);
     return 1;
 }
 
-// Unload music stream
-int lua_UnloadMusicStream(lua_State *L)
+int lua_QuaternionFromMatrix(lua_State* L)
 {
-    Music music = LuaGetArgument_Music(L, 1);
-    UnloadMusicStream(music);
-    return 0;
+    Matrix arg1 = LuaGetArgument_Matrix(L, 1);
+    Quaternion result = QuaternionFromMatrix(arg1);
+    LuaPush_Quaternion(L, result);
+    return 1;
 }
 
-// Start music playing
-int lua_PlayMusicStream(lua_State *L)
+int lua_QuaternionToMatrix(lua_State* L)
 {
-    Music music = LuaGetArgument_Music(L, 1);
-    PlayMusicStream(music);
-    return 0;
+    Quaternion arg1 = LuaGetArgument_Quaternion(L, 1);
+    Matrix result = QuaternionToMatrix(arg1);
+    LuaPush_Matrix(L, &result);
+    return 1;
 }
 
-// Updates buffers for music streaming
-int lua_UpdateMusicStream(lua_State *L)
+int lua_QuaternionFromAxisAngle(lua_State* L)
 {
-    Music music = LuaGetArgument_Music(L, 1);
-    UpdateMusicStream(music);
-    return 0;
+    Vector3 arg1 = LuaGetArgument_Vector3(L, 1);
+    float arg2 = LuaGetArgument_float(L, 2);
+    Quaternion result = QuaternionFromAxisAngle(arg1, arg2);
+    LuaPush_Quaternion(L, result);
+    return 1;
 }
 
-// Stop music playing
-int lua_StopMusicStream(lua_State *L)
+int lua_QuaternionToAxisAngle(lua_State* L)
 {
-    Music music = LuaGetArgument_Music(L, 1);
-    StopMusicStream(music);
-    return 0;
+    Quaternion arg1 = LuaGetArgument_Quaternion(L, 1);
+    Vector3 arg2;
+    float arg3 = 0;
+    QuaternionToAxisAngle(arg1, &arg2, &arg3);
+    LuaPush_Vector3(L, arg2);
+    LuaPush_float(L, arg3);
+    return 2;
 }
 
-// Pause music playing
-int lua_PauseMusicStream(lua_State *L)
+int lua_QuaternionFromEuler(lua_State* L)
 {
-    Music music = LuaGetArgument_Music(L, 1);
-    PauseMusicStream(music);
-    return 0;
+    float arg1 = LuaGetArgument_float(L, 1);
+    float arg2 = LuaGetArgument_float(L, 2);
+    float arg3 = LuaGetArgument_float(L, 3);
+    Quaternion result = QuaternionFromEuler(arg1, arg2, arg3);
+    LuaPush_Quaternion(L, result);
+    return 1;
 }
 
-// Resume playing paused music
-int lua_ResumeMusicStream(lua_State *L)
+int lua_QuaternionToEuler(lua_State* L)
 {
-    Music music = LuaGetArgument_Music(L, 1);
-    ResumeMusicStream(music);
-    return 0;
+    Quaternion arg1 = LuaGetArgument_Quaternion(L, 1);
+    Vector3 result = QuaternionToEuler(arg1);
+    LuaPush_Vector3(L, result);
+    return 1;
 }
 
-// Check if music is playing
-int lua_IsMusicPlaying(lua_State *L)
+int lua_QuaternionTransform(lua_State* L)
 {
-    Music music = LuaGetArgument_Music(L, 1);
-    bool result = IsMusicPlaying(music);
-    LuaPush_bool(L, result);
+    Quaternion arg1 = LuaGetArgument_Quaternion(L, 1);
+    Matrix arg2 = LuaGetArgument_Matrix(L, 2);
+    QuaternionTransform(&arg1, arg2);
+    LuaPush_Quaternion(L, arg1);
     return 1;
 }
 
-// Set volume for music (1.0 is max level)
-int lua_SetMusicVolume(lua_State *L)
+//----------------------------------------------------------------------------------
+// raylib-lua [raymath] module functions - Vector userdata (Vector2, Vector3, Quaternion)
+//----------------------------------------------------------------------------------
+
+// Vector userdata metatables names, indexed by components count
+static const char *vectorTypeNames[5] = { NULL, NULL, "Vector2", "Vector3", "Quaternion" };
+
+// NOTE: Vector metamethods and methods get components count as first upvalue
+#define VECTOR_COMPONENTS(L)    ((int)lua_tointeger(L, lua_upvalueindex(1)))
+
+// Push new vector userdata (components not initialized)
+static float *LuaPushVector(lua_State *L, int n)
 {
-    Music music = LuaGetArgument_Music(L, 1);
-    float volume = LuaGetArgument_float(L, 2);
-    SetMusicVolume(music, volume);
-    return 0;
+    float *v = (float *)lua_newuserdata(L, n*sizeof(float));
+    luaL_setmetatable(L, vectorTypeNames[n]);
+    return v;
 }
 
-// Set pitch for a music (1.0 is base level)
-int lua_SetMusicPitch(lua_State *L)
+// Get vector operand components: vector userdata, table with x, y, z, w fields or number (all components)
+static void LuaGetVectorOperand(lua_State *L, int index, int n, float *v)
 {
-    Music music = LuaGetArgument_Music(L, 1);
-    float pitch = LuaGetArgument_float(L, 2);
-    SetMusicPitch(music, pitch);
-    return 0;
+    static const char *fields[4] = { "x", "y", "z", "w" };
+    const float *data = (const float *)luaL_testudata(L, index, vectorTypeNames[n]);
+
+    if (data != NULL) memcpy(v, data, n*sizeof(float));
+    else if (lua_type(L, index) == LUA_TNUMBER)
+    {
+        float value = (float)lua_tonumber(L, index);
+        for (int i = 0; i < n; i++) v[i] = value;
+    }
+    else
+    {
+        luaL_argcheck(L, lua_type(L, index) == LUA_TTABLE, index, lua_pushfstring(L, "Expected %s", vectorTypeNames[n]));
+
+        for (int i = 0; i < n; i++)
+        {
+            luaL_argcheck(L, lua_getfield(L, index, fields[i]) == LUA_TNUMBER, index, lua_pushfstring(L, "Expected %s.%s", vectorTypeNames[n], fields[i]));
+            v[i] = (float)lua_tonumber(L, -1);
+            lua_pop(L, 1);
+        }
+    }
 }
 
-// Set music loop count (loop repeats)
-int lua_SetMusicLoopCount(lua_State *L)
+static float VectorComponentsDot(const float *a, const float *b, int n)
 {
-    Music music = LuaGetArgument_Music(L, 1);
-    int count = LuaGetArgument_int(L, 2);
-    SetMusicLoopCount(music, count);
-    return 0;
+    float result = 0.0f;
+    for (int i = 0; i < n; i++) result += a[i]*b[i];
+    return result;
 }
 
-// Get music time length (in seconds)
-int lua_GetMusicTimeLength(lua_State *L)
+// Normalize vector components in place (zero vector is kept)
+static void VectorComponentsNormalize(float *v, int n)
 {
-    Music music = LuaGetArgument_Music(L, 1);
-    float result = GetMusicTimeLength(music);
-    LuaPush_float(L, result);
-    return 1;
+    float length = sqrtf(VectorComponentsDot(v, v, n));
+
+    if (length > 0.0f)
+    {
+        for (int i = 0; i < n; i++) v[i] /= length;
+    }
 }
 
-// Get current music time played (in seconds)
-int lua_GetMusicTimePlayed(lua_State *L)
+// Vectors addition: a + b (numbers are added to all components)
+static int LuaVectorAdd(lua_State *L)
 {
-    Music music = LuaGetArgument_Music(L, 1);
-    float result = GetMusicTimePlayed(music);
-    LuaPush_float(L, result);
+    int n = VECTOR_COMPONENTS(L);
+    float a[4], b[4];
+    LuaGetVectorOperand(L, 1, n, a);
+    LuaGetVectorOperand(L, 2, n, b);
+    float *result = LuaPushVector(L, n);
+    for (int i = 0; i < n; i++) result[i] = a[i] + b[i];
     return 1;
 }
 
-// AudioStream management functions
-// Init audio stream (to stream raw audio pcm data)
-int lua_InitAudioStream(lua_State *L)
+// Vectors subtraction: a - b
+static int LuaVectorSub(lua_State *L)
 {
-    unsigned int sampleRate = LuaGetArgument_unsigned(L, 1);
-    unsigned int sampleSize = LuaGetArgument_unsigned(L, 2);
-    unsigned int channels = LuaGetArgument_unsigned(L, 3);
-    AudioStream result = InitAudioStream(sampleRate, sampleSize, channels);
-    LuaPush_AudioStream(L, result);
+    int n = VECTOR_COMPONENTS(L);
+    float a[4], b[4];
+    LuaGetVectorOperand(L, 1, n, a);
+    LuaGetVectorOperand(L, 2, n, b);
+    float *result = LuaPushVector(L, n);
+    for (int i = 0; i < n; i++) result[i] = a[i] - b[i];
     return 1;
 }
 
-// WARNING: Update audio stream buffers with data
-int lua_UpdateAudioStream(lua_State* L)
+// Vectors multiplication: a*b, components product (quaternions product for two quaternions), scaled by numbers
+static int LuaVectorMul(lua_State *L)
 {
-    // TODO: arg2 parameter is a void pointer...
-    
-    AudioStream arg1 = LuaGetArgument_AudioStream(L, 1);
-    void *arg2 = LuaGetArgument_ptr(L, 2);
-    int arg3 = LuaGetArgument_int(L, 3);
-    UpdateAudioStream(arg1, arg2, arg3);
-    return 0;
-}
+    int n = VECTOR_COMPONENTS(L);
+    float a[4], b[4];
+    LuaGetVectorOperand(L, 1, n, a);
+    LuaGetVectorOperand(L, 2, n, b);
+    float *result = LuaPushVector(L, n);
 
-// Close audio stream and free memory
-int lua_CloseAudioStream(lua_State *L)
-{
-    AudioStream stream = LuaGetArgument_AudioStream(L, 1);
-    CloseAudioStream(stream);
-    return 0;
-}
+    if ((n == 4) && (lua_type(L, 1) != LUA_TNUMBER) && (lua_type(L, 2) != LUA_TNUMBER))
+    {
+        Quaternion q = QuaternionMultiply((Quaternion){ a[0], a[1], a[2], a[3] }, (Quaternion){ b[0], b[1], b[2], b[3] });
+        memcpy(result, &q, sizeof(Quaternion));
+    }
+    else
+    {
+        for (int i = 0; i < n; i++) result[i] = a[i]*b[i];
+    }
 
-// Check if any audio stream buffers requires refill
-int lua_IsAudioBufferProcessed(lua_State *L)
-{
-    AudioStream stream = LuaGetArgument_AudioStream(L, 1);
-    bool result = IsAudioBufferProcessed(stream);
-    LuaPush_bool(L, result);
     return 1;
 }
 
-// Play audio stream
-int lua_PlayAudioStream(lua_State *L)
+// Vectors division: a/b, components quotient (numbers divide or are divided by all components)
+static int LuaVectorDiv(lua_State *L)
 {
-    AudioStream stream = LuaGetArgument_AudioStream(L, 1);
-    PlayAudioStream(stream);
-    return 0;
+    int n = VECTOR_COMPONENTS(L);
+    float a[4], b[4];
+    LuaGetVectorOperand(L, 1, n, a);
+    LuaGetVectorOperand(L, 2, n, b);
+    float *result = LuaPushVector(L, n);
+    for (int i = 0; i < n; i++) result[i] = a[i]/b[i];
+    return 1;
 }
 
-// Pause audio stream
-int lua_PauseAudioStream(lua_State *L)
+// Vector negation: -v
+static int LuaVectorUnm(lua_State *L)
 {
-    AudioStream stream = LuaGetArgument_AudioStream(L, 1);
-    PauseAudioStream(stream);
-    return 0;
+    int n = VECTOR_COMPONENTS(L);
+    const float *v = (const float *)luaL_checkudata(L, 1, vectorTypeNames[n]);
+    float *result = LuaPushVector(L, n);
+    for (int i = 0; i < n; i++) result[i] = -v[i];
+    return 1;
 }
 
-// Resume audio stream
-int lua_ResumeAudioStream(lua_State *L)
+// Vectors equality: a == b (same type and components)
+static int LuaVectorEq(lua_State *L)
 {
-    AudioStream stream = LuaGetArgument_AudioStream(L, 1);
-    ResumeAudioStream(stream);
-    return 0;
+    int n = VECTOR_COMPONENTS(L);
+    const float *a = (const float *)luaL_testudata(L, 1, vectorTypeNames[n]);
+    const float *b = (const float *)luaL_testudata(L, 2, vectorTypeNames[n]);
+    bool equal = (a != NULL) && (b != NULL);
+
+    for (int i = 0; equal && (i < n); i++) equal = (a[i] == b[i]);
+
+    LuaPush_bool(L, equal);
+    return 1;
 }
 
-// Check if audio stream is playing
-int lua_IsAudioStreamPlaying(lua_State *L)
+// Vector length: #v
+static int LuaVectorLength(lua_State *L)
 {
-    AudioStream stream = LuaGetArgument_AudioStream(L, 1);
-    bool result = IsAudioStreamPlaying(stream);
-    LuaPush_bool(L, result);
+    int n = VECTOR_COMPONENTS(L);
+    const float *v = (const float *)luaL_checkudata(L, 1, vectorTypeNames[n]);
+    LuaPush_float(L, sqrtf(VectorComponentsDot(v, v, n)));
     return 1;
 }
 
-// Stop audio stream
-int lua_StopAudioStream(lua_State *L)
+// Vector components and methods access: v.x, v:dot(w)...
+// NOTE: Upvalues are components count and methods table
+static int LuaVectorIndex(lua_State *L)
 {
-    AudioStream stream = LuaGetArgument_AudioStream(L, 1);
-    StopAudioStream(stream);
-    return 0;
+    int n = VECTOR_COMPONENTS(L);
+    const float *v = (const float *)lua_touserdata(L, 1);
+    size_t length = 0;
+    const char *key = (lua_type(L, 2) == LUA_TSTRING)? lua_tolstring(L, 2, &length) : NULL;
+
+    if ((key != NULL) && (length == 1))
+    {
+        int component = (key[0] == 'w')? 3 : (key[0] - 'x');
+
+        if ((component >= 0) && (component < n))
+        {
+            LuaPush_float(L, v[component]);
+            return 1;
+        }
+    }
+
+    lua_pushvalue(L, 2);
+    lua_rawget(L, lua_upvalueindex(2));
+    return 1;
 }
 
-// Set volume for audio stream (1.0 is max level)
-int lua_SetAudioStreamVolume(lua_State *L)
+// Vector components assignment: v.x = value
+static int LuaVectorNewIndex(lua_State *L)
 {
-    AudioStream stream = LuaGetArgument_AudioStream(L, 1);
-    float volume = LuaGetArgument_float(L, 2);
-    SetAudioStreamVolume(stream, volume);
+    int n = VECTOR_COMPONENTS(L);
+    float *v = (float *)lua_touserdata(L, 1);
+    const char *key = luaL_checkstring(L, 2);
+    int component = (key[0] == 'w')? 3 : (key[0] - 'x');
+
+    luaL_argcheck(L, (key[0] != '\0') && (key[1] == '\0') && (component >= 0) && (component < n), 2, lua_pushfstring(L, "Unknown %s field", vectorTypeNames[n]));
+    v[component] = LuaGetArgument_float(L, 3);
     return 0;
 }
 
-// Set pitch for audio stream (1.0 is base level)
-int lua_SetAudioStreamPitch(lua_State *L)
+static int LuaVectorToString(lua_State *L)
 {
-    AudioStream stream = LuaGetArgument_AudioStream(L, 1);
-    float pitch = LuaGetArgument_float(L, 2);
-    SetAudioStreamPitch(stream, pitch);
-    return 0;
-}
+    int n = VECTOR_COMPONENTS(L);
+    const float *v = (const float *)luaL_checkudata(L, 1, vectorTypeNames[n]);
+    char text[128];
 
-// TODO: FROM HERE DOWN!
+    if (n == 2) snprintf(text, sizeof(text), "Vector2(%g, %g)", v[0], v[1]);
+    else if (n == 3) snprintf(text, sizeof(text), "Vector3(%g, %g, %g)", v[0], v[1], v[2]);
+    else snprintf(text, sizeof(text), "Quaternion(%g, %g, %g, %g)", v[0], v[1], v[2], v[3]);
 
-//----------------------------------------------------------------------------------
-// Module Functions Definition - Utils math
-//----------------------------------------------------------------------------------
-int lua_Clamp(lua_State* L)
-{
-    float arg1 = LuaGetArgument_float(L, 1);
-    float arg2 = LuaGetArgument_float(L, 2);
-    float arg3 = LuaGetArgument_float(L, 3);
-    float result = Clamp(arg1, arg2, arg3);
-    LuaPush_float(L, result);
+    lua_pushstring(L, text);
     return 1;
 }
 
-//----------------------------------------------------------------------------------
-// Module Functions Definition - Vector2 math
-//----------------------------------------------------------------------------------
-int lua_Vector2Zero(lua_State* L)
+// Vectors dot product: v:dot(w)
+static int LuaVectorDot(lua_State *L)
 {
-    Vector2 result = Vector2Zero();
-    LuaPush_Vector2(L, result);
+    int n = VECTOR_COMPONENTS(L);
+    const float *v = (const float *)luaL_checkudata(L, 1, vectorTypeNames[n]);
+    float w[4];
+    LuaGetVectorOperand(L, 2, n, w);
+    LuaPush_float(L, VectorComponentsDot(v, w, n));
     return 1;
 }
 
-int lua_Vector2One(lua_State* L)
+// Vectors cross product: v:cross(w) -> Vector3 (Vector3), number (Vector2, z component of 3d cross product)
+static int LuaVectorCross(lua_State *L)
 {
-    Vector2 result = Vector2One();
-    LuaPush_Vector2(L, result);
-    return 1;
-}
+    int n = VECTOR_COMPONENTS(L);
+    const float *v = (const float *)luaL_checkudata(L, 1, vectorTypeNames[n]);
+    float w[4];
+    LuaGetVectorOperand(L, 2, n, w);
+
+    if (n == 2)
+    {
+        LuaPush_float(L, v[0]*w[1] - v[1]*w[0]);
+    }
+    else
+    {
+        float *result = LuaPushVector(L, 3);
+        result[0] = v[1]*w[2] - v[2]*w[1];
+        result[1] = v[2]*w[0] - v[0]*w[2];
+        result[2] = v[0]*w[1] - v[1]*w[0];
+    }
 
-int lua_Vector2Add(lua_State* L)
-{
-    Vector2 arg1 = LuaGetArgument_Vector2(L, 1);
-    Vector2 arg2 = LuaGetArgument_Vector2(L, 2);
-    Vector2 result = Vector2Add(arg1, arg2);
-    LuaPush_Vector2(L, result);
     return 1;
 }
 
-int lua_Vector2Subtract(lua_State* L)
+// Vector length: v:length()
+static int LuaVectorLengthMethod(lua_State *L)
 {
-    Vector2 arg1 = LuaGetArgument_Vector2(L, 1);
-    Vector2 arg2 = LuaGetArgument_Vector2(L, 2);
-    Vector2 result = Vector2Subtract(arg1, arg2);
-    LuaPush_Vector2(L, result);
-    return 1;
+    return LuaVectorLength(L);
 }
 
-int lua_Vector2Lenght(lua_State* L)
+// Normalized vector: v:normalize() -> new vector
+static int LuaVectorNormalize(lua_State *L)
 {
-    Vector2 arg1 = LuaGetArgument_Vector2(L, 1);
-    float result = Vector2Lenght(arg1);
-    LuaPush_float(L, result);
+    int n = VECTOR_COMPONENTS(L);
+    const float *v = (const float *)luaL_checkudata(L, 1, vectorTypeNames[n]);
+    float *result = LuaPushVector(L, n);
+    memcpy(result, v, n*sizeof(float));
+    VectorComponentsNormalize(result, n);
     return 1;
 }
 
-int lua_Vector2DotProduct(lua_State* L)
+// Vectors linear interpolation: v:lerp(w, amount) -> new vector
+static int LuaVectorLerp(lua_State *L)
 {
-    Vector2 arg1 = LuaGetArgument_Vector2(L, 1);
-    Vector2 arg2 = LuaGetArgument_Vector2(L, 2);
-    float result = Vector2DotProduct(arg1, arg2);
-    LuaPush_float(L, result);
+    int n = VECTOR_COMPONENTS(L);
+    const float *v = (const float *)luaL_checkudata(L, 1, vectorTypeNames[n]);
+    float w[4];
+    LuaGetVectorOperand(L, 2, n, w);
+    float amount = LuaGetArgument_float(L, 3);
+    float *result = LuaPushVector(L, n);
+    for (int i = 0; i < n; i++) result[i] = v[i] + amount*(w[i] - v[i]);
     return 1;
 }
 
-int lua_Vector2Distance(lua_State* L)
+// Vector components: v:unpack() -> x, y[, z[, w]]
+static int LuaVectorUnpack(lua_State *L)
 {
-    Vector2 arg1 = LuaGetArgument_Vector2(L, 1);
-    Vector2 arg2 = LuaGetArgument_Vector2(L, 2);
-    float result = Vector2Distance(arg1, arg2);
-    LuaPush_float(L, result);
-    return 1;
+    int n = VECTOR_COMPONENTS(L);
+    const float *v = (const float *)luaL_checkudata(L, 1, vectorTypeNames[n]);
+    for (int i = 0; i < n; i++) LuaPush_float(L, v[i]);
+    return n;
 }
 
-int lua_Vector2Angle(lua_State* L)
+// In-place operations, no allocation (vector itself is returned for chaining)
+// Set vector components: v:set(x, y[, z[, w]]) or v:set(w)
+static int LuaVectorSet(lua_State *L)
 {
-    Vector2 arg1 = LuaGetArgument_Vector2(L, 1);
-    Vector2 arg2 = LuaGetArgument_Vector2(L, 2);
-    float result = Vector2Angle(arg1, arg2);
-    LuaPush_float(L, result);
+    int n = VECTOR_COMPONENTS(L);
+    float *v = (float *)luaL_checkudata(L, 1, vectorTypeNames[n]);
+
+    if (lua_type(L, 2) == LUA_TNUMBER)
+    {
+        for (int i = 0; i < n; i++) v[i] = LuaGetArgument_float(L, i + 2);
+    }
+    else LuaGetVectorOperand(L, 2, n, v);
+
+    lua_settop(L, 1);
     return 1;
 }
 
-int lua_Vector2Scale(lua_State* L)
+// Add to vector: v:addInPlace(w)
+static int LuaVectorAddInPlace(lua_State *L)
 {
-    Vector2 arg1 = LuaGetArgument_Vector2(L, 1);
-    float arg2 = LuaGetArgument_float(L, 2);
-    Vector2Scale(&arg1, arg2);
-    LuaPush_Vector2(L, arg1);
+    int n = VECTOR_COMPONENTS(L);
+    float *v = (float *)luaL_checkudata(L, 1, vectorTypeNames[n]);
+    float w[4];
+    LuaGetVectorOperand(L, 2, n, w);
+    for (int i = 0; i < n; i++) v[i] += w[i];
+    lua_settop(L, 1);
     return 1;
 }
 
-int lua_Vector2Negate(lua_State* L)
+// Subtract from vector: v:subInPlace(w)
+static int LuaVectorSubInPlace(lua_State *L)
 {
-    Vector2 arg1 = LuaGetArgument_Vector2(L, 1);
-    Vector2Negate(&arg1);
-    LuaPush_Vector2(L, arg1);
+    int n = VECTOR_COMPONENTS(L);
+    float *v = (float *)luaL_checkudata(L, 1, vectorTypeNames[n]);
+    float w[4];
+    LuaGetVectorOperand(L, 2, n, w);
+    for (int i = 0; i < n; i++) v[i] -= w[i];
+    lua_settop(L, 1);
     return 1;
 }
 
-int lua_Vector2Divide(lua_State* L)
+// Scale vector by a number or by components: v:scaleInPlace(scale)
+static int LuaVectorScaleInPlace(lua_State *L)
 {
-    Vector2 arg1 = LuaGetArgument_Vector2(L, 1);
-    float arg2 = LuaGetArgument_float(L, 2);
-    Vector2Divide(&arg1, arg2);
-    LuaPush_Vector2(L, arg1);
+    int n = VECTOR_COMPONENTS(L);
+    float *v = (float *)luaL_checkudata(L, 1, vectorTypeNames[n]);
+    float w[4];
+    LuaGetVectorOperand(L, 2, n, w);
+    for (int i = 0; i < n; i++) v[i] *= w[i];
+    lua_settop(L, 1);
     return 1;
 }
 
-int lua_Vector2Normalize(lua_State* L)
+// Normalize vector: v:normalizeInPlace()
+static int LuaVectorNormalizeInPlace(lua_State *L)
 {
-    Vector2 arg1 = LuaGetArgument_Vector2(L, 1);
-    Vector2Normalize(&arg1);
-    LuaPush_Vector2(L, arg1);
+    int n = VECTOR_COMPONENTS(L);
+    float *v = (float *)luaL_checkudata(L, 1, vectorTypeNames[n]);
+    VectorComponentsNormalize(v, n);
+    lua_settop(L, 1);
     return 1;
 }
 
-//----------------------------------------------------------------------------------
-// raylib [raymath] module functions - Vector3 math
-//----------------------------------------------------------------------------------
-int lua_VectorZero(lua_State* L)
+// Interpolate vector towards another: v:lerpInPlace(w, amount)
+static int LuaVectorLerpInPlace(lua_State *L)
 {
-    Vector3 result = VectorZero();
-    LuaPush_Vector3(L, result);
+    int n = VECTOR_COMPONENTS(L);
+    float *v = (float *)luaL_checkudata(L, 1, vectorTypeNames[n]);
+    float w[4];
+    LuaGetVectorOperand(L, 2, n, w);
+    float amount = LuaGetArgument_float(L, 3);
+    for (int i = 0; i < n; i++) v[i] += amount*(w[i] - v[i]);
+    lua_settop(L, 1);
     return 1;
 }
 
-int lua_VectorOne(lua_State* L)
+// Build vector userdata metatable for n components (2: Vector2, 3: Vector3, 4: Quaternion)
+static void LuaBuildVectorMetatable(lua_State *L, int n)
 {
-    Vector3 result = VectorOne();
-    LuaPush_Vector3(L, result);
-    return 1;
+    static const luaL_Reg metamethods[] = {
+        { "__add", LuaVectorAdd }, { "__sub", LuaVectorSub }, { "__mul", LuaVectorMul }, { "__div", LuaVectorDiv },
+        { "__unm", LuaVectorUnm }, { "__eq", LuaVectorEq }, { "__len", LuaVectorLength }, { "__newindex", LuaVectorNewIndex },
+        { "__tostring", LuaVectorToString }, { NULL, NULL }
+    };
+    static const luaL_Reg methods[] = {
+        { "dot", LuaVectorDot }, { "length", LuaVectorLengthMethod }, { "normalize", LuaVectorNormalize }, { "lerp", LuaVectorLerp },
+        { "unpack", LuaVectorUnpack }, { "set", LuaVectorSet }, { "addInPlace", LuaVectorAddInPlace }, { "subInPlace", LuaVectorSubInPlace },
+        { "scaleInPlace", LuaVectorScaleInPlace }, { "normalizeInPlace", LuaVectorNormalizeInPlace }, { "lerpInPlace", LuaVectorLerpInPlace },
+        { NULL, NULL }
+    };
+
+    luaL_newmetatable(L, vectorTypeNames[n]);
+    lua_pushinteger(L, n);
+    luaL_setfuncs(L, metamethods, 1);
+
+    lua_pushinteger(L, n);
+    lua_newtable(L);
+    lua_pushinteger(L, n);
+    luaL_setfuncs(L, methods, 1);
+
+    // NOTE: Cross product is not defined for quaternions
+    if (n < 4)
+    {
+        lua_pushinteger(L, n);
+        lua_pushcclosure(L, LuaVectorCross, 1);
+        lua_setfield(L, -2, "cross");
+    }
+
+    lua_pushcclosure(L, LuaVectorIndex, 2);
+    lua_setfield(L, -2, "__index");
+    lua_pop(L, 1);
 }
 
-int lua_VectorAdd(lua_State* L)
+//----------------------------------------------------------------------------------
+// raylib-lua [raymath] module functions - Matrix userdata
+//----------------------------------------------------------------------------------
+
+// Get matrix operand: Matrix userdata (no copy) or table of 16 numbers (decoded into scratch)
+static const Matrix *LuaGetMatrixOperand(lua_State *L, int index, Matrix *scratch)
 {
-    Vector3 arg1 = LuaGetArgument_Vector3(L, 1);
-    Vector3 arg2 = LuaGetArgument_Vector3(L, 2);
-    Vector3 result = VectorAdd(arg1, arg2);
-    LuaPush_Vector3(L, result);
-    return 1;
+    const Matrix *matrix = (const Matrix *)luaL_testudata(L, index, "Matrix");
+    if (matrix != NULL) return matrix;
+
+    *scratch = LuaGetArgument_Matrix(L, index);
+    return scratch;
 }
 
-int lua_VectorSubtract(lua_State* L)
+// Matrices multiplication: a*b (MatrixMultiply()), matrix*vector transforms a Vector3 (as point)
+static int LuaMatrixMul(lua_State *L)
 {
-    Vector3 arg1 = LuaGetArgument_Vector3(L, 1);
-    Vector3 arg2 = LuaGetArgument_Vector3(L, 2);
-    Vector3 result = VectorSubtract(arg1, arg2);
-    LuaPush_Vector3(L, result);
+    Matrix scratch = { 0 };
+    const Matrix *a = LuaGetMatrixOperand(L, 1, &scratch);
+
+    // NOTE: Vector3 tables have no array part (matrix tables have 16 numbers)
+    bool vector = (luaL_testudata(L, 2, "Vector3") != NULL) || ((lua_type(L, 2) == LUA_TTABLE) && (lua_rawlen(L, 2) == 0));
+
+    if (vector)
+    {
+        Vector3 v = LuaGetArgument_Vector3(L, 2);
+        Vector3 *result = (Vector3 *)lua_newuserdata(L, sizeof(Vector3));
+        result->x = a->m0*v.x + a->m4*v.y + a->m8*v.z + a->m12;
+        result->y = a->m1*v.x + a->m5*v.y + a->m9*v.z + a->m13;
+        result->z = a->m2*v.x + a->m6*v.y + a->m10*v.z + a->m14;
+        luaL_setmetatable(L, "Vector3");
+        return 1;
+    }
+
+    Matrix other = { 0 };
+    Matrix result = MatrixMultiply(*a, *LuaGetMatrixOperand(L, 2, &other));
+    LuaPush_Matrix(L, &result);
     return 1;
 }
 
-int lua_VectorCrossProduct(lua_State* L)
+// Matrices equality: a == b
+static int LuaMatrixEq(lua_State *L)
 {
-    Vector3 arg1 = LuaGetArgument_Vector3(L, 1);
-    Vector3 arg2 = LuaGetArgument_Vector3(L, 2);
-    Vector3 result = VectorCrossProduct(arg1, arg2);
-    LuaPush_Vector3(L, result);
+    const float *a = (const float *)luaL_testudata(L, 1, "Matrix");
+    const float *b = (const float *)luaL_testudata(L, 2, "Matrix");
+    bool equal = (a != NULL) && (b != NULL);
+
+    for (int i = 0; equal && (i < 16); i++) equal = (a[i] == b[i]);
+
+    LuaPush_bool(L, equal);
     return 1;
 }
 
-int lua_VectorPerpendicular(lua_State* L)
+// Matrix elements count: #m (16)
+static int LuaMatrixLength(lua_State *L)
 {
-    Vector3 arg1 = LuaGetArgument_Vector3(L, 1);
-    Vector3 result = VectorPerpendicular(arg1);
-    LuaPush_Vector3(L, result);
+    LuaPush_int(L, 16);
     return 1;
 }
 
-int lua_VectorDotProduct(lua_State* L)
+// Matrix elements and methods access: m[1]..m[16] (same order as tables, Matrix struct fields order), m:translateInPlace()...
+// NOTE: Upvalue is methods table
+static int LuaMatrixIndex(lua_State *L)
 {
-    Vector3 arg1 = LuaGetArgument_Vector3(L, 1);
-    Vector3 arg2 = LuaGetArgument_Vector3(L, 2);
-    float result = VectorDotProduct(arg1, arg2);
-    LuaPush_float(L, result);
+    const float *m = (const float *)lua_touserdata(L, 1);
+
+    if (lua_type(L, 2) == LUA_TNUMBER)
+    {
+        lua_Integer i = lua_tointeger(L, 2);
+
+        if ((i >= 1) && (i <= 16))
+        {
+            LuaPush_float(L, m[i - 1]);
+        }
+        else lua_pushnil(L);
+
+        return 1;
+    }
+
+    lua_pushvalue(L, 2);
+    lua_rawget(L, lua_upvalueindex(1));
     return 1;
 }
 
-int lua_VectorLength(lua_State* L)
+// Matrix elements assignment: m[i] = value
+static int LuaMatrixNewIndex(lua_State *L)
 {
-    const Vector3 arg1 = LuaGetArgument_Vector3(L, 1);
-    float result = VectorLength(arg1);
-    LuaPush_float(L, result);
-    return 1;
+    float *m = (float *)lua_touserdata(L, 1);
+    lua_Integer i = luaL_checkinteger(L, 2);
+    luaL_argcheck(L, (i >= 1) && (i <= 16), 2, "Expected Matrix index in [1..16]");
+    m[i - 1] = LuaGetArgument_float(L, 3);
+    return 0;
 }
 
-int lua_VectorScale(lua_State* L)
+// Matrix elements: m:unpack() -> 16 numbers
+static int LuaMatrixUnpack(lua_State *L)
 {
-    Vector3 arg1 = LuaGetArgument_Vector3(L, 1);
-    float arg2 = LuaGetArgument_float(L, 2);
-    VectorScale(&arg1, arg2);
-    LuaPush_Vector3(L, arg1);
-    return 1;
+    const float *m = (const float *)luaL_checkudata(L, 1, "Matrix");
+    luaL_checkstack(L, 16, NULL);
+    for (int i = 0; i < 16; i++) LuaPush_float(L, m[i]);
+    return 16;
 }
 
-int lua_VectorNegate(lua_State* L)
+// In-place operations, no allocation (matrix itself is returned for chaining)
+// NOTE: Transformations are applied after current matrix, as MatrixMultiply(matrix, transform)
+// Set matrix elements: m:set(other) or m:set() for identity
+static int LuaMatrixSet(lua_State *L)
 {
-    Vector3 arg1 = LuaGetArgument_Vector3(L, 1);
-    VectorNegate(&arg1);
-    LuaPush_Vector3(L, arg1);
+    Matrix *m = (Matrix *)luaL_checkudata(L, 1, "Matrix");
+    Matrix scratch = { 0 };
+
+    if (lua_isnoneornil(L, 2)) *m = MatrixIdentity();
+    else *m = *LuaGetMatrixOperand(L, 2, &scratch);
+
+    lua_settop(L, 1);
     return 1;
 }
 
-int lua_VectorNormalize(lua_State* L)
-{
-    Vector3 arg1 = LuaGetArgument_Vector3(L, 1);
-    VectorNormalize(&arg1);
-    LuaPush_Vector3(L, arg1);
+// Multiply matrix by other: m:multiplyInPlace(other)
+static int LuaMatrixMultiplyInPlace(lua_State *L)
+{
+    Matrix *m = (Matrix *)luaL_checkudata(L, 1, "Matrix");
+    Matrix scratch = { 0 };
+    *m = MatrixMultiply(*m, *LuaGetMatrixOperand(L, 2, &scratch));
+    lua_settop(L, 1);
     return 1;
 }
 
-int lua_VectorDistance(lua_State* L)
+// Translate matrix: m:translateInPlace(x, y, z)
+static int LuaMatrixTranslateInPlace(lua_State *L)
 {
-    Vector3 arg1 = LuaGetArgument_Vector3(L, 1);
-    Vector3 arg2 = LuaGetArgument_Vector3(L, 2);
-    float result = VectorDistance(arg1, arg2);
-    LuaPush_float(L, result);
+    Matrix *m = (Matrix *)luaL_checkudata(L, 1, "Matrix");
+    float x = LuaGetArgument_float(L, 2);
+    float y = LuaGetArgument_float(L, 3);
+    float z = LuaGetArgument_float(L, 4);
+    *m = MatrixMultiply(*m, MatrixTranslate(x, y, z));
+    lua_settop(L, 1);
     return 1;
 }
 
-int lua_VectorLerp(lua_State* L)
+// Rotate matrix around axis (angle in radians): m:rotateInPlace(axis, angle)
+static int LuaMatrixRotateInPlace(lua_State *L)
 {
-    Vector3 arg1 = LuaGetArgument_Vector3(L, 1);
-    Vector3 arg2 = LuaGetArgument_Vector3(L, 2);
-    float arg3 = LuaGetArgument_float(L, 3);
-    Vector3 result = VectorLerp(arg1, arg2, arg3);
-    LuaPush_Vector3(L, result);
+    Matrix *m = (Matrix *)luaL_checkudata(L, 1, "Matrix");
+    Vector3 axis = LuaGetArgument_Vector3(L, 2);
+    float angle = LuaGetArgument_float(L, 3);
+    *m = MatrixMultiply(*m, MatrixRotate(axis, angle));
+    lua_settop(L, 1);
     return 1;
 }
 
-int lua_VectorReflect(lua_State* L)
+// Scale matrix: m:scaleInPlace(x, y, z)
+static int LuaMatrixScaleInPlace(lua_State *L)
 {
-    Vector3 arg1 = LuaGetArgument_Vector3(L, 1);
-    Vector3 arg2 = LuaGetArgument_Vector3(L, 2);
-    Vector3 result = VectorReflect(arg1, arg2);
-    LuaPush_Vector3(L, result);
+    Matrix *m = (Matrix *)luaL_checkudata(L, 1, "Matrix");
+    float x = LuaGetArgument_float(L, 2);
+    float y = LuaGetArgument_float(L, 3);
+    float z = LuaGetArgument_float(L, 4);
+    *m = MatrixMultiply(*m, MatrixScale(x, y, z));
+    lua_settop(L, 1);
     return 1;
 }
 
-int lua_VectorTransform(lua_State* L)
+// Invert matrix: m:invertInPlace()
+static int LuaMatrixInvertInPlace(lua_State *L)
 {
-    Vector3 arg1 = LuaGetArgument_Vector3(L, 1);
-    Matrix arg2 = LuaGetArgument_Matrix(L, 2);
-    VectorTransform(&arg1, arg2);
-    LuaPush_Vector3(L, arg1);
+    Matrix *m = (Matrix *)luaL_checkudata(L, 1, "Matrix");
+    MatrixInvert(m);
+    lua_settop(L, 1);
     return 1;
 }
 
-//----------------------------------------------------------------------------------
-// raylib [raymath] module functions - Matrix math
-//----------------------------------------------------------------------------------
-int lua_MatrixDeterminant(lua_State* L)
+// Transpose matrix: m:transposeInPlace()
+static int LuaMatrixTransposeInPlace(lua_State *L)
 {
-    Matrix arg1 = LuaGetArgument_Matrix(L, 1);
-    float result = MatrixDeterminant(arg1);
-    LuaPush_float(L, result);
+    Matrix *m = (Matrix *)luaL_checkudata(L, 1, "Matrix");
+    MatrixTranspose(m);
+    lua_settop(L, 1);
     return 1;
 }
 
-int lua_MatrixTrace(lua_State* L)
+// Build Matrix userdata metatable
+static void LuaBuildMatrixMetatable(lua_State *L)
 {
-    Matrix arg1 = LuaGetArgument_Matrix(L, 1);
-    float result = MatrixTrace(arg1);
-    LuaPush_float(L, result);
-    return 1;
+    static const luaL_Reg metamethods[] = {
+        { "__mul", LuaMatrixMul }, { "__eq", LuaMatrixEq }, { "__len", LuaMatrixLength }, { "__newindex", LuaMatrixNewIndex },
+        { NULL, NULL }
+    };
+    static const luaL_Reg methods[] = {
+        { "unpack", LuaMatrixUnpack }, { "set", LuaMatrixSet }, { "multiplyInPlace", LuaMatrixMultiplyInPlace },
+        { "translateInPlace", LuaMatrixTranslateInPlace }, { "rotateInPlace", LuaMatrixRotateInPlace },
+        { "scaleInPlace", LuaMatrixScaleInPlace }, { "invertInPlace", LuaMatrixInvertInPlace },
+        { "transposeInPlace", LuaMatrixTransposeInPlace }, { NULL, NULL }
+    };
+
+    luaL_newmetatable(L, "Matrix");
+    luaL_setfuncs(L, metamethods, 0);
+    luaL_newlib(L, methods);
+    lua_pushcclosure(L, LuaMatrixIndex, 1);
+    lua_setfield(L, -2, "__index");
+    lua_pop(L, 1);
 }
 
-int lua_MatrixTranspose(lua_State* L)
+//----------------------------------------------------------------------------------
+// raylib-lua [raymath] module functions - Batch math (typed buffers)
+//----------------------------------------------------------------------------------
+
+// Transform count points (3 floats each) by matrix, same as VectorTransform()
+static void TransformPointsKernel(Matrix mat, const float *src, float *dst, int count)
 {
-    Matrix arg1 = LuaGetArgument_Matrix(L, 1);
-    MatrixTranspose(&arg1);
-    LuaPush_Matrix(L, &arg1);
-    return 1;
+    int i = 0;
+
+#if defined(RLUA_SIMD)
+    Simd4 m0 = Simd4Set1(mat.m0), m4 = Simd4Set1(mat.m4), m8 = Simd4Set1(mat.m8), m12 = Simd4Set1(mat.m12);
+    Simd4 m1 = Simd4Set1(mat.m1), m5 = Simd4Set1(mat.m5), m9 = Simd4Set1(mat.m9), m13 = Simd4Set1(mat.m13);
+    Simd4 m2 = Simd4Set1(mat.m2), m6 = Simd4Set1(mat.m6), m10 = Simd4Set1(mat.m10), m14 = Simd4Set1(mat.m14);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        Simd4 v[3], r[3];
+        Simd4LoadVectors(src + 3*i, 3, v);
+        r[0] = Simd4Add(Simd4Add(Simd4Add(Simd4Mul(m0, v[0]), Simd4Mul(m4, v[1])), Simd4Mul(m8, v[2])), m12);
+        r[1] = Simd4Add(Simd4Add(Simd4Add(Simd4Mul(m1, v[0]), Simd4Mul(m5, v[1])), Simd4Mul(m9, v[2])), m13);
+        r[2] = Simd4Add(Simd4Add(Simd4Add(Simd4Mul(m2, v[0]), Simd4Mul(m6, v[1])), Simd4Mul(m10, v[2])), m14);
+        Simd4StoreVectors(dst + 3*i, 3, r);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        Vector3 v = { src[3*i], src[3*i + 1], src[3*i + 2] };
+        VectorTransform(&v, mat);
+        dst[3*i] = v.x;
+        dst[3*i + 1] = v.y;
+        dst[3*i + 2] = v.z;
+    }
 }
 
-int lua_MatrixInvert(lua_State* L)
+// Normalize count vectors of n components (2..4), zero length vectors are kept
+static void NormalizeVectorsKernel(const float *src, float *dst, int count, int n)
 {
-    Matrix arg1 = LuaGetArgument_Matrix(L, 1);
-    MatrixInvert(&arg1);
-    LuaPush_Matrix(L, &arg1);
-    return 1;
+    int i = 0;
+
+#if defined(RLUA_SIMD)
+    Simd4 one = Simd4Set1(1.0f);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        Simd4 v[4];
+        Simd4LoadVectors(src + n*i, n, v);
+
+        Simd4 lengthSqr = Simd4Mul(v[0], v[0]);
+        for (int c = 1; c < n; c++) lengthSqr = Simd4Add(lengthSqr, Simd4Mul(v[c], v[c]));
+
+        Simd4 inverse = Simd4Div(one, Simd4ReplaceZero(Simd4Sqrt(lengthSqr), one));
+        for (int c = 0; c < n; c++) v[c] = Simd4Mul(v[c], inverse);
+
+        Simd4StoreVectors(dst + n*i, n, v);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        const float *v = src + n*i;
+        float lengthSqr = 0.0f;
+        for (int c = 0; c < n; c++) lengthSqr += v[c]*v[c];
+
+        float length = sqrtf(lengthSqr);
+        float inverse = 1.0f/((length == 0.0f)? 1.0f : length);
+        for (int c = 0; c < n; c++) dst[n*i + c] = v[c]*inverse;
+    }
 }
 
-int lua_MatrixNormalize(lua_State* L)
+// Linear interpolation of count floats: dst = a + amount*(b - a)
+static void LerpFloatsKernel(const float *a, const float *b, float amount, float *dst, int count)
 {
-    Matrix arg1 = LuaGetArgument_Matrix(L, 1);
-    MatrixNormalize(&arg1);
-    LuaPush_Matrix(L, &arg1);
-    return 1;
+    int i = 0;
+
+#if defined(RLUA_SIMD)
+    Simd4 t = Simd4Set1(amount);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        Simd4 va = Simd4Load(a + i);
+        Simd4Store(dst + i, Simd4Add(va, Simd4Mul(t, Simd4Sub(Simd4Load(b + i), va))));
+    }
+#endif
+
+    for (; i < count; i++) dst[i] = a[i] + amount*(b[i] - a[i]);
 }
 
-int lua_MatrixIdentity(lua_State* L)
+// Multiply count matrices (16 floats each, Matrix fields order), same as MatrixMultiply(left, right)
+// NOTE: Stride 0 uses the same matrix for all products, dst can be left or right
+static void MatrixMultiplyKernel(const float *left, int leftStride, const float *right, int rightStride, float *dst, int count)
 {
-    Matrix result = MatrixIdentity();
-    LuaPush_Matrix(L, &result);
-    return 1;
+    for (int i = 0; i < count; i++, left += leftStride, right += rightStride, dst += 16)
+    {
+#if defined(RLUA_SIMD)
+        // NOTE: Matrix fields order is transposed (m0, m4, m8, m12...), so dst rows are combinations of left rows
+        Simd4 l0 = Simd4Load(left), l1 = Simd4Load(left + 4), l2 = Simd4Load(left + 8), l3 = Simd4Load(left + 12);
+        Simd4 rows[4];
+
+        for (int r = 0; r < 4; r++)
+        {
+            const float *row = right + 4*r;
+            rows[r] = Simd4Add(Simd4Add(Simd4Mul(Simd4Set1(row[0]), l0), Simd4Mul(Simd4Set1(row[1]), l1)),
+                               Simd4Add(Simd4Mul(Simd4Set1(row[2]), l2), Simd4Mul(Simd4Set1(row[3]), l3)));
+        }
+
+        for (int r = 0; r < 4; r++) Simd4Store(dst + 4*r, rows[r]);
+#else
+        Matrix a, b;
+        memcpy(&a, left, sizeof(Matrix));
+        memcpy(&b, right, sizeof(Matrix));
+        Matrix result = MatrixMultiply(a, b);
+        memcpy(dst, &result, sizeof(Matrix));
+#endif
+    }
 }
 
-int lua_MatrixAdd(lua_State* L)
+// Get float buffer of vectors of n components, checking count is a multiple of n
+static TypedBuffer *LuaGetArgument_VectorsBuffer(lua_State *L, int index, int n)
 {
-    Matrix arg1 = LuaGetArgument_Matrix(L, 1);
-    Matrix arg2 = LuaGetArgument_Matrix(L, 2);
-    Matrix result = MatrixAdd(arg1, arg2);
-    LuaPush_Matrix(L, &result);
-    return 1;
+    TypedBuffer *buffer = LuaGetArgument_Buffer(L, index, BUFFER_FLOAT);
+    luaL_argcheck(L, (buffer->count%n) == 0, index, lua_pushfstring(L, "Expected %d floats per element", n));
+    return buffer;
 }
 
-int lua_MatrixSubstract(lua_State* L)
+// Transform points by matrix: TransformPoints(matrix, src, dst)
+// src and dst are FloatBuffers of Vector3 (3 floats per point, dst can be src)
+int lua_TransformPoints(lua_State *L)
 {
-    Matrix arg1 = LuaGetArgument_Matrix(L, 1);
-    Matrix arg2 = LuaGetArgument_Matrix(L, 2);
-    Matrix result = MatrixSubstract(arg1, arg2);
-    LuaPush_Matrix(L, &result);
-    return 1;
+    Matrix mat = LuaGetArgument_Matrix(L, 1);
+    TypedBuffer *src = LuaGetArgument_VectorsBuffer(L, 2, 3);
+    TypedBuffer *dst = LuaGetArgument_Buffer(L, 3, BUFFER_FLOAT);
+    luaL_argcheck(L, dst->count >= src->count, 3, "Expected dst buffer as large as src buffer");
+    TransformPointsKernel(mat, src->floats, dst->floats, src->count/3);
+    return 0;
 }
 
-int lua_MatrixTranslate(lua_State* L)
+// Normalize vectors: NormalizeVectors(src, dst[, components])
+// src and dst are FloatBuffers of vectors of components floats (2, 3 or 4, default 3), dst can be src
+int lua_NormalizeVectors(lua_State *L)
 {
-    float arg1 = LuaGetArgument_float(L, 1);
-    float arg2 = LuaGetArgument_float(L, 2);
-    float arg3 = LuaGetArgument_float(L, 3);
-    Matrix result = MatrixTranslate(arg1, arg2, arg3);
-    LuaPush_Matrix(L, &result);
-    return 1;
+    int n = (int)luaL_optinteger(L, 3, 3);
+    luaL_argcheck(L, (n >= 2) && (n <= 4), 3, "Expected 2, 3 or 4 components");
+    TypedBuffer *src = LuaGetArgument_VectorsBuffer(L, 1, n);
+    TypedBuffer *dst = LuaGetArgument_Buffer(L, 2, BUFFER_FLOAT);
+    luaL_argcheck(L, dst->count >= src->count, 2, "Expected dst buffer as large as src buffer");
+    NormalizeVectorsKernel(src->floats, dst->floats, src->count/n, n);
+    return 0;
 }
 
-int lua_MatrixRotate(lua_State* L)
+// Interpolate vectors linearly: LerpVectors(a, b, amount, dst)
+// a, b and dst are FloatBuffers of any vector type (interpolated per float), dst can be a or b
+int lua_LerpVectors(lua_State *L)
 {
-    Vector3 arg1 = LuaGetArgument_Vector3(L, 1);
-    float arg2 = LuaGetArgument_float(L, 2);
-    Matrix result = MatrixRotate(arg1, arg2);
-    LuaPush_Matrix(L, &result);
-    return 1;
+    TypedBuffer *a = LuaGetArgument_Buffer(L, 1, BUFFER_FLOAT);
+    TypedBuffer *b = LuaGetArgument_Buffer(L, 2, BUFFER_FLOAT);
+    float amount = LuaGetArgument_float(L, 3);
+    TypedBuffer *dst = LuaGetArgument_Buffer(L, 4, BUFFER_FLOAT);
+    luaL_argcheck(L, b->count == a->count, 2, "Expected buffers of same size");
+    luaL_argcheck(L, dst->count >= a->count, 4, "Expected dst buffer as large as src buffers");
+    LerpFloatsKernel(a->floats, b->floats, amount, dst->floats, a->count);
+    return 0;
 }
 
-int lua_MatrixRotateX(lua_State* L)
+// Spherical interpolation of quaternions: QuaternionSlerpBatch(a, b, amount, dst)
+// a, b and dst are FloatBuffers of Quaternion (4 floats per quaternion), dst can be a or b
+// NOTE: Scalar QuaternionSlerp() per quaternion (acos() and sin() per element)
+int lua_QuaternionSlerpBatch(lua_State *L)
 {
-    float arg1 = LuaGetArgument_float(L, 1);
-    Matrix result = MatrixRotateX(arg1);
-    LuaPush_Matrix(L, &result);
-    return 1;
+    TypedBuffer *a = LuaGetArgument_VectorsBuffer(L, 1, 4);
+    TypedBuffer *b = LuaGetArgument_VectorsBuffer(L, 2, 4);
+    float amount = LuaGetArgument_float(L, 3);
+    TypedBuffer *dst = LuaGetArgument_Buffer(L, 4, BUFFER_FLOAT);
+    luaL_argcheck(L, b->count == a->count, 2, "Expected buffers of same size");
+    luaL_argcheck(L, dst->count >= a->count, 4, "Expected dst buffer as large as src buffers");
+
+    for (int i = 0; i < a->count; i += 4)
+    {
+        Quaternion q1 = { a->floats[i], a->floats[i + 1], a->floats[i + 2], a->floats[i + 3] };
+        Quaternion q2 = { b->floats[i], b->floats[i + 1], b->floats[i + 2], b->floats[i + 3] };
+        Quaternion result = QuaternionSlerp(q1, q2, amount);
+        memcpy(dst->floats + i, &result, sizeof(Quaternion));
+    }
+
+    return 0;
 }
 
-int lua_MatrixRotateY(lua_State* L)
+// Get matrices batch operand: FloatBuffer of matrices (16 floats per matrix) or a Matrix (stride 0, count -1)
+static const float *LuaGetMatricesOperand(lua_State *L, int index, Matrix *shared, int *stride, int *count)
 {
-    float arg1 = LuaGetArgument_float(L, 1);
-    Matrix result = MatrixRotateY(arg1);
-    LuaPush_Matrix(L, &result);
-    return 1;
+    if ((lua_type(L, index) == LUA_TUSERDATA) && (luaL_testudata(L, index, "Matrix") == NULL))
+    {
+        TypedBuffer *buffer = LuaGetArgument_VectorsBuffer(L, index, 16);
+        *stride = 16;
+        *count = buffer->count/16;
+        return buffer->floats;
+    }
+
+    *shared = LuaGetArgument_Matrix(L, index);
+    *stride = 0;
+    *count = -1;
+    return &shared->m0;
 }
 
-int lua_MatrixRotateZ(lua_State* L)
+// Multiply matrices: MatrixMultiplyBatch(left, right, dst), same as MatrixMultiply(left, right) per matrix
+// left and right are FloatBuffers of matrices (16 floats per matrix) or a Matrix used for all, dst can be left or right
+int lua_MatrixMultiplyBatch(lua_State *L)
 {
-    float arg1 = LuaGetArgument_float(L, 1);
-    Matrix result = MatrixRotateZ(arg1);
-    LuaPush_Matrix(L, &result);
-    return 1;
+    Matrix sharedLeft = { 0 }, sharedRight = { 0 };
+    int leftStride = 0, rightStride = 0, leftCount = 0, rightCount = 0;
+    const float *left = LuaGetMatricesOperand(L, 1, &sharedLeft, &leftStride, &leftCount);
+    const float *right = LuaGetMatricesOperand(L, 2, &sharedRight, &rightStride, &rightCount);
+    TypedBuffer *dst = LuaGetArgument_Buffer(L, 3, BUFFER_FLOAT);
+
+    luaL_argcheck(L, (leftCount < 0) || (rightCount < 0) || (leftCount == rightCount), 2, "Expected buffers of same size");
+
+    int count = (leftCount >= 0)? leftCount : (rightCount >= 0)? rightCount : 1;
+    luaL_argcheck(L, dst->count >= 16*count, 3, "Expected dst buffer as large as src buffers");
+
+    MatrixMultiplyKernel(left, leftStride, right, rightStride, dst->floats, count);
+    return 0;
 }
 
-int lua_MatrixScale(lua_State* L)
+//----------------------------------------------------------------------------------
+// raylib-lua [raymath] module functions - Tweens
+//----------------------------------------------------------------------------------
+
+// Tween easing names, TweenCurve in/out/inOut variants (luaL_checkoption() order)
+static const char *tweenEasingNames[] = { "linear",
+    "quadIn", "quadOut", "quadInOut", "cubicIn", "cubicOut", "cubicInOut", "quartIn", "quartOut", "quartInOut",
+    "sineIn", "sineOut", "sineInOut", "expoIn", "expoOut", "expoInOut", "circIn", "circOut", "circInOut",
+    "backIn", "backOut", "backInOut", "elasticIn", "elasticOut", "elasticInOut", "bounceIn", "bounceOut", "bounceInOut", NULL };
+
+// Ease in curve (Robert Penner's easing equations), t in [0, 1]
+static float TweenEaseIn(int curve, float t)
 {
-    float arg1 = LuaGetArgument_float(L, 1);
-    float arg2 = LuaGetArgument_float(L, 2);
-    float arg3 = LuaGetArgument_float(L, 3);
-    Matrix result = MatrixScale(arg1, arg2, arg3);
-    LuaPush_Matrix(L, &result);
-    return 1;
+    switch (curve)
+    {
+        case EASE_QUAD: return t*t;
+        case EASE_CUBIC: return t*t*t;
+        case EASE_QUART: return t*t*t*t;
+        case EASE_SINE: return 1.0f - cosf(t*PI/2.0f);
+        case EASE_EXPO: return (t <= 0.0f)? 0.0f : powf(2.0f, 10.0f*t - 10.0f);
+        case EASE_CIRC: return 1.0f - sqrtf(1.0f - t*t);
+        case EASE_BACK: return t*t*(2.70158f*t - 1.70158f);
+        case EASE_ELASTIC:
+        {
+            if ((t <= 0.0f) || (t >= 1.0f)) return t;
+            return -powf(2.0f, 10.0f*t - 10.0f)*sinf((10.0f*t - 10.75f)*2.0f*PI/3.0f);
+        }
+        case EASE_BOUNCE:
+        {
+            // Bounce is defined as ease out curve: in(t) = 1 - out(1 - t)
+            float s = 1.0f - t;
+            float out = 0.0f;
+
+            if (s < 1.0f/2.75f) out = 7.5625f*s*s;
+            else if (s < 2.0f/2.75f) { s -= 1.5f/2.75f; out = 7.5625f*s*s + 0.75f; }
+            else if (s < 2.5f/2.75f) { s -= 2.25f/2.75f; out = 7.5625f*s*s + 0.9375f; }
+            else { s -= 2.625f/2.75f; out = 7.5625f*s*s + 0.984375f; }
+
+            return 1.0f - out;
+        }
+        default: return t;
+    }
 }
 
-int lua_MatrixMultiply(lua_State* L)
+// Ease tween progress, out and inOut variants are derived from ease in curve
+static float TweenEase(int easing, float t)
 {
-    Matrix arg1 = LuaGetArgument_Matrix(L, 1);
-    Matrix arg2 = LuaGetArgument_Matrix(L, 2);
-    Matrix result = MatrixMultiply(arg1, arg2);
-    LuaPush_Matrix(L, &result);
-    return 1;
+    if (easing == EASE_LINEAR) return t;
+
+    int curve = EASE_QUAD + (easing - 1)/3;
+
+    switch ((easing - 1)%3)
+    {
+        case 0: return TweenEaseIn(curve, t);
+        case 1: return 1.0f - TweenEaseIn(curve, 1.0f - t);
+        default: return (t < 0.5f)? 0.5f*TweenEaseIn(curve, 2.0f*t) : 1.0f - 0.5f*TweenEaseIn(curve, 2.0f - 2.0f*t);
+    }
 }
 
-int lua_MatrixFrustum(lua_State* L)
+// Free tween slot (target reference removed from targets table at targetsIndex)
+static void TweenFree(lua_State *L, TweenSystem *system, int slot, int targetsIndex)
 {
-    double arg1 = LuaGetArgument_double(L, 1);
-    double arg2 = LuaGetArgument_double(L, 2);
-    double arg3 = LuaGetArgument_double(L, 3);
-    double arg4 = LuaGetArgument_double(L, 4);
-    double arg5 = LuaGetArgument_double(L, 5);
-    double arg6 = LuaGetArgument_double(L, 6);
-    Matrix result = MatrixFrustum(arg1, arg2, arg3, arg4, arg5, arg6);
-    LuaPush_Matrix(L, &result);
-    return 1;
+    system->state[slot] = TWEEN_FREE;
+    system->generations[slot]++;
+    system->siblings[slot] = system->freeSlot;
+    system->freeSlot = slot;
+    system->count--;
+
+    lua_pushnil(L);
+    lua_rawseti(L, targetsIndex, slot + 1);
 }
 
-int lua_MatrixPerspective(lua_State* L)
+// Remove waiting tween from its leader followers list
+static void TweenUnlink(TweenSystem *system, int slot)
 {
-    double arg1 = LuaGetArgument_double(L, 1);
-    double arg2 = LuaGetArgument_double(L, 2);
-    double arg3 = LuaGetArgument_double(L, 3);
-    double arg4 = LuaGetArgument_double(L, 4);
-    Matrix result = MatrixPerspective(arg1, arg2, arg3, arg4);
-    LuaPush_Matrix(L, &result);
-    return 1;
+    int *link = &system->followers[system->leaders[slot]];
+
+    while (*link != slot) link = &system->siblings[*link];
+    *link = system->siblings[slot];
 }
 
-int lua_MatrixOrtho(lua_State* L)
+// Cancel tween and tweens sequenced after it
+static void TweenCancel(lua_State *L, TweenSystem *system, int slot, int targetsIndex)
 {
-    double arg1 = LuaGetArgument_double(L, 1);
-    double arg2 = LuaGetArgument_double(L, 2);
-    double arg3 = LuaGetArgument_double(L, 3);
-    double arg4 = LuaGetArgument_double(L, 4);
-    double arg5 = LuaGetArgument_double(L, 5);
-    double arg6 = LuaGetArgument_double(L, 6);
-    Matrix result = MatrixOrtho(arg1, arg2, arg3, arg4, arg5, arg6);
-    LuaPush_Matrix(L, &result);
-    return 1;
+    if (system->state[slot] == TWEEN_WAITING) TweenUnlink(system, slot);
+
+    // NOTE: Followers unlink themselves from this tween list when cancelled
+    while (system->followers[slot] >= 0) TweenCancel(L, system, system->followers[slot], targetsIndex);
+
+    TweenFree(L, system, slot, targetsIndex);
 }
 
-int lua_MatrixLookAt(lua_State* L)
+// End tween, tweens sequenced after it start with remaining time
+// NOTE: Followers after current slot are advanced later in same update pass, remaining time is adjusted for it
+static void TweenEnd(lua_State *L, TweenSystem *system, int slot, float remaining, float dt, int targetsIndex)
 {
-    Vector3 arg1 = LuaGetArgument_Vector3(L, 1);
-    Vector3 arg2 = LuaGetArgument_Vector3(L, 2);
-    Vector3 arg3 = LuaGetArgument_Vector3(L, 3);
-    Matrix result = MatrixLookAt(arg1, arg2, arg3);
-    LuaPush_Matrix(L, &result);
-    return 1;
+    for (int follower = system->followers[slot]; follower >= 0; follower = system->siblings[follower])
+    {
+        system->state[follower] = TWEEN_RUNNING;
+        system->elapsed[follower] = (follower > slot)? (remaining - dt) : remaining;
+    }
+
+    system->followers[slot] = -1;
+    TweenFree(L, system, slot, targetsIndex);
 }
 
-//----------------------------------------------------------------------------------
-// raylib [raymath] module functions - Quaternion math
-//----------------------------------------------------------------------------------
-int lua_QuaternionLength(lua_State* L)
+// Advance all running tweens and write their targets, one pass over tweens arrays
+// NOTE: Targets table (system user value) must be at targetsIndex, ended tweens references are removed
+static void TweensUpdate(lua_State *L, TweenSystem *system, float dt, int targetsIndex)
 {
-    Quaternion arg1 = LuaGetArgument_Quaternion(L, 1);
-    float result = QuaternionLength(arg1);
-    LuaPush_float(L, result);
-    return 1;
+    for (int i = 0; i < system->used; i++)
+    {
+        if (system->state[i] != TWEEN_RUNNING) continue;
+
+        system->elapsed[i] += dt;
+
+        float time = system->elapsed[i] - system->delay[i];
+        if (time < 0.0f) continue;
+
+        float *target = system->targets[i];
+        unsigned char flags = system->flags[i];
+
+        if (!(flags & TWEEN_FLAG_STARTED))
+        {
+            if (!(flags & TWEEN_FLAG_FROM)) system->from[i] = (flags & TWEEN_FLAG_INT)? (float)*(int *)target : *target;
+            flags |= TWEEN_FLAG_STARTED;
+            system->flags[i] = flags;
+        }
+
+        float duration = system->duration[i];
+        bool ended = (time >= duration);
+        float progress = ended? 1.0f : TweenEase(system->easing[i], time/duration);
+        float value = system->from[i] + (system->to[i] - system->from[i])*progress;
+
+        if (flags & TWEEN_FLAG_INT) *(int *)target = (int)floorf(value + 0.5f);
+        else *target = value;
+
+        if (!ended) continue;
+
+        if (system->loops[i] == 1) TweenEnd(L, system, i, time - duration, dt, targetsIndex);
+        else
+        {
+            // Next loop starts without delay, time exceeding loop duration is kept
+            if (system->loops[i] > 1) system->loops[i]--;
+            system->elapsed[i] = (duration > 0.0f)? fmodf(time - duration, duration) : 0.0f;
+            system->delay[i] = 0.0f;
+
+            if (flags & TWEEN_FLAG_YOYO)
+            {
+                float from = system->from[i];
+                system->from[i] = system->to[i];
+                system->to[i] = from;
+            }
+        }
+    }
 }
 
-int lua_QuaternionNormalize(lua_State* L)
+// Get tween target address: Buffer element, vector userdata component or Matrix element
+// Target at index, element (1-based, or component name "x", "y", "z", "w" for vectors) at index + 1
+static float *LuaGetArgument_TweenTarget(lua_State *L, int index, bool *integer)
 {
-    Quaternion arg1 = LuaGetArgument_Quaternion(L, 1);
-    QuaternionNormalize(&arg1);
-    LuaPush_Quaternion(L, arg1);
-    return 1;
+    TypedBuffer *buffer = (TypedBuffer *)luaL_testudata(L, index, "Buffer");
+    float *data = NULL;
+    int count = 0;
+
+    *integer = false;
+
+    if (buffer != NULL)
+    {
+        data = buffer->floats;
+        count = buffer->count;
+        *integer = (buffer->type == BUFFER_INT);
+    }
+    else if ((data = (float *)luaL_testudata(L, index, "Matrix")) != NULL) count = 16;
+    else
+    {
+        for (int n = 2; (n <= 4) && (data == NULL); n++)
+        {
+            data = (float *)luaL_testudata(L, index, vectorTypeNames[n]);
+            count = n;
+        }
+
+        luaL_argcheck(L, data != NULL, index, "Expected Buffer, Vector2, Vector3, Quaternion or Matrix");
+
+        if (lua_type(L, index + 1) == LUA_TSTRING)
+        {
+            const char *key = lua_tostring(L, index + 1);
+            int component = (key[0] == 'w')? 3 : (key[0] - 'x');
+
+            luaL_argcheck(L, (key[0] != '\0') && (key[1] == '\0') && (component >= 0) && (component < count), index + 1, "Invalid vector component");
+            return data + component;
+        }
+    }
+
+    int element = LuaGetArgument_int(L, index + 1);
+    luaL_argcheck(L, (element >= 1) && (element <= count), index + 1, "Expected element index in target");
+
+    return data + element - 1;
 }
 
-int lua_QuaternionMultiply(lua_State* L)
+// Get tween slot from tween id, -1 for ended, cancelled or invalid tweens
+static int LuaGetArgumentTween(lua_State *L, TweenSystem *system, int index)
 {
-    Quaternion arg1 = LuaGetArgument_Quaternion(L, 1);
-    Quaternion arg2 = LuaGetArgument_Quaternion(L, 2);
-    Quaternion result = QuaternionMultiply(arg1, arg2);
-    LuaPush_Quaternion(L, result);
-    return 1;
+    lua_Integer id = luaL_checkinteger(L, index);
+    lua_Integer slot = id & 0xffffffff;
+
+    if ((slot >= system->used) || (system->state[slot] == TWEEN_FREE) || (system->generations[slot] != (unsigned int)(id >> 32))) return -1;
+
+    return (int)slot;
 }
 
-int lua_QuaternionSlerp(lua_State* L)
+// Create a tween system: TweenSystem([maxTweens])
+int lua_TweenSystem(lua_State *L)
 {
-    Quaternion arg1 = LuaGetArgument_Quaternion(L, 1);
-    Quaternion arg2 = LuaGetArgument_Quaternion(L, 2);
-    float arg3 = LuaGetArgument_float(L, 3);
-    Quaternion result = QuaternionSlerp(arg1, arg2, arg3);
-    LuaPush_Quaternion(L, result);
+    int capacity = (int)luaL_optinteger(L, 1, RLUA_TWEENS_CAPACITY);
+    luaL_argcheck(L, capacity > 0, 1, "Expected maxTweens > 0");
+
+    TweenSystem *system = (TweenSystem *)lua_newuserdata(L, sizeof(TweenSystem));
+    memset(system, 0, sizeof(TweenSystem));
+    luaL_setmetatable(L, "TweenSystem");
+
+    system->capacity = capacity;
+    system->freeSlot = -1;
+
+    // Tweens arrays are allocated in one block per element type
+    system->targets = (float **)calloc(capacity, sizeof(float *));
+
+    float *values = (float *)calloc(5*capacity, sizeof(float));
+    system->from = values;
+    system->to = values + capacity;
+    system->elapsed = values + 2*capacity;
+    system->delay = values + 3*capacity;
+    system->duration = values + 4*capacity;
+
+    int *links = (int *)calloc(4*capacity, sizeof(int));
+    system->loops = links;
+    system->followers = links + capacity;
+    system->siblings = links + 2*capacity;
+    system->leaders = links + 3*capacity;
+
+    system->generations = (unsigned int *)calloc(capacity, sizeof(unsigned int));
+
+    unsigned char *bytes = (unsigned char *)calloc(3*capacity, sizeof(unsigned char));
+    system->easing = bytes;
+    system->state = bytes + capacity;
+    system->flags = bytes + 2*capacity;
+
+    // NOTE: Metatable is already set, __gc frees the arrays allocated before failure
+    if ((system->targets == NULL) || (values == NULL) || (links == NULL) || (system->generations == NULL) || (bytes == NULL))
+    {
+        return luaL_error(L, "Tween system of %d tweens could not be allocated", capacity);
+    }
+
+    // Targets table, keeps tweened buffers and vectors alive while tweens are active
+    lua_createtable(L, capacity, 0);
+    lua_setuservalue(L, -2);
+
     return 1;
 }
 
-int lua_QuaternionFromMatrix(lua_State* L)
+// Add a tween animating target element to a value, returns tween id:
+// system:add(target, element, to, duration[, easing[, delay[, options]]])
+// target: FloatBuffer/IntBuffer (element index), Vector2/Vector3/Quaternion (component index or "x", "y", "z", "w")
+//         or Matrix (element index 1..16), target value when tween starts is the start value
+// easing: "linear" (default), "quadIn", "quadOut", "quadInOut"... (quad, cubic, quart, sine, expo, circ, back, elastic, bounce)
+// options: { from, loops, yoyo, after }, loops is times played (default 1, -1 for endless), yoyo reverses direction on
+//          every loop, after is a tween id to wait for (sequence), started immediately if that tween already ended
+static int LuaTweenSystemAdd(lua_State *L)
 {
-    Matrix arg1 = LuaGetArgument_Matrix(L, 1);
-    Quaternion result = QuaternionFromMatrix(arg1);
-    LuaPush_Quaternion(L, result);
+    TweenSystem *system = (TweenSystem *)luaL_checkudata(L, 1, "TweenSystem");
+    bool integer = false;
+    float *target = LuaGetArgument_TweenTarget(L, 2, &integer);
+    float to = LuaGetArgument_float(L, 4);
+    float duration = LuaGetArgument_float(L, 5);
+    int easing = luaL_checkoption(L, 6, "linear", tweenEasingNames);
+    float delay = (float)luaL_optnumber(L, 7, 0.0);
+
+    luaL_argcheck(L, duration >= 0.0f, 5, "Expected duration >= 0");
+    luaL_argcheck(L, (system->freeSlot >= 0) || (system->used < system->capacity), 1, "Too many tweens");
+
+    unsigned char flags = integer? TWEEN_FLAG_INT : 0;
+    float from = 0.0f;
+    int loops = 1;
+    int leader = -1;
+
+    if (!lua_isnoneornil(L, 8))
+    {
+        luaL_checktype(L, 8, LUA_TTABLE);
+
+        if (lua_getfield(L, 8, "from") != LUA_TNIL)
+        {
+            from = LuaGetArgument_float(L, -1);
+            flags |= TWEEN_FLAG_FROM;
+        }
+        if (lua_getfield(L, 8, "loops") != LUA_TNIL) loops = LuaGetArgument_int(L, -1);
+        if (lua_getfield(L, 8, "yoyo") != LUA_TNIL) flags |= lua_toboolean(L, -1)? TWEEN_FLAG_YOYO : 0;
+        if (lua_getfield(L, 8, "after") != LUA_TNIL) leader = LuaGetArgumentTween(L, system, lua_gettop(L));
+        lua_pop(L, 4);
+
+        luaL_argcheck(L, (loops > 0) || (loops == -1), 8, "Expected loops > 0 or -1");
+    }
+
+    int slot = system->freeSlot;
+
+    if (slot >= 0) system->freeSlot = system->siblings[slot];
+    else slot = system->used++;
+
+    system->targets[slot] = target;
+    system->from[slot] = from;
+    system->to[slot] = to;
+    system->elapsed[slot] = 0.0f;
+    system->delay[slot] = delay;
+    system->duration[slot] = duration;
+    system->loops[slot] = loops;
+    system->followers[slot] = -1;
+    system->siblings[slot] = -1;
+    system->leaders[slot] = leader;
+    system->easing[slot] = (unsigned char)easing;
+    system->state[slot] = (leader >= 0)? TWEEN_WAITING : TWEEN_RUNNING;
+    system->flags[slot] = flags;
+    system->count++;
+
+    // Sequenced tweens start in order they were added
+    if (leader >= 0)
+    {
+        int *link = &system->followers[leader];
+        while (*link >= 0) link = &system->siblings[*link];
+        *link = slot;
+    }
+
+    lua_getuservalue(L, 1);
+    lua_pushvalue(L, 2);
+    lua_rawseti(L, -2, slot + 1);
+
+    lua_pushinteger(L, ((lua_Integer)system->generations[slot] << 32) | slot);
     return 1;
 }
 
-int lua_QuaternionToMatrix(lua_State* L)
+// Cancel tween (and tweens sequenced after it), target keeps current value: system:cancel(id)
+// Returns true if tween was active
+static int LuaTweenSystemCancel(lua_State *L)
 {
-    Quaternion arg1 = LuaGetArgument_Quaternion(L, 1);
-    Matrix result = QuaternionToMatrix(arg1);
-    LuaPush_Matrix(L, &result);
+    TweenSystem *system = (TweenSystem *)luaL_checkudata(L, 1, "TweenSystem");
+    int slot = LuaGetArgumentTween(L, system, 2);
+
+    if (slot >= 0)
+    {
+        lua_getuservalue(L, 1);
+        TweenCancel(L, system, slot, lua_gettop(L));
+    }
+
+    LuaPush_bool(L, slot >= 0);
     return 1;
 }
 
-int lua_QuaternionFromAxisAngle(lua_State* L)
+// Check if tween is active (running, delayed or waiting in a sequence): system:isActive(id)
+static int LuaTweenSystemIsActive(lua_State *L)
 {
-    Vector3 arg1 = LuaGetArgument_Vector3(L, 1);
-    float arg2 = LuaGetArgument_float(L, 2);
-    Quaternion result = QuaternionFromAxisAngle(arg1, arg2);
-    LuaPush_Quaternion(L, result);
+    TweenSystem *system = (TweenSystem *)luaL_checkudata(L, 1, "TweenSystem");
+    LuaPush_bool(L, LuaGetArgumentTween(L, system, 2) >= 0);
     return 1;
 }
 
-int lua_QuaternionToAxisAngle(lua_State* L)
+// Advance tweens and write targets: system:update([dt]), dt defaults to GetFrameTime()
+static int LuaTweenSystemUpdate(lua_State *L)
 {
-    Quaternion arg1 = LuaGetArgument_Quaternion(L, 1);
-    Vector3 arg2;
-    float arg3 = 0;
-    QuaternionToAxisAngle(arg1, &arg2, &arg3);
-    LuaPush_Vector3(L, arg2);
-    LuaPush_float(L, arg3);
-    return 2;
+    TweenSystem *system = (TweenSystem *)luaL_checkudata(L, 1, "TweenSystem");
+    float dt = (float)luaL_optnumber(L, 2, GetFrameTime());
+
+    lua_getuservalue(L, 1);
+    TweensUpdate(L, system, dt, lua_gettop(L));
+    return 0;
 }
 
-int lua_QuaternionFromEuler(lua_State* L)
+// Cancel all tweens: system:clear()
+static int LuaTweenSystemClear(lua_State *L)
 {
-    float arg1 = LuaGetArgument_float(L, 1);
-    float arg2 = LuaGetArgument_float(L, 2);
-    float arg3 = LuaGetArgument_float(L, 3);
-    Quaternion result = QuaternionFromEuler(arg1, arg2, arg3);
-    LuaPush_Quaternion(L, result);
-    return 1;
+    TweenSystem *system = (TweenSystem *)luaL_checkudata(L, 1, "TweenSystem");
+
+    system->count = 0;
+    system->used = 0;
+    system->freeSlot = -1;
+
+    // NOTE: Slots generations are kept, ids of cleared tweens stay invalid
+    for (int i = 0; i < system->capacity; i++) system->generations[i]++;
+
+    lua_newtable(L);
+    lua_setuservalue(L, 1);
+    return 0;
 }
 
-int lua_QuaternionToEuler(lua_State* L)
+// Active tweens: #system
+static int LuaTweenSystemCount(lua_State *L)
 {
-    Quaternion arg1 = LuaGetArgument_Quaternion(L, 1);
-    Vector3 result = QuaternionToEuler(arg1);
-    LuaPush_Vector3(L, result);
+    TweenSystem *system = (TweenSystem *)luaL_checkudata(L, 1, "TweenSystem");
+    LuaPush_int(L, system->count);
     return 1;
 }
 
-int lua_QuaternionTransform(lua_State* L)
+// Free tween system arrays (targets are released with user value table)
+static int LuaTweenSystemGC(lua_State *L)
 {
-    Quaternion arg1 = LuaGetArgument_Quaternion(L, 1);
-    Matrix arg2 = LuaGetArgument_Matrix(L, 2);
-    QuaternionTransform(&arg1, arg2);
-    LuaPush_Quaternion(L, arg1);
-    return 1;
+    TweenSystem *system = (TweenSystem *)luaL_checkudata(L, 1, "TweenSystem");
+    free(system->targets);
+    free(system->from);
+    free(system->loops);
+    free(system->generations);
+    free(system->easing);
+    memset(system, 0, sizeof(TweenSystem));
+    return 0;
 }
 
 //----------------------------------------------------------------------------------
@@ -4996,6 +11854,77 @@ int lua_ClosePhysics(lua_State* L)
     return 0;
 }
 
+//------------------------------------------------------------------------------------
+// raylib-lua [profiler] module functions - Allocation-site profiling
+//------------------------------------------------------------------------------------
+
+// Enable Lua allocation-site profiler, sampling one allocation every sampleBytes (on average)
+int lua_EnableAllocProfiler(lua_State *L)
+{
+    int sampleBytes = (int)luaL_optinteger(L, 1, RLUA_ALLOC_SAMPLE_BYTES);
+    luaL_argcheck(L, sampleBytes > 0, 1, "Expected sampleBytes > 0");
+    rLuaEnableAllocProfiler(sampleBytes);
+    return 0;
+}
+
+// Disable Lua allocation-site profiler (collected data is kept)
+int lua_DisableAllocProfiler(lua_State *L)
+{
+    rLuaDisableAllocProfiler();
+    return 0;
+}
+
+// Get top allocation sites: { source, line, func, samples, bytes, bytesPerFrame, types = { table = bytes, ... } }
+int lua_GetAllocSites(lua_State *L)
+{
+    int maxSites = (int)luaL_optinteger(L, 1, 10);
+    bool enabled = allocProfiler.enabled;
+    int frames = (allocProfiler.frames > 0)? allocProfiler.frames : 1;
+
+    allocProfiler.enabled = false;      // Avoid profiling report allocations
+
+    AllocSite **sites = NULL;
+    int count = LuaGetTopAllocSites(&sites);
+    if (count > maxSites) count = maxSites;
+
+    lua_createtable(L, count, 0);
+
+    for (int i = 0; i < count; i++)
+    {
+        lua_createtable(L, 0, 7);
+        LuaPush_string(L, sites[i]->source);
+        lua_setfield(L, -2, "source");
+        LuaPush_int(L, sites[i]->line);
+        lua_setfield(L, -2, "line");
+        LuaPush_string(L, sites[i]->function);
+        lua_setfield(L, -2, "func");
+        LuaPush_int(L, sites[i]->samples);
+        lua_setfield(L, -2, "samples");
+        LuaPush_int(L, sites[i]->bytes);
+        lua_setfield(L, -2, "bytes");
+        LuaPush_float(L, (float)sites[i]->bytes/frames);
+        lua_setfield(L, -2, "bytesPerFrame");
+
+        lua_newtable(L);
+        for (int t = 0; t < RLUA_ALLOC_SITE_TYPES; t++)
+        {
+            if (sites[i]->typeBytes[t] > 0)
+            {
+                LuaPush_int(L, sites[i]->typeBytes[t]);
+                lua_setfield(L, -2, allocTypeNames[t]);
+            }
+        }
+        lua_setfield(L, -2, "types");
+
+        lua_rawseti(L, -2, i + 1);
+    }
+
+    free(sites);
+    allocProfiler.enabled = enabled;
+
+    return 1;
+}
+
 //----------------------------------------------------------------------------------
 // Functions Registering
 //----------------------------------------------------------------------------------
@@ -5008,7 +11937,7 @@ static luaL_Reg raylib_functions[] = {
     REG(Vector2)
     REG(Vector3)
     REG(Vector4)
-    //REG(Matrix)
+    REG(Matrix)
     REG(Quaternion)
     REG(Rectangle)
     REG(Ray)
@@ -5018,6 +11947,10 @@ static luaL_Reg raylib_functions[] = {
     REG(BoundingBox)
     //REG(Material)
 
+    // Register typed buffers
+    REG(FloatBuffer)
+    REG(IntBuffer)
+
     // Register functions
     //--------------------
     REG(InitWindow)
@@ -5066,6 +11999,10 @@ static luaL_Reg raylib_functions[] = {
     REG(TraceLog)
     REG(TakeScreenshot)
     REG(GetRandomValue)
+    REG(Random)
+    REG(FillRandomInts)
+    REG(FillRandomFloats)
+    REG(FillRandomGaussian)
     REG(IsFileExtension)
     REG(GetExtension)
     REG(GetFileName)
@@ -5121,6 +12058,15 @@ static luaL_Reg raylib_functions[] = {
     REG(SetCameraAltControl)
     REG(SetCameraSmoothZoomControl)
     REG(SetCameraMoveControls)
+    REG(CommandList)
+    REG(BeginRecording)
+    REG(EndRecording)
+    REG(DrawCommandList)
+    REG(BeginRenderQueue)
+    REG(EndRenderQueue)
+    REG(SetRenderLayer)
+    REG(SetRenderDepth)
+    REG(GetRenderQueueStats)
     REG(DrawPixel)
     REG(DrawPixelV)
     REG(DrawLine)
@@ -5145,6 +12091,10 @@ static luaL_Reg raylib_functions[] = {
     REG(DrawPoly)
     REG(DrawPolyEx)
     REG(DrawPolyExLines)
+    REG(DrawRectanglesBatch)
+    REG(DrawCirclesBatch)
+    REG(DrawLinesBatch)
+    REG(DrawPixelsBatch)
     REG(CheckCollisionRecs)
     REG(CheckCollisionCircles)
     REG(CheckCollisionCircleRec)
@@ -5213,20 +12163,34 @@ static luaL_Reg raylib_functions[] = {
     REG(DrawTextureEx)
     REG(DrawTextureRec)
     REG(DrawTexturePro)
+    REG(SpriteBatch)
+    REG(ParticleSystem)
+    REG(Tilemap)
     REG(GetFontDefault)
     REG(LoadFont)
     REG(LoadFontEx)
     REG(LoadFontData)
     REG(GenImageFontAtlas)
     REG(UnloadFont)
+    REG(LoadFontDynamic)
+    REG(GetFontDynamicStats)
+    REG(FontLoader)
+    REG(LoadFontFromLoader)
+    REG(LoadFontSDF)
     REG(DrawFPS)
     REG(DrawText)
     REG(DrawTextEx)
+    REG(DrawTextF)
+    REG(DrawTextExF)
+    REG(TextBuffer)
+    REG(TextLayout)
+    REG(DrawTextLayout)
     REG(MeasureText)
     REG(MeasureTextEx)
     REG(FormatText)
     REG(SubText)
     REG(GetGlyphIndex)
+    REG(GetTextCacheStats)
     REG(DrawLine3D)
     REG(DrawCircle3D)
     REG(DrawCube)
@@ -5267,6 +12231,9 @@ static luaL_Reg raylib_functions[] = {
     REG(DrawModelEx)
     REG(DrawModelWires)
     REG(DrawModelWiresEx)
+    REG(DrawModelInstances)
+    REG(DrawModelsCulled)
+    REG(FrustumCull)
     REG(DrawBoundingBox)
     REG(DrawBillboard)
     REG(DrawBillboardRec)
@@ -5424,6 +12391,12 @@ static luaL_Reg raylib_functions[] = {
     REG(QuaternionFromEuler)
     REG(QuaternionToEuler)
     REG(QuaternionTransform)
+    REG(TransformPoints)
+    REG(NormalizeVectors)
+    REG(LerpVectors)
+    REG(QuaternionSlerpBatch)
+    REG(MatrixMultiplyBatch)
+    REG(TweenSystem)
     
     // [physac] module functions
     REG(InitPhysics)
@@ -5445,6 +12418,11 @@ static luaL_Reg raylib_functions[] = {
     REG(ResetPhysics)
     REG(ClosePhysics)
 
+    // [profiler] module functions
+    REG(EnableAllocProfiler)
+    REG(DisableAllocProfiler)
+    REG(GetAllocSites)
+
     { NULL, NULL }  // sentinel: end signal
 };
 
@@ -5457,6 +12435,337 @@ static void rLuaRegisterFunctions(const char *opt_table)
     luaL_setfuncs(L, raylib_functions, 0);
 }
 
+// raylib Lua functions calls counters, indexed as raylib_functions[]
+static unsigned int callCounters[sizeof(raylib_functions)/sizeof(raylib_functions[0])] = { 0 };
+
+// Counting wrapper for raylib Lua functions
+// NOTE: Upvalue 1 is the wrapped function, upvalue 2 its index in raylib_functions[]
+static int LuaCountedCall(lua_State *L)
+{
+    callCounters[lua_tointeger(L, lua_upvalueindex(2))]++;
+
+    return lua_tocfunction(L, lua_upvalueindex(1))(L);
+}
+
+//----------------------------------------------------------------------------------
+// raylib-lua pipelined mode (Lua update on worker thread, drawing on calling thread)
+//----------------------------------------------------------------------------------
+
+// Pipelined functions execution mode
+typedef enum {
+    PIPELINE_CALL_MAIN = 0,         // Executed on main thread, worker waits (GPU resources, window, audio...)
+    PIPELINE_CALL_DIRECT,           // Executed on worker thread (CPU only functions)
+    PIPELINE_CALL_RECORDED          // Executed on worker thread while a frame is recorded, on main thread otherwise
+} PipelineCallMode;
+
+// Functions executed on worker thread (name prefix)
+static const char *pipelineDirectFunctions[] = {
+    "Color", "Vector", "Matrix", "Quaternion", "Check", "Rectangle", "Ray", "RayHitInfo", "Camera", "Camera2D", "BoundingBox",
+    "FloatBuffer", "IntBuffer", "GetColor", "Fade", "GetRandomValue", "GetCollisionRec", "Clamp", "MeasureText", "FormatText",
+    "SubText", "GetGlyphIndex", "CommandList", "BeginRecording", "EndRecording", "SpriteBatch", "ParticleSystem",
+    "Tilemap", "SetRenderLayer", "SetRenderDepth", "GetRenderQueueStats",
+    "GetTextCacheStats", "GetFontDynamicStats", "FontLoader", "TextBuffer", "TextLayout",
+    "TransformPoints", "NormalizeVectors", "LerpVectors", "TweenSystem", "Random",
+    "FillRandom", NULL
+};
+
+// Functions recorded into frame command list (full name)
+static const char *pipelineRecordedFunctions[] = {
+    "ClearBackground", "BeginMode2D", "EndMode2D", "BeginTextureMode", "EndTextureMode", "BeginShaderMode", "EndShaderMode",
+    "BeginBlendMode", "EndBlendMode", "BeginRenderQueue", "EndRenderQueue", "DrawCommandList", "DrawPixel", "DrawPixelV",
+    "DrawLine", "DrawLineV", "DrawLineEx", "DrawLineBezier", "DrawCircle", "DrawCircleGradient", "DrawCircleV", "DrawCircleLines",
+    "DrawRectangle", "DrawRectangleV", "DrawRectangleRec", "DrawRectanglePro", "DrawRectangleGradientV", "DrawRectangleGradientH",
+    "DrawRectangleGradientEx", "DrawRectangleLines", "DrawRectangleLinesEx", "DrawTriangle", "DrawTriangleLines", "DrawPoly",
+    "DrawPolyEx", "DrawPolyExLines", "DrawRectanglesBatch", "DrawCirclesBatch", "DrawLinesBatch", "DrawPixelsBatch",
+    "BeginMode3D", "EndMode3D", "DrawLine3D", "DrawCircle3D", "DrawCube", "DrawCubeV", "DrawCubeWires", "DrawCubeTexture",
+    "DrawSphere", "DrawSphereEx", "DrawSphereWires", "DrawCylinder", "DrawCylinderWires", "DrawPlane", "DrawRay", "DrawGrid",
+    "DrawGizmo", "DrawModel", "DrawModelEx", "DrawModelWires", "DrawModelWiresEx", "DrawModelInstances", "DrawModelsCulled",
+    "DrawBoundingBox", "DrawBillboard", "DrawBillboardRec", "BeginVrDrawing", "EndVrDrawing",
+    "DrawTexture", "DrawTextureV", "DrawTextureEx", "DrawTextureRec", "DrawTexturePro", "DrawFPS", "DrawText", "DrawTextEx",
+    "DrawTextF", "DrawTextExF", "DrawTextLayout", NULL
+};
+
+// Take input state snapshot (main thread, after EndDrawing())
+static void PipelineSnapshotInput(InputSnapshot *input)
+{
+    for (int key = RLUA_PIPELINE_FIRST_KEY; key < RLUA_PIPELINE_MAX_KEYS; key++)
+    {
+        input->keys[key] = (IsKeyDown(key)? INPUT_DOWN : 0) | (IsKeyPressed(key)? INPUT_PRESSED : 0) | (IsKeyReleased(key)? INPUT_RELEASED : 0);
+    }
+
+    for (int button = 0; button < RLUA_PIPELINE_MAX_MOUSE_BUTTONS; button++)
+    {
+        input->mouseButtons[button] = (IsMouseButtonDown(button)? INPUT_DOWN : 0) | (IsMouseButtonPressed(button)? INPUT_PRESSED : 0) | (IsMouseButtonReleased(button)? INPUT_RELEASED : 0);
+    }
+
+    for (int gamepad = 0; gamepad < RLUA_PIPELINE_MAX_GAMEPADS; gamepad++)
+    {
+        input->gamepadAvailable[gamepad] = IsGamepadAvailable(gamepad);
+        if (!input->gamepadAvailable[gamepad]) continue;
+
+        for (int button = 0; button < RLUA_PIPELINE_MAX_GAMEPAD_BUTTONS; button++)
+        {
+            input->gamepadButtons[gamepad][button] = (IsGamepadButtonDown(gamepad, button)? INPUT_DOWN : 0) |
+                                                     (IsGamepadButtonPressed(gamepad, button)? INPUT_PRESSED : 0) |
+                                                     (IsGamepadButtonReleased(gamepad, button)? INPUT_RELEASED : 0);
+        }
+
+        input->gamepadAxisCount[gamepad] = GetGamepadAxisCount(gamepad);
+        for (int axis = 0; axis < RLUA_PIPELINE_MAX_GAMEPAD_AXIS; axis++) input->gamepadAxis[gamepad][axis] = GetGamepadAxisMovement(gamepad, axis);
+    }
+
+    input->keyPressed = GetKeyPressed();
+    input->gamepadButtonPressed = GetGamepadButtonPressed();
+    input->mousePosition = GetMousePosition();
+    input->mouseWheelMove = GetMouseWheelMove();
+    input->gesture = GetGestureDetected();
+    input->screenWidth = GetScreenWidth();
+    input->screenHeight = GetScreenHeight();
+    input->fps = GetFPS();
+    input->frameTime = GetFrameTime();
+    input->time = GetTime();
+    input->shouldClose = WindowShouldClose();
+}
+
+// Get key state flags from input snapshot
+static int PipelineKeyState(lua_State *L)
+{
+    int key = LuaGetArgument_int(L, 1);
+    return ((key >= RLUA_PIPELINE_FIRST_KEY) && (key < RLUA_PIPELINE_MAX_KEYS))? pipeline.input.keys[key] : 0;
+}
+
+// Get mouse button state flags from input snapshot
+static int PipelineMouseButtonState(lua_State *L)
+{
+    int button = LuaGetArgument_int(L, 1);
+    return ((button >= 0) && (button < RLUA_PIPELINE_MAX_MOUSE_BUTTONS))? pipeline.input.mouseButtons[button] : 0;
+}
+
+// Get gamepad button state flags from input snapshot
+static int PipelineGamepadButtonState(lua_State *L)
+{
+    int gamepad = LuaGetArgument_int(L, 1);
+    int button = LuaGetArgument_int(L, 2);
+
+    if ((gamepad < 0) || (gamepad >= RLUA_PIPELINE_MAX_GAMEPADS) || !pipeline.input.gamepadAvailable[gamepad]) return 0;
+
+    return ((button >= 0) && (button < RLUA_PIPELINE_MAX_GAMEPAD_BUTTONS))? pipeline.input.gamepadButtons[gamepad][button] : 0;
+}
+
+// Input snapshot functions, replacing raylib functions in pipelined mode
+static int LuaSnapshotIsKeyPressed(lua_State *L) { LuaPush_bool(L, PipelineKeyState(L) & INPUT_PRESSED); return 1; }
+static int LuaSnapshotIsKeyDown(lua_State *L) { LuaPush_bool(L, PipelineKeyState(L) & INPUT_DOWN); return 1; }
+static int LuaSnapshotIsKeyReleased(lua_State *L) { LuaPush_bool(L, PipelineKeyState(L) & INPUT_RELEASED); return 1; }
+static int LuaSnapshotIsKeyUp(lua_State *L) { LuaPush_bool(L, !(PipelineKeyState(L) & INPUT_DOWN)); return 1; }
+static int LuaSnapshotGetKeyPressed(lua_State *L) { LuaPush_int(L, pipeline.input.keyPressed); return 1; }
+static int LuaSnapshotIsMouseButtonPressed(lua_State *L) { LuaPush_bool(L, PipelineMouseButtonState(L) & INPUT_PRESSED); return 1; }
+static int LuaSnapshotIsMouseButtonDown(lua_State *L) { LuaPush_bool(L, PipelineMouseButtonState(L) & INPUT_DOWN); return 1; }
+static int LuaSnapshotIsMouseButtonReleased(lua_State *L) { LuaPush_bool(L, PipelineMouseButtonState(L) & INPUT_RELEASED); return 1; }
+static int LuaSnapshotIsMouseButtonUp(lua_State *L) { LuaPush_bool(L, !(PipelineMouseButtonState(L) & INPUT_DOWN)); return 1; }
+static int LuaSnapshotGetMouseX(lua_State *L) { LuaPush_int(L, (int)pipeline.input.mousePosition.x); return 1; }
+static int LuaSnapshotGetMouseY(lua_State *L) { LuaPush_int(L, (int)pipeline.input.mousePosition.y); return 1; }
+static int LuaSnapshotGetMousePosition(lua_State *L) { LuaPush_Vector2(L, pipeline.input.mousePosition); return 1; }
+static int LuaSnapshotGetMouseWheelMove(lua_State *L) { LuaPush_int(L, pipeline.input.mouseWheelMove); return 1; }
+static int LuaSnapshotIsGamepadButtonPressed(lua_State *L) { LuaPush_bool(L, PipelineGamepadButtonState(L) & INPUT_PRESSED); return 1; }
+static int LuaSnapshotIsGamepadButtonDown(lua_State *L) { LuaPush_bool(L, PipelineGamepadButtonState(L) & INPUT_DOWN); return 1; }
+static int LuaSnapshotIsGamepadButtonReleased(lua_State *L) { LuaPush_bool(L, PipelineGamepadButtonState(L) & INPUT_RELEASED); return 1; }
+static int LuaSnapshotIsGamepadButtonUp(lua_State *L) { LuaPush_bool(L, !(PipelineGamepadButtonState(L) & INPUT_DOWN)); return 1; }
+static int LuaSnapshotGetGamepadButtonPressed(lua_State *L) { LuaPush_int(L, pipeline.input.gamepadButtonPressed); return 1; }
+static int LuaSnapshotIsGestureDetected(lua_State *L) { LuaPush_bool(L, pipeline.input.gesture == LuaGetArgument_int(L, 1)); return 1; }
+static int LuaSnapshotGetGestureDetected(lua_State *L) { LuaPush_int(L, pipeline.input.gesture); return 1; }
+static int LuaSnapshotGetScreenWidth(lua_State *L) { LuaPush_int(L, pipeline.input.screenWidth); return 1; }
+static int LuaSnapshotGetScreenHeight(lua_State *L) { LuaPush_int(L, pipeline.input.screenHeight); return 1; }
+static int LuaSnapshotGetFPS(lua_State *L) { LuaPush_int(L, pipeline.input.fps); return 1; }
+static int LuaSnapshotGetFrameTime(lua_State *L) { LuaPush_float(L, pipeline.input.frameTime); return 1; }
+static int LuaSnapshotGetTime(lua_State *L) { lua_pushnumber(L, pipeline.input.time); return 1; }
+static int LuaSnapshotWindowShouldClose(lua_State *L) { LuaPush_bool(L, pipeline.input.shouldClose); return 1; }
+
+static int LuaSnapshotIsGamepadAvailable(lua_State *L)
+{
+    int gamepad = LuaGetArgument_int(L, 1);
+    LuaPush_bool(L, (gamepad >= 0) && (gamepad < RLUA_PIPELINE_MAX_GAMEPADS) && pipeline.input.gamepadAvailable[gamepad]);
+    return 1;
+}
+
+static int LuaSnapshotGetGamepadAxisCount(lua_State *L)
+{
+    int gamepad = LuaGetArgument_int(L, 1);
+    LuaPush_int(L, ((gamepad >= 0) && (gamepad < RLUA_PIPELINE_MAX_GAMEPADS))? pipeline.input.gamepadAxisCount[gamepad] : 0);
+    return 1;
+}
+
+static int LuaSnapshotGetGamepadAxisMovement(lua_State *L)
+{
+    int gamepad = LuaGetArgument_int(L, 1);
+    int axis = LuaGetArgument_int(L, 2);
+    float value = 0.0f;
+
+    if ((gamepad >= 0) && (gamepad < RLUA_PIPELINE_MAX_GAMEPADS) && (axis >= 0) && (axis < RLUA_PIPELINE_MAX_GAMEPAD_AXIS)) value = pipeline.input.gamepadAxis[gamepad][axis];
+
+    LuaPush_float(L, value);
+    return 1;
+}
+
+// Begin frame recording (worker thread)
+static int LuaPipelineBeginDrawing(lua_State *L)
+{
+    CommandList *frame = &pipeline.frames[pipeline.recordFrame];
+
+    frame->size = 0;
+    frame->count = 0;
+    recordingList = frame;
+
+    return 0;
+}
+
+// End frame recording and pass it to main thread (worker thread)
+// NOTE: Waits until main thread takes the frame, it happens once previous frame has been drawn
+static int LuaPipelineEndDrawing(lua_State *L)
+{
+    if (renderQueue.active) RenderQueueEnd();
+    if (recordingListRef != LUA_NOREF) lua_EndRecording(L);
+    recordingList = NULL;
+
+    pthread_mutex_lock(&pipeline.mutex);
+
+    pipeline.readyFrame = pipeline.recordFrame;
+    pipeline.frameReady = true;
+    pthread_cond_broadcast(&pipeline.cond);
+
+    while (pipeline.frameReady) pthread_cond_wait(&pipeline.cond, &pipeline.mutex);
+
+    pthread_mutex_unlock(&pipeline.mutex);
+
+    pipeline.recordFrame = 1 - pipeline.recordFrame;
+    dynamicFontsFrame++;
+    if (allocProfiler.enabled) allocProfiler.frames++;
+
+    return 0;
+}
+
+// Pipelined wrapper for raylib Lua functions (worker thread)
+// NOTE: Upvalue 1 is the wrapped function, upvalue 2 its PipelineCallMode
+static int LuaPipelinedCall(lua_State *L)
+{
+    int mode = (int)lua_tointeger(L, lua_upvalueindex(2));
+
+    if ((mode == PIPELINE_CALL_DIRECT) || ((mode == PIPELINE_CALL_RECORDED) && (recordingList != NULL)))
+    {
+        return lua_tocfunction(L, lua_upvalueindex(1))(L);
+    }
+
+    // Execute function on main thread, protected: errors are raised again on worker thread
+    lua_pushvalue(L, lua_upvalueindex(1));
+    lua_insert(L, 1);
+
+    pthread_mutex_lock(&pipeline.mutex);
+
+    pipeline.callState = L;
+    pipeline.callArgs = lua_gettop(L) - 1;
+    pipeline.callPending = true;
+    pthread_cond_broadcast(&pipeline.cond);
+
+    while (pipeline.callPending) pthread_cond_wait(&pipeline.cond, &pipeline.mutex);
+
+    int status = pipeline.callStatus;
+
+    pthread_mutex_unlock(&pipeline.mutex);
+
+    if (status != LUA_OK) return lua_error(L);
+
+    return lua_gettop(L);
+}
+
+// Script execution thread (worker thread)
+static void *PipelineScriptThread(void *arg)
+{
+    const char *script = (const char *)arg;
+    int status = pipeline.scriptIsFile? luaL_dofile(L, script) : luaL_dostring(L, script);
+
+    pthread_mutex_lock(&pipeline.mutex);
+    pipeline.scriptStatus = status;
+    pipeline.scriptDone = true;
+    pthread_cond_broadcast(&pipeline.cond);
+    pthread_mutex_unlock(&pipeline.mutex);
+
+    return NULL;
+}
+
+// Execute script on worker thread, draw recorded frames and execute main thread calls until script ends
+static int PipelineExecute(const char *script, bool isFile)
+{
+    pthread_t thread;
+
+    pipeline.recordFrame = 0;
+    pipeline.frameReady = false;
+    pipeline.callPending = false;
+    pipeline.framesDrawn = 0;
+    pipeline.scriptDone = false;
+    pipeline.scriptIsFile = isFile;
+    memset(&pipeline.input, 0, sizeof(InputSnapshot));
+    memset(&pipeline.nextInput, 0, sizeof(InputSnapshot));
+
+    if (pthread_create(&thread, NULL, PipelineScriptThread, (void *)script) != 0)
+    {
+        TraceLog(WARNING, "Pipelined mode thread could not be created, executing script on current thread");
+        return isFile? luaL_dofile(L, script) : luaL_dostring(L, script);
+    }
+
+    pthread_mutex_lock(&pipeline.mutex);
+
+    while (true)
+    {
+        while (!pipeline.frameReady && !pipeline.callPending && !pipeline.scriptDone) pthread_cond_wait(&pipeline.cond, &pipeline.mutex);
+
+        if (pipeline.callPending)
+        {
+            pthread_mutex_unlock(&pipeline.mutex);
+            int status = lua_pcall(pipeline.callState, pipeline.callArgs, LUA_MULTRET, 0);
+            pthread_mutex_lock(&pipeline.mutex);
+
+            // Before first frame drawn, screen size follows main thread calls (InitWindow())
+            if (pipeline.framesDrawn == 0)
+            {
+                pipeline.input.screenWidth = GetScreenWidth();
+                pipeline.input.screenHeight = GetScreenHeight();
+            }
+
+            pipeline.callStatus = status;
+            pipeline.callPending = false;
+            pthread_cond_broadcast(&pipeline.cond);
+        }
+        else if (pipeline.frameReady)
+        {
+            // Take frame and give latest input snapshot to worker, it starts next frame update
+            CommandList *frame = &pipeline.frames[pipeline.readyFrame];
+            if (pipeline.framesDrawn > 0) pipeline.input = pipeline.nextInput;
+            DynamicFontsUpload();
+            pipeline.frameReady = false;
+            pthread_cond_broadcast(&pipeline.cond);
+            pthread_mutex_unlock(&pipeline.mutex);
+
+            BeginDrawing();
+            DrawCommandListEx(frame, (Vector2){ 0.0f, 0.0f });
+            EndDrawing();
+
+            PipelineSnapshotInput(&pipeline.nextInput);
+
+            pthread_mutex_lock(&pipeline.mutex);
+            pipeline.framesDrawn++;
+        }
+        else break;
+    }
+
+    pthread_mutex_unlock(&pipeline.mutex);
+    pthread_join(thread, NULL);
+
+    // Script could end while recording
+    if (recordingListRef != LUA_NOREF) lua_EndRecording(L);
+    recordingList = NULL;
+
+    return pipeline.scriptStatus;
+}
+
 //----------------------------------------------------------------------------------
 // raylib Lua API
 //----------------------------------------------------------------------------------
@@ -5464,7 +12773,9 @@ static void rLuaRegisterFunctions(const char *opt_table)
 // Initialize Lua system
 RLUADEF void rLuaInitDevice(void)
 {
-    mainLuaState = luaL_newstate();
+    mainLuaState = lua_newstate(LuaAllocator, &allocProfiler);
+    lua_atpanic(mainLuaState, LuaPanic);
+    allocProfiler.state = mainLuaState;
     L = mainLuaState;
     
     LuaStartEnum();
@@ -5734,10 +13045,216 @@ RLUADEF void rLuaCloseDevice(void)
 {
     if (mainLuaState)
     {
+        allocProfiler.state = NULL;
         lua_close(mainLuaState);
         mainLuaState = 0;
         L = 0;
     }
+
+    recordingList = NULL;
+    recordingParent = NULL;
+    recordingListRef = LUA_NOREF;
+
+    free(renderQueue.list.data);
+    free(renderQueue.entries);
+    free(renderQueue.items);
+    memset(&renderQueue, 0, sizeof(RenderQueue));
+
+    TextCacheFree();
+
+#if defined(RLUA_THREADS) && (RLUA_PARTICLES_THREADS > 1)
+    ParticlesWorkersStop();
+#endif
+
+    for (int i = 0; i < glyphLookupsCount; i++)
+    {
+        if (glyphLookups[i].dynamic != NULL) DynamicFontFree(glyphLookups[i].dynamic);
+        GlyphLookupFree(&glyphLookups[i]);
+    }
+    free(glyphLookups);
+    glyphLookups = NULL;
+    glyphLookupsCount = 0;
+
+    if (pipeline.enabled)
+    {
+        pthread_mutex_destroy(&pipeline.mutex);
+        pthread_cond_destroy(&pipeline.cond);
+        free(pipeline.frames[0].data);
+        free(pipeline.frames[1].data);
+        memset(&pipeline, 0, sizeof(Pipeline));
+    }
+
+    // NOTE: Allocation report should be requested before closing Lua device
+    allocProfiler.enabled = false;
+    free(allocProfiler.sites);
+    allocProfiler.sites = NULL;
+}
+
+// Enable Lua allocation-site profiler (sampling period in bytes)
+RLUADEF void rLuaEnableAllocProfiler(int sampleBytes)
+{
+    if (allocProfiler.sites == NULL) allocProfiler.sites = (AllocSite *)calloc(RLUA_MAX_ALLOC_SITES, sizeof(AllocSite));
+    else memset(allocProfiler.sites, 0, RLUA_MAX_ALLOC_SITES*sizeof(AllocSite));
+
+    allocProfiler.sampleBytes = (sampleBytes > 0)? sampleBytes : RLUA_ALLOC_SAMPLE_BYTES;
+    allocProfiler.bytesUntilSample = allocProfiler.sampleBytes;
+    allocProfiler.frames = 0;
+    allocProfiler.sitesCount = 0;
+    allocProfiler.droppedSamples = 0;
+    allocProfiler.enabled = true;
+}
+
+// Disable Lua allocation-site profiler (keeps collected data)
+RLUADEF void rLuaDisableAllocProfiler(void)
+{
+    allocProfiler.enabled = false;
+}
+
+// Log top Lua allocation sites (bytes per frame)
+RLUADEF void rLuaTraceAllocReport(int maxSites)
+{
+    bool enabled = allocProfiler.enabled;
+    int frames = (allocProfiler.frames > 0)? allocProfiler.frames : 1;
+
+    allocProfiler.enabled = false;
+
+    AllocSite **sites = NULL;
+    int count = LuaGetTopAllocSites(&sites);
+    if (count > maxSites) count = maxSites;
+
+    TraceLog(INFO, "Lua allocation sites: %i registered, %i frames, sampling every %i bytes", allocProfiler.sitesCount, allocProfiler.frames, allocProfiler.sampleBytes);
+
+    for (int i = 0; i < count; i++)
+    {
+        int type = LuaGetAllocSiteMainType(sites[i]);
+
+        TraceLog(INFO, "%10.1f B/frame  %s:%i [%s] (%s %i%%)", (float)sites[i]->bytes/frames, sites[i]->source, sites[i]->line,
+                 sites[i]->function, allocTypeNames[type], (int)(100*sites[i]->typeBytes[type]/sites[i]->bytes));
+    }
+
+    if (allocProfiler.droppedSamples > 0) TraceLog(WARNING, "Lua allocation sites table full, %i samples dropped", allocProfiler.droppedSamples);
+
+    free(sites);
+    allocProfiler.enabled = enabled;
+}
+
+// Get Lua allocator counters: allocations creating or growing a block and bytes requested
+// NOTE: Counters are never reset, compute differences between two calls
+RLUADEF void rLuaGetAllocCounters(unsigned long long *count, unsigned long long *bytes)
+{
+    if (count != NULL) *count = allocProfiler.allocsCount;
+    if (bytes != NULL) *bytes = allocProfiler.allocsBytes;
+}
+
+// Count calls per raylib Lua function (registers counting wrappers)
+// NOTE: Call it after rLuaInitDevice(), before executing Lua code
+RLUADEF void rLuaEnableCallCounters(void)
+{
+    if (!mainLuaState || pipeline.enabled) return;
+
+    for (int i = 0; raylib_functions[i].name != NULL; i++)
+    {
+        lua_pushcfunction(L, raylib_functions[i].func);
+        lua_pushinteger(L, i);
+        lua_pushcclosure(L, LuaCountedCall, 2);
+        lua_setglobal(L, raylib_functions[i].name);
+    }
+
+    rLuaResetCallCounters();
+}
+
+// Reset raylib Lua functions calls counters
+RLUADEF void rLuaResetCallCounters(void)
+{
+    memset(callCounters, 0, sizeof(callCounters));
+}
+
+// Get calls count for function index (name is NULL past last function)
+RLUADEF unsigned int rLuaGetCallCount(int index, const char **name)
+{
+    if ((index < 0) || (index >= (int)(sizeof(raylib_functions)/sizeof(raylib_functions[0])))) index = sizeof(raylib_functions)/sizeof(raylib_functions[0]) - 1;
+
+    *name = raylib_functions[index].name;
+
+    return callCounters[index];
+}
+
+// Execute Lua code on a worker thread, frames drawn on calling thread (one frame latency)
+// NOTE: Call it after rLuaInitDevice(), before executing Lua code (replaces call counters wrappers).
+// Worker records drawing functions (shapes, textures, text, 3D shapes, models, drawing modes, SpriteBatch,
+// ParticleSystem) and reads input from a per-frame snapshot; other raylib functions run on calling thread while worker waits
+RLUADEF void rLuaEnablePipelinedMode(void)
+{
+#if !defined(RLUA_THREADS)
+    TraceLog(WARNING, "Pipelined mode requires threads, Lua code is executed on calling thread");
+    return;
+#endif
+
+    static const luaL_Reg snapshotFunctions[] = {
+        { "BeginDrawing", LuaPipelineBeginDrawing },
+        { "EndDrawing", LuaPipelineEndDrawing },
+        { "WindowShouldClose", LuaSnapshotWindowShouldClose },
+        { "GetScreenWidth", LuaSnapshotGetScreenWidth },
+        { "GetScreenHeight", LuaSnapshotGetScreenHeight },
+        { "GetFPS", LuaSnapshotGetFPS },
+        { "GetFrameTime", LuaSnapshotGetFrameTime },
+        { "GetTime", LuaSnapshotGetTime },
+        { "IsKeyPressed", LuaSnapshotIsKeyPressed },
+        { "IsKeyDown", LuaSnapshotIsKeyDown },
+        { "IsKeyReleased", LuaSnapshotIsKeyReleased },
+        { "IsKeyUp", LuaSnapshotIsKeyUp },
+        { "GetKeyPressed", LuaSnapshotGetKeyPressed },
+        { "IsGamepadAvailable", LuaSnapshotIsGamepadAvailable },
+        { "IsGamepadButtonPressed", LuaSnapshotIsGamepadButtonPressed },
+        { "IsGamepadButtonDown", LuaSnapshotIsGamepadButtonDown },
+        { "IsGamepadButtonReleased", LuaSnapshotIsGamepadButtonReleased },
+        { "IsGamepadButtonUp", LuaSnapshotIsGamepadButtonUp },
+        { "GetGamepadButtonPressed", LuaSnapshotGetGamepadButtonPressed },
+        { "GetGamepadAxisCount", LuaSnapshotGetGamepadAxisCount },
+        { "GetGamepadAxisMovement", LuaSnapshotGetGamepadAxisMovement },
+        { "IsMouseButtonPressed", LuaSnapshotIsMouseButtonPressed },
+        { "IsMouseButtonDown", LuaSnapshotIsMouseButtonDown },
+        { "IsMouseButtonReleased", LuaSnapshotIsMouseButtonReleased },
+        { "IsMouseButtonUp", LuaSnapshotIsMouseButtonUp },
+        { "GetMouseX", LuaSnapshotGetMouseX },
+        { "GetMouseY", LuaSnapshotGetMouseY },
+        { "GetMousePosition", LuaSnapshotGetMousePosition },
+        { "GetMouseWheelMove", LuaSnapshotGetMouseWheelMove },
+        { "IsGestureDetected", LuaSnapshotIsGestureDetected },
+        { "GetGestureDetected", LuaSnapshotGetGestureDetected },
+        { NULL, NULL }
+    };
+
+    if (!mainLuaState || pipeline.enabled) return;
+
+    for (int i = 0; raylib_functions[i].name != NULL; i++)
+    {
+        const char *name = raylib_functions[i].name;
+        int mode = PIPELINE_CALL_MAIN;
+
+        for (int k = 0; pipelineDirectFunctions[k] != NULL; k++)
+        {
+            if (strncmp(name, pipelineDirectFunctions[k], strlen(pipelineDirectFunctions[k])) == 0) mode = PIPELINE_CALL_DIRECT;
+        }
+
+        for (int k = 0; pipelineRecordedFunctions[k] != NULL; k++)
+        {
+            if (strcmp(name, pipelineRecordedFunctions[k]) == 0) mode = PIPELINE_CALL_RECORDED;
+        }
+
+        lua_pushcfunction(L, raylib_functions[i].func);
+        lua_pushinteger(L, mode);
+        lua_pushcclosure(L, LuaPipelinedCall, 2);
+        lua_setglobal(L, name);
+    }
+
+    lua_pushglobaltable(L);
+    luaL_setfuncs(L, snapshotFunctions, 0);
+    lua_pop(L, 1);
+
+    pthread_mutex_init(&pipeline.mutex, NULL);
+    pthread_cond_init(&pipeline.cond, NULL);
+    pipeline.enabled = true;
 }
 
 // Execute raylib Lua code
@@ -5749,7 +13266,7 @@ RLUADEF void rLuaExecuteCode(const char *code)
         return;
     }
 
-    int result = luaL_dostring(L, code);
+    int result = pipeline.enabled? PipelineExecute(code, false) : luaL_dostring(L, code);
 
     switch (result)
     {
@@ -5769,7 +13286,7 @@ RLUADEF void rLuaExecuteFile(const char *filename)
         return;
     }
 
-    int result = luaL_dofile(L, filename);
+    int result = pipeline.enabled? PipelineExecute(filename, true) : luaL_dofile(L, filename);
 
     switch (result)
     {
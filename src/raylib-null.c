@@ -0,0 +1,3675 @@
+/**********************************************************************************************
+*
+*   raylib-null - Headless (null) raylib backend for raylib-lua
+*
+*   Link this module instead of raylib library to run raylib Lua programs headless,
+*   check raylib-null.h for details on backend behaviour and scripted input API.
+*
+*   COMPILATION (GCC):
+*
+*   gcc -c raylib-null.c -I. -I<raylib>/src -std=c99 -Wall -O2
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2019 Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#if !defined(_POSIX_C_SOURCE)
+    #define _POSIX_C_SOURCE 199309L     // Required for clock_gettime()
+#endif
+
+#include "raylib.h"
+#include "raylib-null.h"
+
+#define RAYMATH_IMPLEMENTATION          // Real math functions, raylib-lua bindings call them
+#include "raymath.h"
+
+#include "rlgl.h"                       // rlgl immediate mode functions called by raylib-lua batches
+
+#if defined(NULL_SUPPORT_STB_IMAGE)
+    #define STB_IMAGE_IMPLEMENTATION
+    #define STBI_NO_THREAD_LOCALS
+    #include "external/stb_image.h"     // Required for: stbi_load()
+#endif
+
+#include <stdlib.h>             // Required for: malloc(), calloc(), free(), rand(), abs()
+#include <stdio.h>              // Required for: FILE, fopen(), vprintf(), vsprintf()
+#include <string.h>             // Required for: memcpy(), memset(), strlen(), strrchr(), strcmp()
+#include <stdarg.h>             // Required for: va_list, va_start(), va_end()
+#include <math.h>               // Required for: sqrtf(), fabsf(), floorf(), powf(), atan2f()
+
+#if defined(_WIN32)
+    #include <direct.h>         // Required for: _getcwd(), _chdir()
+    #define GETCWD _getcwd
+    #define CHDIR _chdir
+    #include <windows.h>        // Required for: QueryPerformanceCounter()
+    #undef DrawText             // Avoid windows.h macros collision with raylib functions
+    #undef LoadImage
+    #undef PlaySound
+    #undef CloseWindow
+    #undef ShowCursor
+#else
+    #include <unistd.h>         // Required for: getcwd(), chdir()
+    #define GETCWD getcwd
+    #define CHDIR chdir
+    #include <time.h>           // Required for: clock_gettime()
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define MAX_FILEPATH_LENGTH         512     // Maximum file path length (GetWorkingDirectory(), GetDirectoryPath())
+#define MAX_TEXT_BUFFER_LENGTH     1024     // Maximum text length (FormatText(), SubText())
+#define MAX_STORAGE_VALUES          256     // Maximum integer values stored by StorageSaveValue()
+#define DEFAULT_FONT_SIZE            10     // Default font base size (same as raylib)
+#define DEFAULT_FONT_CHARS          224     // Default font characters (from 32 to 255, same as raylib)
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Music type data, simulated playing time
+// NOTE: Music is defined as an opaque pointer to MusicData in raylib.h
+typedef struct MusicData {
+    float timeLength;       // Music length in seconds
+    float timePlayed;       // Music time played in seconds
+    int loopCount;          // Loops to play (0 = infinite)
+    bool playing;           // Music is playing
+} MusicData;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static NullStats stats = { 0 };                 // Backend calls counters
+
+static bool windowReady = false;                // Window initialized (no real window)
+static bool windowShouldClose = false;          // Close requested by host program
+static bool cursorHidden = false;               // Cursor hidden state
+static int screenWidth = 0;                     // Screen width
+static int screenHeight = 0;                    // Screen height
+static int frameLimit = 0;                      // Frames to draw before WindowShouldClose() (0 = no limit)
+static int frameCounter = 0;                    // Frames drawn
+static double frameTime = 1.0/60.0;             // Simulated time step, defined by SetTargetFPS()
+static double currentTime = 0.0;                // Simulated time since InitWindow()
+static unsigned char traceLogTypes = INFO | WARNING | ERROR;    // Trace log types enabled
+
+static NullFrameCallback frameCallback = NULL;  // Host program frame callback
+static void *frameCallbackUserData = NULL;      // Host program frame callback data
+
+static char currentKeyState[NULL_MAX_KEYS] = { 0 };                 // Keyboard keys state for current frame
+static char previousKeyState[NULL_MAX_KEYS] = { 0 };                // Keyboard keys state for previous frame
+static int lastKeyPressed = -1;                                     // Last key pressed (current frame)
+static int exitKey = KEY_ESCAPE;                                    // Key to close program
+static char currentMouseState[NULL_MAX_MOUSE_BUTTONS] = { 0 };      // Mouse buttons state for current frame
+static char previousMouseState[NULL_MAX_MOUSE_BUTTONS] = { 0 };     // Mouse buttons state for previous frame
+static Vector2 mousePosition = { 0.0f, 0.0f };                      // Mouse position
+static float mouseScale = 1.0f;                                     // Mouse position scaling
+static int mouseWheelMove = 0;                                      // Mouse wheel movement (current frame)
+static bool gamepadReady[NULL_MAX_GAMEPADS] = { 0 };                // Gamepads availability
+static char currentGamepadState[NULL_MAX_GAMEPADS][NULL_MAX_GAMEPAD_BUTTONS] = { 0 };  // Gamepads buttons state for current frame
+static char previousGamepadState[NULL_MAX_GAMEPADS][NULL_MAX_GAMEPAD_BUTTONS] = { 0 }; // Gamepads buttons state for previous frame
+static float gamepadAxisState[NULL_MAX_GAMEPADS][NULL_MAX_GAMEPAD_AXIS] = { 0 };       // Gamepads axis state
+static int lastGamepadButtonPressed = -1;                           // Last gamepad button pressed (current frame)
+static int gestureDetected = GESTURE_NONE;                          // Gesture detected (current frame)
+
+static int storageValues[MAX_STORAGE_VALUES] = { 0 };              // Values storage (in memory, no file)
+static unsigned int resourceIdCounter = 1;                          // GPU/audio resources fake ids
+
+static Font defaultFont = { 0 };                // Default font, approximated metrics
+static bool vrSimulatorReady = false;           // VR simulator state
+static bool audioDeviceReady = false;           // Audio device state
+static Matrix matProjection = { 0 };            // Projection matrix, SetMatrixProjection()
+static Matrix matModelview = { 0 };             // Modelview matrix, SetMatrixModelview()
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Declaration
+//----------------------------------------------------------------------------------
+static Color *GetColorDataRGBA(Image image);                    // Get image pixels as RGBA (32bit) array
+static void SetImageDataRGBA(Image *image, Color *pixels, int width, int height);  // Set image pixels from RGBA array, keeping image format
+static Mesh GenMeshBoxes(const BoundingBox *boxes, int count);  // Generate mesh with multiple boxes (placeholder geometry)
+static void LoadDefaultFont(void);                              // Init default font (approximated metrics)
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Null backend control
+//----------------------------------------------------------------------------------
+
+// WindowShouldClose() returns true after frames drawn (0 = no limit)
+void NullSetFrameLimit(int frames)
+{
+    frameLimit = frames;
+}
+
+// Set callback called at the end of every frame
+void NullSetFrameCallback(NullFrameCallback callback, void *userData)
+{
+    frameCallback = callback;
+    frameCallbackUserData = userData;
+}
+
+// Make WindowShouldClose() return true
+void NullRequestClose(void)
+{
+    windowShouldClose = true;
+}
+
+// Reset window, time and input state (before running a new program)
+void NullResetState(void)
+{
+    windowShouldClose = false;
+    cursorHidden = false;
+    frameCounter = 0;
+    frameTime = 1.0/60.0;
+    currentTime = 0.0;
+
+    memset(currentKeyState, 0, sizeof(currentKeyState));
+    memset(previousKeyState, 0, sizeof(previousKeyState));
+    memset(currentMouseState, 0, sizeof(currentMouseState));
+    memset(previousMouseState, 0, sizeof(previousMouseState));
+    memset(gamepadReady, 0, sizeof(gamepadReady));
+    memset(currentGamepadState, 0, sizeof(currentGamepadState));
+    memset(previousGamepadState, 0, sizeof(previousGamepadState));
+    memset(gamepadAxisState, 0, sizeof(gamepadAxisState));
+
+    lastKeyPressed = -1;
+    lastGamepadButtonPressed = -1;
+    exitKey = KEY_ESCAPE;
+    mousePosition = (Vector2){ 0.0f, 0.0f };
+    mouseScale = 1.0f;
+    mouseWheelMove = 0;
+    gestureDetected = GESTURE_NONE;
+}
+
+// Get backend calls counters
+NullStats NullGetStats(void)
+{
+    return stats;
+}
+
+// Reset backend calls counters
+void NullResetStats(void)
+{
+    memset(&stats, 0, sizeof(NullStats));
+}
+
+// Get wall clock time in seconds (high resolution)
+double NullGetWallTime(void)
+{
+#if defined(_WIN32)
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart/(double)frequency.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec*1e-9;
+#endif
+}
+
+// Set keyboard key state
+void NullSetKeyDown(int key, bool down)
+{
+    if ((key < 0) || (key >= NULL_MAX_KEYS)) return;
+
+    if (down && !currentKeyState[key]) lastKeyPressed = key;
+    currentKeyState[key] = down;
+}
+
+// Set mouse button state
+void NullSetMouseButtonDown(int button, bool down)
+{
+    if ((button >= 0) && (button < NULL_MAX_MOUSE_BUTTONS)) currentMouseState[button] = down;
+}
+
+// Set mouse wheel movement for current frame
+void NullSetMouseWheelMove(int move)
+{
+    mouseWheelMove = move;
+}
+
+// Set gamepad availability
+void NullSetGamepadAvailable(int gamepad, bool available)
+{
+    if ((gamepad >= 0) && (gamepad < NULL_MAX_GAMEPADS)) gamepadReady[gamepad] = available;
+}
+
+// Set gamepad button state
+void NullSetGamepadButtonDown(int gamepad, int button, bool down)
+{
+    if ((gamepad < 0) || (gamepad >= NULL_MAX_GAMEPADS) || (button < 0) || (button >= NULL_MAX_GAMEPAD_BUTTONS)) return;
+
+    if (down && !currentGamepadState[gamepad][button]) lastGamepadButtonPressed = button;
+    currentGamepadState[gamepad][button] = down;
+}
+
+// Set gamepad axis value
+void NullSetGamepadAxisMovement(int gamepad, int axis, float value)
+{
+    if ((gamepad >= 0) && (gamepad < NULL_MAX_GAMEPADS) && (axis >= 0) && (axis < NULL_MAX_GAMEPAD_AXIS)) gamepadAxisState[gamepad][axis] = value;
+}
+
+// Set gesture detected for current frame
+void NullSetGestureDetected(int gesture)
+{
+    gestureDetected = gesture;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Window and Graphics Device
+//----------------------------------------------------------------------------------
+
+// Initialize window (no window created)
+void InitWindow(int width, int height, const char *title)
+{
+    TraceLog(INFO, "Initializing raylib null backend (headless): %s", title);
+
+    screenWidth = width;
+    screenHeight = height;
+    windowReady = true;
+    currentTime = 0.0;
+
+    LoadDefaultFont();
+    matProjection = MatrixIdentity();
+    matModelview = MatrixIdentity();
+
+    stats.windowCalls++;
+}
+
+// Close window
+void CloseWindow(void)
+{
+    free(defaultFont.chars);
+    defaultFont.chars = NULL;
+    windowReady = false;
+    stats.windowCalls++;
+}
+
+// Check if window has been initialized successfully
+bool IsWindowReady(void)
+{
+    return windowReady;
+}
+
+// Check if close requested: frame limit reached, exit key pressed or host request
+bool WindowShouldClose(void)
+{
+    if (!windowReady) return true;
+    if ((frameLimit > 0) && (frameCounter >= frameLimit)) return true;
+    if ((exitKey >= 0) && (exitKey < NULL_MAX_KEYS) && currentKeyState[exitKey]) return true;
+
+    return windowShouldClose;
+}
+
+// Check if window has been minimized
+bool IsWindowMinimized(void) { return false; }
+
+// Window management functions, no window available
+void ToggleFullscreen(void) { stats.windowCalls++; }
+void SetWindowIcon(Image image) { stats.windowCalls++; }
+void SetWindowTitle(const char *title) { stats.windowCalls++; }
+void SetWindowPosition(int x, int y) { stats.windowCalls++; }
+void SetWindowMonitor(int monitor) { stats.windowCalls++; }
+void SetWindowMinSize(int width, int height) { stats.windowCalls++; }
+
+// Set window dimensions
+void SetWindowSize(int width, int height)
+{
+    screenWidth = width;
+    screenHeight = height;
+    stats.windowCalls++;
+}
+
+// Get current screen width
+int GetScreenWidth(void) { return screenWidth; }
+
+// Get current screen height
+int GetScreenHeight(void) { return screenHeight; }
+
+// Cursor-related functions
+void ShowCursor(void) { cursorHidden = false; stats.windowCalls++; }
+void HideCursor(void) { cursorHidden = true; stats.windowCalls++; }
+bool IsCursorHidden(void) { return cursorHidden; }
+void EnableCursor(void) { cursorHidden = false; stats.windowCalls++; }
+void DisableCursor(void) { cursorHidden = true; stats.windowCalls++; }
+
+// Drawing-related functions
+void ClearBackground(Color color) { stats.drawCalls++; }
+void BeginDrawing(void) { stats.modeCalls++; }
+
+// End frame: advance simulated time, update input state and call host frame callback
+void EndDrawing(void)
+{
+    stats.modeCalls++;
+    stats.frames++;
+    frameCounter++;
+    currentTime += frameTime;
+
+    // Input events polling: current state becomes previous state
+    memcpy(previousKeyState, currentKeyState, sizeof(currentKeyState));
+    memcpy(previousMouseState, currentMouseState, sizeof(currentMouseState));
+    memcpy(previousGamepadState, currentGamepadState, sizeof(currentGamepadState));
+    lastKeyPressed = -1;
+    lastGamepadButtonPressed = -1;
+    mouseWheelMove = 0;
+    gestureDetected = GESTURE_NONE;
+
+    if (frameCallback != NULL) frameCallback(frameCounter, frameCallbackUserData);
+}
+
+void BeginMode2D(Camera2D camera) { stats.modeCalls++; }
+void EndMode2D(void) { stats.modeCalls++; }
+void BeginMode3D(Camera3D camera) { stats.modeCalls++; }
+void EndMode3D(void) { stats.modeCalls++; }
+void BeginTextureMode(RenderTexture2D target) { stats.modeCalls++; }
+void EndTextureMode(void) { stats.modeCalls++; }
+
+// Get world-space position for a screen-space position (depth: 0.0 near plane, 1.0 far plane)
+static Vector3 UnprojectScreen(Vector3 source, Matrix proj, Matrix view)
+{
+    Matrix matViewProj = MatrixMultiply(view, proj);
+    MatrixInvert(&matViewProj);
+
+    Quaternion quat = { source.x, source.y, source.z, 1.0f };
+    QuaternionTransform(&quat, matViewProj);
+
+    return (Vector3){ quat.x/quat.w, quat.y/quat.w, quat.z/quat.w };
+}
+
+// Returns a ray trace from mouse position
+Ray GetMouseRay(Vector2 mousePosition, Camera camera)
+{
+    Ray ray = { 0 };
+
+    // Normalized device coordinates
+    float x = (2.0f*mousePosition.x)/(float)screenWidth - 1.0f;
+    float y = 1.0f - (2.0f*mousePosition.y)/(float)screenHeight;
+
+    Matrix matView = MatrixLookAt(camera.position, camera.target, camera.up);
+    Matrix matProj = MatrixPerspective(camera.fovy*DEG2RAD, (double)screenWidth/(double)screenHeight, 0.01, 1000.0);
+
+    Vector3 nearPoint = UnprojectScreen((Vector3){ x, y, 0.0f }, matProj, matView);
+    Vector3 farPoint = UnprojectScreen((Vector3){ x, y, 1.0f }, matProj, matView);
+
+    ray.position = camera.position;
+    ray.direction = VectorSubtract(farPoint, nearPoint);
+    VectorNormalize(&ray.direction);
+
+    return ray;
+}
+
+// Returns the screen space position for a 3d world space position
+Vector2 GetWorldToScreen(Vector3 position, Camera camera)
+{
+    Matrix matProj = MatrixPerspective(camera.fovy*DEG2RAD, (double)screenWidth/(double)screenHeight, 0.01, 1000.0);
+    Matrix matView = MatrixLookAt(camera.position, camera.target, camera.up);
+
+    Quaternion worldPos = { position.x, position.y, position.z, 1.0f };
+    QuaternionTransform(&worldPos, matView);
+    QuaternionTransform(&worldPos, matProj);
+
+    Vector3 ndcPos = { worldPos.x/worldPos.w, -worldPos.y/worldPos.w, worldPos.z/worldPos.w };
+
+    return (Vector2){ (ndcPos.x + 1.0f)/2.0f*(float)screenWidth, (ndcPos.y + 1.0f)/2.0f*(float)screenHeight };
+}
+
+// Returns camera transform matrix (view matrix)
+Matrix GetCameraMatrix(Camera camera)
+{
+    return MatrixLookAt(camera.position, camera.target, camera.up);
+}
+
+// Set target FPS, it defines simulated time step
+void SetTargetFPS(int fps)
+{
+    frameTime = (fps > 0)? 1.0/(double)fps : 1.0/60.0;
+}
+
+// Returns current FPS (simulated)
+int GetFPS(void) { return (int)(1.0/frameTime + 0.5); }
+
+// Returns time in seconds for last frame drawn (simulated)
+float GetFrameTime(void) { return (float)frameTime; }
+
+// Returns elapsed time in seconds since InitWindow() (simulated)
+double GetTime(void) { return currentTime; }
+
+// Returns hexadecimal value for a Color
+int ColorToInt(Color color)
+{
+    return (((int)color.r << 24) | ((int)color.g << 16) | ((int)color.b << 8) | (int)color.a);
+}
+
+// Returns color normalized as float [0..1]
+Vector4 ColorNormalize(Color color)
+{
+    return (Vector4){ (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+}
+
+// Returns HSV values for a Color
+// NOTE: Hue is returned as degrees [0..360]
+Vector3 ColorToHSV(Color color)
+{
+    Vector3 rgb = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+    Vector3 hsv = { 0.0f, 0.0f, 0.0f };
+
+    float min = (rgb.x < rgb.y)? rgb.x : rgb.y;
+    min = (min < rgb.z)? min : rgb.z;
+    float max = (rgb.x > rgb.y)? rgb.x : rgb.y;
+    max = (max > rgb.z)? max : rgb.z;
+    float delta = max - min;
+
+    hsv.z = max;
+
+    if ((delta < 0.00001f) || (max <= 0.0f)) return hsv;    // Undefined hue
+
+    hsv.y = delta/max;
+
+    if (rgb.x >= max) hsv.x = (rgb.y - rgb.z)/delta;                // Between yellow & magenta
+    else if (rgb.y >= max) hsv.x = 2.0f + (rgb.z - rgb.x)/delta;    // Between cyan & yellow
+    else hsv.x = 4.0f + (rgb.x - rgb.y)/delta;                      // Between magenta & cyan
+
+    hsv.x *= 60.0f;
+    if (hsv.x < 0.0f) hsv.x += 360.0f;
+
+    return hsv;
+}
+
+// Returns a Color struct from hexadecimal value
+Color GetColor(int hexValue)
+{
+    return (Color){ (unsigned char)(hexValue >> 24) & 0xff, (unsigned char)(hexValue >> 16) & 0xff,
+                    (unsigned char)(hexValue >> 8) & 0xff, (unsigned char)hexValue & 0xff };
+}
+
+// Color fade-in or fade-out, alpha goes from 0.0f to 1.0f
+Color Fade(Color color, float alpha)
+{
+    if (alpha < 0.0f) alpha = 0.0f;
+    else if (alpha > 1.0f) alpha = 1.0f;
+
+    return (Color){ color.r, color.g, color.b, (unsigned char)(255.0f*alpha) };
+}
+
+// Misc. functions
+void ShowLogo(void) { }
+void SetConfigFlags(unsigned char flags) { }
+
+// Enable trace log message types (bit flags based)
+void SetTraceLog(unsigned char types)
+{
+    traceLogTypes = types;
+}
+
+// Show trace log messages
+void TraceLog(int logType, const char *text, ...)
+{
+    if (!(traceLogTypes & logType)) return;
+
+    va_list args;
+    va_start(args, text);
+
+    switch (logType)
+    {
+        case INFO: printf("INFO: "); break;
+        case ERROR: printf("ERROR: "); break;
+        case WARNING: printf("WARNING: "); break;
+        case DEBUG: printf("DEBUG: "); break;
+        default: break;
+    }
+
+    vprintf(text, args);
+    printf("\n");
+
+    va_end(args);
+
+    if (logType == ERROR) exit(1);
+}
+
+// Takes a screenshot of current screen, nothing to save
+void TakeScreenshot(const char *fileName) { stats.resourceCalls++; }
+
+// Returns a random value between min and max (both included)
+int GetRandomValue(int min, int max)
+{
+    if (min > max)
+    {
+        int tmp = max;
+        max = min;
+        min = tmp;
+    }
+
+    return (rand()%(abs(max - min) + 1) + min);
+}
+
+// Check file extension
+bool IsFileExtension(const char *fileName, const char *ext)
+{
+    const char *fileExt = strrchr(fileName, '.');
+
+    return ((fileExt != NULL) && (strcmp(fileExt, ext) == 0));
+}
+
+// Get pointer to extension for a filename string
+const char *GetExtension(const char *fileName)
+{
+    const char *dot = strrchr(fileName, '.');
+
+    if (!dot || (dot == fileName)) return "";
+
+    return (dot + 1);
+}
+
+// Get pointer to filename for a path string
+const char *GetFileName(const char *filePath)
+{
+    const char *fileName = strrchr(filePath, '/');
+    const char *winFileName = strrchr(filePath, '\\');
+
+    if ((winFileName != NULL) && ((fileName == NULL) || (winFileName > fileName))) fileName = winFileName;
+
+    if (fileName == NULL) return filePath;
+
+    return (fileName + 1);
+}
+
+// Get full path for a given fileName (uses static string)
+const char *GetDirectoryPath(const char *fileName)
+{
+    static char filePath[MAX_FILEPATH_LENGTH];
+    memset(filePath, 0, MAX_FILEPATH_LENGTH);
+
+    const char *lastSlash = GetFileName(fileName);
+    int length = (int)(lastSlash - fileName);
+
+    if (length > 0) strncpy(filePath, fileName, (length < MAX_FILEPATH_LENGTH)? (length - 1) : (MAX_FILEPATH_LENGTH - 1));
+
+    return filePath;
+}
+
+// Get current working directory (uses static string)
+const char *GetWorkingDirectory(void)
+{
+    static char currentDir[MAX_FILEPATH_LENGTH];
+    memset(currentDir, 0, MAX_FILEPATH_LENGTH);
+
+    if (GETCWD(currentDir, MAX_FILEPATH_LENGTH - 1) == NULL) currentDir[0] = '\0';
+
+    return currentDir;
+}
+
+// Change working directory, returns true if success
+bool ChangeDirectory(const char *dir)
+{
+    bool result = (CHDIR(dir) == 0);
+
+    if (!result) TraceLog(WARNING, "Could not change to directory: %s", dir);
+
+    return result;
+}
+
+// No files dropped without window
+bool IsFileDropped(void) { return false; }
+
+// Get dropped files names
+char **GetDroppedFiles(int *count)
+{
+    *count = 0;
+    return NULL;
+}
+
+void ClearDroppedFiles(void) { }
+
+// Save integer value to storage (in memory, no file written)
+void StorageSaveValue(int position, int value)
+{
+    if ((position >= 0) && (position < MAX_STORAGE_VALUES)) storageValues[position] = value;
+}
+
+// Load integer value from storage (in memory)
+int StorageLoadValue(int position)
+{
+    if ((position >= 0) && (position < MAX_STORAGE_VALUES)) return storageValues[position];
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Input Handling (scripted)
+//----------------------------------------------------------------------------------
+
+// Detect if a key has been pressed once
+bool IsKeyPressed(int key)
+{
+    if ((key < 0) || (key >= NULL_MAX_KEYS)) return false;
+    return (currentKeyState[key] && !previousKeyState[key]);
+}
+
+// Detect if a key is being pressed
+bool IsKeyDown(int key)
+{
+    if ((key < 0) || (key >= NULL_MAX_KEYS)) return false;
+    return currentKeyState[key];
+}
+
+// Detect if a key has been released once
+bool IsKeyReleased(int key)
+{
+    if ((key < 0) || (key >= NULL_MAX_KEYS)) return false;
+    return (!currentKeyState[key] && previousKeyState[key]);
+}
+
+// Detect if a key is NOT being pressed
+bool IsKeyUp(int key)
+{
+    return !IsKeyDown(key);
+}
+
+// Get latest key pressed
+int GetKeyPressed(void) { return lastKeyPressed; }
+
+// Set a custom key to exit program
+void SetExitKey(int key) { exitKey = key; }
+
+// Detect if a gamepad is available
+bool IsGamepadAvailable(int gamepad)
+{
+    return ((gamepad >= 0) && (gamepad < NULL_MAX_GAMEPADS) && gamepadReady[gamepad]);
+}
+
+// Check gamepad name
+bool IsGamepadName(int gamepad, const char *name)
+{
+    return (IsGamepadAvailable(gamepad) && (strcmp(name, GetGamepadName(gamepad)) == 0));
+}
+
+// Return gamepad internal name id
+const char *GetGamepadName(int gamepad)
+{
+    return IsGamepadAvailable(gamepad)? "Null Gamepad" : NULL;
+}
+
+// Detect if a gamepad button has been pressed once
+bool IsGamepadButtonPressed(int gamepad, int button)
+{
+    if (!IsGamepadAvailable(gamepad) || (button < 0) || (button >= NULL_MAX_GAMEPAD_BUTTONS)) return false;
+    return (currentGamepadState[gamepad][button] && !previousGamepadState[gamepad][button]);
+}
+
+// Detect if a gamepad button is being pressed
+bool IsGamepadButtonDown(int gamepad, int button)
+{
+    if (!IsGamepadAvailable(gamepad) || (button < 0) || (button >= NULL_MAX_GAMEPAD_BUTTONS)) return false;
+    return currentGamepadState[gamepad][button];
+}
+
+// Detect if a gamepad button has been released once
+bool IsGamepadButtonReleased(int gamepad, int button)
+{
+    if (!IsGamepadAvailable(gamepad) || (button < 0) || (button >= NULL_MAX_GAMEPAD_BUTTONS)) return false;
+    return (!currentGamepadState[gamepad][button] && previousGamepadState[gamepad][button]);
+}
+
+// Detect if a gamepad button is NOT being pressed
+bool IsGamepadButtonUp(int gamepad, int button)
+{
+    return !IsGamepadButtonDown(gamepad, button);
+}
+
+// Get the last gamepad button pressed
+int GetGamepadButtonPressed(void) { return lastGamepadButtonPressed; }
+
+// Return gamepad axis count for a gamepad
+int GetGamepadAxisCount(int gamepad)
+{
+    return IsGamepadAvailable(gamepad)? NULL_MAX_GAMEPAD_AXIS : 0;
+}
+
+// Return axis movement value for a gamepad axis
+float GetGamepadAxisMovement(int gamepad, int axis)
+{
+    if (!IsGamepadAvailable(gamepad) || (axis < 0) || (axis >= NULL_MAX_GAMEPAD_AXIS)) return 0.0f;
+    return gamepadAxisState[gamepad][axis];
+}
+
+// Detect if a mouse button has been pressed once
+bool IsMouseButtonPressed(int button)
+{
+    if ((button < 0) || (button >= NULL_MAX_MOUSE_BUTTONS)) return false;
+    return (currentMouseState[button] && !previousMouseState[button]);
+}
+
+// Detect if a mouse button is being pressed
+bool IsMouseButtonDown(int button)
+{
+    if ((button < 0) || (button >= NULL_MAX_MOUSE_BUTTONS)) return false;
+    return currentMouseState[button];
+}
+
+// Detect if a mouse button has been released once
+bool IsMouseButtonReleased(int button)
+{
+    if ((button < 0) || (button >= NULL_MAX_MOUSE_BUTTONS)) return false;
+    return (!currentMouseState[button] && previousMouseState[button]);
+}
+
+// Detect if a mouse button is NOT being pressed
+bool IsMouseButtonUp(int button)
+{
+    return !IsMouseButtonDown(button);
+}
+
+// Returns mouse position X
+int GetMouseX(void) { return (int)(mousePosition.x*mouseScale); }
+
+// Returns mouse position Y
+int GetMouseY(void) { return (int)(mousePosition.y*mouseScale); }
+
+// Returns mouse position XY
+Vector2 GetMousePosition(void)
+{
+    return (Vector2){ mousePosition.x*mouseScale, mousePosition.y*mouseScale };
+}
+
+// Set mouse position XY, also used by host program to script mouse movement
+void SetMousePosition(Vector2 position)
+{
+    mousePosition = position;
+}
+
+// Set mouse scaling
+void SetMouseScale(float scale) { mouseScale = scale; }
+
+// Returns mouse wheel movement Y
+int GetMouseWheelMove(void) { return mouseWheelMove; }
+
+// Returns touch position X (mouse position)
+int GetTouchX(void) { return GetMouseX(); }
+
+// Returns touch position Y (mouse position)
+int GetTouchY(void) { return GetMouseY(); }
+
+// Returns touch position XY for a touch point index (mouse position)
+Vector2 GetTouchPosition(int index)
+{
+    return (index == 0)? GetMousePosition() : (Vector2){ -1.0f, -1.0f };
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Gestures (scripted)
+//----------------------------------------------------------------------------------
+void SetGesturesEnabled(unsigned int gestureFlags) { }
+bool IsGestureDetected(int gesture) { return ((gestureDetected & gesture) == gesture) && (gesture != GESTURE_NONE); }
+int GetGestureDetected(void) { return gestureDetected; }
+int GetTouchPointsCount(void) { return IsMouseButtonDown(0)? 1 : 0; }
+float GetGestureHoldDuration(void) { return 0.0f; }
+Vector2 GetGestureDragVector(void) { return (Vector2){ 0.0f, 0.0f }; }
+float GetGestureDragAngle(void) { return 0.0f; }
+Vector2 GetGesturePinchVector(void) { return (Vector2){ 0.0f, 0.0f }; }
+float GetGesturePinchAngle(void) { return 0.0f; }
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Camera System
+// NOTE: Camera is not updated, scripted input does not drive camera system
+//----------------------------------------------------------------------------------
+void SetCameraMode(Camera camera, int mode) { }
+void UpdateCamera(Camera *camera) { }
+void SetCameraPanControl(int panKey) { }
+void SetCameraAltControl(int altKey) { }
+void SetCameraSmoothZoomControl(int szKey) { }
+void SetCameraMoveControls(int frontKey, int backKey, int rightKey, int leftKey, int upKey, int downKey) { }
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Basic Shapes Drawing and Collisions
+//----------------------------------------------------------------------------------
+void DrawPixel(int posX, int posY, Color color) { stats.drawCalls++; }
+void DrawPixelV(Vector2 position, Color color) { stats.drawCalls++; }
+void DrawLine(int startPosX, int startPosY, int endPosX, int endPosY, Color color) { stats.drawCalls++; }
+void DrawLineV(Vector2 startPos, Vector2 endPos, Color color) { stats.drawCalls++; }
+void DrawLineEx(Vector2 startPos, Vector2 endPos, float thick, Color color) { stats.drawCalls++; }
+void DrawLineBezier(Vector2 startPos, Vector2 endPos, float thick, Color color) { stats.drawCalls++; }
+void DrawCircle(int centerX, int centerY, float radius, Color color) { stats.drawCalls++; }
+void DrawCircleGradient(int centerX, int centerY, float radius, Color color1, Color color2) { stats.drawCalls++; }
+void DrawCircleV(Vector2 center, float radius, Color color) { stats.drawCalls++; }
+void DrawCircleLines(int centerX, int centerY, float radius, Color color) { stats.drawCalls++; }
+void DrawRectangle(int posX, int posY, int width, int height, Color color) { stats.drawCalls++; }
+void DrawRectangleV(Vector2 position, Vector2 size, Color color) { stats.drawCalls++; }
+void DrawRectangleRec(Rectangle rec, Color color) { stats.drawCalls++; }
+void DrawRectanglePro(Rectangle rec, Vector2 origin, float rotation, Color color) { stats.drawCalls++; }
+void DrawRectangleGradientV(int posX, int posY, int width, int height, Color color1, Color color2) { stats.drawCalls++; }
+void DrawRectangleGradientH(int posX, int posY, int width, int height, Color color1, Color color2) { stats.drawCalls++; }
+void DrawRectangleGradientEx(Rectangle rec, Color col1, Color col2, Color col3, Color col4) { stats.drawCalls++; }
+void DrawRectangleLines(int posX, int posY, int width, int height, Color color) { stats.drawCalls++; }
+void DrawRectangleLinesEx(Rectangle rec, int lineThick, Color color) { stats.drawCalls++; }
+void DrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color) { stats.drawCalls++; }
+void DrawTriangleLines(Vector2 v1, Vector2 v2, Vector2 v3, Color color) { stats.drawCalls++; }
+void DrawPoly(Vector2 center, int sides, float radius, float rotation, Color color) { stats.drawCalls++; }
+void DrawPolyEx(Vector2 *points, int numPoints, Color color) { stats.drawCalls++; }
+void DrawPolyExLines(Vector2 *points, int numPoints, Color color) { stats.drawCalls++; }
+
+// Check collision between two rectangles
+bool CheckCollisionRecs(Rectangle rec1, Rectangle rec2)
+{
+    return ((rec1.x < (rec2.x + rec2.width)) && ((rec1.x + rec1.width) > rec2.x) &&
+            (rec1.y < (rec2.y + rec2.height)) && ((rec1.y + rec1.height) > rec2.y));
+}
+
+// Check collision between two circles
+bool CheckCollisionCircles(Vector2 center1, float radius1, Vector2 center2, float radius2)
+{
+    float dx = center2.x - center1.x;
+    float dy = center2.y - center1.y;
+
+    return (sqrtf(dx*dx + dy*dy) <= (radius1 + radius2));
+}
+
+// Check collision between circle and rectangle
+bool CheckCollisionCircleRec(Vector2 center, float radius, Rectangle rec)
+{
+    float dx = fabsf(center.x - (rec.x + rec.width/2.0f));
+    float dy = fabsf(center.y - (rec.y + rec.height/2.0f));
+
+    if (dx > (rec.width/2.0f + radius)) return false;
+    if (dy > (rec.height/2.0f + radius)) return false;
+
+    if (dx <= (rec.width/2.0f)) return true;
+    if (dy <= (rec.height/2.0f)) return true;
+
+    float cornerDistanceSq = (dx - rec.width/2.0f)*(dx - rec.width/2.0f) + (dy - rec.height/2.0f)*(dy - rec.height/2.0f);
+
+    return (cornerDistanceSq <= (radius*radius));
+}
+
+// Get collision rectangle for two rectangles collision
+Rectangle GetCollisionRec(Rectangle rec1, Rectangle rec2)
+{
+    Rectangle retRec = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+    if (CheckCollisionRecs(rec1, rec2))
+    {
+        float left = (rec1.x > rec2.x)? rec1.x : rec2.x;
+        float right = ((rec1.x + rec1.width) < (rec2.x + rec2.width))? (rec1.x + rec1.width) : (rec2.x + rec2.width);
+        float top = (rec1.y > rec2.y)? rec1.y : rec2.y;
+        float bottom = ((rec1.y + rec1.height) < (rec2.y + rec2.height))? (rec1.y + rec1.height) : (rec2.y + rec2.height);
+
+        retRec = (Rectangle){ left, top, right - left, bottom - top };
+    }
+
+    return retRec;
+}
+
+// Check if point is inside rectangle
+bool CheckCollisionPointRec(Vector2 point, Rectangle rec)
+{
+    return ((point.x >= rec.x) && (point.x <= (rec.x + rec.width)) && (point.y >= rec.y) && (point.y <= (rec.y + rec.height)));
+}
+
+// Check if point is inside circle
+bool CheckCollisionPointCircle(Vector2 point, Vector2 center, float radius)
+{
+    return CheckCollisionCircles(point, 0.0f, center, radius);
+}
+
+// Check if point is inside a triangle defined by three points (p1, p2, p3)
+bool CheckCollisionPointTriangle(Vector2 point, Vector2 p1, Vector2 p2, Vector2 p3)
+{
+    float alpha = ((p2.y - p3.y)*(point.x - p3.x) + (p3.x - p2.x)*(point.y - p3.y)) /
+                  ((p2.y - p3.y)*(p1.x - p3.x) + (p3.x - p2.x)*(p1.y - p3.y));
+
+    float beta = ((p3.y - p1.y)*(point.x - p3.x) + (p1.x - p3.x)*(point.y - p3.y)) /
+                 ((p2.y - p3.y)*(p1.x - p3.x) + (p3.x - p2.x)*(p1.y - p3.y));
+
+    float gamma = 1.0f - alpha - beta;
+
+    return ((alpha > 0) && (beta > 0) && (gamma > 0));
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Image and Texture Loading and Manipulation
+//----------------------------------------------------------------------------------
+
+// Load image from file into CPU memory (RAM)
+// NOTE: Without NULL_SUPPORT_STB_IMAGE a placeholder image (checked, 64x64) is generated
+Image LoadImage(const char *fileName)
+{
+    Image image = { 0 };
+
+#if defined(NULL_SUPPORT_STB_IMAGE)
+    int comp = 0;
+    image.data = stbi_load(fileName, &image.width, &image.height, &comp, 0);
+    image.mipmaps = 1;
+
+    if (comp == 1) image.format = UNCOMPRESSED_GRAYSCALE;
+    else if (comp == 2) image.format = UNCOMPRESSED_GRAY_ALPHA;
+    else if (comp == 3) image.format = UNCOMPRESSED_R8G8B8;
+    else if (comp == 4) image.format = UNCOMPRESSED_R8G8B8A8;
+
+    if (image.data == NULL) TraceLog(WARNING, "[%s] Image could not be loaded", fileName);
+#else
+    image = GenImageChecked(64, 64, 8, 8, MAGENTA, BLACK);
+    TraceLog(DEBUG, "[%s] Image placeholder generated (null backend)", fileName);
+#endif
+
+    stats.resourceCalls++;
+
+    return image;
+}
+
+// Load image from Color array data (RGBA - 32bit)
+Image LoadImageEx(Color *pixels, int width, int height)
+{
+    Image image = { 0 };
+
+    image.data = malloc(width*height*sizeof(Color));
+    memcpy(image.data, pixels, width*height*sizeof(Color));
+    image.width = width;
+    image.height = height;
+    image.mipmaps = 1;
+    image.format = UNCOMPRESSED_R8G8B8A8;
+
+    return image;
+}
+
+// Load image from raw data with parameters
+// NOTE: This functions makes a copy of provided data
+Image LoadImagePro(void *data, int width, int height, int format)
+{
+    Image srcImage = { data, width, height, 1, format };
+
+    return ImageCopy(srcImage);
+}
+
+// Load an image from RAW file data
+Image LoadImageRaw(const char *fileName, int width, int height, int format, int headerSize)
+{
+    Image image = { 0 };
+    FILE *rawFile = fopen(fileName, "rb");
+
+    if (rawFile == NULL) TraceLog(WARNING, "[%s] RAW image file could not be opened", fileName);
+    else
+    {
+        int size = GetPixelDataSize(width, height, format);
+
+        if (headerSize > 0) fseek(rawFile, headerSize, SEEK_SET);
+
+        image.data = calloc(size, 1);
+
+        if (fread(image.data, 1, size, rawFile) < (size_t)size) TraceLog(WARNING, "[%s] RAW image data can not be read, wrong requested format or size", fileName);
+
+        image.width = width;
+        image.height = height;
+        image.mipmaps = 1;
+        image.format = format;
+
+        fclose(rawFile);
+    }
+
+    return image;
+}
+
+// Export image as a PNG file, nothing written
+void ExportImage(const char *fileName, Image image) { stats.resourceCalls++; }
+
+// Load texture from file into GPU memory (VRAM)
+Texture2D LoadTexture(const char *fileName)
+{
+    Image image = LoadImage(fileName);
+    Texture2D texture = LoadTextureFromImage(image);
+    UnloadImage(image);
+
+    return texture;
+}
+
+// Load a texture from image data (fake texture id, only size and format are kept)
+Texture2D LoadTextureFromImage(Image image)
+{
+    Texture2D texture = { 0 };
+
+    if (image.data != NULL)
+    {
+        texture.id = resourceIdCounter++;
+        texture.width = image.width;
+        texture.height = image.height;
+        texture.mipmaps = image.mipmaps;
+        texture.format = image.format;
+    }
+
+    stats.resourceCalls++;
+
+    return texture;
+}
+
+// Load texture for rendering (framebuffer)
+RenderTexture2D LoadRenderTexture(int width, int height)
+{
+    RenderTexture2D target = { 0 };
+
+    target.id = resourceIdCounter++;
+    target.texture = (Texture2D){ resourceIdCounter++, width, height, 1, UNCOMPRESSED_R8G8B8A8 };
+    target.depth = (Texture2D){ resourceIdCounter++, width, height, 1, 19 };     // 19 = DEPTH_COMPONENT_24BIT
+
+    stats.resourceCalls++;
+
+    return target;
+}
+
+// Unload image from CPU memory (RAM)
+void UnloadImage(Image image)
+{
+    free(image.data);
+}
+
+void UnloadTexture(Texture2D texture) { stats.resourceCalls++; }
+void UnloadRenderTexture(RenderTexture2D target) { stats.resourceCalls++; }
+
+// Get pixel data from image in the form of Color struct array
+static Color *GetColorDataRGBA(Image image)
+{
+    Color *pixels = (Color *)calloc(image.width*image.height, sizeof(Color));
+
+    if (image.format >= COMPRESSED_DXT1_RGB)
+    {
+        TraceLog(WARNING, "Pixel data retrieval not supported for compressed image formats");
+        return pixels;
+    }
+
+    unsigned char *data = (unsigned char *)image.data;
+
+    for (int i = 0, k = 0; i < image.width*image.height; i++)
+    {
+        switch (image.format)
+        {
+            case UNCOMPRESSED_GRAYSCALE:
+            {
+                pixels[i] = (Color){ data[i], data[i], data[i], 255 };
+            } break;
+            case UNCOMPRESSED_GRAY_ALPHA:
+            {
+                pixels[i] = (Color){ data[k], data[k], data[k], data[k + 1] };
+                k += 2;
+            } break;
+            case UNCOMPRESSED_R5G5B5A1:
+            {
+                unsigned short pixel = ((unsigned short *)data)[i];
+                pixels[i] = (Color){ (unsigned char)((float)((pixel & 0xF800) >> 11)*(255.0f/31)), (unsigned char)((float)((pixel & 0x7C0) >> 6)*(255.0f/31)),
+                                     (unsigned char)((float)((pixel & 0x3E) >> 1)*(255.0f/31)), (unsigned char)((pixel & 0x1)*255) };
+            } break;
+            case UNCOMPRESSED_R5G6B5:
+            {
+                unsigned short pixel = ((unsigned short *)data)[i];
+                pixels[i] = (Color){ (unsigned char)((float)((pixel & 0xF800) >> 11)*(255.0f/31)), (unsigned char)((float)((pixel & 0x7E0) >> 5)*(255.0f/63)),
+                                     (unsigned char)((float)(pixel & 0x1F)*(255.0f/31)), 255 };
+            } break;
+            case UNCOMPRESSED_R4G4B4A4:
+            {
+                unsigned short pixel = ((unsigned short *)data)[i];
+                pixels[i] = (Color){ (unsigned char)((float)((pixel & 0xF000) >> 12)*(255.0f/15)), (unsigned char)((float)((pixel & 0xF00) >> 8)*(255.0f/15)),
+                                     (unsigned char)((float)((pixel & 0xF0) >> 4)*(255.0f/15)), (unsigned char)((float)(pixel & 0xF)*(255.0f/15)) };
+            } break;
+            case UNCOMPRESSED_R8G8B8A8:
+            {
+                pixels[i] = (Color){ data[k], data[k + 1], data[k + 2], data[k + 3] };
+                k += 4;
+            } break;
+            case UNCOMPRESSED_R8G8B8:
+            {
+                pixels[i] = (Color){ data[k], data[k + 1], data[k + 2], 255 };
+                k += 3;
+            } break;
+            case UNCOMPRESSED_R32:
+            {
+                unsigned char value = (unsigned char)(((float *)data)[i]*255.0f);
+                pixels[i] = (Color){ value, value, value, 255 };
+            } break;
+            case UNCOMPRESSED_R32G32B32:
+            {
+                float *values = (float *)data;
+                pixels[i] = (Color){ (unsigned char)(values[k]*255.0f), (unsigned char)(values[k + 1]*255.0f), (unsigned char)(values[k + 2]*255.0f), 255 };
+                k += 3;
+            } break;
+            case UNCOMPRESSED_R32G32B32A32:
+            {
+                float *values = (float *)data;
+                pixels[i] = (Color){ (unsigned char)(values[k]*255.0f), (unsigned char)(values[k + 1]*255.0f),
+                                     (unsigned char)(values[k + 2]*255.0f), (unsigned char)(values[k + 3]*255.0f) };
+                k += 4;
+            } break;
+            default: break;
+        }
+    }
+
+    return pixels;
+}
+
+// Set image pixels from RGBA array, converted to current image format
+// NOTE: Previous image data is freed, mipmaps are not kept (compressed formats become RGBA)
+static void SetImageDataRGBA(Image *image, Color *pixels, int width, int height)
+{
+    if (image->format >= COMPRESSED_DXT1_RGB) image->format = UNCOMPRESSED_R8G8B8A8;
+
+    free(image->data);
+    image->data = malloc(GetPixelDataSize(width, height, image->format));
+    image->width = width;
+    image->height = height;
+    image->mipmaps = 1;
+
+    unsigned char *data = (unsigned char *)image->data;
+
+    for (int i = 0, k = 0; i < width*height; i++)
+    {
+        Color c = pixels[i];
+
+        switch (image->format)
+        {
+            case UNCOMPRESSED_GRAYSCALE:
+            {
+                data[i] = (unsigned char)((float)c.r*0.299f + (float)c.g*0.587f + (float)c.b*0.114f);
+            } break;
+            case UNCOMPRESSED_GRAY_ALPHA:
+            {
+                data[k] = (unsigned char)((float)c.r*0.299f + (float)c.g*0.587f + (float)c.b*0.114f);
+                data[k + 1] = c.a;
+                k += 2;
+            } break;
+            case UNCOMPRESSED_R5G6B5:
+            {
+                unsigned char r = (unsigned char)(roundf((float)c.r*31.0f/255.0f));
+                unsigned char g = (unsigned char)(roundf((float)c.g*63.0f/255.0f));
+                unsigned char b = (unsigned char)(roundf((float)c.b*31.0f/255.0f));
+                ((unsigned short *)data)[i] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+            } break;
+            case UNCOMPRESSED_R5G5B5A1:
+            {
+                unsigned char r = (unsigned char)(roundf((float)c.r*31.0f/255.0f));
+                unsigned char g = (unsigned char)(roundf((float)c.g*31.0f/255.0f));
+                unsigned char b = (unsigned char)(roundf((float)c.b*31.0f/255.0f));
+                unsigned char a = (c.a > 50)? 1 : 0;
+                ((unsigned short *)data)[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+            } break;
+            case UNCOMPRESSED_R4G4B4A4:
+            {
+                unsigned char r = (unsigned char)(roundf((float)c.r*15.0f/255.0f));
+                unsigned char g = (unsigned char)(roundf((float)c.g*15.0f/255.0f));
+                unsigned char b = (unsigned char)(roundf((float)c.b*15.0f/255.0f));
+                unsigned char a = (unsigned char)(roundf((float)c.a*15.0f/255.0f));
+                ((unsigned short *)data)[i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+            } break;
+            case UNCOMPRESSED_R8G8B8:
+            {
+                data[k] = c.r;
+                data[k + 1] = c.g;
+                data[k + 2] = c.b;
+                k += 3;
+            } break;
+            case UNCOMPRESSED_R8G8B8A8:
+            {
+                ((Color *)data)[i] = c;
+            } break;
+            case UNCOMPRESSED_R32:
+            {
+                ((float *)data)[i] = ((float)c.r*0.299f + (float)c.g*0.587f + (float)c.b*0.114f)/255.0f;
+            } break;
+            case UNCOMPRESSED_R32G32B32:
+            {
+                ((float *)data)[k] = (float)c.r/255.0f;
+                ((float *)data)[k + 1] = (float)c.g/255.0f;
+                ((float *)data)[k + 2] = (float)c.b/255.0f;
+                k += 3;
+            } break;
+            case UNCOMPRESSED_R32G32B32A32:
+            {
+                ((float *)data)[k] = (float)c.r/255.0f;
+                ((float *)data)[k + 1] = (float)c.g/255.0f;
+                ((float *)data)[k + 2] = (float)c.b/255.0f;
+                ((float *)data)[k + 3] = (float)c.a/255.0f;
+                k += 4;
+            } break;
+            default: break;
+        }
+    }
+}
+
+// Get pixel data from image as a Color struct array
+Color *GetImageData(Image image)
+{
+    return GetColorDataRGBA(image);
+}
+
+// Get pixel data from image as Vector4 array (float normalized)
+Vector4 *GetImageDataNormalized(Image image)
+{
+    Color *pixels = GetColorDataRGBA(image);
+    Vector4 *normPixels = (Vector4 *)malloc(image.width*image.height*sizeof(Vector4));
+
+    for (int i = 0; i < image.width*image.height; i++) normPixels[i] = ColorNormalize(pixels[i]);
+
+    free(pixels);
+
+    return normPixels;
+}
+
+// Get pixel data size in bytes (image or texture)
+int GetPixelDataSize(int width, int height, int format)
+{
+    int bpp = 0;    // Bits per pixel
+
+    switch (format)
+    {
+        case UNCOMPRESSED_GRAYSCALE: bpp = 8; break;
+        case UNCOMPRESSED_GRAY_ALPHA:
+        case UNCOMPRESSED_R5G6B5:
+        case UNCOMPRESSED_R5G5B5A1:
+        case UNCOMPRESSED_R4G4B4A4: bpp = 16; break;
+        case UNCOMPRESSED_R8G8B8A8: bpp = 32; break;
+        case UNCOMPRESSED_R8G8B8: bpp = 24; break;
+        case UNCOMPRESSED_R32: bpp = 32; break;
+        case UNCOMPRESSED_R32G32B32: bpp = 32*3; break;
+        case UNCOMPRESSED_R32G32B32A32: bpp = 32*4; break;
+        case COMPRESSED_DXT1_RGB:
+        case COMPRESSED_DXT1_RGBA:
+        case COMPRESSED_ETC1_RGB:
+        case COMPRESSED_ETC2_RGB:
+        case COMPRESSED_PVRT_RGB:
+        case COMPRESSED_PVRT_RGBA: bpp = 4; break;
+        case COMPRESSED_DXT3_RGBA:
+        case COMPRESSED_DXT5_RGBA:
+        case COMPRESSED_ETC2_EAC_RGBA:
+        case COMPRESSED_ASTC_4x4_RGBA: bpp = 8; break;
+        case COMPRESSED_ASTC_8x8_RGBA: bpp = 2; break;
+        default: break;
+    }
+
+    return width*height*bpp/8;
+}
+
+// Get pixel data from GPU texture, no data available (blank image)
+Image GetTextureData(Texture2D texture)
+{
+    Image image = GenImageColor(texture.width, texture.height, BLANK);
+    stats.resourceCalls++;
+
+    return image;
+}
+
+void UpdateTexture(Texture2D texture, const void *pixels) { stats.resourceCalls++; }
+
+// Create an image duplicate (useful for transformations)
+Image ImageCopy(Image image)
+{
+    Image newImage = { 0 };
+
+    int width = image.width;
+    int height = image.height;
+    int size = 0;
+
+    for (int i = 0; i < image.mipmaps; i++)
+    {
+        size += GetPixelDataSize(width, height, image.format);
+
+        width /= 2;
+        height /= 2;
+
+        // Security check for NPOT textures
+        if (width < 1) width = 1;
+        if (height < 1) height = 1;
+    }
+
+    newImage.data = malloc(size);
+
+    if (newImage.data != NULL)
+    {
+        memcpy(newImage.data, image.data, size);
+
+        newImage.width = image.width;
+        newImage.height = image.height;
+        newImage.mipmaps = image.mipmaps;
+        newImage.format = image.format;
+    }
+
+    return newImage;
+}
+
+// Convert image to POT (power-of-two)
+void ImageToPOT(Image *image, Color fillColor)
+{
+    int potWidth = (int)powf(2, ceilf(logf((float)image->width)/logf(2)));
+    int potHeight = (int)powf(2, ceilf(logf((float)image->height)/logf(2)));
+
+    if ((potWidth != image->width) || (potHeight != image->height)) ImageResizeCanvas(image, potWidth, potHeight, 0, 0, fillColor);
+}
+
+// Convert image data to desired format
+void ImageFormat(Image *image, int newFormat)
+{
+    if ((newFormat != 0) && (image->format != newFormat))
+    {
+        if ((image->format < COMPRESSED_DXT1_RGB) && (newFormat < COMPRESSED_DXT1_RGB))
+        {
+            Color *pixels = GetColorDataRGBA(*image);
+            int mipmaps = image->mipmaps;
+
+            image->format = newFormat;
+            SetImageDataRGBA(image, pixels, image->width, image->height);
+            free(pixels);
+
+            if (mipmaps > 1) ImageMipmaps(image);
+        }
+        else TraceLog(WARNING, "Image data format is compressed, can not be converted");
+    }
+}
+
+// Apply alpha mask to image
+// NOTE: Alpha mask is converted to grayscale, result image format is RGBA
+void ImageAlphaMask(Image *image, Image alphaMask)
+{
+    if ((image->width != alphaMask.width) || (image->height != alphaMask.height))
+    {
+        TraceLog(WARNING, "Alpha mask must be same size as image");
+        return;
+    }
+
+    Color *pixels = GetColorDataRGBA(*image);
+    Color *maskPixels = GetColorDataRGBA(alphaMask);
+
+    for (int i = 0; i < image->width*image->height; i++)
+    {
+        pixels[i].a = (unsigned char)((float)maskPixels[i].r*0.299f + (float)maskPixels[i].g*0.587f + (float)maskPixels[i].b*0.114f);
+    }
+
+    image->format = UNCOMPRESSED_R8G8B8A8;
+    SetImageDataRGBA(image, pixels, image->width, image->height);
+
+    free(maskPixels);
+    free(pixels);
+}
+
+// Clear alpha channel to desired color
+// NOTE: Threshold defines the alpha limit, 0.0f to 1.0f
+void ImageAlphaClear(Image *image, Color color, float threshold)
+{
+    Color *pixels = GetColorDataRGBA(*image);
+
+    for (int i = 0; i < image->width*image->height; i++) if (pixels[i].a <= (unsigned char)(threshold*255.0f)) pixels[i] = color;
+
+    SetImageDataRGBA(image, pixels, image->width, image->height);
+    free(pixels);
+}
+
+// Crop image depending on alpha value
+void ImageAlphaCrop(Image *image, float threshold)
+{
+    Color *pixels = GetColorDataRGBA(*image);
+
+    int xMin = image->width, xMax = -1;
+    int yMin = image->height, yMax = -1;
+
+    for (int y = 0; y < image->height; y++)
+    {
+        for (int x = 0; x < image->width; x++)
+        {
+            if (pixels[y*image->width + x].a > (unsigned char)(threshold*255.0f))
+            {
+                if (x < xMin) xMin = x;
+                if (x > xMax) xMax = x;
+                if (y < yMin) yMin = y;
+                if (y > yMax) yMax = y;
+            }
+        }
+    }
+
+    free(pixels);
+
+    if (xMax >= 0) ImageCrop(image, (Rectangle){ (float)xMin, (float)yMin, (float)(xMax - xMin + 1), (float)(yMax - yMin + 1) });
+}
+
+// Premultiply alpha channel
+void ImageAlphaPremultiply(Image *image)
+{
+    Color *pixels = GetColorDataRGBA(*image);
+
+    for (int i = 0; i < image->width*image->height; i++)
+    {
+        float alpha = (float)pixels[i].a/255.0f;
+        pixels[i].r = (unsigned char)((float)pixels[i].r*alpha);
+        pixels[i].g = (unsigned char)((float)pixels[i].g*alpha);
+        pixels[i].b = (unsigned char)((float)pixels[i].b*alpha);
+    }
+
+    SetImageDataRGBA(image, pixels, image->width, image->height);
+    free(pixels);
+}
+
+// Crop an image to area defined by a rectangle
+// NOTE: Security checks are performed in case rectangle goes out of bounds
+void ImageCrop(Image *image, Rectangle crop)
+{
+    if (crop.x < 0) { crop.width += crop.x; crop.x = 0; }
+    if (crop.y < 0) { crop.height += crop.y; crop.y = 0; }
+    if ((crop.x + crop.width) > image->width) crop.width = image->width - crop.x;
+    if ((crop.y + crop.height) > image->height) crop.height = image->height - crop.y;
+
+    if ((crop.width < 1) || (crop.height < 1))
+    {
+        TraceLog(WARNING, "Image can not be cropped, crop rectangle out of bounds");
+        return;
+    }
+
+    Color *pixels = GetColorDataRGBA(*image);
+    Color *cropPixels = (Color *)malloc((int)crop.width*(int)crop.height*sizeof(Color));
+
+    for (int y = 0; y < (int)crop.height; y++)
+    {
+        memcpy(cropPixels + y*(int)crop.width, pixels + ((int)crop.y + y)*image->width + (int)crop.x, (int)crop.width*sizeof(Color));
+    }
+
+    SetImageDataRGBA(image, cropPixels, (int)crop.width, (int)crop.height);
+
+    free(cropPixels);
+    free(pixels);
+}
+
+// Resize image (bilinear filtering)
+void ImageResize(Image *image, int newWidth, int newHeight)
+{
+    if ((newWidth < 1) || (newHeight < 1)) return;
+
+    Color *pixels = GetColorDataRGBA(*image);
+    Color *output = (Color *)malloc(newWidth*newHeight*sizeof(Color));
+
+    float xRatio = (newWidth > 1)? (float)(image->width - 1)/(float)(newWidth - 1) : 0.0f;
+    float yRatio = (newHeight > 1)? (float)(image->height - 1)/(float)(newHeight - 1) : 0.0f;
+
+    for (int y = 0; y < newHeight; y++)
+    {
+        float sy = y*yRatio;
+        int y0 = (int)sy;
+        int y1 = (y0 < (image->height - 1))? y0 + 1 : y0;
+        float fy = sy - y0;
+
+        for (int x = 0; x < newWidth; x++)
+        {
+            float sx = x*xRatio;
+            int x0 = (int)sx;
+            int x1 = (x0 < (image->width - 1))? x0 + 1 : x0;
+            float fx = sx - x0;
+
+            Color c00 = pixels[y0*image->width + x0];
+            Color c10 = pixels[y0*image->width + x1];
+            Color c01 = pixels[y1*image->width + x0];
+            Color c11 = pixels[y1*image->width + x1];
+
+            #define BILERP(ch) (unsigned char)((c00.ch*(1 - fx) + c10.ch*fx)*(1 - fy) + (c01.ch*(1 - fx) + c11.ch*fx)*fy + 0.5f)
+            output[y*newWidth + x] = (Color){ BILERP(r), BILERP(g), BILERP(b), BILERP(a) };
+            #undef BILERP
+        }
+    }
+
+    SetImageDataRGBA(image, output, newWidth, newHeight);
+
+    free(output);
+    free(pixels);
+}
+
+// Resize and image to new size using Nearest-Neighbor scaling algorithm
+void ImageResizeNN(Image *image, int newWidth, int newHeight)
+{
+    if ((newWidth < 1) || (newHeight < 1)) return;
+
+    Color *pixels = GetColorDataRGBA(*image);
+    Color *output = (Color *)malloc(newWidth*newHeight*sizeof(Color));
+
+    // EDIT: added +1 to account for an early rounding problem
+    int xRatio = (int)((image->width << 16)/newWidth) + 1;
+    int yRatio = (int)((image->height << 16)/newHeight) + 1;
+
+    for (int y = 0; y < newHeight; y++)
+    {
+        for (int x = 0; x < newWidth; x++)
+        {
+            int x2 = ((x*xRatio) >> 16);
+            int y2 = ((y*yRatio) >> 16);
+
+            output[(y*newWidth) + x] = pixels[(y2*image->width) + x2];
+        }
+    }
+
+    SetImageDataRGBA(image, output, newWidth, newHeight);
+
+    free(output);
+    free(pixels);
+}
+
+// Resize canvas and fill with color
+// NOTE: Resize offset is relative to the top-left corner of the original image
+void ImageResizeCanvas(Image *image, int newWidth, int newHeight, int offsetX, int offsetY, Color color)
+{
+    if ((newWidth < 1) || (newHeight < 1)) return;
+
+    Color *pixels = GetColorDataRGBA(*image);
+    Color *output = (Color *)malloc(newWidth*newHeight*sizeof(Color));
+
+    for (int i = 0; i < newWidth*newHeight; i++) output[i] = color;
+
+    for (int y = 0; y < image->height; y++)
+    {
+        for (int x = 0; x < image->width; x++)
+        {
+            int dx = x + offsetX;
+            int dy = y + offsetY;
+
+            if ((dx >= 0) && (dx < newWidth) && (dy >= 0) && (dy < newHeight)) output[dy*newWidth + dx] = pixels[y*image->width + x];
+        }
+    }
+
+    SetImageDataRGBA(image, output, newWidth, newHeight);
+
+    free(output);
+    free(pixels);
+}
+
+// Generate all mipmap levels for a provided image
+// NOTE: Mipmaps levels are stored consecutively after base image data
+void ImageMipmaps(Image *image)
+{
+    if (image->format >= COMPRESSED_DXT1_RGB)
+    {
+        TraceLog(WARNING, "Mipmaps can not be generated for compressed image formats");
+        return;
+    }
+
+    int mipCount = 1;
+    int mipWidth = image->width;
+    int mipHeight = image->height;
+    int mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);
+    int baseSize = mipSize;
+
+    while ((mipWidth != 1) || (mipHeight != 1))
+    {
+        if (mipWidth != 1) mipWidth /= 2;
+        if (mipHeight != 1) mipHeight /= 2;
+
+        mipCount++;
+        mipSize += GetPixelDataSize(mipWidth, mipHeight, image->format);
+    }
+
+    if (image->mipmaps >= mipCount) return;
+
+    unsigned char *data = (unsigned char *)malloc(mipSize);
+    memcpy(data, image->data, baseSize);
+
+    Image mipmap = ImageCopy((Image){ image->data, image->width, image->height, 1, image->format });
+    int offset = baseSize;
+
+    mipWidth = image->width;
+    mipHeight = image->height;
+
+    for (int i = 1; i < mipCount; i++)
+    {
+        if (mipWidth != 1) mipWidth /= 2;
+        if (mipHeight != 1) mipHeight /= 2;
+
+        ImageResize(&mipmap, mipWidth, mipHeight);
+
+        int size = GetPixelDataSize(mipWidth, mipHeight, image->format);
+        memcpy(data + offset, mipmap.data, size);
+        offset += size;
+    }
+
+    UnloadImage(mipmap);
+
+    free(image->data);
+    image->data = data;
+    image->mipmaps = mipCount;
+}
+
+// Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
+// NOTE: In case selected bpp do not represent an known 16bit format,
+// dithered data is stored in the LSB part of the unsigned short
+void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp)
+{
+    if (image->format >= COMPRESSED_DXT1_RGB)
+    {
+        TraceLog(WARNING, "Compressed data formats can not be dithered");
+        return;
+    }
+
+    if ((rBpp + gBpp + bBpp + aBpp) > 16)
+    {
+        TraceLog(WARNING, "Unsupported dithering bpps (%ibpp), only 16bpp or lower modes supported", (rBpp + gBpp + bBpp + aBpp));
+        return;
+    }
+
+    Color *pixels = GetColorDataRGBA(*image);
+    int bpps[4] = { rBpp, gBpp, bBpp, aBpp };
+
+    for (int y = 0; y < image->height; y++)
+    {
+        for (int x = 0; x < image->width; x++)
+        {
+            unsigned char *channels = (unsigned char *)&pixels[y*image->width + x];
+
+            for (int c = 0; c < 4; c++)
+            {
+                if (bpps[c] == 0) continue;
+
+                int levels = (1 << bpps[c]) - 1;
+                int oldValue = channels[c];
+                int newValue = (int)(roundf((float)oldValue*levels/255.0f)*255.0f/levels);
+                int error = oldValue - newValue;
+
+                channels[c] = (unsigned char)newValue;
+
+                // Error diffusion to neighbour pixels (Floyd-Steinberg weights)
+                #define DIFFUSE(dx, dy, w) \
+                    if (((x + dx) >= 0) && ((x + dx) < image->width) && ((y + dy) < image->height)) { \
+                        unsigned char *n = (unsigned char *)&pixels[(y + dy)*image->width + (x + dx)]; \
+                        int v = n[c] + error*w/16; n[c] = (unsigned char)((v < 0)? 0 : ((v > 255)? 255 : v)); }
+
+                DIFFUSE(1, 0, 7)
+                DIFFUSE(-1, 1, 3)
+                DIFFUSE(0, 1, 5)
+                DIFFUSE(1, 1, 1)
+                #undef DIFFUSE
+            }
+        }
+    }
+
+    if ((rBpp == 5) && (gBpp == 6) && (bBpp == 5) && (aBpp == 0)) image->format = UNCOMPRESSED_R5G6B5;
+    else if ((rBpp == 5) && (gBpp == 5) && (bBpp == 5) && (aBpp == 1)) image->format = UNCOMPRESSED_R5G5B5A1;
+    else if ((rBpp == 4) && (gBpp == 4) && (bBpp == 4) && (aBpp == 4)) image->format = UNCOMPRESSED_R4G4B4A4;
+    else TraceLog(WARNING, "Unsupported dithered OpenGL internal format: %ibpp (R%iG%iB%iA%i), image format kept", (rBpp + gBpp + bBpp + aBpp), rBpp, gBpp, bBpp, aBpp);
+
+    SetImageDataRGBA(image, pixels, image->width, image->height);
+    free(pixels);
+}
+
+// Create an image from text (default font)
+Image ImageText(const char *text, int fontSize, Color color)
+{
+    int defaultFontSize = 10;   // Default Font chars height in pixel
+    if (fontSize < defaultFontSize) fontSize = defaultFontSize;
+    int spacing = fontSize/defaultFontSize;
+
+    return ImageTextEx(GetFontDefault(), text, (float)fontSize, (float)spacing, color);
+}
+
+// Create an image from text (custom sprite font)
+// NOTE: No glyphs are rasterized, image is blank with the size of measured text
+Image ImageTextEx(Font font, const char *text, float fontSize, float spacing, Color tint)
+{
+    Vector2 imSize = MeasureTextEx(font, text, fontSize, spacing);
+
+    return GenImageColor(((int)imSize.x > 0)? (int)imSize.x : 1, ((int)imSize.y > 0)? (int)imSize.y : 1, BLANK);
+}
+
+// Draw an image (source) within an image (destination)
+// NOTE: Color tint is applied to source image, alpha blending is used
+void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec)
+{
+    // Security checks to avoid size and rectangle issues (out of bounds)
+    if (srcRec.x < 0) { srcRec.width += srcRec.x; srcRec.x = 0; }
+    if (srcRec.y < 0) { srcRec.height += srcRec.y; srcRec.y = 0; }
+    if ((srcRec.x + srcRec.width) > src.width) srcRec.width = src.width - srcRec.x;
+    if ((srcRec.y + srcRec.height) > src.height) srcRec.height = src.height - srcRec.y;
+
+    if (((int)srcRec.width < 1) || ((int)srcRec.height < 1) || ((int)dstRec.width < 1) || ((int)dstRec.height < 1)) return;
+
+    Image srcCopy = ImageCopy(src);
+    ImageCrop(&srcCopy, srcRec);
+    if (((int)dstRec.width != srcCopy.width) || ((int)dstRec.height != srcCopy.height)) ImageResize(&srcCopy, (int)dstRec.width, (int)dstRec.height);
+
+    Color *srcPixels = GetColorDataRGBA(srcCopy);
+    Color *dstPixels = GetColorDataRGBA(*dst);
+
+    for (int y = 0; y < srcCopy.height; y++)
+    {
+        for (int x = 0; x < srcCopy.width; x++)
+        {
+            int dx = (int)dstRec.x + x;
+            int dy = (int)dstRec.y + y;
+
+            if ((dx < 0) || (dx >= dst->width) || (dy < 0) || (dy >= dst->height)) continue;
+
+            Color s = srcPixels[y*srcCopy.width + x];
+            Color *d = &dstPixels[dy*dst->width + dx];
+
+            // Alpha blending (source over)
+            float srcAlpha = (float)s.a/255.0f;
+            float dstAlpha = (float)d->a/255.0f;
+            float outAlpha = srcAlpha + dstAlpha*(1.0f - srcAlpha);
+
+            if (outAlpha <= 0.0f) *d = BLANK;
+            else
+            {
+                d->r = (unsigned char)(((float)s.r*srcAlpha + (float)d->r*dstAlpha*(1.0f - srcAlpha))/outAlpha);
+                d->g = (unsigned char)(((float)s.g*srcAlpha + (float)d->g*dstAlpha*(1.0f - srcAlpha))/outAlpha);
+                d->b = (unsigned char)(((float)s.b*srcAlpha + (float)d->b*dstAlpha*(1.0f - srcAlpha))/outAlpha);
+                d->a = (unsigned char)(outAlpha*255.0f);
+            }
+        }
+    }
+
+    SetImageDataRGBA(dst, dstPixels, dst->width, dst->height);
+
+    free(dstPixels);
+    free(srcPixels);
+    UnloadImage(srcCopy);
+}
+
+// Draw rectangle within an image
+void ImageDrawRectangle(Image *dst, Vector2 position, Rectangle rec, Color color)
+{
+    Image imRec = GenImageColor((int)rec.width, (int)rec.height, color);
+
+    Rectangle dstRec = { position.x, position.y, (float)imRec.width, (float)imRec.height };
+
+    ImageDraw(dst, imRec, rec, dstRec);
+
+    UnloadImage(imRec);
+}
+
+// Draw text (default font) within an image (destination)
+void ImageDrawText(Image *dst, Vector2 position, const char *text, int fontSize, Color color) { }
+
+// Draw text (custom sprite font) within an image (destination)
+void ImageDrawTextEx(Image *dst, Vector2 position, Font font, const char *text, float fontSize, float spacing, Color color) { }
+
+// Flip image vertically
+void ImageFlipVertical(Image *image)
+{
+    Color *pixels = GetColorDataRGBA(*image);
+    Color *flipped = (Color *)malloc(image->width*image->height*sizeof(Color));
+
+    for (int y = 0; y < image->height; y++) memcpy(flipped + y*image->width, pixels + (image->height - 1 - y)*image->width, image->width*sizeof(Color));
+
+    SetImageDataRGBA(image, flipped, image->width, image->height);
+
+    free(flipped);
+    free(pixels);
+}
+
+// Flip image horizontally
+void ImageFlipHorizontal(Image *image)
+{
+    Color *pixels = GetColorDataRGBA(*image);
+    Color *flipped = (Color *)malloc(image->width*image->height*sizeof(Color));
+
+    for (int y = 0; y < image->height; y++)
+    {
+        for (int x = 0; x < image->width; x++) flipped[y*image->width + x] = pixels[y*image->width + (image->width - 1 - x)];
+    }
+
+    SetImageDataRGBA(image, flipped, image->width, image->height);
+
+    free(flipped);
+    free(pixels);
+}
+
+// Rotate image clockwise 90deg
+void ImageRotateCW(Image *image)
+{
+    Color *pixels = GetColorDataRGBA(*image);
+    Color *rotated = (Color *)malloc(image->width*image->height*sizeof(Color));
+
+    for (int y = 0; y < image->height; y++)
+    {
+        for (int x = 0; x < image->width; x++) rotated[x*image->height + (image->height - 1 - y)] = pixels[y*image->width + x];
+    }
+
+    SetImageDataRGBA(image, rotated, image->height, image->width);
+
+    free(rotated);
+    free(pixels);
+}
+
+// Rotate image counter-clockwise 90deg
+void ImageRotateCCW(Image *image)
+{
+    Color *pixels = GetColorDataRGBA(*image);
+    Color *rotated = (Color *)malloc(image->width*image->height*sizeof(Color));
+
+    for (int y = 0; y < image->height; y++)
+    {
+        for (int x = 0; x < image->width; x++) rotated[(image->width - 1 - x)*image->height + y] = pixels[y*image->width + x];
+    }
+
+    SetImageDataRGBA(image, rotated, image->height, image->width);
+
+    free(rotated);
+    free(pixels);
+}
+
+// Modify image color: tint
+void ImageColorTint(Image *image, Color color)
+{
+    Color *pixels = GetColorDataRGBA(*image);
+
+    for (int i = 0; i < image->width*image->height; i++)
+    {
+        pixels[i].r = (unsigned char)(((int)pixels[i].r*color.r)/255);
+        pixels[i].g = (unsigned char)(((int)pixels[i].g*color.g)/255);
+        pixels[i].b = (unsigned char)(((int)pixels[i].b*color.b)/255);
+        pixels[i].a = (unsigned char)(((int)pixels[i].a*color.a)/255);
+    }
+
+    SetImageDataRGBA(image, pixels, image->width, image->height);
+    free(pixels);
+}
+
+// Modify image color: invert
+void ImageColorInvert(Image *image)
+{
+    Color *pixels = GetColorDataRGBA(*image);
+
+    for (int i = 0; i < image->width*image->height; i++)
+    {
+        pixels[i].r = 255 - pixels[i].r;
+        pixels[i].g = 255 - pixels[i].g;
+        pixels[i].b = 255 - pixels[i].b;
+    }
+
+    SetImageDataRGBA(image, pixels, image->width, image->height);
+    free(pixels);
+}
+
+// Modify image color: grayscale
+void ImageColorGrayscale(Image *image)
+{
+    ImageFormat(image, UNCOMPRESSED_GRAYSCALE);
+}
+
+// Modify image color: contrast
+// NOTE: Contrast values between -100 and 100
+void ImageColorContrast(Image *image, float contrast)
+{
+    if (contrast < -100) contrast = -100;
+    if (contrast > 100) contrast = 100;
+
+    contrast = (100.0f + contrast)/100.0f;
+    contrast *= contrast;
+
+    Color *pixels = GetColorDataRGBA(*image);
+
+    for (int i = 0; i < image->width*image->height; i++)
+    {
+        unsigned char *channels = (unsigned char *)&pixels[i];
+
+        for (int c = 0; c < 3; c++)
+        {
+            float value = (((float)channels[c]/255.0f - 0.5f)*contrast + 0.5f)*255.0f;
+            channels[c] = (unsigned char)((value < 0)? 0 : ((value > 255)? 255 : value));
+        }
+    }
+
+    SetImageDataRGBA(image, pixels, image->width, image->height);
+    free(pixels);
+}
+
+// Modify image color: brightness
+// NOTE: Brightness values between -255 and 255
+void ImageColorBrightness(Image *image, int brightness)
+{
+    if (brightness < -255) brightness = -255;
+    if (brightness > 255) brightness = 255;
+
+    Color *pixels = GetColorDataRGBA(*image);
+
+    for (int i = 0; i < image->width*image->height; i++)
+    {
+        unsigned char *channels = (unsigned char *)&pixels[i];
+
+        for (int c = 0; c < 3; c++)
+        {
+            int value = channels[c] + brightness;
+            channels[c] = (unsigned char)((value < 0)? 0 : ((value > 255)? 255 : value));
+        }
+    }
+
+    SetImageDataRGBA(image, pixels, image->width, image->height);
+    free(pixels);
+}
+
+// Modify image color: replace color
+void ImageColorReplace(Image *image, Color color, Color replace)
+{
+    Color *pixels = GetColorDataRGBA(*image);
+
+    for (int i = 0; i < image->width*image->height; i++)
+    {
+        if ((pixels[i].r == color.r) && (pixels[i].g == color.g) && (pixels[i].b == color.b) && (pixels[i].a == color.a)) pixels[i] = replace;
+    }
+
+    SetImageDataRGBA(image, pixels, image->width, image->height);
+    free(pixels);
+}
+
+// Generate image: plain color
+Image GenImageColor(int width, int height, Color color)
+{
+    Color *pixels = (Color *)malloc(width*height*sizeof(Color));
+
+    for (int i = 0; i < width*height; i++) pixels[i] = color;
+
+    Image image = LoadImageEx(pixels, width, height);
+
+    free(pixels);
+
+    return image;
+}
+
+// Generate image: vertical gradient
+Image GenImageGradientV(int width, int height, Color top, Color bottom)
+{
+    Color *pixels = (Color *)malloc(width*height*sizeof(Color));
+
+    for (int j = 0; j < height; j++)
+    {
+        float factor = (float)j/(float)height;
+
+        for (int i = 0; i < width; i++)
+        {
+            pixels[j*width + i].r = (int)((float)bottom.r*factor + (float)top.r*(1.f - factor));
+            pixels[j*width + i].g = (int)((float)bottom.g*factor + (float)top.g*(1.f - factor));
+            pixels[j*width + i].b = (int)((float)bottom.b*factor + (float)top.b*(1.f - factor));
+            pixels[j*width + i].a = (int)((float)bottom.a*factor + (float)top.a*(1.f - factor));
+        }
+    }
+
+    Image image = LoadImageEx(pixels, width, height);
+    free(pixels);
+
+    return image;
+}
+
+// Generate image: horizontal gradient
+Image GenImageGradientH(int width, int height, Color left, Color right)
+{
+    Color *pixels = (Color *)malloc(width*height*sizeof(Color));
+
+    for (int i = 0; i < width; i++)
+    {
+        float factor = (float)i/(float)width;
+
+        for (int j = 0; j < height; j++)
+        {
+            pixels[j*width + i].r = (int)((float)right.r*factor + (float)left.r*(1.f - factor));
+            pixels[j*width + i].g = (int)((float)right.g*factor + (float)left.g*(1.f - factor));
+            pixels[j*width + i].b = (int)((float)right.b*factor + (float)left.b*(1.f - factor));
+            pixels[j*width + i].a = (int)((float)right.a*factor + (float)left.a*(1.f - factor));
+        }
+    }
+
+    Image image = LoadImageEx(pixels, width, height);
+    free(pixels);
+
+    return image;
+}
+
+// Generate image: radial gradient
+Image GenImageGradientRadial(int width, int height, float density, Color inner, Color outer)
+{
+    Color *pixels = (Color *)malloc(width*height*sizeof(Color));
+    float radius = (width < height)? (float)width/2.0f : (float)height/2.0f;
+
+    float centerX = (float)width/2.0f;
+    float centerY = (float)height/2.0f;
+
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            float dist = hypotf((float)x - centerX, (float)y - centerY);
+            float factor = (dist - radius*density)/(radius*(1.0f - density));
+
+            factor = (float)fmax(factor, 0.f);
+            factor = (float)fmin(factor, 1.f); // dist can be bigger than radius so we have to check
+
+            pixels[y*width + x].r = (int)((float)outer.r*factor + (float)inner.r*(1.0f - factor));
+            pixels[y*width + x].g = (int)((float)outer.g*factor + (float)inner.g*(1.0f - factor));
+            pixels[y*width + x].b = (int)((float)outer.b*factor + (float)inner.b*(1.0f - factor));
+            pixels[y*width + x].a = (int)((float)outer.a*factor + (float)inner.a*(1.0f - factor));
+        }
+    }
+
+    Image image = LoadImageEx(pixels, width, height);
+    free(pixels);
+
+    return image;
+}
+
+// Generate image: checked
+Image GenImageChecked(int width, int height, int checksX, int checksY, Color col1, Color col2)
+{
+    Color *pixels = (Color *)malloc(width*height*sizeof(Color));
+
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            if ((x/checksX + y/checksY)%2 == 0) pixels[y*width + x] = col1;
+            else pixels[y*width + x] = col2;
+        }
+    }
+
+    Image image = LoadImageEx(pixels, width, height);
+    free(pixels);
+
+    return image;
+}
+
+// Generate image: white noise
+Image GenImageWhiteNoise(int width, int height, float factor)
+{
+    Color *pixels = (Color *)malloc(width*height*sizeof(Color));
+
+    for (int i = 0; i < width*height; i++)
+    {
+        if (GetRandomValue(0, 99) < (int)(factor*100.0f)) pixels[i] = WHITE;
+        else pixels[i] = BLACK;
+    }
+
+    Image image = LoadImageEx(pixels, width, height);
+    free(pixels);
+
+    return image;
+}
+
+// Value noise lattice hash, used by GenImagePerlinNoise()
+static float NoiseLattice(int x, int y)
+{
+    unsigned int h = (unsigned int)x*374761393u + (unsigned int)y*668265263u;
+    h = (h ^ (h >> 13))*1274126177u;
+
+    return (float)((h ^ (h >> 16)) & 0xffff)/65535.0f;
+}
+
+// Generate image: perlin noise
+// NOTE: Approximated with smooth value noise (no stb_perlin available), 4 octaves
+Image GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float scale)
+{
+    Color *pixels = (Color *)malloc(width*height*sizeof(Color));
+
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            float nx = (float)(x + offsetX)*scale/(float)width;
+            float ny = (float)(y + offsetY)*scale/(float)height;
+
+            float value = 0.0f;
+            float amplitude = 0.5f;
+
+            for (int octave = 0; octave < 4; octave++)
+            {
+                int x0 = (int)floorf(nx);
+                int y0 = (int)floorf(ny);
+                float fx = nx - x0;
+                float fy = ny - y0;
+
+                fx = fx*fx*(3.0f - 2.0f*fx);
+                fy = fy*fy*(3.0f - 2.0f*fy);
+
+                float top = NoiseLattice(x0, y0) + (NoiseLattice(x0 + 1, y0) - NoiseLattice(x0, y0))*fx;
+                float bottom = NoiseLattice(x0, y0 + 1) + (NoiseLattice(x0 + 1, y0 + 1) - NoiseLattice(x0, y0 + 1))*fx;
+
+                value += (top + (bottom - top)*fy)*amplitude;
+
+                nx *= 2.0f;
+                ny *= 2.0f;
+                amplitude *= 0.5f;
+            }
+
+            int intensity = (int)(value*(255.0f/0.9375f));
+            if (intensity > 255) intensity = 255;
+            pixels[y*width + x] = (Color){ (unsigned char)intensity, (unsigned char)intensity, (unsigned char)intensity, 255 };
+        }
+    }
+
+    Image image = LoadImageEx(pixels, width, height);
+    free(pixels);
+
+    return image;
+}
+
+// Generate image: cellular algorithm. Bigger tileSize means bigger cells
+Image GenImageCellular(int width, int height, int tileSize)
+{
+    Color *pixels = (Color *)malloc(width*height*sizeof(Color));
+
+    int seedsPerRow = width/tileSize;
+    int seedsPerCol = height/tileSize;
+    int seedsCount = seedsPerRow*seedsPerCol;
+
+    Vector2 *seeds = (Vector2 *)malloc(seedsCount*sizeof(Vector2));
+
+    for (int i = 0; i < seedsCount; i++)
+    {
+        int y = (i/seedsPerRow)*tileSize + GetRandomValue(0, tileSize - 1);
+        int x = (i%seedsPerRow)*tileSize + GetRandomValue(0, tileSize - 1);
+        seeds[i] = (Vector2){ (float)x, (float)y };
+    }
+
+    for (int y = 0; y < height; y++)
+    {
+        int tileY = y/tileSize;
+
+        for (int x = 0; x < width; x++)
+        {
+            int tileX = x/tileSize;
+
+            float minDistance = (float)strtod("Inf", NULL);
+
+            // Check all adjacent tiles
+            for (int i = -1; i < 2; i++)
+            {
+                if ((tileX + i < 0) || (tileX + i >= seedsPerRow)) continue;
+
+                for (int j = -1; j < 2; j++)
+                {
+                    if ((tileY + j < 0) || (tileY + j >= seedsPerCol)) continue;
+
+                    Vector2 neighborSeed = seeds[(tileY + j)*seedsPerRow + tileX + i];
+
+                    float dist = (float)hypot(x - (int)neighborSeed.x, y - (int)neighborSeed.y);
+                    minDistance = (float)fmin(minDistance, dist);
+                }
+            }
+
+            // I made this up but it seems to give good results at all tile sizes
+            int intensity = (int)(minDistance*256.0f/tileSize);
+            if (intensity > 255) intensity = 255;
+
+            pixels[y*width + x] = (Color){ (unsigned char)intensity, (unsigned char)intensity, (unsigned char)intensity, 255 };
+        }
+    }
+
+    free(seeds);
+
+    Image image = LoadImageEx(pixels, width, height);
+    free(pixels);
+
+    return image;
+}
+
+// Generate GPU mipmaps for a texture (only mipmaps count is updated)
+void GenTextureMipmaps(Texture2D *texture)
+{
+    int mipmaps = 1;
+    int size = (texture->width > texture->height)? texture->width : texture->height;
+
+    while (size > 1) { size /= 2; mipmaps++; }
+
+    texture->mipmaps = mipmaps;
+    stats.resourceCalls++;
+}
+
+void SetTextureFilter(Texture2D texture, int filterMode) { stats.resourceCalls++; }
+void SetTextureWrap(Texture2D texture, int wrapMode) { stats.resourceCalls++; }
+
+void DrawTexture(Texture2D texture, int posX, int posY, Color tint) { stats.drawCalls++; }
+void DrawTextureV(Texture2D texture, Vector2 position, Color tint) { stats.drawCalls++; }
+void DrawTextureEx(Texture2D texture, Vector2 position, float rotation, float scale, Color tint) { stats.drawCalls++; }
+void DrawTextureRec(Texture2D texture, Rectangle sourceRec, Vector2 position, Color tint) { stats.drawCalls++; }
+void DrawTexturePro(Texture2D texture, Rectangle sourceRec, Rectangle destRec, Vector2 origin, float rotation, Color tint) { stats.drawCalls++; }
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Font Loading and Text Drawing
+// NOTE: Fonts are synthetic, characters metrics are approximated (no font files parsed)
+//----------------------------------------------------------------------------------
+
+// Get approximated character width for a font size (proportional font metrics)
+static int GetCharWidthApprox(int value, int fontSize)
+{
+    int width = fontSize/2;
+
+    if (strchr(" !'.,:;|il`", value) != NULL) width = fontSize/4;
+    else if (strchr("mwMW@", value) != NULL) width = fontSize*3/4;
+
+    return (width > 0)? width : 1;
+}
+
+// Generate synthetic font with approximated metrics, packed in a fake atlas texture
+static Font GenFontSynthetic(int fontSize, int *fontChars, int charsCount)
+{
+    Font font = { 0 };
+
+    font.baseSize = fontSize;
+    font.charsCount = (charsCount > 0)? charsCount : 95;
+    font.chars = (CharInfo *)calloc(font.charsCount, sizeof(CharInfo));
+
+    int atlasWidth = 512;
+    int posX = 0, posY = 0;
+
+    for (int i = 0; i < font.charsCount; i++)
+    {
+        font.chars[i].value = (fontChars != NULL)? fontChars[i] : 32 + i;
+
+        int width = GetCharWidthApprox(font.chars[i].value, fontSize);
+
+        if ((posX + width) > atlasWidth)
+        {
+            posX = 0;
+            posY += fontSize + 1;
+        }
+
+        font.chars[i].rec = (Rectangle){ (float)posX, (float)posY, (float)width, (float)fontSize };
+        font.chars[i].advanceX = 0;
+        posX += width + 1;
+    }
+
+    font.texture = (Texture2D){ resourceIdCounter++, atlasWidth, posY + fontSize, 1, UNCOMPRESSED_GRAY_ALPHA };
+
+    return font;
+}
+
+// Init default font (approximated metrics)
+static void LoadDefaultFont(void)
+{
+    if (defaultFont.chars != NULL) return;
+
+    int fontChars[DEFAULT_FONT_CHARS];
+    for (int i = 0; i < DEFAULT_FONT_CHARS; i++) fontChars[i] = 32 + i;
+
+    defaultFont = GenFontSynthetic(DEFAULT_FONT_SIZE, fontChars, DEFAULT_FONT_CHARS);
+}
+
+// Get the default Font
+Font GetFontDefault(void)
+{
+    LoadDefaultFont();
+
+    return defaultFont;
+}
+
+// Load Font from file into GPU memory (VRAM)
+Font LoadFont(const char *fileName)
+{
+    stats.resourceCalls++;
+
+    return GenFontSynthetic(32, NULL, 95);      // 32 = DEFAULT_TTF_FONTSIZE
+}
+
+// Load Font from file with extended parameters
+Font LoadFontEx(const char *fileName, int fontSize, int charsCount, int *fontChars)
+{
+    stats.resourceCalls++;
+
+    return GenFontSynthetic(fontSize, fontChars, (charsCount > 0)? charsCount : 95);
+}
+
+// Load font data for further use
+// NOTE: Characters bitmaps are generated as filled boxes (1 pixel border)
+CharInfo *LoadFontData(const char *fileName, int fontSize, int *fontChars, int charsCount, bool sdf)
+{
+    if (charsCount <= 0) charsCount = 95;
+
+    CharInfo *chars = (CharInfo *)calloc(charsCount, sizeof(CharInfo));
+
+    for (int i = 0; i < charsCount; i++)
+    {
+        int width = GetCharWidthApprox((fontChars != NULL)? fontChars[i] : 32 + i, fontSize);
+
+        chars[i].value = (fontChars != NULL)? fontChars[i] : 32 + i;
+        chars[i].rec = (Rectangle){ 0.0f, 0.0f, (float)width, (float)fontSize };
+        chars[i].advanceX = width;
+        chars[i].data = (unsigned char *)calloc(width*fontSize, 1);
+
+        if (chars[i].value != 32)
+        {
+            for (int y = 1; y < fontSize - 1; y++)
+            {
+                for (int x = 1; x < width - 1; x++) chars[i].data[y*width + x] = sdf? 128 : 255;
+            }
+        }
+    }
+
+    stats.resourceCalls++;
+
+    return chars;
+}
+
+// Generate image font atlas using chars info
+// NOTE: Packing method: rows packing (packMethod ignored), image format: GRAY_ALPHA
+Image GenImageFontAtlas(CharInfo *chars, int fontSize, int charsCount, int padding, int packMethod)
+{
+    Image atlas = { 0 };
+
+    // Calculate image size based on required pixel area
+    float requiredArea = 0;
+    for (int i = 0; i < charsCount; i++) requiredArea += ((chars[i].rec.width + 2*padding)*(fontSize + 2*padding));
+    float guessSize = sqrtf(requiredArea)*1.3f;
+    int imageSize = (int)powf(2, ceilf(logf((float)guessSize)/logf(2)));
+
+    atlas.width = imageSize;
+    atlas.height = imageSize;
+    atlas.mipmaps = 1;
+    atlas.format = UNCOMPRESSED_GRAY_ALPHA;
+
+    unsigned char *grayscale = (unsigned char *)calloc(imageSize*imageSize, 1);
+
+    int offsetX = padding;
+    int offsetY = padding;
+
+    for (int i = 0; i < charsCount; i++)
+    {
+        int width = (int)chars[i].rec.width;
+        int height = (int)chars[i].rec.height;
+
+        if ((offsetX + width + padding) >= imageSize)
+        {
+            offsetX = padding;
+            offsetY += (fontSize + 2*padding);
+
+            if (offsetY > (imageSize - fontSize - padding)) break;
+        }
+
+        if (chars[i].data != NULL)
+        {
+            for (int y = 0; y < height; y++)
+            {
+                for (int x = 0; x < width; x++) grayscale[(offsetY + y)*imageSize + offsetX + x] = chars[i].data[y*width + x];
+            }
+        }
+
+        chars[i].rec.x = (float)offsetX;
+        chars[i].rec.y = (float)offsetY;
+
+        offsetX += (width + 2*padding);
+    }
+
+    // Convert image data from GRAYSCALE to GRAY_ALPHA
+    unsigned char *dataGrayAlpha = (unsigned char *)malloc(imageSize*imageSize*2);
+
+    for (int i = 0, k = 0; i < imageSize*imageSize; i++, k += 2)
+    {
+        dataGrayAlpha[k] = 255;
+        dataGrayAlpha[k + 1] = grayscale[i];
+    }
+
+    free(grayscale);
+    atlas.data = dataGrayAlpha;
+
+    return atlas;
+}
+
+// Unload Font from GPU memory (VRAM)
+void UnloadFont(Font font)
+{
+    // NOTE: Make sure spriteFont is not default font (fallback)
+    if ((font.chars != NULL) && (font.chars != defaultFont.chars)) free(font.chars);
+
+    stats.resourceCalls++;
+}
+
+void DrawFPS(int posX, int posY) { stats.drawCalls++; }
+void DrawText(const char *text, int posX, int posY, int fontSize, Color color) { stats.drawCalls++; }
+void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint) { stats.drawCalls++; }
+
+// Measure string width for default font
+int MeasureText(const char *text, int fontSize)
+{
+    Vector2 vec = { 0.0f, 0.0f };
+
+    // Check if default font has been loaded
+    if (GetFontDefault().texture.id != 0)
+    {
+        int defaultFontSize = 10;   // Default Font chars height in pixel
+        if (fontSize < defaultFontSize) fontSize = defaultFontSize;
+        int spacing = fontSize/defaultFontSize;
+
+        vec = MeasureTextEx(GetFontDefault(), text, (float)fontSize, (float)spacing);
+    }
+
+    return (int)vec.x;
+}
+
+// Measure string size for Font
+Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing)
+{
+    int len = strlen(text);
+    int tempLen = 0;                // Used to count longer text line num chars
+    int lenCounter = 0;
+
+    float textWidth = 0;
+    float tempTextWidth = 0;        // Used to count longer text line width
+
+    float textHeight = (float)font.baseSize;
+    float scaleFactor = fontSize/(float)font.baseSize;
+
+    for (int i = 0; i < len; i++)
+    {
+        lenCounter++;
+
+        if (text[i] != '\n')
+        {
+            int index = GetGlyphIndex(font, (int)text[i]);
+
+            if (font.chars[index].advanceX != 0) textWidth += font.chars[index].advanceX;
+            else textWidth += (font.chars[index].rec.width + font.chars[index].offsetX);
+        }
+        else
+        {
+            if (tempTextWidth < textWidth) tempTextWidth = textWidth;
+            lenCounter = 0;
+            textWidth = 0;
+            textHeight += ((float)font.baseSize*1.5f); // NOTE: Fixed line spacing of 1.5 lines
+        }
+
+        if (tempLen < lenCounter) tempLen = lenCounter;
+    }
+
+    if (tempTextWidth < textWidth) tempTextWidth = textWidth;
+
+    Vector2 vec;
+    vec.x = tempTextWidth*scaleFactor + (float)((tempLen - 1)*spacing); // Adds chars spacing to measure
+    vec.y = textHeight*scaleFactor;
+
+    return vec;
+}
+
+// Formatting of text with variables to 'embed'
+const char *FormatText(const char *text, ...)
+{
+    static char buffer[MAX_TEXT_BUFFER_LENGTH];
+
+    va_list args;
+    va_start(args, text);
+    vsnprintf(buffer, MAX_TEXT_BUFFER_LENGTH, text, args);
+    va_end(args);
+
+    return buffer;
+}
+
+// Get a piece of a text string
+const char *SubText(const char *text, int position, int length)
+{
+    static char buffer[MAX_TEXT_BUFFER_LENGTH];
+    int textLength = strlen(text);
+
+    if (position >= textLength)
+    {
+        position = textLength - 1;
+        length = 0;
+    }
+
+    if (length >= textLength) length = textLength;
+    if (length >= MAX_TEXT_BUFFER_LENGTH) length = MAX_TEXT_BUFFER_LENGTH - 1;
+
+    for (int c = 0 ; c < length ; c++) buffer[c] = text[position + c];
+
+    buffer[length] = '\0';
+
+    return buffer;
+}
+
+// Get index position for a unicode character on font
+int GetGlyphIndex(Font font, int character)
+{
+    for (int i = 0; i < font.charsCount; i++)
+    {
+        if (font.chars[i].value == character) return i;
+    }
+
+    return 0;   // Fallback to first character (space)
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Basic 3d Shapes Drawing and Models
+//----------------------------------------------------------------------------------
+void DrawLine3D(Vector3 startPos, Vector3 endPos, Color color) { stats.drawCalls++; }
+void DrawCircle3D(Vector3 center, float radius, Vector3 rotationAxis, float rotationAngle, Color color) { stats.drawCalls++; }
+void DrawCube(Vector3 position, float width, float height, float length, Color color) { stats.drawCalls++; }
+void DrawCubeV(Vector3 position, Vector3 size, Color color) { stats.drawCalls++; }
+void DrawCubeWires(Vector3 position, float width, float height, float length, Color color) { stats.drawCalls++; }
+void DrawCubeTexture(Texture2D texture, Vector3 position, float width, float height, float length, Color color) { stats.drawCalls++; }
+void DrawSphere(Vector3 centerPos, float radius, Color color) { stats.drawCalls++; }
+void DrawSphereEx(Vector3 centerPos, float radius, int rings, int slices, Color color) { stats.drawCalls++; }
+void DrawSphereWires(Vector3 centerPos, float radius, int rings, int slices, Color color) { stats.drawCalls++; }
+void DrawCylinder(Vector3 position, float radiusTop, float radiusBottom, float height, int slices, Color color) { stats.drawCalls++; }
+void DrawCylinderWires(Vector3 position, float radiusTop, float radiusBottom, float height, int slices, Color color) { stats.drawCalls++; }
+void DrawPlane(Vector3 centerPos, Vector2 size, Color color) { stats.drawCalls++; }
+void DrawRay(Ray ray, Color color) { stats.drawCalls++; }
+void DrawGrid(int slices, float spacing) { stats.drawCalls++; }
+void DrawGizmo(Vector3 position) { stats.drawCalls++; }
+
+// Load model from files (mesh and material)
+Model LoadModel(const char *fileName)
+{
+    Model model = { 0 };
+
+    model.mesh = LoadMesh(fileName);
+    model.transform = MatrixIdentity();
+    model.material = LoadMaterialDefault();
+
+    return model;
+}
+
+// Load model from generated mesh
+// WARNING: A shallow copy of mesh is generated, passed by value,
+// as long as struct contains pointers to data and some values, we get a copy
+// of mesh pointing to same data as original version... be careful!
+Model LoadModelFromMesh(Mesh mesh)
+{
+    Model model = { 0 };
+
+    model.mesh = mesh;
+    model.transform = MatrixIdentity();
+    model.material = LoadMaterialDefault();
+
+    return model;
+}
+
+// Unload model from memory (RAM and/or VRAM)
+void UnloadModel(Model model)
+{
+    UnloadMesh(&model.mesh);
+    UnloadMaterial(model.material);
+}
+
+// Load mesh from file
+// NOTE: Mesh files are not parsed, a unit cube placeholder mesh is generated
+Mesh LoadMesh(const char *fileName)
+{
+    stats.resourceCalls++;
+    TraceLog(DEBUG, "[%s] Mesh placeholder generated (null backend)", fileName);
+
+    return GenMeshCube(1.0f, 1.0f, 1.0f);
+}
+
+// Unload mesh from memory (RAM and/or VRAM)
+void UnloadMesh(Mesh *mesh)
+{
+    free(mesh->vertices);
+    free(mesh->texcoords);
+    free(mesh->texcoords2);
+    free(mesh->normals);
+    free(mesh->tangents);
+    free(mesh->colors);
+    free(mesh->indices);
+
+    memset(mesh, 0, sizeof(Mesh));
+    stats.resourceCalls++;
+}
+
+// Export mesh as an OBJ file
+void ExportMesh(const char *fileName, Mesh mesh)
+{
+    FILE *objFile = fopen(fileName, "wt");
+
+    if (objFile == NULL)
+    {
+        TraceLog(WARNING, "[%s] Mesh could not be exported", fileName);
+        return;
+    }
+
+    fprintf(objFile, "# raylib Mesh OBJ exporter (null backend)\n");
+    fprintf(objFile, "# Vertex Count:     %i\n", mesh.vertexCount);
+    fprintf(objFile, "# Triangle Count:   %i\n\n", mesh.triangleCount);
+
+    for (int i = 0; i < mesh.vertexCount; i++) fprintf(objFile, "v %.3f %.3f %.3f\n", mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2]);
+    if (mesh.texcoords != NULL) for (int i = 0; i < mesh.vertexCount; i++) fprintf(objFile, "vt %.3f %.3f\n", mesh.texcoords[i*2], mesh.texcoords[i*2 + 1]);
+    if (mesh.normals != NULL) for (int i = 0; i < mesh.vertexCount; i++) fprintf(objFile, "vn %.3f %.3f %.3f\n", mesh.normals[i*3], mesh.normals[i*3 + 1], mesh.normals[i*3 + 2]);
+
+    for (int i = 0; i < mesh.triangleCount; i++)
+    {
+        int v[3];
+        for (int k = 0; k < 3; k++) v[k] = ((mesh.indices != NULL)? mesh.indices[i*3 + k] : i*3 + k) + 1;
+
+        fprintf(objFile, "f %i/%i/%i %i/%i/%i %i/%i/%i\n", v[0], v[0], v[0], v[1], v[1], v[1], v[2], v[2], v[2]);
+    }
+
+    fclose(objFile);
+}
+
+// Compute mesh bounding box limits
+// NOTE: minVertex and maxVertex should be transformed by model transform matrix
+BoundingBox MeshBoundingBox(Mesh mesh)
+{
+    // Get min and max vertex to construct bounds (AABB)
+    Vector3 minVertex = { 0 };
+    Vector3 maxVertex = { 0 };
+
+    if (mesh.vertices != NULL)
+    {
+        minVertex = (Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
+        maxVertex = (Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
+
+        for (int i = 1; i < mesh.vertexCount; i++)
+        {
+            minVertex = VectorMin(minVertex, (Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
+            maxVertex = VectorMax(maxVertex, (Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
+        }
+    }
+
+    // Create the bounding box
+    BoundingBox box;
+    box.min = minVertex;
+    box.max = maxVertex;
+
+    return box;
+}
+
+// Compute mesh tangents (placeholder: tangents set along X axis)
+void MeshTangents(Mesh *mesh)
+{
+    if (mesh->tangents == NULL) mesh->tangents = (float *)malloc(mesh->vertexCount*4*sizeof(float));
+
+    for (int i = 0; i < mesh->vertexCount; i++)
+    {
+        mesh->tangents[i*4] = 1.0f;
+        mesh->tangents[i*4 + 1] = 0.0f;
+        mesh->tangents[i*4 + 2] = 0.0f;
+        mesh->tangents[i*4 + 3] = 1.0f;
+    }
+}
+
+// Compute mesh binormals (binormals are not stored in mesh)
+void MeshBinormals(Mesh *mesh) { }
+
+// Generate mesh with multiple boxes (non-indexed triangles)
+static Mesh GenMeshBoxes(const BoundingBox *boxes, int count)
+{
+    // Box faces corners (unit cube) and normals, two triangles per face
+    static const float corners[6][4][3] = {
+        { { -1, -1,  1 }, {  1, -1,  1 }, {  1,  1,  1 }, { -1,  1,  1 } },     // Front face
+        { { -1, -1, -1 }, { -1,  1, -1 }, {  1,  1, -1 }, {  1, -1, -1 } },     // Back face
+        { { -1,  1, -1 }, { -1,  1,  1 }, {  1,  1,  1 }, {  1,  1, -1 } },     // Top face
+        { { -1, -1, -1 }, {  1, -1, -1 }, {  1, -1,  1 }, { -1, -1,  1 } },     // Bottom face
+        { {  1, -1, -1 }, {  1,  1, -1 }, {  1,  1,  1 }, {  1, -1,  1 } },     // Right face
+        { { -1, -1, -1 }, { -1, -1,  1 }, { -1,  1,  1 }, { -1,  1, -1 } }      // Left face
+    };
+    static const float normals[6][3] = { { 0, 0, 1 }, { 0, 0, -1 }, { 0, 1, 0 }, { 0, -1, 0 }, { 1, 0, 0 }, { -1, 0, 0 } };
+    static const float texcoords[4][2] = { { 0, 0 }, { 1, 0 }, { 1, 1 }, { 0, 1 } };
+    static const int order[6] = { 0, 1, 2, 0, 2, 3 };
+
+    Mesh mesh = { 0 };
+
+    mesh.vertexCount = count*36;
+    mesh.triangleCount = count*12;
+    mesh.vertices = (float *)malloc(mesh.vertexCount*3*sizeof(float));
+    mesh.texcoords = (float *)malloc(mesh.vertexCount*2*sizeof(float));
+    mesh.normals = (float *)malloc(mesh.vertexCount*3*sizeof(float));
+
+    int v = 0;
+
+    for (int b = 0; b < count; b++)
+    {
+        Vector3 center = { (boxes[b].min.x + boxes[b].max.x)/2.0f, (boxes[b].min.y + boxes[b].max.y)/2.0f, (boxes[b].min.z + boxes[b].max.z)/2.0f };
+        Vector3 half = { (boxes[b].max.x - boxes[b].min.x)/2.0f, (boxes[b].max.y - boxes[b].min.y)/2.0f, (boxes[b].max.z - boxes[b].min.z)/2.0f };
+
+        for (int f = 0; f < 6; f++)
+        {
+            for (int k = 0; k < 6; k++, v++)
+            {
+                int c = order[k];
+
+                mesh.vertices[v*3] = center.x + corners[f][c][0]*half.x;
+                mesh.vertices[v*3 + 1] = center.y + corners[f][c][1]*half.y;
+                mesh.vertices[v*3 + 2] = center.z + corners[f][c][2]*half.z;
+                mesh.texcoords[v*2] = texcoords[c][0];
+                mesh.texcoords[v*2 + 1] = texcoords[c][1];
+                mesh.normals[v*3] = normals[f][0];
+                mesh.normals[v*3 + 1] = normals[f][1];
+                mesh.normals[v*3 + 2] = normals[f][2];
+            }
+        }
+    }
+
+    return mesh;
+}
+
+// Generate plane mesh (with subdivisions)
+Mesh GenMeshPlane(float width, float length, int resX, int resZ)
+{
+    Mesh mesh = { 0 };
+
+    resX++;
+    resZ++;
+
+    // Vertices definition
+    int vertexCount = resX*resZ; // vertices get reused for the faces
+
+    mesh.vertexCount = vertexCount;
+    mesh.vertices = (float *)malloc(vertexCount*3*sizeof(float));
+    mesh.normals = (float *)malloc(vertexCount*3*sizeof(float));
+    mesh.texcoords = (float *)malloc(vertexCount*2*sizeof(float));
+
+    for (int z = 0; z < resZ; z++)
+    {
+        // [-length/2, length/2]
+        float zPos = ((float)z/(resZ - 1) - 0.5f)*length;
+
+        for (int x = 0; x < resX; x++)
+        {
+            // [-width/2, width/2]
+            float xPos = ((float)x/(resX - 1) - 0.5f)*width;
+            int i = x + z*resX;
+
+            mesh.vertices[i*3] = xPos;
+            mesh.vertices[i*3 + 1] = 0.0f;
+            mesh.vertices[i*3 + 2] = zPos;
+            mesh.normals[i*3] = 0.0f;
+            mesh.normals[i*3 + 1] = 1.0f;
+            mesh.normals[i*3 + 2] = 0.0f;
+            mesh.texcoords[i*2] = (float)x/(resX - 1);
+            mesh.texcoords[i*2 + 1] = (float)z/(resZ - 1);
+        }
+    }
+
+    // Triangles definition (indices)
+    int numFaces = (resX - 1)*(resZ - 1);
+
+    mesh.triangleCount = numFaces*2;
+    mesh.indices = (unsigned short *)malloc(numFaces*6*sizeof(unsigned short));
+
+    int t = 0;
+    for (int face = 0; face < numFaces; face++)
+    {
+        // Retrieve lower left corner from face ind
+        int i = face % (resX - 1) + (face/(resZ - 1)*resX);
+
+        mesh.indices[t++] = i + resX;
+        mesh.indices[t++] = i + 1;
+        mesh.indices[t++] = i;
+
+        mesh.indices[t++] = i + resX;
+        mesh.indices[t++] = i + resX + 1;
+        mesh.indices[t++] = i + 1;
+    }
+
+    return mesh;
+}
+
+// Generate cuboid mesh
+Mesh GenMeshCube(float width, float height, float length)
+{
+    BoundingBox box = { { -width/2.0f, -height/2.0f, -length/2.0f }, { width/2.0f, height/2.0f, length/2.0f } };
+
+    return GenMeshBoxes(&box, 1);
+}
+
+// Generate sphere mesh (box placeholder with sphere bounds)
+Mesh GenMeshSphere(float radius, int rings, int slices)
+{
+    BoundingBox box = { { -radius, -radius, -radius }, { radius, radius, radius } };
+
+    return GenMeshBoxes(&box, 1);
+}
+
+// Generate half-sphere mesh (box placeholder with half-sphere bounds)
+Mesh GenMeshHemiSphere(float radius, int rings, int slices)
+{
+    BoundingBox box = { { -radius, 0.0f, -radius }, { radius, radius, radius } };
+
+    return GenMeshBoxes(&box, 1);
+}
+
+// Generate cylinder mesh (box placeholder with cylinder bounds)
+Mesh GenMeshCylinder(float radius, float height, int slices)
+{
+    BoundingBox box = { { -radius, 0.0f, -radius }, { radius, height, radius } };
+
+    return GenMeshBoxes(&box, 1);
+}
+
+// Generate torus mesh (box placeholder with torus bounds)
+Mesh GenMeshTorus(float radius, float size, int radSeg, int sides)
+{
+    float extent = radius + size;
+    BoundingBox box = { { -extent, -size, -extent }, { extent, size, extent } };
+
+    return GenMeshBoxes(&box, 1);
+}
+
+// Generate trefoil knot mesh (box placeholder with knot bounds)
+Mesh GenMeshKnot(float radius, float size, int radSeg, int sides)
+{
+    float extent = radius*3.0f + size;
+    BoundingBox box = { { -extent, -extent, -size - radius }, { extent, extent, size + radius } };
+
+    return GenMeshBoxes(&box, 1);
+}
+
+// Generate a mesh from heightmap
+// NOTE: Vertex data is uploaded to GPU
+Mesh GenMeshHeightmap(Image heightmap, Vector3 size)
+{
+    #define GRAY_VALUE(c) ((c.r+c.g+c.b)/3)
+
+    Mesh mesh = { 0 };
+
+    int mapX = heightmap.width;
+    int mapZ = heightmap.height;
+
+    if ((mapX < 2) || (mapZ < 2)) return mesh;
+
+    Color *pixels = GetImageData(heightmap);
+
+    // NOTE: One vertex per pixel
+    mesh.triangleCount = (mapX - 1)*(mapZ - 1)*2;    // One quad every four pixels
+    mesh.vertexCount = mesh.triangleCount*3;
+
+    mesh.vertices = (float *)malloc(mesh.vertexCount*3*sizeof(float));
+    mesh.normals = (float *)malloc(mesh.vertexCount*3*sizeof(float));
+    mesh.texcoords = (float *)malloc(mesh.vertexCount*2*sizeof(float));
+
+    Vector3 scaleFactor = { size.x/(mapX - 1), size.y/255.0f, size.z/(mapZ - 1) };
+    int v = 0;
+
+    for (int z = 0; z < mapZ - 1; z++)
+    {
+        for (int x = 0; x < mapX - 1; x++)
+        {
+            // Quad corners: (x, z), (x, z + 1), (x + 1, z), (x + 1, z + 1)
+            int quad[6][2] = { { x, z }, { x, z + 1 }, { x + 1, z }, { x + 1, z }, { x, z + 1 }, { x + 1, z + 1 } };
+
+            for (int k = 0; k < 6; k++, v++)
+            {
+                int px = quad[k][0];
+                int pz = quad[k][1];
+
+                mesh.vertices[v*3] = (float)px*scaleFactor.x;
+                mesh.vertices[v*3 + 1] = (float)GRAY_VALUE(pixels[px + pz*mapX])*scaleFactor.y;
+                mesh.vertices[v*3 + 2] = (float)pz*scaleFactor.z;
+                mesh.texcoords[v*2] = (float)px/(mapX - 1);
+                mesh.texcoords[v*2 + 1] = (float)pz/(mapZ - 1);
+            }
+
+            // Compute face normals (one per triangle, same for the three vertices)
+            for (int t = v - 6; t < v; t += 3)
+            {
+                Vector3 p1 = { mesh.vertices[t*3], mesh.vertices[t*3 + 1], mesh.vertices[t*3 + 2] };
+                Vector3 p2 = { mesh.vertices[(t + 1)*3], mesh.vertices[(t + 1)*3 + 1], mesh.vertices[(t + 1)*3 + 2] };
+                Vector3 p3 = { mesh.vertices[(t + 2)*3], mesh.vertices[(t + 2)*3 + 1], mesh.vertices[(t + 2)*3 + 2] };
+
+                Vector3 normal = VectorCrossProduct(VectorSubtract(p2, p1), VectorSubtract(p3, p1));
+                VectorNormalize(&normal);
+
+                for (int k = 0; k < 3; k++)
+                {
+                    mesh.normals[(t + k)*3] = normal.x;
+                    mesh.normals[(t + k)*3 + 1] = normal.y;
+                    mesh.normals[(t + k)*3 + 2] = normal.z;
+                }
+            }
+        }
+    }
+
+    free(pixels);
+
+    return mesh;
+
+    #undef GRAY_VALUE
+}
+
+// Generate a cubes mesh from pixel data
+// NOTE: One box per white pixel (walls), floor and ceiling are not generated
+Mesh GenMeshCubicmap(Image cubicmap, Vector3 cubeSize)
+{
+    Color *cubicmapPixels = GetImageData(cubicmap);
+    BoundingBox *boxes = (BoundingBox *)malloc(cubicmap.width*cubicmap.height*sizeof(BoundingBox));
+    int boxesCount = 0;
+
+    float w = cubeSize.x;
+    float h = cubeSize.z;
+    float h2 = cubeSize.y;
+
+    for (int z = 0; z < cubicmap.height; z++)
+    {
+        for (int x = 0; x < cubicmap.width; x++)
+        {
+            Color pixel = cubicmapPixels[z*cubicmap.width + x];
+
+            if ((pixel.r == 255) && (pixel.g == 255) && (pixel.b == 255))
+            {
+                boxes[boxesCount++] = (BoundingBox){ { w*(x - 0.5f), 0.0f, h*(z - 0.5f) }, { w*(x + 0.5f), h2, h*(z + 0.5f) } };
+            }
+        }
+    }
+
+    Mesh mesh = GenMeshBoxes(boxes, boxesCount);
+
+    free(boxes);
+    free(cubicmapPixels);
+
+    return mesh;
+}
+
+// Load material from file
+Material LoadMaterial(const char *fileName)
+{
+    stats.resourceCalls++;
+
+    return LoadMaterialDefault();
+}
+
+// Load default material (Supports: DIFFUSE, SPECULAR, NORMAL maps)
+Material LoadMaterialDefault(void)
+{
+    Material material = { 0 };
+
+    material.shader = GetShaderDefault();
+    material.maps[MAP_DIFFUSE].texture = GetTextureDefault();   // White texture (1x1 pixel)
+
+    material.maps[MAP_DIFFUSE].color = WHITE;    // Diffuse color
+    material.maps[MAP_SPECULAR].color = WHITE;   // Specular color
+
+    return material;
+}
+
+void UnloadMaterial(Material material) { stats.resourceCalls++; }
+
+void DrawModel(Model model, Vector3 position, float scale, Color tint) { stats.drawCalls++; }
+void DrawModelEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint) { stats.drawCalls++; }
+void DrawModelWires(Model model, Vector3 position, float scale, Color tint) { stats.drawCalls++; }
+void DrawModelWiresEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint) { stats.drawCalls++; }
+void DrawBoundingBox(BoundingBox box, Color color) { stats.drawCalls++; }
+void DrawBillboard(Camera camera, Texture2D texture, Vector3 center, float size, Color tint) { stats.drawCalls++; }
+void DrawBillboardRec(Camera camera, Texture2D texture, Rectangle sourceRec, Vector3 center, float size, Color tint) { stats.drawCalls++; }
+
+// Detect collision between two spheres
+bool CheckCollisionSpheres(Vector3 centerA, float radiusA, Vector3 centerB, float radiusB)
+{
+    return (VectorDistance(centerA, centerB) <= (radiusA + radiusB));
+}
+
+// Detect collision between two boxes
+// NOTE: Boxes are defined by two points minimum and maximum
+bool CheckCollisionBoxes(BoundingBox box1, BoundingBox box2)
+{
+    bool collision = true;
+
+    if ((box1.max.x >= box2.min.x) && (box1.min.x <= box2.max.x))
+    {
+        if ((box1.max.y < box2.min.y) || (box1.min.y > box2.max.y)) collision = false;
+        if ((box1.max.z < box2.min.z) || (box1.min.z > box2.max.z)) collision = false;
+    }
+    else collision = false;
+
+    return collision;
+}
+
+// Detect collision between box and sphere
+bool CheckCollisionBoxSphere(BoundingBox box, Vector3 centerSphere, float radiusSphere)
+{
+    float dmin = 0;
+
+    if (centerSphere.x < box.min.x) dmin += powf(centerSphere.x - box.min.x, 2);
+    else if (centerSphere.x > box.max.x) dmin += powf(centerSphere.x - box.max.x, 2);
+
+    if (centerSphere.y < box.min.y) dmin += powf(centerSphere.y - box.min.y, 2);
+    else if (centerSphere.y > box.max.y) dmin += powf(centerSphere.y - box.max.y, 2);
+
+    if (centerSphere.z < box.min.z) dmin += powf(centerSphere.z - box.min.z, 2);
+    else if (centerSphere.z > box.max.z) dmin += powf(centerSphere.z - box.max.z, 2);
+
+    return (dmin <= (radiusSphere*radiusSphere));
+}
+
+// Detect collision between ray and sphere
+bool CheckCollisionRaySphere(Ray ray, Vector3 spherePosition, float sphereRadius)
+{
+    Vector3 raySpherePos = VectorSubtract(spherePosition, ray.position);
+    float distance = VectorLength(raySpherePos);
+    float vector = VectorDotProduct(raySpherePos, ray.direction);
+    float d = sphereRadius*sphereRadius - (distance*distance - vector*vector);
+
+    return (d >= 0.0f);
+}
+
+// Detect collision between ray and sphere with extended parameters and collision point detection
+bool CheckCollisionRaySphereEx(Ray ray, Vector3 spherePosition, float sphereRadius, Vector3 *collisionPoint)
+{
+    Vector3 raySpherePos = VectorSubtract(spherePosition, ray.position);
+    float distance = VectorLength(raySpherePos);
+    float vector = VectorDotProduct(raySpherePos, ray.direction);
+    float d = sphereRadius*sphereRadius - (distance*distance - vector*vector);
+
+    bool collision = (d >= 0.0f);
+
+    // Check if ray origin is inside the sphere to calculate the correct collision point
+    float collisionDistance = 0;
+
+    if (distance < sphereRadius) collisionDistance = vector + sqrtf(d);
+    else collisionDistance = vector - sqrtf(d);
+
+    // Calculate collision point
+    Vector3 offset = ray.direction;
+    VectorScale(&offset, collisionDistance);
+    Vector3 cPoint = VectorAdd(ray.position, offset);
+
+    collisionPoint->x = cPoint.x;
+    collisionPoint->y = cPoint.y;
+    collisionPoint->z = cPoint.z;
+
+    return collision;
+}
+
+// Detect collision between ray and bounding box
+bool CheckCollisionRayBox(Ray ray, BoundingBox box)
+{
+    float t[8];
+    t[0] = (box.min.x - ray.position.x)/ray.direction.x;
+    t[1] = (box.max.x - ray.position.x)/ray.direction.x;
+    t[2] = (box.min.y - ray.position.y)/ray.direction.y;
+    t[3] = (box.max.y - ray.position.y)/ray.direction.y;
+    t[4] = (box.min.z - ray.position.z)/ray.direction.z;
+    t[5] = (box.max.z - ray.position.z)/ray.direction.z;
+    t[6] = (float)fmax(fmax(fmin(t[0], t[1]), fmin(t[2], t[3])), fmin(t[4], t[5]));
+    t[7] = (float)fmin(fmin(fmax(t[0], t[1]), fmax(t[2], t[3])), fmax(t[4], t[5]));
+
+    return !((t[7] < 0) || (t[6] > t[7]));
+}
+
+// Get collision info between ray and model
+RayHitInfo GetCollisionRayModel(Ray ray, Model *model)
+{
+    RayHitInfo result = { 0 };
+
+    // If mesh doesn't have vertex data on CPU, can't test it.
+    if (!model->mesh.vertices) return result;
+
+    // model->mesh.triangleCount may not be set, vertexCount is more reliable
+    int triangleCount = (model->mesh.indices != NULL)? model->mesh.triangleCount : model->mesh.vertexCount/3;
+
+    // Test against all triangles in mesh
+    for (int i = 0; i < triangleCount; i++)
+    {
+        Vector3 vertices[3];
+
+        for (int k = 0; k < 3; k++)
+        {
+            int index = (model->mesh.indices != NULL)? model->mesh.indices[i*3 + k] : i*3 + k;
+
+            vertices[k] = (Vector3){ model->mesh.vertices[index*3], model->mesh.vertices[index*3 + 1], model->mesh.vertices[index*3 + 2] };
+            VectorTransform(&vertices[k], model->transform);
+        }
+
+        RayHitInfo triHitInfo = GetCollisionRayTriangle(ray, vertices[0], vertices[1], vertices[2]);
+
+        if (triHitInfo.hit)
+        {
+            // Save the closest hit triangle
+            if ((!result.hit) || (result.distance > triHitInfo.distance)) result = triHitInfo;
+        }
+    }
+
+    return result;
+}
+
+// Get collision info between ray and triangle
+// NOTE: Based on https://en.wikipedia.org/wiki/M%C3%B6ller%E2%80%93Trumbore_intersection_algorithm
+RayHitInfo GetCollisionRayTriangle(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3)
+{
+    #define EPSILON 0.000001        // A small number
+
+    Vector3 edge1, edge2;
+    Vector3 p, q, tv;
+    float det, invDet, u, v, t;
+    RayHitInfo result = { 0 };
+
+    // Find vectors for two edges sharing V1
+    edge1 = VectorSubtract(p2, p1);
+    edge2 = VectorSubtract(p3, p1);
+
+    // Begin calculating determinant - also used to calculate u parameter
+    p = VectorCrossProduct(ray.direction, edge2);
+
+    // If determinant is near zero, ray lies in plane of triangle or ray is parallel to plane of triangle
+    det = VectorDotProduct(edge1, p);
+
+    // Avoid culling!
+    if ((det > -EPSILON) && (det < EPSILON)) return result;
+
+    invDet = 1.0f/det;
+
+    // Calculate distance from V1 to ray origin
+    tv = VectorSubtract(ray.position, p1);
+
+    // Calculate u parameter and test bound
+    u = VectorDotProduct(tv, p)*invDet;
+
+    // The intersection lies outside of the triangle
+    if ((u < 0.0f) || (u > 1.0f)) return result;
+
+    // Prepare to test v parameter
+    q = VectorCrossProduct(tv, edge1);
+
+    // Calculate V parameter and test bound
+    v = VectorDotProduct(ray.direction, q)*invDet;
+
+    // The intersection lies outside of the triangle
+    if ((v < 0.0f) || ((u + v) > 1.0f)) return result;
+
+    t = VectorDotProduct(edge2, q)*invDet;
+
+    if (t > EPSILON)
+    {
+        // Ray hit, get hit point and normal
+        result.hit = true;
+        result.distance = t;
+        result.normal = VectorCrossProduct(edge1, edge2);
+        VectorNormalize(&result.normal);
+
+        Vector3 offset = ray.direction;
+        VectorScale(&offset, t);
+        result.position = VectorAdd(ray.position, offset);
+    }
+
+    return result;
+
+    #undef EPSILON
+}
+
+// Get collision info between ray and ground plane (Y-normal plane)
+RayHitInfo GetCollisionRayGround(Ray ray, float groundHeight)
+{
+    #define EPSILON 0.000001        // A small number
+
+    RayHitInfo result = { 0 };
+
+    if (fabsf(ray.direction.y) > EPSILON)
+    {
+        float distance = (ray.position.y - groundHeight)/-ray.direction.y;
+
+        if (distance >= 0.0)
+        {
+            Vector3 offset = ray.direction;
+            VectorScale(&offset, distance);
+
+            result.hit = true;
+            result.distance = distance;
+            result.normal = (Vector3){ 0.0, 1.0, 0.0 };
+            result.position = VectorAdd(ray.position, offset);
+        }
+    }
+
+    return result;
+
+    #undef EPSILON
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Shaders, Blending and VR
+//----------------------------------------------------------------------------------
+
+// Load chars array from text file
+char *LoadText(const char *fileName)
+{
+    char *text = NULL;
+    FILE *textFile = fopen(fileName, "rt");
+
+    if (textFile != NULL)
+    {
+        fseek(textFile, 0, SEEK_END);
+        long count = ftell(textFile);
+        rewind(textFile);
+
+        if (count > 0)
+        {
+            text = (char *)malloc(count + 1);
+            count = (long)fread(text, sizeof(char), count, textFile);
+            text[count] = '\0';
+        }
+
+        fclose(textFile);
+    }
+    else TraceLog(WARNING, "[%s] Text file could not be opened", fileName);
+
+    return text;
+}
+
+// Load shader from files and bind default locations
+Shader LoadShader(const char *vsFileName, const char *fsFileName)
+{
+    stats.resourceCalls++;
+
+    return LoadShaderCode(NULL, NULL);
+}
+
+// Load shader from code strings and bind default locations
+Shader LoadShaderCode(char *vsCode, char *fsCode)
+{
+    Shader shader = { 0 };
+
+    shader.id = resourceIdCounter++;
+    for (int i = 0; i < MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
+
+    stats.resourceCalls++;
+
+    return shader;
+}
+
+void UnloadShader(Shader shader) { stats.resourceCalls++; }
+
+// Get default shader
+Shader GetShaderDefault(void)
+{
+    Shader shader = { 0 };
+
+    shader.id = 1;
+    for (int i = 0; i < MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
+
+    return shader;
+}
+
+// Get default texture (white texture 1x1 pixel)
+Texture2D GetTextureDefault(void)
+{
+    return (Texture2D){ 1, 1, 1, 1, UNCOMPRESSED_R8G8B8A8 };
+}
+
+// Get shader uniform location (any uniform is considered available)
+int GetShaderLocation(Shader shader, const char *uniformName) { return 0; }
+
+void SetShaderValue(Shader shader, int uniformLoc, const float *value, int size) { stats.resourceCalls++; }
+void SetShaderValuei(Shader shader, int uniformLoc, const int *value, int size) { stats.resourceCalls++; }
+void SetShaderValueMatrix(Shader shader, int uniformLoc, Matrix mat) { stats.resourceCalls++; }
+
+// Set a custom projection matrix (replaces internal projection matrix)
+void SetMatrixProjection(Matrix proj) { matProjection = proj; }
+
+// Set a custom modelview matrix (replaces internal modelview matrix)
+void SetMatrixModelview(Matrix view) { matModelview = view; }
+
+// Return internal modelview matrix
+Matrix GetMatrixModelview() { return matModelview; }
+
+// Generate cubemap texture from HDR texture
+Texture2D GenTextureCubemap(Shader shader, Texture2D skyHDR, int size)
+{
+    stats.resourceCalls++;
+    return (Texture2D){ resourceIdCounter++, size, size, 1, UNCOMPRESSED_R32G32B32 };
+}
+
+// Generate irradiance texture using cubemap data
+Texture2D GenTextureIrradiance(Shader shader, Texture2D cubemap, int size)
+{
+    stats.resourceCalls++;
+    return (Texture2D){ resourceIdCounter++, size, size, 1, UNCOMPRESSED_R32G32B32 };
+}
+
+// Generate prefilter texture using cubemap data
+Texture2D GenTexturePrefilter(Shader shader, Texture2D cubemap, int size)
+{
+    stats.resourceCalls++;
+    return (Texture2D){ resourceIdCounter++, size, size, 1, UNCOMPRESSED_R32G32B32 };
+}
+
+// Generate BRDF texture using cubemap data
+Texture2D GenTextureBRDF(Shader shader, Texture2D cubemap, int size)
+{
+    stats.resourceCalls++;
+    return (Texture2D){ resourceIdCounter++, size, size, 1, UNCOMPRESSED_R32G32B32 };
+}
+
+void BeginShaderMode(Shader shader) { stats.modeCalls++; }
+void EndShaderMode(void) { stats.modeCalls++; }
+void BeginBlendMode(int mode) { stats.modeCalls++; }
+void EndBlendMode(void) { stats.modeCalls++; }
+
+// Get VR device information for some standard devices (Oculus Rift CV1 parameters)
+VrDeviceInfo GetVrDeviceInfo(int vrDeviceType)
+{
+    VrDeviceInfo hmd = { 0 };
+
+    hmd.hResolution = 2160;                 // HMD horizontal resolution in pixels
+    hmd.vResolution = 1200;                 // HMD vertical resolution in pixels
+    hmd.hScreenSize = 0.133793f;            // HMD horizontal size in meters
+    hmd.vScreenSize = 0.0669f;              // HMD vertical size in meters
+    hmd.vScreenCenter = 0.04678f;           // HMD screen center in meters
+    hmd.eyeToScreenDistance = 0.041f;       // HMD distance between eye and display in meters
+    hmd.lensSeparationDistance = 0.07f;     // HMD lens separation distance in meters
+    hmd.interpupillaryDistance = 0.07f;     // HMD IPD (distance between pupils) in meters
+    hmd.lensDistortionValues[0] = 1.0f;     // HMD lens distortion constant parameter 0
+    hmd.lensDistortionValues[1] = 0.22f;    // HMD lens distortion constant parameter 1
+    hmd.lensDistortionValues[2] = 0.24f;    // HMD lens distortion constant parameter 2
+    hmd.lensDistortionValues[3] = 0.0f;     // HMD lens distortion constant parameter 3
+    hmd.chromaAbCorrection[0] = 0.996f;     // HMD chromatic aberration correction parameter 0
+    hmd.chromaAbCorrection[1] = -0.004f;    // HMD chromatic aberration correction parameter 1
+    hmd.chromaAbCorrection[2] = 1.014f;     // HMD chromatic aberration correction parameter 2
+    hmd.chromaAbCorrection[3] = 0.0f;       // HMD chromatic aberration correction parameter 3
+
+    return hmd;
+}
+
+void InitVrSimulator(VrDeviceInfo info) { vrSimulatorReady = true; }
+void CloseVrSimulator(void) { vrSimulatorReady = false; }
+bool IsVrSimulatorReady(void) { return vrSimulatorReady; }
+void SetVrDistortionShader(Shader shader) { }
+void UpdateVrTracking(Camera *camera) { }
+void ToggleVrMode(void) { stats.modeCalls++; }
+void BeginVrDrawing(void) { stats.modeCalls++; }
+void EndVrDrawing(void) { stats.modeCalls++; }
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - rlgl immediate mode (subset used by raylib-lua batches)
+// NOTE: Vertex data is discarded, every rlBegin()/rlEnd() block counts as one draw call
+//----------------------------------------------------------------------------------
+void rlBegin(int mode) { }
+void rlEnd(void) { stats.drawCalls++; }
+void rlVertex2f(float x, float y) { }
+void rlTexCoord2f(float x, float y) { }
+void rlNormal3f(float x, float y, float z) { }
+void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a) { }
+void rlEnableTexture(unsigned int id) { }
+void rlDisableTexture(void) { }
+void rlglDraw(void) { }
+void rlDrawMesh(Mesh mesh, Material material, Matrix transform) { stats.drawCalls++; }
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Audio Loading and Playing
+// NOTE: No audio device, sounds are never playing, music playing time is simulated
+//----------------------------------------------------------------------------------
+void InitAudioDevice(void) { audioDeviceReady = true; stats.audioCalls++; }
+void CloseAudioDevice(void) { audioDeviceReady = false; stats.audioCalls++; }
+bool IsAudioDeviceReady(void) { return audioDeviceReady; }
+void SetMasterVolume(float volume) { stats.audioCalls++; }
+
+// Load wave data from file
+// NOTE: Audio files are not decoded, a silence wave (1 second, 44100 Hz, 16 bit, stereo) is generated
+Wave LoadWave(const char *fileName)
+{
+    Wave wave = { 0 };
+
+    wave.sampleCount = 44100;
+    wave.sampleRate = 44100;
+    wave.sampleSize = 16;
+    wave.channels = 2;
+    wave.data = calloc(wave.sampleCount*wave.channels, wave.sampleSize/8);
+
+    stats.resourceCalls++;
+
+    return wave;
+}
+
+// Load wave data from raw array data
+Wave LoadWaveEx(void *data, int sampleCount, int sampleRate, int sampleSize, int channels)
+{
+    Wave wave;
+
+    wave.data = data;
+    wave.sampleCount = sampleCount;
+    wave.sampleRate = sampleRate;
+    wave.sampleSize = sampleSize;
+    wave.channels = channels;
+
+    // NOTE: Copy wave data to work with, user is responsible of input data to free
+    Wave cwave = WaveCopy(wave);
+
+    WaveFormat(&cwave, sampleRate, sampleSize, channels);
+
+    return cwave;
+}
+
+// Load sound from file
+Sound LoadSound(const char *fileName)
+{
+    Wave wave = LoadWave(fileName);
+    Sound sound = LoadSoundFromWave(wave);
+    UnloadWave(wave);
+
+    return sound;
+}
+
+// Load sound from wave data
+Sound LoadSoundFromWave(Wave wave)
+{
+    Sound sound = { 0 };
+
+    if (wave.data != NULL)
+    {
+        sound.source = resourceIdCounter++;
+        sound.buffer = resourceIdCounter++;
+    }
+
+    stats.resourceCalls++;
+
+    return sound;
+}
+
+void UpdateSound(Sound sound, const void *data, int samplesCount) { stats.resourceCalls++; }
+
+// Unload wave data
+void UnloadWave(Wave wave)
+{
+    free(wave.data);
+}
+
+void UnloadSound(Sound sound) { stats.resourceCalls++; }
+void PlaySound(Sound sound) { stats.audioCalls++; }
+void PauseSound(Sound sound) { stats.audioCalls++; }
+void ResumeSound(Sound sound) { stats.audioCalls++; }
+void StopSound(Sound sound) { stats.audioCalls++; }
+bool IsSoundPlaying(Sound sound) { return false; }
+void SetSoundVolume(Sound sound, float volume) { stats.audioCalls++; }
+void SetSoundPitch(Sound sound, float pitch) { stats.audioCalls++; }
+
+// Convert wave data to desired format
+void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels)
+{
+    if ((wave->sampleRate == (unsigned int)sampleRate) && (wave->sampleSize == (unsigned int)sampleSize) && (wave->channels == (unsigned int)channels)) return;
+
+    float *samples = GetWaveData(*wave);
+
+    // Resample (linear interpolation) and convert channels (mono <-> stereo, extra channels dropped)
+    int sampleCount = (int)((float)wave->sampleCount*(float)sampleRate/(float)wave->sampleRate);
+    float *output = (float *)malloc(sampleCount*channels*sizeof(float));
+
+    for (int i = 0; i < sampleCount; i++)
+    {
+        float srcPos = (float)i*(float)wave->sampleRate/(float)sampleRate;
+        int i0 = (int)srcPos;
+        int i1 = (i0 < ((int)wave->sampleCount - 1))? i0 + 1 : i0;
+        float factor = srcPos - (float)i0;
+
+        for (int c = 0; c < channels; c++)
+        {
+            int srcChannel = (c < (int)wave->channels)? c : (int)wave->channels - 1;
+
+            float s0 = samples[i0*wave->channels + srcChannel];
+            float s1 = samples[i1*wave->channels + srcChannel];
+
+            output[i*channels + c] = s0 + (s1 - s0)*factor;
+        }
+    }
+
+    free(wave->data);
+    wave->data = malloc(sampleCount*channels*sampleSize/8);
+
+    for (int i = 0; i < sampleCount*channels; i++)
+    {
+        if (sampleSize == 8) ((unsigned char *)wave->data)[i] = (unsigned char)(output[i]*127.0f + 128);
+        else if (sampleSize == 16) ((short *)wave->data)[i] = (short)(output[i]*32767.0f);
+        else if (sampleSize == 32) ((float *)wave->data)[i] = output[i];
+    }
+
+    wave->sampleCount = sampleCount;
+    wave->sampleRate = sampleRate;
+    wave->sampleSize = sampleSize;
+    wave->channels = channels;
+
+    free(output);
+    free(samples);
+}
+
+// Copy a wave to a new wave
+Wave WaveCopy(Wave wave)
+{
+    Wave newWave = { 0 };
+
+    newWave.data = malloc(wave.sampleCount*wave.sampleSize/8*wave.channels);
+
+    if (newWave.data != NULL)
+    {
+        // NOTE: Size must be provided in bytes
+        memcpy(newWave.data, wave.data, wave.sampleCount*wave.channels*wave.sampleSize/8);
+
+        newWave.sampleCount = wave.sampleCount;
+        newWave.sampleRate = wave.sampleRate;
+        newWave.sampleSize = wave.sampleSize;
+        newWave.channels = wave.channels;
+    }
+
+    return newWave;
+}
+
+// Crop a wave to defined samples range
+// NOTE: Security check in case of out-of-range
+void WaveCrop(Wave *wave, int initSample, int finalSample)
+{
+    if ((initSample >= 0) && (initSample < finalSample) && ((unsigned int)finalSample > 0) && ((unsigned int)finalSample < wave->sampleCount))
+    {
+        int sampleCount = finalSample - initSample;
+
+        void *data = malloc(sampleCount*wave->sampleSize/8*wave->channels);
+
+        memcpy(data, (unsigned char *)wave->data + (initSample*wave->channels*wave->sampleSize/8), sampleCount*wave->channels*wave->sampleSize/8);
+
+        free(wave->data);
+        wave->data = data;
+        wave->sampleCount = sampleCount;
+    }
+    else TraceLog(WARNING, "Wave crop range out of bounds");
+}
+
+// Get samples data from wave as a floats array
+// NOTE: Returned sample values are normalized to range [-1..1]
+float *GetWaveData(Wave wave)
+{
+    float *samples = (float *)malloc(wave.sampleCount*wave.channels*sizeof(float));
+
+    for (unsigned int i = 0; i < wave.sampleCount; i++)
+    {
+        for (unsigned int j = 0; j < wave.channels; j++)
+        {
+            if (wave.sampleSize == 8) samples[wave.channels*i + j] = (float)(((unsigned char *)wave.data)[wave.channels*i + j] - 127)/256.0f;
+            else if (wave.sampleSize == 16) samples[wave.channels*i + j] = (float)((short *)wave.data)[wave.channels*i + j]/32767.0f;
+            else if (wave.sampleSize == 32) samples[wave.channels*i + j] = ((float *)wave.data)[wave.channels*i + j];
+        }
+    }
+
+    return samples;
+}
+
+// Load music stream from file
+// NOTE: Audio files are not decoded, music length is fixed (10 seconds)
+Music LoadMusicStream(const char *fileName)
+{
+    Music music = (MusicData *)malloc(sizeof(MusicData));
+
+    music->timeLength = 10.0f;
+    music->timePlayed = 0.0f;
+    music->loopCount = -1;      // Infinite loop by default
+    music->playing = false;
+
+    stats.resourceCalls++;
+
+    return music;
+}
+
+// Unload music stream
+void UnloadMusicStream(Music music)
+{
+    free(music);
+    stats.resourceCalls++;
+}
+
+// Start music playing (open stream)
+void PlayMusicStream(Music music)
+{
+    music->playing = true;
+    music->timePlayed = 0.0f;
+    stats.audioCalls++;
+}
+
+// Update (re-fill) music buffers if data already processed
+// NOTE: Music time played advances simulated frame time
+void UpdateMusicStream(Music music)
+{
+    stats.audioCalls++;
+
+    if (!music->playing) return;
+
+    music->timePlayed += (float)frameTime;
+
+    if (music->timePlayed >= music->timeLength)
+    {
+        if (music->loopCount == 0) StopMusicStream(music);
+        else
+        {
+            if (music->loopCount > 0) music->loopCount--;
+            music->timePlayed -= music->timeLength;
+        }
+    }
+}
+
+// Stop music playing (close stream)
+void StopMusicStream(Music music)
+{
+    music->playing = false;
+    music->timePlayed = 0.0f;
+    stats.audioCalls++;
+}
+
+void PauseMusicStream(Music music) { music->playing = false; stats.audioCalls++; }
+void ResumeMusicStream(Music music) { music->playing = true; stats.audioCalls++; }
+bool IsMusicPlaying(Music music) { return music->playing; }
+void SetMusicVolume(Music music, float volume) { stats.audioCalls++; }
+void SetMusicPitch(Music music, float pitch) { stats.audioCalls++; }
+
+// Set music loop count (loop repeats)
+// NOTE: If set to -1, means infinite loop
+void SetMusicLoopCount(Music music, int count) { music->loopCount = count; }
+
+// Get music time length (in seconds)
+float GetMusicTimeLength(Music music) { return music->timeLength; }
+
+// Get current music time played (in seconds)
+float GetMusicTimePlayed(Music music) { return music->timePlayed; }
+
+// Init audio stream (to stream audio pcm data)
+AudioStream InitAudioStream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels)
+{
+    AudioStream stream = { 0 };
+
+    stream.sampleRate = sampleRate;
+    stream.sampleSize = sampleSize;
+    stream.channels = channels;
+    stream.source = resourceIdCounter++;
+    stream.buffers[0] = resourceIdCounter++;
+    stream.buffers[1] = resourceIdCounter++;
+
+    stats.resourceCalls++;
+
+    return stream;
+}
+
+void UpdateAudioStream(AudioStream stream, const void *data, int samplesCount) { stats.audioCalls++; }
+void CloseAudioStream(AudioStream stream) { stats.resourceCalls++; }
+
+// Check if any audio stream buffers requires refill (always, no audio device)
+bool IsAudioBufferProcessed(AudioStream stream) { return true; }
+
+void PlayAudioStream(AudioStream stream) { stats.audioCalls++; }
+void PauseAudioStream(AudioStream stream) { stats.audioCalls++; }
+void ResumeAudioStream(AudioStream stream) { stats.audioCalls++; }
+bool IsAudioStreamPlaying(AudioStream stream) { return false; }
+void StopAudioStream(AudioStream stream) { stats.audioCalls++; }
+void SetAudioStreamVolume(AudioStream stream, float volume) { stats.audioCalls++; }
+void SetAudioStreamPitch(AudioStream stream, float pitch) { stats.audioCalls++; }
@@ -0,0 +1,106 @@
+/**********************************************************************************************
+*
+*   raylib-null - Headless (null) raylib backend for raylib-lua
+*
+*   DESCRIPTION:
+*
+*   Stub implementation of raylib API (the subset called by raylib-lua.h) to be linked instead
+*   of raylib library, it allows running raylib Lua programs without window, GPU or audio device.
+*   Useful to measure pure binding and script overhead per frame (benchmarking) on CI or servers.
+*
+*     - Window, drawing, audio and GPU resources functions are no-ops, counted in NullStats
+*     - Image manipulation/generation, colors, collisions and math (raymath) functions are real
+*     - Time is simulated: every EndDrawing() advances a fixed step (1/targetFPS)
+*     - Input is scriptable: keyboard, mouse, gamepads and gestures state is set by host
+*       program, usually from a frame callback called on every EndDrawing()
+*
+*   CONFIGURATION:
+*
+*   #define NULL_SUPPORT_STB_IMAGE
+*       Load images from files using stb_image.h (raylib/src/external), otherwise LoadImage()
+*       generates a placeholder image (required to get real textures sizes)
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2019 Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef RAYLIB_NULL_H
+#define RAYLIB_NULL_H
+
+#include "raylib.h"
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define NULL_MAX_KEYS                512    // Keyboard keys tracked
+#define NULL_MAX_MOUSE_BUTTONS         3    // Mouse buttons tracked
+#define NULL_MAX_GAMEPADS              4    // Gamepads tracked
+#define NULL_MAX_GAMEPAD_BUTTONS      32    // Buttons tracked per gamepad
+#define NULL_MAX_GAMEPAD_AXIS          8    // Axis tracked per gamepad
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Null backend calls counters
+typedef struct NullStats {
+    int frames;             // Frames drawn (EndDrawing() calls)
+    int drawCalls;          // Shapes, textures, text and models drawing calls
+    int modeCalls;          // Drawing modes begin/end calls (2D, 3D, texture, shader, blend, VR)
+    int windowCalls;        // Window and cursor management calls
+    int resourceCalls;      // GPU/audio resources loading, unloading and update calls
+    int audioCalls;         // Audio device, sounds, music and streams management calls
+} NullStats;
+
+// Frame callback, called at the end of every EndDrawing(), after input state update
+// NOTE: Input state set inside callback is visible to program on next frame
+typedef void (*NullFrameCallback)(int frame, void *userData);
+
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+void NullSetFrameLimit(int frames);                                     // WindowShouldClose() returns true after frames drawn (0 = no limit)
+void NullSetFrameCallback(NullFrameCallback callback, void *userData);  // Set callback called at the end of every frame
+void NullRequestClose(void);                                            // Make WindowShouldClose() return true
+void NullResetState(void);                                              // Reset window, time and input state (before running a new program)
+
+NullStats NullGetStats(void);                                           // Get backend calls counters
+void NullResetStats(void);                                              // Reset backend calls counters
+double NullGetWallTime(void);                                           // Get wall clock time in seconds (high resolution)
+
+// Scripted input
+void NullSetKeyDown(int key, bool down);                                // Set keyboard key state
+void NullSetMouseButtonDown(int button, bool down);                     // Set mouse button state
+void NullSetMouseWheelMove(int move);                                   // Set mouse wheel movement for current frame
+void NullSetGamepadAvailable(int gamepad, bool available);              // Set gamepad availability
+void NullSetGamepadButtonDown(int gamepad, int button, bool down);      // Set gamepad button state
+void NullSetGamepadAxisMovement(int gamepad, int axis, float value);    // Set gamepad axis value
+void NullSetGestureDetected(int gesture);                               // Set gesture detected for current frame
+// NOTE: Mouse position is set with raylib SetMousePosition()
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // RAYLIB_NULL_H
@@ -17,6 +17,24 @@
 *   Just launch your raylib .lua file from command line:    rll.exe core_basic_window.lua
 *   or drag&drop your .lua file over rll.exe
 *
+*   To find Lua lines allocating most memory per frame (GC pressure), use:
+*       rll.exe core_basic_window.lua --alloc-profile [sampleBytes]
+*
+*   To run Lua update on a worker thread while previous frame is drawn (one frame latency), use:
+*       rll.exe core_basic_window.lua --pipelined
+*
+*   HEADLESS MODE:
+*
+*   Define RLUA_HEADLESS and link raylib-null.c instead of raylib library to run Lua programs
+*   without window, GPU or audio device, useful to measure binding and script overhead per frame:
+*
+*   gcc -o rll_headless rlualauncher.c ../../src/raylib-null.c -DRLUA_HEADLESS -I../../src \
+*       -I<raylib>/src -I../../src/external/lua/include -L../../src/external/lua/lib -llua53 -lm -std=c99
+*
+*       rll_headless core_basic_window.lua --frames 600
+*
+*   Program runs for provided frames (default: 300) and reports wall time per frame
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -44,6 +62,27 @@
 #define RLUA_IMPLEMENTATION
 #include "raylib-lua.h"         // raylib Lua binding
 
+#if defined(RLUA_HEADLESS)
+    #include "raylib-null.h"    // raylib null backend: scripted input, frame limit and stats
+
+    #define HEADLESS_DEFAULT_FRAMES     300     // Frames to run Lua program in headless mode
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static double frameWallTime = 0.0;          // Wall time at last frame end
+static double frameWallTimeMax = 0.0;       // Maximum wall time spent on a frame
+
+// Headless frame callback: measure wall time spent per frame
+static void HeadlessFrameCallback(int frame, void *userData)
+{
+    double time = NullGetWallTime();
+
+    if ((time - frameWallTime) > frameWallTimeMax) frameWallTimeMax = time - frameWallTime;
+    frameWallTime = time;
+}
+#endif
+
 //------------------------------------------------------------------------------------
 // Program main entry point
 //------------------------------------------------------------------------------------
@@ -51,15 +90,62 @@ int main(int argc, char *argv[])
 {
     if (argc > 1)
     {
-        // TODO: Support additional arguments for lua file execution
-        
+        bool allocProfile = false;
+        int allocSampleBytes = 0;
+        int frames = 0;
+        bool pipelined = false;
+
+        for (int i = 2; i < argc; i++)
+        {
+            if (strcmp(argv[i], "--alloc-profile") == 0)
+            {
+                allocProfile = true;
+                if (((i + 1) < argc) && (argv[i + 1][0] != '-')) allocSampleBytes = atoi(argv[++i]);
+            }
+            else if ((strcmp(argv[i], "--frames") == 0) && ((i + 1) < argc)) frames = atoi(argv[++i]);
+            else if (strcmp(argv[i], "--pipelined") == 0) pipelined = true;
+        }
+
         if (IsFileExtension(argv[1], ".lua"))
         {
             rLuaInitDevice();            // Initialize lua device
+
+            if (allocProfile) rLuaEnableAllocProfiler(allocSampleBytes);
+            if (pipelined) rLuaEnablePipelinedMode();
+
+#if defined(RLUA_HEADLESS)
+            NullSetFrameLimit((frames > 0)? frames : HEADLESS_DEFAULT_FRAMES);
+            NullSetFrameCallback(HeadlessFrameCallback, NULL);
+
+            double startTime = NullGetWallTime();
+            frameWallTime = startTime;
+#endif
             rLuaExecuteFile(argv[1]);    // Execute lua program (argument file)
+
+#if defined(RLUA_HEADLESS)
+            NullStats stats = NullGetStats();
+            double totalTime = NullGetWallTime() - startTime;
+
+            TraceLog(INFO, "Headless run: %i frames in %.3f s", stats.frames, totalTime);
+
+            if (stats.frames > 0)
+            {
+                TraceLog(INFO, "    Frame time: %.4f ms (avg), %.4f ms (max)", totalTime*1000.0/stats.frames, frameWallTimeMax*1000.0);
+                TraceLog(INFO, "    Calls per frame: %.1f draw, %.1f mode, %.1f resource, %.1f audio",
+                         (float)stats.drawCalls/stats.frames, (float)stats.modeCalls/stats.frames,
+                         (float)stats.resourceCalls/stats.frames, (float)stats.audioCalls/stats.frames);
+            }
+#else
+            (void)frames;   // Frame limit only available in headless mode
+#endif
+            if (allocProfile) rLuaTraceAllocReport(20);
+
             rLuaCloseDevice();           // Close Lua device and free resources
         }
     }
+#if defined(RLUA_HEADLESS)
+    else printf("USAGE: rll_headless <file.lua> [--frames N] [--alloc-profile [sampleBytes]]\n");
+#else
     else
     {
         bool launcherShouldClose = false;
@@ -149,6 +235,7 @@ int main(int argc, char *argv[])
             }
         }
     }
+#endif
 
     return 0;
 }